@@ -65,6 +65,19 @@ bool BenchApp::hasBenchSource(uint32_t benchType)
   }
 }
 
+bool BenchApp::hasBenchShape(uint32_t benchType)
+{
+  switch (benchType)
+  {
+    case BENCH_TYPE_CREATE_DESTROY:
+    case BENCH_TYPE_CREATE_LAYER:
+      return false;
+
+    default:
+      return true;
+  }
+}
+
 void BenchApp::runAll()
 {
   Fog::ListIterator<BenchModule*> it(modules);
@@ -102,7 +115,9 @@ void BenchApp::runModule(BenchModule* module)
       if (sprites.isEmpty() && (
           type == BENCH_TYPE_BLIT_IMAGE_I ||
           type == BENCH_TYPE_BLIT_IMAGE_F ||
-          type == BENCH_TYPE_BLIT_IMAGE_ROTATE))
+          type == BENCH_TYPE_BLIT_IMAGE_ROTATE ||
+          type == BENCH_TYPE_BLIT_SPRITES_10K ||
+          type == BENCH_TYPE_BLIT_SPRITES_100K))
       {
         continue;
       }
@@ -112,7 +127,7 @@ void BenchApp::runModule(BenchModule* module)
 
       for (;;)
       {
-        params.op = type != BENCH_TYPE_CREATE_DESTROY ? 0 : BENCH_OPERATOR_NONE;
+        params.op = hasBenchShape(type) ? 0 : BENCH_OPERATOR_NONE;
 
         for (;;)
         {
@@ -122,7 +137,7 @@ void BenchApp::runModule(BenchModule* module)
           s.justify(22, Fog::CharW(' '), Fog::TEXT_JUSTIFY_LEFT);
           s.append(Fog::CharW('|'));
 
-          if (type != BENCH_TYPE_CREATE_DESTROY)
+          if (hasBenchShape(type))
           {
             sizeIndex = 0;
             params.shapeSize = sizeList.getAt(sizeIndex);
@@ -173,7 +188,7 @@ void BenchApp::registerResults(BenchModule* module, const BenchParams& params, c
 {
   module->totalTime += output.time;
 
-  if (saveImages && params.type != BENCH_TYPE_CREATE_DESTROY)
+  if (saveImages && hasBenchShape(params.type))
   {
     Fog::StringW fileName;
 
@@ -276,7 +291,10 @@ Fog::StringW BenchApp::getBenchString(uint32_t bench) const
     "FillComplex",
     "BlitImageI",
     "BlitImageF",
-    "BlitImageRot"
+    "BlitImageRot",
+    "BlitSprites10k",
+    "BlitSprites100k",
+    "CreateLayer"
   };
 
   if (bench < BENCH_TYPE_COUNT)
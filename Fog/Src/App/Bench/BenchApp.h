@@ -75,7 +75,10 @@ enum BENCH_TYPE
   BENCH_TYPE_BLIT_IMAGE_I = 7,
   BENCH_TYPE_BLIT_IMAGE_F = 8,
   BENCH_TYPE_BLIT_IMAGE_ROTATE = 9,
-  BENCH_TYPE_COUNT = 10
+  BENCH_TYPE_BLIT_SPRITES_10K = 10,
+  BENCH_TYPE_BLIT_SPRITES_100K = 11,
+  BENCH_TYPE_CREATE_LAYER = 12,
+  BENCH_TYPE_COUNT = 13
 };
 
 // ============================================================================
@@ -96,6 +99,7 @@ struct BenchApp
   // --------------------------------------------------------------------------
 
   bool hasBenchSource(uint32_t benchType);
+  bool hasBenchShape(uint32_t benchType);
 
   void runAll();
   void runModule(BenchModule* module);
@@ -215,6 +219,8 @@ struct BenchModule
   virtual void runBlitImageI(BenchOutput& output, const BenchParams& params) = 0;
   virtual void runBlitImageF(BenchOutput& output, const BenchParams& params) = 0;
   virtual void runBlitImageRotate(BenchOutput& output, const BenchParams& params) = 0;
+  virtual void runBlitSprites(BenchOutput& output, const BenchParams& params, uint32_t count) = 0;
+  virtual void runCreateLayer(BenchOutput& output, const BenchParams& params) = 0;
 
   // --------------------------------------------------------------------------
   // [Members]
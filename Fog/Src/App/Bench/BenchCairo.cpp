@@ -64,6 +64,8 @@ void BenchCairo::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_I:
     case BENCH_TYPE_BLIT_IMAGE_F:
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
+    case BENCH_TYPE_BLIT_SPRITES_10K:
+    case BENCH_TYPE_BLIT_SPRITES_100K:
       prepareSprites(params.shapeSize);
       break;
   }
@@ -122,6 +124,18 @@ void BenchCairo::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
       runBlitImageRotate(output, params);
       break;
+
+    case BENCH_TYPE_BLIT_SPRITES_10K:
+      runBlitSprites(output, params, 10000);
+      break;
+
+    case BENCH_TYPE_BLIT_SPRITES_100K:
+      runBlitSprites(output, params, 100000);
+      break;
+
+    case BENCH_TYPE_CREATE_LAYER:
+      runCreateLayer(output, params);
+      break;
   }
 
   output.time = Fog::Time::now() - start;
@@ -246,6 +260,20 @@ void BenchCairo::runCreateDestroy(BenchOutput& output, const BenchParams& params
   }
 }
 
+void BenchCairo::runCreateLayer(BenchOutput& output, const BenchParams& params)
+{
+  // Temporary layer churn (create/paint/destroy a screen-sized image).
+  uint32_t i, quantity = params.quantity;
+  for (i = 0; i < quantity; i++)
+  {
+    cairo_surface_t* layer = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, params.screenSize.w, params.screenSize.h);
+    cairo_t* lcr = cairo_create(layer);
+    configureContext(lcr, params);
+    cairo_destroy(lcr);
+    cairo_surface_destroy(layer);
+  }
+}
+
 void BenchCairo::runFillRectI(BenchOutput& output, const BenchParams& params)
 {
   cairo_t* cr = cairo_create(screenCairo);
@@ -617,4 +645,33 @@ void BenchCairo::runBlitImageRotate(BenchOutput& output, const BenchParams& para
   cairo_destroy(cr);
 }
 
+void BenchCairo::runBlitSprites(BenchOutput& output, const BenchParams& params, uint32_t count)
+{
+  cairo_t* cr = cairo_create(screenCairo);
+  configureContext(cr, params);
+
+  BenchRandom rPts(app);
+
+  Fog::SizeI screenSize(
+    params.screenSize.w - params.shapeSize,
+    params.screenSize.h - params.shapeSize);
+
+  uint32_t spriteIndex = 0;
+  uint32_t spritesLength = (uint32_t)sprites.getLength();
+
+  // There is no batch API, each sprite is blitted separately.
+  for (uint32_t i = 0; i < count; i++)
+  {
+    Fog::PointI pt(rPts.getPointI(screenSize));
+    cairo_set_source_surface(cr, spritesCairo[spriteIndex], pt.x, pt.y);
+    cairo_rectangle(cr, pt.x, pt.y, params.shapeSize, params.shapeSize);
+    cairo_fill(cr);
+
+    if (++spriteIndex >= spritesLength)
+      spriteIndex = 0;
+  }
+
+  cairo_destroy(cr);
+}
+
 #endif // FOG_BENCH_CAIRO
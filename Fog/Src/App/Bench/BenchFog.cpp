@@ -52,6 +52,8 @@ void BenchFog::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_I:
     case BENCH_TYPE_BLIT_IMAGE_F:
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
+    case BENCH_TYPE_BLIT_SPRITES_10K:
+    case BENCH_TYPE_BLIT_SPRITES_100K:
       prepareSprites(params.shapeSize);
       break;
   }
@@ -100,6 +102,18 @@ void BenchFog::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
       runBlitImageRotate(output, params);
       break;
+
+    case BENCH_TYPE_BLIT_SPRITES_10K:
+      runBlitSprites(output, params, 10000);
+      break;
+
+    case BENCH_TYPE_BLIT_SPRITES_100K:
+      runBlitSprites(output, params, 100000);
+      break;
+
+    case BENCH_TYPE_CREATE_LAYER:
+      runCreateLayer(output, params);
+      break;
   }
 
   output.time = Fog::Time::now() - start;
@@ -151,6 +165,18 @@ void BenchFog::runCreateDestroy(BenchOutput& output, const BenchParams& params)
   }
 }
 
+void BenchFog::runCreateLayer(BenchOutput& output, const BenchParams& params)
+{
+  // Temporary layer churn (create/paint/destroy a screen-sized image).
+  uint32_t i, quantity = params.quantity;
+  for (i = 0; i < quantity; i++)
+  {
+    Fog::Image layer(params.screenSize, Fog::IMAGE_FORMAT_PRGB32);
+    Fog::Painter lp(layer, Fog::NO_FLAGS);
+    configurePainter(lp, params);
+  }
+}
+
 void BenchFog::runFillRectI(BenchOutput& output, const BenchParams& params)
 {
   Fog::Painter p(screen, Fog::NO_FLAGS);
@@ -485,3 +511,55 @@ void BenchFog::runBlitImageRotate(BenchOutput& output, const BenchParams& params
       spriteIndex = 0;
   }
 }
+
+void BenchFog::runBlitSprites(BenchOutput& output, const BenchParams& params, uint32_t count)
+{
+  uint32_t spritesLength = (uint32_t)sprites.getLength();
+  int size = params.shapeSize;
+
+  // All sprites are placed side by side into a single atlas, each item refers
+  // to its fragment, so the whole batch is submitted by a single call.
+  Fog::Image atlas;
+  if (atlas.create(Fog::SizeI(size * (int)spritesLength, size), Fog::IMAGE_FORMAT_PRGB32) != Fog::ERR_OK)
+    return;
+
+  uint32_t spriteIndex;
+  for (spriteIndex = 0; spriteIndex < spritesLength; spriteIndex++)
+    atlas.blitImage(Fog::PointI((int)spriteIndex * size, 0), sprites[spriteIndex], Fog::COMPOSITE_SRC);
+
+  Fog::BlitItem* items = static_cast<Fog::BlitItem*>(Fog::MemMgr::alloc(count * sizeof(Fog::BlitItem)));
+  if (items == NULL)
+    return;
+
+  Fog::Painter p(screen, Fog::NO_FLAGS);
+  configurePainter(p, params);
+
+  BenchRandom rPts(app);
+
+  Fog::SizeI screenSize(
+    params.screenSize.w - params.shapeSize,
+    params.screenSize.h - params.shapeSize);
+
+  uint32_t i, quantity = params.quantity;
+  for (i = 0; i < quantity; i += count)
+  {
+    uint32_t n = Fog::Math::min<uint32_t>(count, quantity - i);
+    uint32_t j;
+
+    spriteIndex = 0;
+    for (j = 0; j < n; j++)
+    {
+      Fog::PointI pt(rPts.getPointI(screenSize));
+
+      items[j] = Fog::BlitItem(Fog::PointD(pt.x, pt.y),
+        Fog::RectI((int)spriteIndex * size, 0, size, size));
+
+      if (++spriteIndex >= spritesLength)
+        spriteIndex = 0;
+    }
+
+    p.blitImages(atlas, items, n);
+  }
+
+  Fog::MemMgr::free(items);
+}
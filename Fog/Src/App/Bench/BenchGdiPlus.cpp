@@ -78,6 +78,8 @@ void BenchGdiPlus::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_I:
     case BENCH_TYPE_BLIT_IMAGE_F:
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
+    case BENCH_TYPE_BLIT_SPRITES_10K:
+    case BENCH_TYPE_BLIT_SPRITES_100K:
       prepareSprites(params.shapeSize);
       break;
   }
@@ -136,6 +138,18 @@ void BenchGdiPlus::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
       runBlitImageRotate(output, params);
       break;
+
+    case BENCH_TYPE_BLIT_SPRITES_10K:
+      runBlitSprites(output, params, 10000);
+      break;
+
+    case BENCH_TYPE_BLIT_SPRITES_100K:
+      runBlitSprites(output, params, 100000);
+      break;
+
+    case BENCH_TYPE_CREATE_LAYER:
+      runCreateLayer(output, params);
+      break;
   }
 
   output.time = Fog::Time::now() - start;
@@ -252,6 +266,18 @@ void BenchGdiPlus::runCreateDestroy(BenchOutput& output, const BenchParams& para
   }
 }
 
+void BenchGdiPlus::runCreateLayer(BenchOutput& output, const BenchParams& params)
+{
+  // Temporary layer churn (create/paint/destroy a screen-sized image).
+  uint32_t i, quantity = params.quantity;
+  for (i = 0; i < quantity; i++)
+  {
+    Gdiplus::Bitmap layer(params.screenSize.w, params.screenSize.h, PixelFormat32bppPARGB);
+    Gdiplus::Graphics lgr(&layer);
+    configureGraphics(lgr, params);
+  }
+}
+
 void BenchGdiPlus::runFillRectI(BenchOutput& output, const BenchParams& params)
 {
   Gdiplus::Graphics gr(screenGdi);
@@ -595,5 +621,30 @@ void BenchGdiPlus::runBlitImageRotate(BenchOutput& output, const BenchParams& pa
   }
 }
 
+void BenchGdiPlus::runBlitSprites(BenchOutput& output, const BenchParams& params, uint32_t count)
+{
+  Gdiplus::Graphics gr(screenGdi);
+  configureGraphics(gr, params);
+
+  BenchRandom rPts(app);
+
+  Fog::SizeI screenSize(
+    params.screenSize.w - params.shapeSize,
+    params.screenSize.h - params.shapeSize);
+
+  uint32_t spriteIndex = 0;
+  uint32_t spritesLength = (uint32_t)sprites.getLength();
+
+  // There is no batch API, each sprite is blitted separately.
+  for (uint32_t i = 0; i < count; i++)
+  {
+    Fog::PointI pt(rPts.getPointI(screenSize));
+    gr.DrawImage(spritesGdi[spriteIndex], pt.x, pt.y);
+
+    if (++spriteIndex >= spritesLength)
+      spriteIndex = 0;
+  }
+}
+
 // [Guard]
 #endif // FOG_BENCH_GDIPLUS
@@ -66,6 +66,8 @@ void BenchQt4::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_I:
     case BENCH_TYPE_BLIT_IMAGE_F:
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
+    case BENCH_TYPE_BLIT_SPRITES_10K:
+    case BENCH_TYPE_BLIT_SPRITES_100K:
       prepareSprites(params.shapeSize);
       break;
   }
@@ -123,6 +125,18 @@ void BenchQt4::bench(BenchOutput& output, const BenchParams& params)
     case BENCH_TYPE_BLIT_IMAGE_ROTATE:
       runBlitImageRotate(output, params);
       break;
+
+    case BENCH_TYPE_BLIT_SPRITES_10K:
+      runBlitSprites(output, params, 10000);
+      break;
+
+    case BENCH_TYPE_BLIT_SPRITES_100K:
+      runBlitSprites(output, params, 100000);
+      break;
+
+    case BENCH_TYPE_CREATE_LAYER:
+      runCreateLayer(output, params);
+      break;
   }
 
   output.time = Fog::Time::now() - start;
@@ -206,6 +220,18 @@ void BenchQt4::runCreateDestroy(BenchOutput& output, const BenchParams& params)
   }
 }
 
+void BenchQt4::runCreateLayer(BenchOutput& output, const BenchParams& params)
+{
+  // Temporary layer churn (create/paint/destroy a screen-sized image).
+  uint32_t i, quantity = params.quantity;
+  for (i = 0; i < quantity; i++)
+  {
+    QImage layer(params.screenSize.w, params.screenSize.h, QImage::Format_ARGB32_Premultiplied);
+    QPainter lp(&layer);
+    configurePainter(lp, params);
+  }
+}
+
 void BenchQt4::runFillRectI(BenchOutput& output, const BenchParams& params)
 {
   QPainter p(screenQt);
@@ -535,5 +561,30 @@ void BenchQt4::runBlitImageRotate(BenchOutput& output, const BenchParams& params
   }
 }
 
+void BenchQt4::runBlitSprites(BenchOutput& output, const BenchParams& params, uint32_t count)
+{
+  QPainter p(screenQt);
+  configurePainter(p, params);
+
+  BenchRandom rPts(app);
+
+  Fog::SizeI screenSize(
+    params.screenSize.w - params.shapeSize,
+    params.screenSize.h - params.shapeSize);
+
+  uint32_t spriteIndex = 0;
+  uint32_t spritesLength = (uint32_t)sprites.getLength();
+
+  // There is no batch API, each sprite is blitted separately.
+  for (uint32_t i = 0; i < count; i++)
+  {
+    Fog::PointI pt(rPts.getPointI(screenSize));
+    p.drawImage(QPoint(pt.x, pt.y), *spritesQt[spriteIndex]);
+
+    if (++spriteIndex >= spritesLength)
+      spriteIndex = 0;
+  }
+}
+
 // [Guard]
 #endif // FOG_BENCH_QT4
@@ -58,6 +58,8 @@ struct BenchQt4 : public BenchModule
   virtual void runBlitImageI(BenchOutput& output, const BenchParams& params);
   virtual void runBlitImageF(BenchOutput& output, const BenchParams& params);
   virtual void runBlitImageRotate(BenchOutput& output, const BenchParams& params);
+  virtual void runBlitSprites(BenchOutput& output, const BenchParams& params, uint32_t count);
+  virtual void runCreateLayer(BenchOutput& output, const BenchParams& params);
 
   // --------------------------------------------------------------------------
   // [Members]
@@ -0,0 +1,155 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogA8Bench]
+// ============================================================================
+
+// Renders the same scene into an A8 and a PRGB32 image using several
+// compositing operators. The A8 result is compared against the alpha channel
+// of the PRGB32 result and the time needed to render each scene is printed.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 640,
+  BENCH_HEIGHT = 480,
+  BENCH_QUANTITY = 200
+};
+
+struct OperatorInfo
+{
+  uint32_t op;
+  const char* name;
+};
+
+static const OperatorInfo operators[] =
+{
+  { COMPOSITE_SRC     , "Src"      },
+  { COMPOSITE_SRC_OVER, "SrcOver"  },
+  { COMPOSITE_SRC_IN  , "SrcIn"    },
+  { COMPOSITE_SRC_OUT , "SrcOut"   },
+  { COMPOSITE_SRC_ATOP, "SrcAtop"  },
+  { COMPOSITE_DST_OVER, "DstOver"  },
+  { COMPOSITE_DST_IN  , "DstIn"    },
+  { COMPOSITE_DST_OUT , "DstOut"   },
+  { COMPOSITE_DST_ATOP, "DstAtop"  },
+  { COMPOSITE_XOR     , "Xor"      },
+  { COMPOSITE_PLUS    , "Plus"     },
+  { COMPOSITE_MULTIPLY, "Multiply" }
+};
+
+static void prepareSprite(Image& sprite)
+{
+  Painter p(sprite);
+
+  p.setCompositingOperator(COMPOSITE_SRC);
+  p.setSource(Argb32(0x00000000));
+  p.fillAll();
+
+  p.setCompositingOperator(COMPOSITE_SRC_OVER);
+  p.setSource(Argb32(0xC0FF8000));
+  p.fillCircle(CircleF(PointF(32.0f, 32.0f), 30.0f));
+
+  p.end();
+}
+
+static void renderScene(Image& image, const Image& sprite, uint32_t op)
+{
+  Painter p(image);
+
+  // Background with varying alpha.
+  p.setCompositingOperator(COMPOSITE_SRC);
+  for (int y = 0; y < BENCH_HEIGHT; y += 16)
+  {
+    for (int x = 0; x < BENCH_WIDTH; x += 16)
+    {
+      p.setSource(Argb32(((x ^ y) & 16) ? 0xFF000000 : 0x40000000));
+      p.fillRect(RectI(x, y, 16, 16));
+    }
+  }
+
+  p.setCompositingOperator(op);
+
+  uint32_t seed = 1;
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    int x = int((seed >> 8) % BENCH_WIDTH) - 32;
+    seed = seed * 1103515245U + 12345U;
+    int y = int((seed >> 8) % BENCH_HEIGHT) - 32;
+    seed = seed * 1103515245U + 12345U;
+    uint32_t a = (seed >> 8) & 0xFF;
+
+    // Solid fills (span and line), then an image blit.
+    p.setSource(Argb32((a << 24) | 0x00336699));
+    p.fillCircle(CircleF(PointF(float(x), float(y)), 24.0f));
+    p.fillRect(RectI(x, y + 40, 57, 17));
+    p.blitImage(PointI(x + 40, y), sprite);
+  }
+
+  p.end();
+}
+
+static int compareAlpha(const Image& a8, const Image& prgb32)
+{
+  int maxDiff = 0;
+
+  for (int y = 0; y < BENCH_HEIGHT; y++)
+  {
+    const uint8_t* aLine = a8.getFirst() + y * a8.getStride();
+    const uint8_t* pLine = prgb32.getFirst() + y * prgb32.getStride();
+
+    for (int x = 0; x < BENCH_WIDTH; x++)
+    {
+      int diff = int(aLine[x]) - int(pLine[x * 4 + PIXEL_ARGB32_POS_A]);
+      if (diff < 0) diff = -diff;
+      if (diff > maxDiff) maxDiff = diff;
+    }
+  }
+
+  return maxDiff;
+}
+
+int main(int argc, char* argv[])
+{
+  Image a8;
+  Image prgb32;
+  Image sprite;
+
+  if (a8.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_A8) != ERR_OK ||
+      prgb32.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK ||
+      sprite.create(SizeI(64, 64), IMAGE_FORMAT_PRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  prepareSprite(sprite);
+
+  printf("%-10s | %12s | %12s | %8s\n", "Operator", "A8 [ms]", "PRGB32 [ms]", "MaxDiff");
+
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(operators); i++)
+  {
+    uint32_t op = operators[i].op;
+
+    Time start(Time::now());
+    renderScene(a8, sprite, op);
+    TimeDelta a8Time = Time::now() - start;
+
+    start = Time::now();
+    renderScene(prgb32, sprite, op);
+    TimeDelta prgb32Time = Time::now() - start;
+
+    printf("%-10s | %12.2f | %12.2f | %8d\n",
+      operators[i].name,
+      a8Time.getMillisecondsD(),
+      prgb32Time.getMillisecondsD(),
+      compareAlpha(a8, prgb32));
+  }
+
+  return 0;
+}
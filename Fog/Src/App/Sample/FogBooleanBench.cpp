@@ -0,0 +1,203 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogBooleanBench]
+// ============================================================================
+
+// Combines two star-shaped polygons with randomized radii using all boolean
+// operators. Each polygon has POLYGON_VERTICES vertices and the polygons are
+// shifted so their edges intersect many times. The rectangle intersection
+// and disjoint inputs are handled by fast-paths and are measured separately.
+// The result is in operations/s.
+//
+// Before the benchmark the fast-paths are checked by the area of the result.
+// The result must consist of non-overlapping contours, so the sum of signed
+// areas of all contours is the area filled by both fill rules. Degenerate
+// rectangles and self-overlapping inputs would break it.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_QUANTITY = 20,
+
+  POLYGON_VERTICES = 1000
+};
+
+static void prepareStar(PathD& path, double cx, double cy, uint32_t seed)
+{
+  path.clear();
+
+  for (int i = 0; i < POLYGON_VERTICES; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+
+    double r = 150.0 + double((seed >> 8) % 100);
+    double a = double(i) * (MATH_TWO_PI / double(POLYGON_VERTICES));
+
+    PointD pt(cx + r * Math::cos(a), cy + r * Math::sin(a));
+
+    if (i == 0)
+      path.moveTo(pt);
+    else
+      path.lineTo(pt);
+  }
+
+  path.close();
+}
+
+// Get the signed area of the polygon [start, end) multiplied by two.
+static double getFigureArea(const PointD* pts, size_t start, size_t end)
+{
+  double area = 0.0;
+
+  for (size_t i = start; i < end; i++)
+  {
+    const PointD& p0 = pts[i];
+    const PointD& p1 = pts[i + 1 < end ? i + 1 : start];
+    area += p0.x * p1.y - p1.x * p0.y;
+  }
+
+  return area;
+}
+
+static double getArea(const PathD& path)
+{
+  const uint8_t* cmd = path.getCommands();
+  const PointD* pts = path.getVertices();
+  size_t length = path.getLength();
+
+  double area = 0.0;
+  size_t start = 0;
+
+  for (size_t i = 0; i < length; i++)
+  {
+    if (cmd[i] == PATH_CMD_MOVE_TO)
+    {
+      area += getFigureArea(pts, start, i);
+      start = i;
+    }
+    else if (cmd[i] == PATH_CMD_CLOSE)
+    {
+      area += getFigureArea(pts, start, i);
+      start = i + 1;
+    }
+  }
+
+  area += getFigureArea(pts, start, length);
+  return Math::abs(area) * 0.5;
+}
+
+static bool checkArea(const char* name, const PathD& a, const PathD& b, uint32_t op, uint32_t fillRule, double expected)
+{
+  PathD dst;
+  err_t err = PathD::combine(dst, a, b, op, fillRule);
+  double area = getArea(dst);
+
+  if (err != ERR_OK || !Math::isFuzzyEq(area, expected, 1e-6))
+  {
+    printf("Boolean check failed: %s (%s), err=%u, area=%g (expected %g).\n",
+      name, fillRule == FILL_RULE_EVEN_ODD ? "even-odd" : "non-zero", (uint)err, area, expected);
+    return false;
+  }
+
+  return true;
+}
+
+static bool checkFastPaths()
+{
+  bool ok = true;
+
+  // Degenerate figure which has only axis-aligned edges, but isn't a
+  // rectangle (zero area), intersected with a square.
+  PathD degenerate;
+  degenerate.moveTo(PointD(0.0, 0.0));
+  degenerate.lineTo(PointD(10.0, 0.0));
+  degenerate.lineTo(PointD(10.0, 10.0));
+  degenerate.lineTo(PointD(10.0, 0.0));
+  degenerate.close();
+
+  PathD square;
+  square.rect(RectD(5.0, -5.0, 10.0, 20.0));
+
+  ok &= checkArea("Degenerate & Rect", degenerate, square, PATH_OP_INTERSECT, FILL_RULE_NON_ZERO, 0.0);
+  ok &= checkArea("Rect & Degenerate", square, degenerate, PATH_OP_INTERSECT, FILL_RULE_NON_ZERO, 0.0);
+
+  // Two overlapping squares of the same orientation in one path, the overlap
+  // is 5x5. The non-zero fill covers 175, the even-odd fill 150.
+  PathD overlap;
+  overlap.rect(RectD(0.0, 0.0, 10.0, 10.0));
+  overlap.rect(RectD(5.0, 5.0, 10.0, 10.0));
+
+  PathD clip;
+  clip.rect(RectD(-1.0, -1.0, 20.0, 20.0));
+
+  PathD disjoint;
+  disjoint.rect(RectD(100.0, 100.0, 10.0, 10.0));
+
+  for (uint32_t fillRule = 0; fillRule < FILL_RULE_COUNT; fillRule++)
+  {
+    double area = fillRule == FILL_RULE_EVEN_ODD ? 150.0 : 175.0;
+
+    ok &= checkArea("Overlap & Rect", overlap, clip, PATH_OP_INTERSECT, fillRule, area);
+    ok &= checkArea("Overlap | Disjoint", overlap, disjoint, PATH_OP_UNION, fillRule, area + 100.0);
+    ok &= checkArea("Overlap ^ Disjoint", overlap, disjoint, PATH_OP_XOR, fillRule, area + 100.0);
+    ok &= checkArea("Overlap - Disjoint", overlap, disjoint, PATH_OP_SUBTRACT, fillRule, area);
+    ok &= checkArea("Disjoint -r Overlap", disjoint, overlap, PATH_OP_SUBTRACT_REV, fillRule, area);
+    ok &= checkArea("Overlap & Disjoint", overlap, disjoint, PATH_OP_INTERSECT, fillRule, 0.0);
+  }
+
+  return ok;
+}
+
+static double runBench(const PathD& a, const PathD& b, uint32_t op, size_t* resultLength)
+{
+  PathD dst;
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+    PathD::combine(dst, a, b, op);
+
+  double ms = (Time::now() - start).getMillisecondsD();
+
+  *resultLength = dst.getLength();
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  static const char* opNames[] = { "Union", "Intersect", "Subtract", "SubtractRev", "Xor" };
+
+  if (!checkFastPaths())
+    return 1;
+
+  PathD a, b, c, rect;
+  prepareStar(a, 300.0, 300.0, 1);
+  prepareStar(b, 340.0, 320.0, 2);
+  prepareStar(c, 1300.0, 300.0, 3);
+  rect.rect(RectD(200.0, 200.0, 200.0, 200.0));
+
+  printf("%-14s | %12s | %8s\n", "Operation", "Ops/s", "Length");
+
+  for (uint32_t op = 0; op < PATH_OP_COUNT; op++)
+  {
+    size_t length;
+    double ops = runBench(a, b, op, &length);
+    printf("%-14s | %12.1f | %8d\n", opNames[op], ops, int(length));
+  }
+
+  size_t length;
+  double ops;
+
+  ops = runBench(a, rect, PATH_OP_INTERSECT, &length);
+  printf("%-14s | %12.1f | %8d\n", "Rect", ops, int(length));
+
+  ops = runBench(a, c, PATH_OP_UNION, &length);
+  printf("%-14s | %12.1f | %8d\n", "Disjoint", ops, int(length));
+
+  return 0;
+}
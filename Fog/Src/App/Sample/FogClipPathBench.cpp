@@ -0,0 +1,363 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogClipPathBench]
+// ============================================================================
+
+// Clips a path which contains many small figures scattered around a 640x480
+// clip-box by PathClipper::clipPath() using rotated and general affine
+// transforms and compares it with the generic approach (Transform::mapPath()
+// followed by PathClipper::continuePath()). Most of the figures are either
+// fully inside or fully outside of the clip-box. The result is in paths/s.
+//
+// Before the benchmark the output of PathClipper::clipPath() is checked
+// against the generic approach using random paths and affine transforms.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_QUANTITY = 2000,
+  FIGURE_COUNT = 500
+};
+
+static const char* transformNames[] =
+{
+  "Rotation",
+  "Affine"
+};
+
+template<typename PathT, typename NumT>
+static void preparePath(PathT& path)
+{
+  uint32_t seed = 1;
+
+  path.clear();
+
+  for (int i = 0; i < FIGURE_COUNT; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    double cx = double((seed >> 16) % 1600) - 480.0;
+
+    seed = seed * 1103515245U + 12345U;
+    double cy = double((seed >> 16) % 1200) - 360.0;
+
+    seed = seed * 1103515245U + 12345U;
+    double r = double((seed >> 16) % 30) + 5.0;
+
+    if (i & 1)
+      path.ellipse(NumT(cx), NumT(cy), NumT(r), NumT(r * 0.5));
+    else
+      path.rect(NumT(cx - r), NumT(cy - r), NumT(r * 2.0), NumT(r * 2.0));
+  }
+}
+
+static void prepareTransform(TransformD& tr, int type)
+{
+  tr.reset();
+  tr.translate(PointD(320.0, 240.0));
+  tr.rotate(0.3);
+
+  if (type == 1)
+  {
+    tr.scale(PointD(1.2, 0.8));
+    tr.skew(PointD(0.2, 0.1));
+  }
+
+  tr.translate(PointD(-320.0, -240.0));
+}
+
+// ============================================================================
+// [FogClipPathBench - Check]
+// ============================================================================
+
+static uint32_t nextRandom(uint32_t& seed)
+{
+  seed = seed * 1103515245U + 12345U;
+  return (seed >> 16) & 0x7FFF;
+}
+
+static double nextDouble(uint32_t& seed, double min, double max)
+{
+  return min + (max - min) * double(nextRandom(seed)) / 32767.0;
+}
+
+// Random figures of lines, quads and cubics, some of them are not closed.
+template<typename PathT, typename PointT, typename NumT>
+static void prepareRandomPath(PathT& path, uint32_t& seed)
+{
+  path.clear();
+
+  int figureCount = int(nextRandom(seed) % 40) + 1;
+  for (int i = 0; i < figureCount; i++)
+  {
+    double cx = nextDouble(seed, -400.0, 1000.0);
+    double cy = nextDouble(seed, -300.0, 800.0);
+    double r = nextDouble(seed, 5.0, 200.0);
+
+    path.moveTo(PointT(NumT(cx), NumT(cy)));
+
+    int segmentCount = int(nextRandom(seed) % 6) + 1;
+    for (int j = 0; j < segmentCount; j++)
+    {
+      PointT p0(NumT(cx + nextDouble(seed, -r, r)), NumT(cy + nextDouble(seed, -r, r)));
+      PointT p1(NumT(cx + nextDouble(seed, -r, r)), NumT(cy + nextDouble(seed, -r, r)));
+      PointT p2(NumT(cx + nextDouble(seed, -r, r)), NumT(cy + nextDouble(seed, -r, r)));
+
+      switch (nextRandom(seed) % 3)
+      {
+        case 0: path.lineTo(p0); break;
+        case 1: path.quadTo(p0, p1); break;
+        case 2: path.cubicTo(p0, p1, p2); break;
+      }
+    }
+
+    if (nextRandom(seed) % 4 != 0)
+      path.close();
+  }
+}
+
+static void prepareRandomTransform(TransformD& tr, uint32_t& seed)
+{
+  tr.reset();
+  tr.translate(PointD(nextDouble(seed, 0.0, 640.0), nextDouble(seed, 0.0, 480.0)));
+  tr.rotate(nextDouble(seed, -3.14, 3.14));
+
+  if (nextRandom(seed) & 1)
+  {
+    tr.scale(PointD(nextDouble(seed, 0.2, 3.0), nextDouble(seed, 0.2, 3.0)));
+    tr.skew(PointD(nextDouble(seed, -0.5, 0.5), nextDouble(seed, -0.5, 0.5)));
+  }
+
+  tr.translate(PointD(-nextDouble(seed, 0.0, 640.0), -nextDouble(seed, 0.0, 480.0)));
+}
+
+static size_t getFigureEnd(const uint8_t* cmd, size_t i, size_t length)
+{
+  while (++i < length)
+  {
+    if (cmd[i] == PATH_CMD_MOVE_TO)
+      break;
+
+    if (cmd[i] == PATH_CMD_CLOSE)
+      return i + 1;
+  }
+
+  return i;
+}
+
+// Whether the figure was collapsed onto the border of the clip-box (all its
+// vertices are on the border and its area is zero). The generic approach
+// emits such figures for the figures outside of the clip-box, clipPath()
+// skips them, so they are not compared.
+template<typename PathT, typename BoxT, typename NumT>
+static bool isCollapsedFigure(const PathT& path, size_t start, size_t end, const BoxT& box, NumT epsilon)
+{
+  const uint8_t* cmd = path.getCommands();
+
+  double area = 0.0;
+  size_t last = start;
+
+  for (size_t i = start; i < end; i++)
+  {
+    if (cmd[i] == PATH_CMD_CLOSE)
+      continue;
+
+    if (Math::abs(path.getVertices()[i].x - box.x0) > epsilon && Math::abs(path.getVertices()[i].x - box.x1) > epsilon &&
+        Math::abs(path.getVertices()[i].y - box.y0) > epsilon && Math::abs(path.getVertices()[i].y - box.y1) > epsilon)
+      return false;
+
+    area += double(path.getVertices()[last].x) * double(path.getVertices()[i].y) - double(path.getVertices()[i].x) * double(path.getVertices()[last].y);
+    last = i;
+  }
+
+  area += double(path.getVertices()[last].x) * double(path.getVertices()[start].y) - double(path.getVertices()[start].x) * double(path.getVertices()[last].y);
+  return Math::abs(area) <= double(epsilon) * 1000.0;
+}
+
+template<typename PathT, typename BoxT, typename NumT>
+static size_t getNextFigure(const PathT& path, size_t i, const BoxT& box, NumT epsilon)
+{
+  size_t length = path.getLength();
+
+  while (i < length)
+  {
+    size_t end = getFigureEnd(path.getCommands(), i, length);
+    if (!isCollapsedFigure<PathT, BoxT, NumT>(path, i, end, box, epsilon))
+      break;
+    i = end;
+  }
+
+  return i;
+}
+
+// Compare the figures of both paths, except the collapsed ones.
+template<typename PathT, typename BoxT, typename NumT>
+static bool isPathEqual(const PathT& a, const PathT& b, const BoxT& box, NumT epsilon)
+{
+  size_t aLength = a.getLength();
+  size_t bLength = b.getLength();
+
+  size_t aIndex = 0;
+  size_t bIndex = 0;
+
+  for (;;)
+  {
+    aIndex = getNextFigure<PathT, BoxT, NumT>(a, aIndex, box, epsilon);
+    bIndex = getNextFigure<PathT, BoxT, NumT>(b, bIndex, box, epsilon);
+
+    if (aIndex == aLength || bIndex == bLength)
+      return aIndex == aLength && bIndex == bLength;
+
+    size_t aEnd = getFigureEnd(a.getCommands(), aIndex, aLength);
+    size_t bEnd = getFigureEnd(b.getCommands(), bIndex, bLength);
+
+    if (aEnd - aIndex != bEnd - bIndex)
+      return false;
+
+    for (; aIndex < aEnd; aIndex++, bIndex++)
+    {
+      if (a.getCommands()[aIndex] != b.getCommands()[bIndex])
+        return false;
+
+      // The vertex of the close command isn't used.
+      if (a.getCommands()[aIndex] == PATH_CMD_CLOSE)
+        continue;
+
+      if (Math::abs(a.getVertices()[aIndex].x - b.getVertices()[bIndex].x) > epsilon ||
+          Math::abs(a.getVertices()[aIndex].y - b.getVertices()[bIndex].y) > epsilon)
+        return false;
+    }
+  }
+}
+
+// Compare PathClipper::clipPath() with Transform::mapPath() followed by
+// PathClipper::continuePath().
+template<typename PathT, typename PointT, typename BoxT, typename TransformT, typename ClipperT, typename NumT>
+static int checkPaths(const char* typeName, NumT epsilon)
+{
+  uint32_t seed = 1;
+  int failures = 0;
+
+  for (int i = 0; i < 1000; i++)
+  {
+    PathT src;
+    PathT dst;
+    PathT tmp;
+    PathT ref;
+
+    TransformD trD;
+
+    prepareRandomPath<PathT, PointT, NumT>(src, seed);
+    prepareRandomTransform(trD, seed);
+
+    TransformT tr(trD);
+    BoxT box(NumT(0.0), NumT(0.0), NumT(640.0), NumT(480.0));
+    ClipperT clipper(box);
+
+    err_t err = clipper.clipPath(dst, src, tr);
+
+    tr.mapPath(tmp, src);
+    err_t errRef = clipper.continuePath(ref, tmp);
+
+    if (err != errRef || !isPathEqual<PathT, BoxT, NumT>(dst, ref, box, epsilon))
+    {
+      if (failures < 10)
+        printf("%s check #%d failed (length %d, expected %d).\n",
+          typeName, i, int(dst.getLength()), int(ref.getLength()));
+      failures++;
+    }
+  }
+
+  return failures;
+}
+
+static bool checkClipPath()
+{
+  int failures = 0;
+
+  failures += checkPaths<PathF, PointF, BoxF, TransformF, PathClipperF, float >("Float" , 0.01f);
+  failures += checkPaths<PathD, PointD, BoxD, TransformD, PathClipperD, double>("Double", 1e-7 );
+
+  printf("ClipPath check: %d tests, %d failures.\n", 2000, failures);
+  return failures == 0;
+}
+
+// ============================================================================
+// [FogClipPathBench - Bench]
+// ============================================================================
+
+static double getPathsPerSecond(double ms)
+{
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+template<typename PathT, typename TransformT, typename ClipperT>
+static void benchPath(const char* typeName, const char* transformName,
+  const PathT& src, const TransformT& tr, const ClipperT& clipper)
+{
+  PathT dst;
+  PathT tmp;
+  ClipperT c(clipper);
+
+  double rClip;
+  double rGeneric;
+  size_t lClip;
+  size_t lGeneric;
+  int i;
+
+  Time start(Time::now());
+  for (i = 0; i < BENCH_QUANTITY; i++)
+  {
+    dst.clear();
+    c.clipPath(dst, src, tr);
+  }
+  rClip = getPathsPerSecond((Time::now() - start).getMillisecondsD());
+  lClip = dst.getLength();
+
+  start = Time::now();
+  for (i = 0; i < BENCH_QUANTITY; i++)
+  {
+    dst.clear();
+    tr.mapPath(tmp, src);
+    c.continuePath(dst, tmp);
+  }
+  rGeneric = getPathsPerSecond((Time::now() - start).getMillisecondsD());
+  lGeneric = dst.getLength();
+
+  printf("%-6s | %-10s | %12.1f | %12.1f | %8d | %8d\n",
+    typeName, transformName, rClip, rGeneric, int(lClip), int(lGeneric));
+}
+
+int main(int argc, char* argv[])
+{
+  if (!checkClipPath())
+    return 1;
+
+  PathF srcF;
+  PathD srcD;
+
+  preparePath<PathF, float>(srcF);
+  preparePath<PathD, double>(srcD);
+
+  BoxD clipBox(0.0, 0.0, 640.0, 480.0);
+
+  printf("%-6s | %-10s | %12s | %12s | %8s | %8s\n",
+    "Type", "Transform", "ClipPath", "Map+Clip", "Length", "Length");
+
+  for (int type = 0; type < (int)FOG_ARRAY_SIZE(transformNames); type++)
+  {
+    TransformD trD;
+    prepareTransform(trD, type);
+
+    TransformF trF(trD);
+
+    benchPath("Float", transformNames[type], srcF, trF, PathClipperF(BoxF(clipBox)));
+    benchPath("Double", transformNames[type], srcD, trD, PathClipperD(clipBox));
+  }
+
+  return 0;
+}
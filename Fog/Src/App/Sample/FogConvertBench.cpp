@@ -0,0 +1,189 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+#include <string.h>
+
+// ============================================================================
+// [FogConvertBench]
+// ============================================================================
+
+// Measures the throughput of Fog::ImageConverter for every pair of pixel
+// formats (plus non-premultiplied ARGB32 and byte-swapped XRGB32/RGB24). The
+// result is in MPix/s, "line" is a single-threaded blitRect(), "image" is
+// convertImage(), which splits large images across the thread pool.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 1024,
+  BENCH_HEIGHT = 1024,
+  BENCH_QUANTITY = 20
+};
+
+enum
+{
+  BENCH_FORMAT_ARGB32 = IMAGE_FORMAT_COUNT,
+  BENCH_FORMAT_XRGB32_BS,
+  BENCH_FORMAT_RGB24_BS,
+  BENCH_FORMAT_COUNT
+};
+
+static const char* getFormatName(uint32_t format)
+{
+  static const char* names[] =
+  {
+    "PRGB32", "XRGB32", "RGB24", "A8", "I8", "PRGB64", "RGB48", "A16",
+    "ARGB32", "XRGB32-BS", "RGB24-BS"
+  };
+
+  return format < FOG_ARRAY_SIZE(names) ? names[format] : "?";
+}
+
+static ImageFormatDescription getFormatDescription(uint32_t format)
+{
+  ImageFormatDescription desc;
+
+  switch (format)
+  {
+    case BENCH_FORMAT_ARGB32:
+      desc.createArgb(32, IMAGE_FD_NONE,
+        0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF);
+      break;
+
+    case BENCH_FORMAT_XRGB32_BS:
+      desc.createArgb(32, IMAGE_FD_FILL_UNUSED_BITS,
+        0x00000000, 0x0000FF00, 0x00FF0000, 0xFF000000);
+      break;
+
+    case BENCH_FORMAT_RGB24_BS:
+      desc.createArgb(24, IMAGE_FD_NONE,
+        0x00000000, 0x000000FF, 0x0000FF00, 0x00FF0000);
+      break;
+
+    default:
+      desc = ImageFormatDescription::getByFormat(format);
+      break;
+  }
+
+  return desc;
+}
+
+static double getMPixPerSec(const TimeDelta& delta)
+{
+  double ms = delta.getMillisecondsD();
+  if (ms <= 0.0)
+    return 0.0;
+
+  return double(BENCH_WIDTH) * double(BENCH_HEIGHT) * double(BENCH_QUANTITY) / (ms * 1000.0);
+}
+
+static err_t createConverter(ImageConverter& converter,
+  uint32_t dstFormat, uint32_t srcFormat, uint32_t ditherType, const ImagePalette& palette)
+{
+  ImageFormatDescription sf = getFormatDescription(srcFormat);
+  const ImagePalette* srcPalette = (srcFormat == IMAGE_FORMAT_I8) ? &palette : NULL;
+
+  if (dstFormat == IMAGE_FORMAT_I8)
+  {
+    ImageDither8Params params;
+    params.rCount = 6;
+    params.gCount = 6;
+    params.bCount = 6;
+    params.transposeTable = NULL;
+    params.transposeTableLength = 0;
+    params.ditherType = ditherType;
+
+    return converter.createDithered8(params, sf, NULL, srcPalette);
+  }
+
+  return converter.create(getFormatDescription(dstFormat), sf, false, NULL, srcPalette);
+}
+
+int main(int argc, char* argv[])
+{
+  ImagePalette palette = ImagePalette::fromColorCube(6, 6, 6);
+
+  uint32_t bpp = 8;
+  ssize_t stride = (ssize_t)BENCH_WIDTH * bpp;
+
+  uint8_t* src = reinterpret_cast<uint8_t*>(MemMgr::alloc((size_t)stride * BENCH_HEIGHT));
+  uint8_t* dst = reinterpret_cast<uint8_t*>(MemMgr::alloc((size_t)stride * BENCH_HEIGHT));
+
+  if (src == NULL || dst == NULL)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  // Random, but premultiplied-like data (alpha is the highest byte).
+  for (size_t i = 0; i < (size_t)stride * BENCH_HEIGHT; i++)
+    src[i] = (uint8_t)((i * 2654435761U) >> 24) | ((i & 3) == 3 ? 0x80 : 0x00);
+
+  printf("%-10s -> %-10s | %10s | %10s\n", "Source", "Destination", "Line", "Image");
+
+  for (uint32_t srcFormat = 0; srcFormat < BENCH_FORMAT_COUNT; srcFormat++)
+  {
+    for (uint32_t dstFormat = 0; dstFormat < BENCH_FORMAT_COUNT; dstFormat++)
+    {
+      uint32_t ditherCount = (dstFormat == IMAGE_FORMAT_I8) ? 2 : 1;
+
+      for (uint32_t ditherIndex = 0; ditherIndex < ditherCount; ditherIndex++)
+      {
+        uint32_t ditherType = ditherIndex == 0 ? DITHER_TYPE_PATTERN : DITHER_TYPE_ERROR_DIFFUSION;
+
+        ImageConverter converter;
+        if (createConverter(converter, dstFormat, srcFormat, ditherType, palette) != ERR_OK)
+        {
+          printf("%-10s -> %-10s | %10s | %10s\n",
+            getFormatName(srcFormat), getFormatName(dstFormat), "n/a", "n/a");
+          continue;
+        }
+
+        // Line - Single thread.
+        Time start(Time::now());
+        for (int i = 0; i < BENCH_QUANTITY; i++)
+          converter.blitRect(dst, stride, src, stride, BENCH_WIDTH, BENCH_HEIGHT);
+        TimeDelta lineTime = Time::now() - start;
+
+        // Image - Only standard formats can be stored in Fog::Image.
+        char imageResult[32] = "n/a";
+
+        if (srcFormat < IMAGE_FORMAT_COUNT && dstFormat < IMAGE_FORMAT_COUNT)
+        {
+          Image srcImage;
+          Image dstImage;
+
+          if (srcImage.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), srcFormat) == ERR_OK)
+          {
+            if (srcFormat == IMAGE_FORMAT_I8)
+              srcImage.setPalette(palette);
+
+            uint8_t* p = srcImage.getFirstX();
+            for (int y = 0; y < BENCH_HEIGHT; y++)
+              memcpy(p + (ssize_t)y * srcImage.getStride(), src + (ssize_t)y * stride,
+                BENCH_WIDTH * ImageFormatDescription::getByFormat(srcFormat).getBytesPerPixel());
+
+            start = Time::now();
+            for (int i = 0; i < BENCH_QUANTITY; i++)
+              converter.convertImage(dstImage, srcImage);
+            TimeDelta imageTime = Time::now() - start;
+
+            snprintf(imageResult, FOG_ARRAY_SIZE(imageResult), "%10.1f", getMPixPerSec(imageTime));
+          }
+        }
+
+        printf("%-10s -> %-10s | %10.1f | %10s%s\n",
+          getFormatName(srcFormat), getFormatName(dstFormat),
+          getMPixPerSec(lineTime), imageResult,
+          dstFormat == IMAGE_FORMAT_I8 ? (ditherIndex == 0 ? " (pattern)" : " (error-diffusion)") : "");
+      }
+    }
+  }
+
+  MemMgr::free(src);
+  MemMgr::free(dst);
+
+  return 0;
+}
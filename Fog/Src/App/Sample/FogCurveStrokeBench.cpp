@@ -0,0 +1,183 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogCurveStrokeBench]
+// ============================================================================
+
+// Strokes glyph outlines (quadratic curves in 1000 units per em) and icons
+// (cubic curves on a 24x24 grid) rendered at several sizes and compares the
+// default stroker mode (PATH_STROKER_MODE_FLATTEN) with the curve offsetting
+// (PATH_STROKER_MODE_CURVES). Prints the strokes/s, the length of the stroked
+// path and its length after flattening (what the rasterizer gets).
+
+using namespace Fog;
+
+enum
+{
+  BENCH_QUANTITY = 200
+};
+
+struct PathSource
+{
+  const char* data;
+  float advance;
+};
+
+// Glyph-like outlines, 'o', 'S' and 'a'.
+static const PathSource glyphs[] =
+{
+  {
+    "M300 -15Q170 -15 95 75Q20 165 20 300Q20 435 95 525Q170 615 300 615"
+    "Q430 615 505 525Q580 435 580 300Q580 165 505 75Q430 -15 300 -15Z"
+    "M300 75Q375 75 420 140Q465 205 465 300Q465 395 420 460Q375 525 300 525"
+    "Q225 525 180 460Q135 395 135 300Q135 205 180 140Q225 75 300 75Z",
+    600.0f
+  },
+  {
+    "M520 190Q520 90 440 35Q360 -20 250 -20Q140 -20 60 40L110 125Q175 75 250 75"
+    "Q320 75 360 105Q400 135 400 185Q400 235 355 262Q310 290 220 320"
+    "Q120 350 80 400Q40 450 40 520Q40 610 115 665Q190 720 290 720"
+    "Q390 720 470 670L425 585Q360 625 290 625Q230 625 195 598Q160 570 160 525"
+    "Q160 480 205 455Q250 430 340 400Q440 370 480 315Q520 260 520 190Z",
+    560.0f
+  },
+  {
+    "M400 0L395 65Q340 -15 240 -15Q150 -15 95 35Q40 85 40 165Q40 255 110 302"
+    "Q180 350 315 350L390 350L390 385Q390 450 355 485Q320 520 250 520"
+    "Q180 520 110 480L75 565Q160 615 265 615Q385 615 445 555Q505 495 505 380"
+    "L505 0Z"
+    "M390 265L320 265Q235 265 195 240Q155 215 155 170Q155 125 185 100"
+    "Q215 75 265 75Q320 75 355 110Q390 145 390 200Z",
+    560.0f
+  }
+};
+
+// Icon-like outlines, heart, check in a circle, cloud and wave.
+static const PathSource icons[] =
+{
+  {
+    "M12 21C12 21 3 14.5 3 8.5C3 5.4 5.4 3 8.3 3C10 3 11.3 3.9 12 5.1"
+    "C12.7 3.9 14 3 15.7 3C18.6 3 21 5.4 21 8.5C21 14.5 12 21 12 21Z",
+    24.0f
+  },
+  {
+    "M12 2C6.5 2 2 6.5 2 12C2 17.5 6.5 22 12 22C17.5 22 22 17.5 22 12"
+    "C22 6.5 17.5 2 12 2Z"
+    "M7 12.5L10.5 16L17 8.5",
+    24.0f
+  },
+  {
+    "M6.5 19C4 19 2 17 2 14.5C2 12.2 3.7 10.3 6 10C6.7 7.1 9.1 5 12 5"
+    "C15.3 5 18 7.4 18.4 10.5C20.5 10.9 22 12.7 22 14.8C22 17.1 20.1 19 17.8 19Z",
+    24.0f
+  },
+  {
+    "M2 12C4 8 6 8 8 12C10 16 12 16 14 12C16 8 18 8 20 12C21 14 22 15 23 15",
+    24.0f
+  }
+};
+
+static const char* modeNames[] =
+{
+  "Flatten",
+  "Curves"
+};
+
+static void preparePath(PathF& path, const PathSource* src, size_t count)
+{
+  PathF tmp;
+  float x = 0.0f;
+
+  path.clear();
+
+  for (size_t i = 0; i < count; i++)
+  {
+    tmp.clear();
+    SvgUtil::parsePath(tmp, StringW::fromAscii8(src[i].data));
+
+    path.appendTranslated(tmp, PointF(x, 0.0f));
+    x += src[i].advance;
+  }
+}
+
+static double runBench(const PathF& path, float scale, float width, uint32_t mode,
+  size_t& length, size_t& flatLength)
+{
+  PathStrokerParamsF params;
+  params.setLineWidth(width / scale);
+  params.setLineJoin(LINE_JOIN_ROUND);
+  params.setLineCaps(LINE_CAP_ROUND);
+
+  TransformF tr;
+  tr.scale(PointF(scale, scale));
+
+  PathStrokerF stroker(params, tr);
+  stroker.setStrokeMode(mode);
+
+  PathF dst;
+  PathF flat;
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    dst.clear();
+    stroker.strokePath(dst, path);
+  }
+
+  double ms = (Time::now() - start).getMillisecondsD();
+
+  PathF::flatten(flat, dst, stroker.getFlatness());
+
+  length = dst.getLength();
+  flatLength = flat.getLength();
+
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+static void benchSet(const char* setName, const PathF& path, float unitsPerPixel,
+  const int* sizes, size_t sizeCount)
+{
+  static const float widths[] = { 1.0f, 4.0f };
+
+  for (size_t i = 0; i < sizeCount; i++)
+  {
+    float scale = float(sizes[i]) / unitsPerPixel;
+
+    for (size_t j = 0; j < FOG_ARRAY_SIZE(widths); j++)
+    {
+      for (uint32_t mode = 0; mode < PATH_STROKER_MODE_COUNT; mode++)
+      {
+        size_t length;
+        size_t flatLength;
+        double r = runBench(path, scale, widths[j], mode, length, flatLength);
+
+        printf("%-6s | %4dpx | %5.1f | %-7s | %12.1f | %8d | %8d\n",
+          setName, sizes[i], widths[j], modeNames[mode], r, int(length), int(flatLength));
+      }
+    }
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  static const int glyphSizes[] = { 16, 64, 256 };
+  static const int iconSizes[] = { 24, 96, 384 };
+
+  PathF glyphPath;
+  PathF iconPath;
+
+  preparePath(glyphPath, glyphs, FOG_ARRAY_SIZE(glyphs));
+  preparePath(iconPath, icons, FOG_ARRAY_SIZE(icons));
+
+  printf("%-6s | %6s | %5s | %-7s | %12s | %8s | %8s\n",
+    "Set", "Size", "Width", "Mode", "Strokes/s", "Length", "Flat");
+
+  benchSet("Glyphs", glyphPath, 1000.0f, glyphSizes, FOG_ARRAY_SIZE(glyphSizes));
+  benchSet("Icons", iconPath, 24.0f, iconSizes, FOG_ARRAY_SIZE(iconSizes));
+
+  return 0;
+}
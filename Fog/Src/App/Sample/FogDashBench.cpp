@@ -0,0 +1,207 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogDashBench]
+// ============================================================================
+
+// Strokes long dashed polylines like the ones found in CAD drawings and maps.
+// The same polyline is stroked solid, dashed and dashed at 64x zoom where
+// most of the polyline is outside of the canvas. Dashes outside of the clip
+// box are skipped before stroking so the zoomed case shouldn't be slower
+// than the unzoomed one. The result is in strokes/s.
+//
+// Before the benchmark the stroker is checked against the SVG dashing rules
+// (zero length dash entries) and against segments long enough that a float
+// position can't be advanced by a single dash.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 800,
+  BENCH_HEIGHT = 600,
+  BENCH_QUANTITY = 100,
+
+  POLYLINE_VERTICES = 5000
+};
+
+static void preparePolyline(PathF& path)
+{
+  uint32_t seed = 1;
+  float x = 0.0f;
+  float y = float(BENCH_HEIGHT / 2);
+
+  path.clear();
+  path.moveTo(PointF(x, y));
+
+  for (int i = 1; i < POLYLINE_VERTICES; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    x += float(BENCH_WIDTH) / float(POLYLINE_VERTICES);
+    y += float(int((seed >> 8) % 21) - 10);
+
+    if (y < 0.0f) y = 0.0f;
+    if (y > float(BENCH_HEIGHT)) y = float(BENCH_HEIGHT);
+
+    path.lineTo(PointF(x, y));
+  }
+}
+
+static size_t countFigures(const PathF& path)
+{
+  const uint8_t* cmd = path.getCommands();
+  size_t length = path.getLength();
+  size_t count = 0;
+
+  for (size_t i = 0; i < length; i++)
+  {
+    if (cmd[i] == PATH_CMD_MOVE_TO)
+      count++;
+  }
+
+  return count;
+}
+
+static bool checkDashes()
+{
+  bool ok = true;
+
+  PathStrokerParamsF params;
+  params.setLineWidth(1.0f);
+  params.setLineCaps(LINE_CAP_BUTT);
+
+  // Zero length dash entries - {10, 0, 10, 5} on a 100 pixels long line. The
+  // zero gap joins two dashes, but both are emitted, so each period of 25
+  // pixels produces two figures.
+  {
+    static const float dashes[] = { 10.0f, 0.0f, 10.0f, 5.0f };
+
+    List<float> dashList;
+    dashList.setList(dashes, FOG_ARRAY_SIZE(dashes));
+    params.setDashList(dashList);
+
+    PathF src;
+    src.moveTo(PointF(0.0f, 0.0f));
+    src.lineTo(PointF(100.0f, 0.0f));
+
+    PathF dst;
+    PathStrokerF stroker(params);
+
+    err_t err = stroker.strokePath(dst, src);
+    size_t figures = countFigures(dst);
+    BoxF bbox(0.0f, 0.0f, 0.0f, 0.0f);
+    dst.getBoundingBox(bbox);
+
+    if (err != ERR_OK || figures != 8 || !Math::isFuzzyEq(bbox.x0, 0.0f) || !Math::isFuzzyEq(bbox.x1, 95.0f))
+    {
+      printf("Dash check failed: {10, 0, 10, 5}, err=%u, figures=%u (expected 8), x0=%g, x1=%g (expected 0, 95).\n",
+        (uint)err, (uint)figures, bbox.x0, bbox.x1);
+      ok = false;
+    }
+  }
+
+  // Long segments clipped to a small box far from their start. The dashes
+  // are shorter than the float precision at that position, the stroker must
+  // finish and the result must stay inside of the clip box.
+  {
+    static const float dashes[] = { 1.0f, 1.0f };
+    static const float starts[] = { 100.0f, 1.0e7f, 3.0e7f, 1.0e9f };
+
+    List<float> dashList;
+    dashList.setList(dashes, FOG_ARRAY_SIZE(dashes));
+    params.setDashList(dashList);
+
+    for (size_t i = 0; i < FOG_ARRAY_SIZE(starts); i++)
+    {
+      float start = starts[i];
+      BoxF clipBox(start, -10.0f, start + 100.0f, 10.0f);
+
+      PathF src;
+      src.moveTo(PointF(0.0f, 0.0f));
+      src.lineTo(PointF(start + 1000.0f, 0.0f));
+
+      PathF dst;
+      PathStrokerF stroker(params, TransformF(), clipBox);
+
+      err_t err = stroker.strokePath(dst, src);
+      BoxF bbox(0.0f, 0.0f, 0.0f, 0.0f);
+
+      if (err == ERR_OK && !dst.isEmpty())
+        dst.getBoundingBox(bbox);
+
+      if (err != ERR_OK || (!dst.isEmpty() && (bbox.x1 < clipBox.x0 - 2.0f || bbox.x0 > clipBox.x1 + 2.0f)))
+      {
+        printf("Dash check failed: segment ending at %g, err=%u.\n", start + 1000.0f, (uint)err);
+        ok = false;
+      }
+    }
+  }
+
+  return ok;
+}
+
+static double runBench(Image& image, const PathF& path, bool dashed, float zoom)
+{
+  static const float dashes[] = { 6.0f, 3.0f, 1.0f, 3.0f };
+
+  Painter p(image);
+  p.setSource(Argb32(0xFFFFFFFF));
+  p.fillAll();
+
+  p.setSource(Argb32(0xFF000000));
+  p.setLineWidth(1.5f / zoom);
+  p.setLineJoin(LINE_JOIN_ROUND);
+
+  if (dashed)
+  {
+    List<float> dashList;
+    dashList.setList(dashes, FOG_ARRAY_SIZE(dashes));
+
+    p.setDashList(dashList);
+    p.setDashOffset(2.0f / zoom);
+  }
+
+  // Zoom around the center of the canvas.
+  TransformF tr;
+  tr.translate(PointF(float(BENCH_WIDTH / 2), float(BENCH_HEIGHT / 2)));
+  tr.scale(PointF(zoom, zoom));
+  tr.translate(PointF(-float(BENCH_WIDTH / 2), -float(BENCH_HEIGHT / 2)));
+  p.setTransform(tr);
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+    p.drawPath(path);
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  Image image;
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_XRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  if (!checkDashes())
+    return 1;
+
+  PathF path;
+  preparePolyline(path);
+
+  printf("%-14s | %12s\n", "Stroke", "Strokes/s");
+  printf("%-14s | %12.1f\n", "Solid", runBench(image, path, false, 1.0f));
+  printf("%-14s | %12.1f\n", "Dashed", runBench(image, path, true, 1.0f));
+  printf("%-14s | %12.1f\n", "Solid x64", runBench(image, path, false, 64.0f));
+  printf("%-14s | %12.1f\n", "Dashed x64", runBench(image, path, true, 64.0f));
+
+  return 0;
+}
@@ -0,0 +1,207 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogDecodeBench]
+// ============================================================================
+
+// Decodes JPEG and BMP files through the plain file stream (each read of the
+// decoder is a read() call), the buffered file stream (Stream::openBuffered())
+// and the zero-copy memory mapped stream (Stream::openMMap()). The file stream
+// is wrapped by a device which counts read calls which reach the file, so the
+// result contains the time of a single decode and the count of read() calls
+// per decode (zero for the mapped file).
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 1600,
+  BENCH_HEIGHT = 1200,
+  BENCH_QUANTITY = 20
+};
+
+// ============================================================================
+// [CountingStreamDevice]
+// ============================================================================
+
+struct CountingStreamDevice : public StreamDevice
+{
+  CountingStreamDevice(const Stream& base) :
+    base(base),
+    readCount(0),
+    readBytes(0)
+  {
+    // Not FD/HFILE, the device isn't FdStreamDevice/WinStreamDevice.
+    flags = base.getFlags() & ~(STREAM_IS_FD | STREAM_IS_HFILE);
+  }
+
+  virtual int64_t seek(int64_t offset, int whence) { return base.seek(offset, whence); }
+  virtual int64_t tell() const { return base.tell(); }
+
+  virtual size_t read(void* buffer, size_t size)
+  {
+    readCount++;
+    readBytes += size;
+    return base.read(buffer, size);
+  }
+
+  virtual size_t write(const void* buffer, size_t size) { return base.write(buffer, size); }
+
+  virtual err_t getSize(int64_t* size) { return base.getSize(size); }
+  virtual err_t setSize(int64_t size) { return base.setSize(size); }
+  virtual err_t truncate(int64_t offset) { return base.truncate(offset); }
+
+  virtual void close() { base.close(); }
+
+  Stream base;
+  size_t readCount;
+  uint64_t readBytes;
+};
+
+// ============================================================================
+// [Helpers]
+// ============================================================================
+
+enum BENCH_MODE
+{
+  BENCH_MODE_FILE = 0,
+  BENCH_MODE_BUFFERED = 1,
+  BENCH_MODE_MMAP = 2,
+  BENCH_MODE_COUNT = 3
+};
+
+static const char* modeNames[] =
+{
+  "File",
+  "Buffered",
+  "MMap"
+};
+
+static void prepareImage(Image& image)
+{
+  image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_XRGB32);
+
+  uint8_t* pixels = image.getFirstX();
+  ssize_t stride = image.getStride();
+  uint32_t seed = 1;
+
+  for (int y = 0; y < BENCH_HEIGHT; y++)
+  {
+    uint32_t* p = reinterpret_cast<uint32_t*>(pixels + (ssize_t)y * stride);
+
+    for (int x = 0; x < BENCH_WIDTH; x++)
+    {
+      // Gradients with a bit of noise, to not compress too well.
+      seed = seed * 1103515245U + 12345U;
+      uint32_t noise = (seed >> 16) & 0x0F;
+
+      uint32_t r = ((x * 255) / BENCH_WIDTH + noise) & 0xFF;
+      uint32_t g = ((y * 255) / BENCH_HEIGHT + noise) & 0xFF;
+      uint32_t b = (((x ^ y) & 0xFF) + noise) & 0xFF;
+
+      p[x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+    }
+  }
+}
+
+static err_t openStream(Stream& stream, CountingStreamDevice** counter,
+  const StringW& fileName, uint32_t mode)
+{
+  *counter = NULL;
+
+  if (mode == BENCH_MODE_MMAP)
+    return stream.openMMap(fileName, false);
+
+  Stream file;
+  FOG_RETURN_ON_ERROR(file.openFile(fileName, STREAM_OPEN_READ));
+
+  CountingStreamDevice* device = fog_new CountingStreamDevice(file);
+  if (FOG_IS_NULL(device))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  *counter = device;
+  stream = Stream(device);
+
+  if (mode == BENCH_MODE_BUFFERED)
+    return stream.openBuffered(stream);
+  else
+    return ERR_OK;
+}
+
+static void benchFile(const char* name, const StringW& fileName, const StringW& extension)
+{
+  for (uint32_t mode = 0; mode < BENCH_MODE_COUNT; mode++)
+  {
+    size_t readCount = 0;
+    uint64_t readBytes = 0;
+    err_t err = ERR_OK;
+
+    Time start(Time::now());
+
+    for (int i = 0; i < BENCH_QUANTITY && err == ERR_OK; i++)
+    {
+      Stream stream;
+      CountingStreamDevice* counter;
+      Image image;
+
+      err = openStream(stream, &counter, fileName, mode);
+      if (err == ERR_OK)
+        err = image.readFromStream(stream, extension);
+
+      if (counter != NULL)
+      {
+        readCount += counter->readCount;
+        readBytes += counter->readBytes;
+      }
+    }
+
+    double ms = (Time::now() - start).getMillisecondsD();
+
+    if (err != ERR_OK)
+    {
+      printf("%-4s | %-8s | failed (error %u)\n", name, modeNames[mode], (uint)err);
+      continue;
+    }
+
+    printf("%-4s | %-8s | %10.3f | %10.1f | %12.0f\n", name, modeNames[mode],
+      ms / double(BENCH_QUANTITY),
+      double(readCount) / double(BENCH_QUANTITY),
+      double(readBytes) / double(BENCH_QUANTITY));
+  }
+}
+
+// ============================================================================
+// [Main]
+// ============================================================================
+
+int main(int argc, char* argv[])
+{
+  static const char* const extensions[] = { "jpg", "bmp" };
+  static const char* const names[] = { "JPEG", "BMP" };
+
+  Image image;
+  prepareImage(image);
+
+  printf("%-4s | %-8s | %10s | %10s | %12s\n",
+    "Type", "Stream", "ms/decode", "reads", "read bytes");
+
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(extensions); i++)
+  {
+    StringW extension = StringW::fromAscii8(extensions[i]);
+    StringW fileName = StringW::fromAscii8("FogDecodeBench.");
+    fileName.append(extension);
+
+    if (image.writeToFile(fileName) != ERR_OK)
+    {
+      printf("%-4s | can't write the test file\n", names[i]);
+      continue;
+    }
+
+    benchFile(names[i], fileName, extension);
+  }
+
+  return 0;
+}
@@ -0,0 +1,161 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogFilterStrokeBench]
+// ============================================================================
+
+// Measures the throughput of Painter::filterStrokedShape() (blurred outlines)
+// for several blur radii and line widths. The result is in strokes/s.
+//
+// Before the benchmark a stroked rectangle is blurred and the pixels farther
+// from the outline than the blur radius (the interior and the exterior of the
+// rectangle) are checked to be unchanged.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 640,
+  BENCH_HEIGHT = 480,
+  BENCH_QUANTITY = 1000
+};
+
+static void prepareBackground(Image& image)
+{
+  Painter p(image);
+
+  for (int y = 0; y < BENCH_HEIGHT; y += 16)
+  {
+    for (int x = 0; x < BENCH_WIDTH; x += 16)
+    {
+      p.setSource(Argb32(((x ^ y) & 16) ? 0xFF203040 : 0xFFE0C0A0));
+      p.fillRect(RectI(x, y, 16, 16));
+    }
+  }
+
+  p.end();
+}
+
+static bool checkInterior()
+{
+  enum { RADIUS = 4, X0 = 100, Y0 = 100, X1 = 300, Y1 = 250 };
+
+  Image original;
+  Image image;
+
+  if (original.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK ||
+      image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return false;
+  }
+
+  prepareBackground(original);
+  prepareBackground(image);
+
+  {
+    Painter p(image);
+    p.setLineWidth(2.0f);
+
+    FeBlur blur(FE_BLUR_TYPE_STACK, float(RADIUS));
+    RectF rect(float(X0), float(Y0), float(X1 - X0), float(Y1 - Y0));
+    p.filterStrokedShape(blur, ShapeF(&rect));
+    p.end();
+  }
+
+  // The stroke covers [X0 - 1, X0 + 1] (and the same for the other edges),
+  // the filter can change the pixels up to RADIUS pixels from it.
+  int border = 1 + RADIUS + 1;
+  int changedNear = 0;
+  int changedFar = 0;
+
+  for (int y = 0; y < BENCH_HEIGHT; y++)
+  {
+    const uint32_t* a = reinterpret_cast<const uint32_t*>(original.getScanline(y));
+    const uint32_t* b = reinterpret_cast<const uint32_t*>(image.getScanline(y));
+
+    for (int x = 0; x < BENCH_WIDTH; x++)
+    {
+      if (a[x] == b[x])
+        continue;
+
+      bool outer = x >= X0 - border && x < X1 + border && y >= Y0 - border && y < Y1 + border;
+      bool inner = x >= X0 + border && x < X1 - border && y >= Y0 + border && y < Y1 - border;
+
+      if (outer && !inner)
+        changedNear++;
+      else
+        changedFar++;
+    }
+  }
+
+  if (changedNear == 0 || changedFar != 0)
+  {
+    printf("Filter check failed: %d pixels changed near the outline, %d pixels changed inside or outside of it.\n",
+      changedNear, changedFar);
+    return false;
+  }
+
+  return true;
+}
+
+static double runBench(Image& image, const FeBlur& blur, float lineWidth)
+{
+  Painter p(image);
+  p.setLineWidth(lineWidth);
+
+  uint32_t seed = 1;
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    float cx = float((seed >> 8) % BENCH_WIDTH);
+    seed = seed * 1103515245U + 12345U;
+    float cy = float((seed >> 8) % BENCH_HEIGHT);
+    seed = seed * 1103515245U + 12345U;
+    float r = float(16 + (seed >> 8) % 48);
+
+    CircleF circle(PointF(cx, cy), r);
+    p.filterStrokedShape(blur, ShapeF(&circle));
+  }
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  static const float radii[] = { 2.0f, 5.0f, 10.0f };
+  static const float widths[] = { 1.0f, 4.0f, 12.0f };
+
+  Image image;
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  if (!checkInterior())
+    return 1;
+
+  printf("%-8s | %-8s | %12s\n", "Radius", "Width", "Strokes/s");
+
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(radii); i++)
+  {
+    for (size_t j = 0; j < FOG_ARRAY_SIZE(widths); j++)
+    {
+      prepareBackground(image);
+
+      FeBlur blur(FE_BLUR_TYPE_STACK, radii[i]);
+      printf("%-8g | %-8g | %12.1f\n", radii[i], widths[j], runBench(image, blur, widths[j]));
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogGradientCacheBench]
+// ============================================================================
+
+// Renders a gradient-heavy SVG document repeatedly with and without the global
+// color-stop cache (Fog::ColorStopCache). The document can be passed as the
+// first argument, otherwise a document containing many gradients is generated.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 800,
+  BENCH_HEIGHT = 600,
+  BENCH_QUANTITY = 50,
+  BENCH_GRADIENTS = 200
+};
+
+static StringW createDocument()
+{
+  StringW svg;
+
+  svg.appendFormat("<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" height=\"%d\">\n",
+    BENCH_WIDTH, BENCH_HEIGHT);
+  svg.append(Ascii8("<defs>\n"));
+
+  // Only a few distinct color stops, but each gradient has its own stop list.
+  for (int i = 0; i < BENCH_GRADIENTS; i++)
+  {
+    uint32_t c0 = 0x00FF0000U >> ((i % 3) * 8);
+    uint32_t c1 = 0x000000FFU << ((i % 2) * 8);
+
+    svg.appendFormat(
+      "<linearGradient id=\"g%d\" x1=\"0\" y1=\"0\" x2=\"1\" y2=\"1\">"
+      "<stop offset=\"0\" stop-color=\"#%06X\"/>"
+      "<stop offset=\"0.5\" stop-color=\"#FFFFFF\" stop-opacity=\"0.5\"/>"
+      "<stop offset=\"1\" stop-color=\"#%06X\"/>"
+      "</linearGradient>\n", i, c0, c1);
+  }
+
+  svg.append(Ascii8("</defs>\n"));
+
+  for (int i = 0; i < BENCH_GRADIENTS; i++)
+  {
+    int x = (i * 37) % (BENCH_WIDTH - 100);
+    int y = (i * 53) % (BENCH_HEIGHT - 100);
+
+    svg.appendFormat(
+      "<rect x=\"%d\" y=\"%d\" width=\"100\" height=\"100\" rx=\"10\" fill=\"url(#g%d)\"/>\n", x, y, i);
+  }
+
+  svg.append(Ascii8("</svg>\n"));
+  return svg;
+}
+
+static TimeDelta runBench(SvgDocument& document, Image& image)
+{
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    Painter p(image);
+
+    p.setSource(Argb32(0xFFFFFFFF));
+    p.fillAll();
+    document.render(&p);
+
+    p.end();
+  }
+
+  return Time::now() - start;
+}
+
+int main(int argc, char* argv[])
+{
+  SvgDocument document;
+  err_t err;
+
+  if (argc >= 2)
+    err = document.readFromFile(StringW::fromAscii8(argv[1]));
+  else
+    err = document.readFromString(createDocument());
+
+  if (err != ERR_OK)
+  {
+    printf("Failed to read the document (error=%u).\n", err);
+    return 1;
+  }
+
+  Image image;
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  size_t budget = ColorStopCache::getSharedBudget();
+  ColorStopCacheStats stats;
+
+  // Without the global cache.
+  ColorStopCache::setSharedBudget(0);
+  ColorStopCache::resetSharedStats();
+
+  TimeDelta uncachedTime = runBench(document, image);
+  printf("Uncached: %8.2f [ms]\n", uncachedTime.getMillisecondsD());
+
+  // With the global cache.
+  ColorStopCache::setSharedBudget(budget);
+  ColorStopCache::resetSharedStats();
+
+  TimeDelta cachedTime = runBench(document, image);
+  ColorStopCache::getSharedStats(stats);
+
+  printf("Cached  : %8.2f [ms] (hits=%u, misses=%u, evicted=%u, entries=%u, bytes=%u)\n",
+    cachedTime.getMillisecondsD(),
+    (uint)stats.hitCount,
+    (uint)stats.missCount,
+    (uint)stats.evictCount,
+    (uint)stats.entryCount,
+    (uint)stats.usedBytes);
+
+  return 0;
+}
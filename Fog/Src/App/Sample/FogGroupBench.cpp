@@ -0,0 +1,91 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+#if defined(FOG_OS_POSIX)
+#include <sys/resource.h>
+#endif // FOG_OS_POSIX
+
+// ============================================================================
+// [FogGroupBench]
+// ============================================================================
+
+// Paints many nested groups with opacity (as produced by SVG documents), each
+// group contains only a small shape, on a large canvas. The group buffers
+// cover only the tiles touched by the group content and are reused, so the
+// cost of a group should depend on the size of its content and not on the
+// size of the canvas. The result is in groups/s and the peak memory usage of
+// the process.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 2048,
+  BENCH_HEIGHT = 2048,
+  BENCH_QUANTITY = 5000
+};
+
+static double benchGroups(Image& image, bool wideShapes)
+{
+  Painter p(image);
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    float x = float((i * 97) % (BENCH_WIDTH - 64));
+    float y = float((i * 61) % (BENCH_HEIGHT - 64));
+
+    p.setOpacity(0.75f);
+    p.beginGroup();
+
+    p.setSource(Argb32(0xFF2060A0));
+    p.fillRect(RectF(x, y, 48.0f, 48.0f));
+
+    p.setOpacity(0.5f);
+    p.beginGroup();
+
+    p.setSource(Argb32(0xFFFFC040));
+    if (wideShapes)
+      p.fillRect(RectF(-4096.0f, y + 16.0f, 12288.0f, 4.0f));
+    else
+      p.fillCircle(CircleF(PointF(x + 24.0f, y + 24.0f), 16.0f));
+
+    p.paintGroup();
+    p.paintGroup();
+  }
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY * 2) * 1000.0 / ms : 0.0;
+}
+
+static long getPeakMemoryKB()
+{
+#if defined(FOG_OS_POSIX)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    return long(usage.ru_maxrss);
+#endif // FOG_OS_POSIX
+  return -1;
+}
+
+int main(int argc, char* argv[])
+{
+  Image image;
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+  image.clear(Argb32(0xFFFFFFFF));
+
+  printf("%-8s | %12s | %14s\n", "Content", "Groups/s", "Peak [KB]");
+  printf("%-8s | %12.1f | %14ld\n", "Small", benchGroups(image, false), getPeakMemoryKB());
+  printf("%-8s | %12.1f | %14ld\n", "Wide", benchGroups(image, true), getPeakMemoryKB());
+
+  return 0;
+}
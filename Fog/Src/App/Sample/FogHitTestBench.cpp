@@ -0,0 +1,154 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogHitTestBench]
+// ============================================================================
+
+// Hit-tests 1000000 points against a closed wavy outline made of 50000 line
+// segments. The linear hit-test walks the whole path for each point, it's
+// forced by marking the path modified before each query and it's measured
+// using fewer points. The indexed hit-test, the batch hit-test, and the stroke
+// distance query use the hit-index built from the path. The time needed to
+// build the hit-index is measured separately. The result is in queries/s.
+
+using namespace Fog;
+
+enum
+{
+  PATH_SEGMENTS = 50000,
+
+  QUERY_COUNT = 1000000,
+  QUERY_COUNT_LINEAR = 1000,
+
+  BUILD_QUANTITY = 20
+};
+
+static void preparePath(PathD& path)
+{
+  path.clear();
+
+  for (int i = 0; i < PATH_SEGMENTS; i++)
+  {
+    double a = double(i) * (MATH_TWO_PI / double(PATH_SEGMENTS));
+    double r = 250.0 + 40.0 * Math::sin(a * 37.0);
+
+    PointD pt(300.0 + r * Math::cos(a), 300.0 + r * Math::sin(a));
+
+    if (i == 0)
+      path.moveTo(pt);
+    else
+      path.lineTo(pt);
+  }
+
+  path.close();
+}
+
+static void preparePoints(PointD* pts, size_t count)
+{
+  uint32_t seed = 1;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    double x = double((seed >> 8) % 60000) / 100.0;
+
+    seed = seed * 1103515245U + 12345U;
+    double y = double((seed >> 8) % 60000) / 100.0;
+
+    pts[i].set(x, y);
+  }
+}
+
+static void printResult(const char* name, double ms, size_t count, size_t hits)
+{
+  double qps = ms > 0.0 ? double(count) * 1000.0 / ms : 0.0;
+  printf("%-10s | %14.1f | %8d\n", name, qps, int(hits));
+}
+
+int main(int argc, char* argv[])
+{
+  PathD path;
+  preparePath(path);
+
+  PointD* pts = static_cast<PointD*>(MemMgr::alloc(QUERY_COUNT * sizeof(PointD)));
+  bool* results = static_cast<bool*>(MemMgr::alloc(QUERY_COUNT * sizeof(bool)));
+
+  if (pts == NULL || results == NULL)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  preparePoints(pts, QUERY_COUNT);
+
+  printf("%-10s | %14s | %8s\n", "Query", "Queries/s", "Hits");
+
+  size_t i;
+  size_t hits;
+  Time start;
+
+  // Linear.
+  hits = 0;
+  start = Time::now();
+
+  for (i = 0; i < QUERY_COUNT_LINEAR; i++)
+  {
+    path._modifiedVertices();
+    hits += path.hitTest(pts[i], FILL_RULE_NON_ZERO);
+  }
+
+  printResult("Linear", (Time::now() - start).getMillisecondsD(), QUERY_COUNT_LINEAR, hits);
+
+  // Build.
+  start = Time::now();
+
+  for (i = 0; i < BUILD_QUANTITY; i++)
+  {
+    path._modifiedVertices();
+    path.getHitIndex();
+  }
+
+  printResult("Build", (Time::now() - start).getMillisecondsD(), BUILD_QUANTITY, 0);
+
+  // Indexed.
+  hits = 0;
+  start = Time::now();
+
+  for (i = 0; i < QUERY_COUNT; i++)
+    hits += path.hitTest(pts[i], FILL_RULE_NON_ZERO);
+
+  printResult("Indexed", (Time::now() - start).getMillisecondsD(), QUERY_COUNT, hits);
+
+  // Batch.
+  hits = 0;
+  start = Time::now();
+
+  path.hitTest(results, pts, QUERY_COUNT, FILL_RULE_NON_ZERO);
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  for (i = 0; i < QUERY_COUNT; i++)
+    hits += results[i];
+
+  printResult("Batch", ms, QUERY_COUNT, hits);
+
+  // Distance (stroke having 4px line-width).
+  const PathHitIndexD* hitIndex = path.getHitIndex();
+  if (hitIndex != NULL)
+  {
+    hits = 0;
+    start = Time::now();
+
+    for (i = 0; i < QUERY_COUNT; i++)
+      hits += hitIndex->hitTestStroke(pts[i], 4.0);
+
+    printResult("Distance", (Time::now() - start).getMillisecondsD(), QUERY_COUNT, hits);
+  }
+
+  MemMgr::free(results);
+  MemMgr::free(pts);
+
+  return 0;
+}
@@ -0,0 +1,140 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <math.h>
+#include <stdio.h>
+
+// ============================================================================
+// [FogLinearBench]
+// ============================================================================
+
+// Renders the same scene (antialiased circles and semi-transparent rectangles)
+// using sRGB and linear-light compositing and prints the time of both and
+// their ratio. The linear-light result of a simple translucent fill is also
+// compared to a reference computed in double precision.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 640,
+  BENCH_HEIGHT = 480,
+  BENCH_QUANTITY = 2000
+};
+
+static const uint32_t fillColor = 0x80FF4020;
+
+static void prepareBackground(Image& image)
+{
+  Painter p(image);
+
+  p.setCompositingOperator(COMPOSITE_SRC);
+  for (int y = 0; y < BENCH_HEIGHT; y += 16)
+  {
+    for (int x = 0; x < BENCH_WIDTH; x += 16)
+    {
+      p.setSource(Argb32(((x ^ y) & 16) ? 0xFF203040 : 0xFFE0C0A0));
+      p.fillRect(RectI(x, y, 16, 16));
+    }
+  }
+
+  p.end();
+}
+
+static double runBench(Image& image, uint32_t colorSpace)
+{
+  prepareBackground(image);
+
+  Painter p(image);
+  p.setColorSpace(colorSpace);
+
+  uint32_t seed = 1;
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    float cx = float((seed >> 8) % BENCH_WIDTH);
+    seed = seed * 1103515245U + 12345U;
+    float cy = float((seed >> 8) % BENCH_HEIGHT);
+    seed = seed * 1103515245U + 12345U;
+    uint32_t color = (seed >> 8) | 0x40000000;
+
+    p.setSource(Argb32(color));
+    p.fillCircle(CircleF(PointF(cx, cy), 24.0f));
+    p.fillRect(RectI(int(cx), int(cy) + 30, 48, 16));
+  }
+
+  p.end();
+  return (Time::now() - start).getMillisecondsD();
+}
+
+static double linearFromSRgb(double x)
+{
+  return x <= 0.04045 ? x / 12.92 : pow((x + 0.055) / 1.055, 2.4);
+}
+
+static double sRgbFromLinear(double x)
+{
+  return x <= 0.0031308 ? x * 12.92 : 1.055 * pow(x, 1.0 / 2.4) - 0.055;
+}
+
+static int compareReference(const Image& image)
+{
+  double sa = double(fillColor >> 24) / 255.0;
+  int maxDiff = 0;
+
+  for (int y = 0; y < BENCH_HEIGHT; y++)
+  {
+    const uint32_t* line = reinterpret_cast<const uint32_t*>(image.getFirst() + y * image.getStride());
+
+    for (int x = 0; x < BENCH_WIDTH; x++)
+    {
+      uint32_t bg = ((x ^ y) & 16) ? 0xFF203040 : 0xFFE0C0A0;
+
+      for (int i = 0; i < 24; i += 8)
+      {
+        double s = linearFromSRgb(double((fillColor >> i) & 0xFF) / 255.0);
+        double d = linearFromSRgb(double((bg >> i) & 0xFF) / 255.0);
+        int ref = int(sRgbFromLinear(s * sa + d * (1.0 - sa)) * 255.0 + 0.5);
+
+        int diff = int((line[x] >> i) & 0xFF) - ref;
+        if (diff < 0) diff = -diff;
+        if (diff > maxDiff) maxDiff = diff;
+      }
+    }
+  }
+
+  return maxDiff;
+}
+
+int main(int argc, char* argv[])
+{
+  Image image;
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_XRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  double srgbTime = runBench(image, COLOR_SPACE_SRGB);
+  double linearTime = runBench(image, COLOR_SPACE_LINEAR);
+
+  printf("%-10s | %12s\n", "Space", "Time [ms]");
+  printf("%-10s | %12.2f\n", "sRGB", srgbTime);
+  printf("%-10s | %12.2f\n", "Linear", linearTime);
+  printf("Ratio: %.2f\n", srgbTime > 0.0 ? linearTime / srgbTime : 0.0);
+
+  // Translucent fill of the whole image in linear-light.
+  prepareBackground(image);
+  {
+    Painter p(image);
+    p.setColorSpace(COLOR_SPACE_LINEAR);
+    p.setSource(Argb32(fillColor));
+    p.fillAll();
+    p.end();
+  }
+  printf("MaxDiff: %d\n", compareReference(image));
+
+  return 0;
+}
@@ -0,0 +1,120 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogPathOnPathBench]
+// ============================================================================
+
+// Warps a line of 10000 glyph-like outlines (boxes with curved counters) along
+// an open wavy guide and along a closed circular guide using PathOnPath. The
+// glyphs are placed from left to right, so the guide lookup follows the
+// monotone cursor, and the same line is also warped in reversed glyph order
+// to measure the binary-search fallback. The result is in glyphs/s.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_QUANTITY = 10,
+
+  GLYPH_COUNT = 10000,
+  GLYPH_ADVANCE = 10
+};
+
+static void prepareGlyphs(PathD& path, bool reversed)
+{
+  path.clear();
+
+  for (int i = 0; i < GLYPH_COUNT; i++)
+  {
+    int index = reversed ? GLYPH_COUNT - 1 - i : i;
+    double x = double(index * GLYPH_ADVANCE);
+
+    // Outer contour with a curved top.
+    path.moveTo(PointD(x + 1.0, 0.0));
+    path.lineTo(PointD(x + 1.0, -8.0));
+    path.cubicTo(PointD(x + 3.0, -11.0), PointD(x + 7.0, -11.0), PointD(x + 9.0, -8.0));
+    path.lineTo(PointD(x + 9.0, 0.0));
+    path.close();
+
+    // Counter.
+    path.moveTo(PointD(x + 3.0, -2.0));
+    path.lineTo(PointD(x + 7.0, -2.0));
+    path.quadTo(PointD(x + 5.0, -9.0), PointD(x + 3.0, -2.0));
+    path.close();
+  }
+}
+
+static void prepareWave(PathD& path)
+{
+  path.clear();
+  path.moveTo(PointD(0.0, 300.0));
+
+  for (int i = 0; i < 40; i++)
+  {
+    double x = double(i) * 200.0;
+    path.cubicTo(PointD(x + 66.0, 200.0), PointD(x + 133.0, 400.0), PointD(x + 200.0, 300.0));
+  }
+}
+
+static void prepareCircle(PathD& path)
+{
+  path.clear();
+  path.circle(CircleD(PointD(400.0, 300.0), 250.0));
+}
+
+static double runBench(const PathOnPath& effect, const PathD& glyphs, size_t* resultLength)
+{
+  PathD dst;
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+    effect.process(dst, glyphs);
+
+  double ms = (Time::now() - start).getMillisecondsD();
+
+  *resultLength = dst.getLength();
+  return ms > 0.0 ? double(BENCH_QUANTITY) * double(GLYPH_COUNT) * 1000.0 / ms : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  PathD glyphs, reversed, wave, circle;
+
+  prepareGlyphs(glyphs, false);
+  prepareGlyphs(reversed, true);
+  prepareWave(wave);
+  prepareCircle(circle);
+
+  PathOnPath onWave;
+  PathOnPath onCircle;
+
+  if (onWave.setPath(wave) != ERR_OK || onCircle.setPath(circle) != ERR_OK)
+  {
+    printf("Failed to set the guide path.\n");
+    return 1;
+  }
+
+  // Fit the whole line to the guide.
+  onWave.setBaseLength(double(GLYPH_COUNT * GLYPH_ADVANCE));
+  onCircle.setBaseLength(double(GLYPH_COUNT * GLYPH_ADVANCE));
+
+  printf("%-16s | %12s | %8s\n", "Guide", "Glyphs/s", "Length");
+
+  size_t length;
+  double glyphsPerSecond;
+
+  glyphsPerSecond = runBench(onWave, glyphs, &length);
+  printf("%-16s | %12.1f | %8d\n", "Wave", glyphsPerSecond, int(length));
+
+  glyphsPerSecond = runBench(onWave, reversed, &length);
+  printf("%-16s | %12.1f | %8d\n", "Wave (reversed)", glyphsPerSecond, int(length));
+
+  glyphsPerSecond = runBench(onCircle, glyphs, &length);
+  printf("%-16s | %12.1f | %8d\n", "Circle", glyphsPerSecond, int(length));
+
+  return 0;
+}
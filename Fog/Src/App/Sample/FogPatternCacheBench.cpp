@@ -0,0 +1,126 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogPatternCacheBench]
+// ============================================================================
+
+// Alternates two textured fills (and two gradient fills) thousands of times,
+// each fill sets its source and transform again. Recently used pattern
+// contexts are cached by the paint engine so only the first fill of each
+// source should create a pattern context. The result is in fills/s.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 640,
+  BENCH_HEIGHT = 480,
+  BENCH_QUANTITY = 20000,
+
+  TEXTURE_SIZE = 64
+};
+
+static void prepareTexture(Image& texture, uint32_t color0, uint32_t color1)
+{
+  Painter p(texture);
+
+  p.setSource(Argb32(color0));
+  p.fillAll();
+
+  p.setSource(Argb32(color1));
+  p.fillRect(RectI(0, 0, TEXTURE_SIZE / 2, TEXTURE_SIZE / 2));
+  p.fillRect(RectI(TEXTURE_SIZE / 2, TEXTURE_SIZE / 2, TEXTURE_SIZE / 2, TEXTURE_SIZE / 2));
+
+  p.end();
+}
+
+static double benchTextures(Image& image, const Image& tex0, const Image& tex1)
+{
+  Painter p(image);
+  p.setImageQuality(IMAGE_QUALITY_BILINEAR);
+
+  TransformD tr0 = TransformD::fromRotation(0.3);
+  TransformD tr1 = TransformD::fromScaling(1.5, 0.75);
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    int x = (i * 7) % (BENCH_WIDTH - 32);
+    int y = (i * 13) % (BENCH_HEIGHT - 32);
+
+    p.save();
+    p.setSource(Texture(tex0, TEXTURE_TILE_REPEAT), tr0);
+    p.fillRect(RectI(x, y, 32, 32));
+    p.restore();
+
+    p.save();
+    p.setSource(Texture(tex1, TEXTURE_TILE_REFLECT), tr1);
+    p.fillRect(RectI(x + 16, y, 32, 32));
+    p.restore();
+  }
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY * 2) * 1000.0 / ms : 0.0;
+}
+
+static double benchGradients(Image& image)
+{
+  Painter p(image);
+
+  LinearGradientF g0(PointF(0.0f, 0.0f), PointF(64.0f, 64.0f));
+  g0.addStop(0.0f, Argb32(0xFFFF0000));
+  g0.addStop(1.0f, Argb32(0xFF0000FF));
+
+  RadialGradientF g1(PointF(32.0f, 32.0f), PointF(32.0f, 32.0f), 32.0f);
+  g1.addStop(0.0f, Argb32(0xFFFFFFFF));
+  g1.addStop(1.0f, Argb32(0x00000000));
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    int x = (i * 7) % (BENCH_WIDTH - 32);
+    int y = (i * 13) % (BENCH_HEIGHT - 32);
+
+    p.setSource(g0);
+    p.fillRect(RectI(x, y, 32, 32));
+
+    p.setSource(g1);
+    p.fillRect(RectI(x + 16, y, 32, 32));
+  }
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY * 2) * 1000.0 / ms : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  Image image;
+  Image tex0;
+  Image tex1;
+
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK ||
+      tex0.create(SizeI(TEXTURE_SIZE, TEXTURE_SIZE), IMAGE_FORMAT_PRGB32) != ERR_OK ||
+      tex1.create(SizeI(TEXTURE_SIZE, TEXTURE_SIZE), IMAGE_FORMAT_XRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  prepareTexture(tex0, 0xFF2040A0, 0x80FFFFFF);
+  prepareTexture(tex1, 0xFF000000, 0xFFFFC000);
+
+  printf("%-10s | %12s\n", "Source", "Fills/s");
+  printf("%-10s | %12.1f\n", "Texture", benchTextures(image, tex0, tex1));
+  printf("%-10s | %12.1f\n", "Gradient", benchGradients(image));
+
+  return 0;
+}
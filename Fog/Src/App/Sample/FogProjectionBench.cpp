@@ -0,0 +1,222 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <math.h>
+#include <stdio.h>
+
+// ============================================================================
+// [FogProjectionBench]
+// ============================================================================
+
+// Fills the whole image by a texture transformed by a perspective transform
+// using all tile modes and both image qualities. The result is compared to a
+// reference computed per pixel in double precision and the maximum difference
+// of a color component is printed together with the throughput in MPix/s.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 640,
+  BENCH_HEIGHT = 480,
+  BENCH_QUANTITY = 50,
+
+  TEXTURE_SIZE = 64
+};
+
+struct TileInfo
+{
+  uint32_t tileType;
+  const char* name;
+};
+
+static const TileInfo tiles[] =
+{
+  { TEXTURE_TILE_PAD    , "Pad"     },
+  { TEXTURE_TILE_REPEAT , "Repeat"  },
+  { TEXTURE_TILE_REFLECT, "Reflect" },
+  { TEXTURE_TILE_CLAMP  , "Clamp"   }
+};
+
+static void prepareTexture(Image& texture)
+{
+  for (int y = 0; y < TEXTURE_SIZE; y++)
+  {
+    uint32_t* line = reinterpret_cast<uint32_t*>(texture.getFirstX() + y * texture.getStride());
+
+    for (int x = 0; x < TEXTURE_SIZE; x++)
+    {
+      uint32_t r = uint32_t(x * 4);
+      uint32_t g = uint32_t(y * 4);
+      uint32_t b = ((x ^ y) & 8) ? 0xFF : 0x00;
+      line[x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+    }
+  }
+}
+
+static int tileCoord(int c, int size, uint32_t tileType)
+{
+  switch (tileType)
+  {
+    case TEXTURE_TILE_PAD:
+      return c < 0 ? 0 : c >= size ? size - 1 : c;
+
+    case TEXTURE_TILE_REPEAT:
+      c %= size;
+      return c < 0 ? c + size : c;
+
+    case TEXTURE_TILE_REFLECT:
+      c %= size * 2;
+      if (c < 0) c += size * 2;
+      return c >= size ? size * 2 - 1 - c : c;
+
+    default:
+      return (c < 0 || c >= size) ? -1 : c;
+  }
+}
+
+static void fetchTexel(double* dst, const Image& texture, int x, int y, uint32_t tileType)
+{
+  x = tileCoord(x, TEXTURE_SIZE, tileType);
+  y = tileCoord(y, TEXTURE_SIZE, tileType);
+
+  // Clamp color is transparent.
+  if (x < 0 || y < 0)
+  {
+    dst[0] = dst[1] = dst[2] = dst[3] = 0.0;
+    return;
+  }
+
+  uint32_t pix = reinterpret_cast<const uint32_t*>(texture.getFirst() + y * texture.getStride())[x];
+  for (int i = 0; i < 4; i++)
+    dst[i] = double((pix >> (i * 8)) & 0xFF);
+}
+
+// Double precision reference of a single pixel.
+static uint32_t referencePixel(const Image& texture, const TransformD& inv,
+  int x, int y, uint32_t tileType, uint32_t quality)
+{
+  PointD pt(double(x) + 0.5, double(y) + 0.5);
+  inv.mapPoint(pt);
+
+  double c[4];
+
+  if (quality == IMAGE_QUALITY_NEAREST)
+  {
+    fetchTexel(c, texture, int(floor(pt.x)), int(floor(pt.y)), tileType);
+  }
+  else
+  {
+    double u = pt.x - 0.5;
+    double v = pt.y - 0.5;
+
+    int x0 = int(floor(u));
+    int y0 = int(floor(v));
+
+    double fx = u - double(x0);
+    double fy = v - double(y0);
+
+    double c00[4], c01[4], c10[4], c11[4];
+    fetchTexel(c00, texture, x0    , y0    , tileType);
+    fetchTexel(c01, texture, x0 + 1, y0    , tileType);
+    fetchTexel(c10, texture, x0    , y0 + 1, tileType);
+    fetchTexel(c11, texture, x0 + 1, y0 + 1, tileType);
+
+    for (int i = 0; i < 4; i++)
+    {
+      c[i] = (c00[i] * (1.0 - fx) + c01[i] * fx) * (1.0 - fy) +
+             (c10[i] * (1.0 - fx) + c11[i] * fx) * fy;
+    }
+  }
+
+  uint32_t result = 0;
+  for (int i = 0; i < 4; i++)
+    result |= uint32_t(int(c[i] + 0.5) & 0xFF) << (i * 8);
+  return result;
+}
+
+static int compareReference(const Image& image, const Image& texture, const TransformD& tr,
+  uint32_t tileType, uint32_t quality)
+{
+  TransformD inv = tr.inverted();
+  int maxDiff = 0;
+
+  for (int y = 0; y < BENCH_HEIGHT; y++)
+  {
+    const uint32_t* line = reinterpret_cast<const uint32_t*>(image.getFirst() + y * image.getStride());
+
+    for (int x = 0; x < BENCH_WIDTH; x++)
+    {
+      uint32_t a = line[x];
+      uint32_t b = referencePixel(texture, inv, x, y, tileType, quality);
+
+      for (int i = 0; i < 32; i += 8)
+      {
+        int diff = int((a >> i) & 0xFF) - int((b >> i) & 0xFF);
+        if (diff < 0) diff = -diff;
+        if (diff > maxDiff) maxDiff = diff;
+      }
+    }
+  }
+
+  return maxDiff;
+}
+
+static double runBench(Image& image, const Texture& texture, const TransformD& tr, uint32_t quality)
+{
+  Painter p(image);
+
+  p.setCompositingOperator(COMPOSITE_SRC);
+  p.setImageQuality(quality);
+  p.setSource(texture, tr);
+
+  Time start(Time::now());
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+    p.fillAll();
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_WIDTH) * double(BENCH_HEIGHT) * double(BENCH_QUANTITY) / (ms * 1000.0) : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  Image image;
+  Image texture;
+
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK ||
+      texture.create(SizeI(TEXTURE_SIZE, TEXTURE_SIZE), IMAGE_FORMAT_XRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  prepareTexture(texture);
+
+  // A texture tile mapped to a trapezoid (floor-like perspective), the horizon
+  // is above the image so the z coordinate never changes its sign.
+  TransformD tr = TransformD::fromQuadToQuad(
+    PointD(260.0, 120.0), PointD(380.0, 120.0), PointD(420.0, 220.0), PointD(220.0, 220.0),
+    RectD(0.0, 0.0, double(TEXTURE_SIZE), double(TEXTURE_SIZE)));
+
+  printf("%-8s | %-8s | %12s | %8s\n", "Tile", "Quality", "MPix/s", "MaxDiff");
+
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(tiles); i++)
+  {
+    for (uint32_t quality = IMAGE_QUALITY_NEAREST; quality <= IMAGE_QUALITY_BILINEAR; quality++)
+    {
+      Texture t(texture, tiles[i].tileType, Color(Argb32(0x00000000)));
+
+      double mpix = runBench(image, t, tr, quality);
+      int maxDiff = compareReference(image, texture, tr, tiles[i].tileType, quality);
+
+      printf("%-8s | %-8s | %12.2f | %8d\n",
+        tiles[i].name,
+        quality == IMAGE_QUALITY_NEAREST ? "Nearest" : "Bilinear",
+        mpix,
+        maxDiff);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,185 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogRTreeBench]
+// ============================================================================
+
+// Indexes 1k to 1M random boxes scattered around a 10000x10000 area by RTreeF
+// and measures bulk-loading (build), dynamic insertion, point, box and nearest
+// queries. The queries are compared with a linear scan of all boxes, which is
+// what the code without a spatial index does. The result is in entries/s for
+// build and insert and in queries/s for the others.
+
+using namespace Fog;
+
+enum
+{
+  QUERY_QUANTITY = 100000,
+  SCAN_BUDGET = 100000000
+};
+
+static uint32_t seed = 1;
+
+static float getRandom(float range)
+{
+  seed = seed * 1103515245U + 12345U;
+  return float((seed >> 8) & 0xFFFF) * (range / 65536.0f);
+}
+
+static void prepareItems(RTreeItemF* items, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    float x = getRandom(10000.0f);
+    float y = getRandom(10000.0f);
+    float w = getRandom(40.0f) + 1.0f;
+    float h = getRandom(40.0f) + 1.0f;
+
+    items[i].box.setBox(x, y, x + w, y + h);
+    items[i].data = (void*)(i + 1);
+  }
+}
+
+static void prepareQueries(PointF* pts, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    pts[i].set(getRandom(10000.0f), getRandom(10000.0f));
+}
+
+static double getPerSecond(size_t count, double ms)
+{
+  return ms > 0.0 ? double(count) * 1000.0 / ms : 0.0;
+}
+
+static size_t queryPoint(const RTreeF& tree, const PointF* pts, size_t count)
+{
+  size_t found = 0;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    for (RTreeIteratorF it(tree, pts[i]); it.isValid(); it.next())
+      found++;
+  }
+
+  return found;
+}
+
+static size_t queryBox(const RTreeF& tree, const PointF* pts, size_t count)
+{
+  size_t found = 0;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    BoxF box(pts[i].x, pts[i].y, pts[i].x + 100.0f, pts[i].y + 100.0f);
+
+    for (RTreeIteratorF it(tree, box); it.isValid(); it.next())
+      found++;
+  }
+
+  return found;
+}
+
+static size_t queryNearest(const RTreeF& tree, const PointF* pts, size_t count)
+{
+  size_t found = 0;
+  RTreeItemF item;
+
+  for (size_t i = 0; i < count; i++)
+    found += tree.findNearest(item, pts[i]);
+
+  return found;
+}
+
+static size_t scanPoint(const RTreeItemF* items, size_t length, const PointF* pts, size_t count)
+{
+  size_t found = 0;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    for (size_t j = 0; j < length; j++)
+      found += items[j].box.hitTest(pts[i]);
+  }
+
+  return found;
+}
+
+static void benchCount(size_t length)
+{
+  RTreeItemF* items = reinterpret_cast<RTreeItemF*>(MemMgr::alloc(length * sizeof(RTreeItemF)));
+  PointF* pts = reinterpret_cast<PointF*>(MemMgr::alloc(QUERY_QUANTITY * sizeof(PointF)));
+
+  if (items == NULL || pts == NULL)
+  {
+    MemMgr::free(items);
+    MemMgr::free(pts);
+    return;
+  }
+
+  prepareItems(items, length);
+  prepareQueries(pts, QUERY_QUANTITY);
+
+  RTreeF bulk;
+  RTreeF dynamic;
+
+  Time start(Time::now());
+  bulk.build(items, length);
+  double rBuild = getPerSecond(length, (Time::now() - start).getMillisecondsD());
+
+  start = Time::now();
+  for (size_t i = 0; i < length; i++)
+    dynamic.insert(items[i].box, items[i].data);
+  double rInsert = getPerSecond(length, (Time::now() - start).getMillisecondsD());
+
+  printf("%8d | %-7s | %12.0f | %12.0f | %12s | %12s | %12s | %8s\n",
+    int(length), "Build", rBuild, rInsert, "", "", "", "");
+
+  const RTreeF* trees[] = { &bulk, &dynamic };
+  static const char* treeNames[] = { "Bulk", "Dynamic" };
+
+  for (size_t t = 0; t < FOG_ARRAY_SIZE(trees); t++)
+  {
+    start = Time::now();
+    size_t nPoint = queryPoint(*trees[t], pts, QUERY_QUANTITY);
+    double rPoint = getPerSecond(QUERY_QUANTITY, (Time::now() - start).getMillisecondsD());
+
+    start = Time::now();
+    queryBox(*trees[t], pts, QUERY_QUANTITY);
+    double rBox = getPerSecond(QUERY_QUANTITY, (Time::now() - start).getMillisecondsD());
+
+    start = Time::now();
+    queryNearest(*trees[t], pts, QUERY_QUANTITY);
+    double rNearest = getPerSecond(QUERY_QUANTITY, (Time::now() - start).getMillisecondsD());
+
+    printf("%8d | %-7s | %12s | %12s | %12.0f | %12.0f | %12.0f | %8d\n",
+      int(length), treeNames[t], "", "", rPoint, rBox, rNearest, int(nPoint));
+  }
+
+  // The linear scan is limited to keep the run short for large counts.
+  size_t scanCount = Math::max<size_t>(Math::min<size_t>(SCAN_BUDGET / length, QUERY_QUANTITY), 1);
+
+  start = Time::now();
+  size_t nScan = scanPoint(items, length, pts, scanCount);
+  double rScan = getPerSecond(scanCount, (Time::now() - start).getMillisecondsD());
+
+  printf("%8d | %-7s | %12s | %12s | %12.0f | %12s | %12s | %8d\n",
+    int(length), "Scan", "", "", rScan, "", "", int(nScan));
+
+  MemMgr::free(items);
+  MemMgr::free(pts);
+}
+
+int main(int argc, char* argv[])
+{
+  static const size_t counts[] = { 1000, 10000, 100000, 1000000 };
+
+  printf("%8s | %-7s | %12s | %12s | %12s | %12s | %12s | %8s\n",
+    "Entries", "Index", "Build/s", "Insert/s", "Point/s", "Box/s", "Nearest/s", "Found");
+
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(counts); i++)
+    benchCount(counts[i]);
+
+  return 0;
+}
@@ -0,0 +1,482 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+// Reduce is not exported by Fog, Reduce.cpp is compiled into this sample.
+#include <Fog/G2d/Tools/Reduce_p.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// ============================================================================
+// [FogReduceBench]
+// ============================================================================
+
+// Compares Reduce (RGB cube and exact-match table) with the previous version
+// of the algorithm (color to index hash), which is kept here as RefReduce.
+// Both are run on the same images - all formats supported by Reduce, color
+// counts around the 256 colors limit, colors sharing the same cell of the
+// cube or differing only in alpha, both with and without discarding the alpha
+// channel. The histograms, palettes and translated indexes must be the same,
+// only the order of equally used colors may differ (the sort isn't stable).
+//
+// After the check the time of analyze() followed by traslate() of each pixel
+// of a 1024x1024 image is measured for both.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_SIZE = 1024,
+  BENCH_QUANTITY = 5,
+
+  CHECK_PROBES = 20000
+};
+
+static uint32_t seed = 1;
+
+static uint32_t rnd()
+{
+  seed = seed * 1103515245U + 12345U;
+  return (seed >> 1) ^ (seed << 17);
+}
+
+// ============================================================================
+// [RefReduce]
+// ============================================================================
+
+// The previous Reduce, the color to index hash is replaced by a sorted array
+// of keys, because only lookups by key are needed.
+struct RefReduce
+{
+  bool analyze(const Image& image, bool discardAlphaChannel = false);
+  uint32_t traslate(uint32_t key) const;
+
+  // Get the index of key in keys[] or the index where it should be inserted.
+  uint32_t find(uint32_t key) const
+  {
+    uint32_t lo = 0;
+    uint32_t hi = keyCount;
+
+    while (lo < hi)
+    {
+      uint32_t mid = (lo + hi) / 2;
+      if (keys[mid] < key)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+    return lo;
+  }
+
+  Reduce::Entity entities[256];
+  Argb32 palette[256];
+
+  uint32_t count;
+  uint32_t mask;
+
+  uint32_t keys[256];
+  uint64_t usage[256];
+  uint8_t indexes[256];
+  uint32_t keyCount;
+};
+
+static int RefReduce_compareAscent(const void* _a, const void* _b)
+{
+  const Reduce::Entity* a = (const Reduce::Entity *)_a;
+  const Reduce::Entity* b = (const Reduce::Entity *)_b;
+
+  if (a->usage < b->usage)
+    return -1;
+  else if (a->usage > b->usage)
+    return 1;
+  else
+    return 0;
+}
+
+bool RefReduce::analyze(const Image& image, bool discardAlphaChannel)
+{
+  int w = image.getWidth();
+  int h = image.getHeight();
+  int bpp = image.getBytesPerPixel();
+
+  count = 0;
+  mask = 0xFFFFFFFF;
+  keyCount = 0;
+
+  Reduce::Entity* e = entities;
+
+  switch (image.getDepth())
+  {
+    case 8:
+    {
+      for (uint32_t i = 0; i < 256; i++)
+      {
+        e[i].key = i;
+        e[i].usage = 0;
+      }
+
+      for (int y = 0; y < h; y++)
+      {
+        const uint8_t* p = image.getScanline(y);
+        for (int x = 0; x < w; x++)
+          e[p[x]].usage++;
+      }
+
+      for (uint32_t i = 0; i < 256; i++)
+      {
+        if (e[i].usage != 0)
+          e[count++] = e[i];
+      }
+
+      mask = 0xFF;
+      break;
+    }
+
+    case 24:
+    case 32:
+    {
+      uint32_t m = image.getFormatDescription().getUsedBits32();
+      if (discardAlphaChannel)
+        m ^= image.getFormatDescription().getAMask32();
+
+      for (int y = 0; y < h; y++)
+      {
+        const uint8_t* p = image.getScanline(y);
+
+        for (int x = 0; x < w; x++, p += bpp)
+        {
+          uint32_t c;
+
+          if (bpp == 4)
+            c = reinterpret_cast<const uint32_t*>(p)[0];
+          else
+            c = uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16);
+          c &= m;
+
+          uint32_t i = find(c);
+          if (i < keyCount && keys[i] == c)
+          {
+            usage[i]++;
+            continue;
+          }
+
+          if (keyCount == 256)
+            return false;
+
+          for (uint32_t j = keyCount; j > i; j--)
+          {
+            keys[j] = keys[j - 1];
+            usage[j] = usage[j - 1];
+          }
+
+          keys[i] = c;
+          usage[i] = 1;
+          keyCount++;
+        }
+      }
+
+      for (uint32_t i = 0; i < keyCount; i++)
+      {
+        e[i].key = keys[i];
+        e[i].usage = usage[i];
+      }
+
+      count = keyCount;
+      mask = m;
+      break;
+    }
+
+    default:
+      return false;
+  }
+
+  qsort(e, count, sizeof(Reduce::Entity), RefReduce_compareAscent);
+
+  // Fix the B&W images, it's usual that black color is at [0].
+  if (count == 2 && e[1].key == 0)
+  {
+    Reduce::Entity t = e[0];
+    e[0] = e[1];
+    e[1] = t;
+  }
+
+  // Index of each key.
+  keyCount = 0;
+  for (uint32_t i = 0; i < count; i++)
+  {
+    uint32_t k = find(e[i].key);
+
+    for (uint32_t j = keyCount; j > k; j--)
+    {
+      keys[j] = keys[j - 1];
+      indexes[j] = indexes[j - 1];
+    }
+
+    keys[k] = e[i].key;
+    indexes[k] = uint8_t(i);
+    keyCount++;
+  }
+
+  switch (image.getFormat())
+  {
+    case IMAGE_FORMAT_PRGB32:
+      if (!discardAlphaChannel)
+      {
+        for (uint32_t i = 0; i < count; i++)
+          palette[i] = e[i].key;
+        break;
+      }
+      // ... Fall through ...
+
+    case IMAGE_FORMAT_XRGB32:
+    case IMAGE_FORMAT_RGB24:
+      for (uint32_t i = 0; i < count; i++)
+        palette[i] = e[i].key | 0xFF000000;
+      break;
+
+    case IMAGE_FORMAT_A8:
+      for (uint32_t i = 0; i < count; i++)
+        palette[i] = e[i].key * 0x01010101;
+      break;
+
+    case IMAGE_FORMAT_I8:
+    {
+      const Argb32* srcPal = image.getPalette().getData();
+
+      for (uint32_t i = 0; i < count; i++)
+        palette[i] = srcPal[e[i].key];
+      break;
+    }
+
+    default:
+      return false;
+  }
+
+  return true;
+}
+
+uint32_t RefReduce::traslate(uint32_t key) const
+{
+  uint32_t i = find(key);
+  return (i < keyCount && keys[i] == key) ? indexes[i] : 255;
+}
+
+// ============================================================================
+// [Check]
+// ============================================================================
+
+static bool createImage(Image& image, int w, int h, uint32_t format, uint32_t colors, uint32_t colorMask, int runs)
+{
+  if (image.create(SizeI(w, h), format) != ERR_OK)
+    return false;
+
+  if (format == IMAGE_FORMAT_I8 && image.setPalette(ImagePalette::fromGreyscale(256)) != ERR_OK)
+    return false;
+
+  uint32_t palette[1000];
+  for (uint32_t i = 0; i < colors; i++)
+    palette[i] = rnd() & colorMask;
+
+  int bpp = image.getBytesPerPixel();
+  uint32_t c = palette[0];
+
+  for (int y = 0; y < h; y++)
+  {
+    uint8_t* p = image.getScanlineX(y);
+
+    for (int x = 0; x < w; x++, p += bpp)
+    {
+      if (runs == 0 || rnd() % runs == 0)
+        c = palette[rnd() % colors];
+
+      if (bpp == 4)
+      {
+        reinterpret_cast<uint32_t*>(p)[0] = c;
+      }
+      else if (bpp == 3)
+      {
+        p[0] = uint8_t(c);
+        p[1] = uint8_t(c >> 8);
+        p[2] = uint8_t(c >> 16);
+      }
+      else
+      {
+        p[0] = uint8_t(c);
+      }
+    }
+  }
+
+  return true;
+}
+
+static bool compare(const Image& image, bool discardAlphaChannel)
+{
+  Reduce r;
+  RefReduce ref;
+
+  bool ok = r.analyze(image, discardAlphaChannel);
+  bool refOk = ref.analyze(image, discardAlphaChannel);
+
+  if (ok != refOk)
+    return false;
+
+  if (!ok)
+    return true;
+
+  uint32_t count = r.getCount();
+  if (count != ref.count || r.getMask() != ref.mask || r.getPalette().getLength() != count)
+    return false;
+
+  const Reduce::Entity* e = r.getEntities();
+  const Argb32* pal = r.getPalette().getData();
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    // Entities are sorted by usage, the order of keys may differ only if
+    // their usage is the same.
+    if (e[i].usage != ref.entities[i].usage)
+      return false;
+
+    // Each key must be in both histograms with the same usage and color.
+    uint32_t j = ref.traslate(e[i].key);
+    if (j == 255 && count <= 255)
+      return false;
+
+    if (ref.entities[j].key != e[i].key || ref.entities[j].usage != e[i].usage)
+      return false;
+
+    if (pal[i].u32 != ref.palette[j].u32)
+      return false;
+
+    if (r.traslate(e[i].key) != i)
+      return false;
+  }
+
+  // Random keys, most of them are not in the palette.
+  uint32_t mask = r.getMask();
+  for (uint32_t i = 0; i < CHECK_PROBES; i++)
+  {
+    uint32_t key = (i & 1) ? (rnd() & mask) : (e[rnd() % count].key ^ (rnd() & 0x01010101 & mask));
+
+    // Index 255 is returned also for unknown keys.
+    uint32_t b = ref.traslate(key);
+    bool known = b != 255 || (count == 256 && ref.entities[255].key == key);
+
+    uint32_t a = r.traslate(key);
+    if (known ? (e[a].key != key) : (a != 255))
+      return false;
+  }
+
+  return true;
+}
+
+static bool checkReduce()
+{
+  static const uint32_t formats[] =
+  {
+    IMAGE_FORMAT_PRGB32, IMAGE_FORMAT_XRGB32, IMAGE_FORMAT_RGB24, IMAGE_FORMAT_A8, IMAGE_FORMAT_I8
+  };
+
+  static const uint32_t colorCounts[] = { 1, 2, 3, 16, 17, 100, 200, 255, 256, 257, 1000 };
+  static const int sizes[][2] = { { 1, 1 }, { 3, 7 }, { 17, 13 }, { 64, 64 }, { 333, 101 } };
+
+  // The full range, colors sharing cells of the cube, colors which differ
+  // in alpha and in the low bits only.
+  static const uint32_t colorMasks[] = { 0xFFFFFFFF, 0x03030303, 0x80FFC0C0 };
+
+  int tests = 0;
+  int failures = 0;
+
+  for (size_t f = 0; f < FOG_ARRAY_SIZE(formats); f++)
+  for (size_t c = 0; c < FOG_ARRAY_SIZE(colorCounts); c++)
+  for (size_t s = 0; s < FOG_ARRAY_SIZE(sizes); s++)
+  for (size_t m = 0; m < FOG_ARRAY_SIZE(colorMasks); m++)
+  for (int runs = 0; runs < 3; runs++)
+  {
+    Image image;
+    if (!createImage(image, sizes[s][0], sizes[s][1], formats[f], colorCounts[c], colorMasks[m], runs * 20))
+    {
+      printf("Out of memory.\n");
+      return false;
+    }
+
+    for (int discard = 0; discard < 2; discard++)
+    {
+      tests++;
+
+      if (!compare(image, discard != 0))
+      {
+        printf("Reduce check failed: format=%u colors=%u size=%dx%d mask=%08X runs=%d discard=%d.\n",
+          formats[f], colorCounts[c], sizes[s][0], sizes[s][1], colorMasks[m], runs * 20, discard);
+        failures++;
+      }
+    }
+  }
+
+  printf("Reduce check: %d tests, %d failures.\n", tests, failures);
+  return failures == 0;
+}
+
+// ============================================================================
+// [Bench]
+// ============================================================================
+
+template<typename ReduceT>
+static double runBench(const Image& image, uint32_t* sink)
+{
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    ReduceT r;
+    r.analyze(image);
+
+    for (int y = 0; y < BENCH_SIZE; y++)
+    {
+      const uint32_t* p = reinterpret_cast<const uint32_t*>(image.getScanline(y));
+      for (int x = 0; x < BENCH_SIZE; x++)
+        *sink += r.traslate(p[x] & 0x00FFFFFF);
+    }
+  }
+
+  return (Time::now() - start).getMillisecondsD() / double(BENCH_QUANTITY);
+}
+
+int main(int argc, char* argv[])
+{
+  if (!checkReduce())
+    return 1;
+
+  static const struct
+  {
+    const char* name;
+    uint32_t colors;
+    int runs;
+  } cases[] =
+  {
+    { "256 colors", 256, 0 },
+    { "64 colors, runs", 64, 200 },
+    { "2 colors", 2, 0 }
+  };
+
+  printf("%-16s | %12s | %12s\n", "Image", "Previous [ms]", "Reduce [ms]");
+
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(cases); i++)
+  {
+    Image image;
+    if (!createImage(image, BENCH_SIZE, BENCH_SIZE, IMAGE_FORMAT_XRGB32, cases[i].colors, 0x00FFFFFF, cases[i].runs))
+    {
+      printf("Out of memory.\n");
+      return 1;
+    }
+
+    uint32_t sink = 0;
+    double refTime = runBench<RefReduce>(image, &sink);
+    double newTime = runBench<Reduce>(image, &sink);
+
+    printf("%-16s | %12.2f | %12.2f\n", cases[i].name, refTime, newTime);
+  }
+
+  return 0;
+}
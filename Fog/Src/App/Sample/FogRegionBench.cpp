@@ -0,0 +1,109 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogRegionBench]
+// ============================================================================
+
+// Fills regions containing 10 to 10000 rectangles using fillRegion() and
+// then fills a grid of small rectangles clipped by the same regions. Regions
+// are filled directly from their bands and rectangles completely inside a
+// single clip-box use the clip-box fast-path. The result is in fills/s.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 1024,
+  BENCH_HEIGHT = 1024,
+  BENCH_QUANTITY = 200
+};
+
+static void prepareRegion(Region& region, int count)
+{
+  region.clear();
+
+  uint32_t seed = uint32_t(count);
+  for (int i = 0; i < count; i++)
+  {
+    seed = seed * 1103515245U + 12345U;
+    int x = int((seed >> 8) % (BENCH_WIDTH - 16));
+    seed = seed * 1103515245U + 12345U;
+    int y = int((seed >> 8) % (BENCH_HEIGHT - 16));
+    seed = seed * 1103515245U + 12345U;
+    int w = 4 + int((seed >> 8) % 12);
+    int h = 4 + int((seed >> 16) % 12);
+
+    region.union_(BoxI(x, y, x + w, y + h));
+  }
+}
+
+static double benchFill(Image& image, const Region& region, bool opaque)
+{
+  Painter p(image);
+  p.setSource(Argb32(opaque ? 0xFF2040A0 : 0x802040A0));
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+    p.fillRegion(region);
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+static double benchClip(Image& image, const Region& region)
+{
+  Painter p(image);
+  p.setSource(Argb32(0xFFA04020));
+  p.clipRegion(CLIP_OP_REPLACE, region);
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    for (int y = 0; y < BENCH_HEIGHT; y += 64)
+    {
+      for (int x = 0; x < BENCH_WIDTH; x += 64)
+        p.fillRect(RectI(x + (i & 7), y + (i & 7), 8, 8));
+    }
+  }
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  static const int counts[] = { 10, 100, 1000, 10000 };
+
+  Image image;
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  printf("%-6s | %6s | %12s | %12s | %12s\n", "Rects", "Boxes", "Solid", "Opacity", "Clipped");
+
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(counts); i++)
+  {
+    Region region;
+    prepareRegion(region, counts[i]);
+
+    double solid = benchFill(image, region, true);
+    double alpha = benchFill(image, region, false);
+    double clipped = benchClip(image, region);
+
+    printf("%-6d | %6d | %12.1f | %12.1f | %12.1f\n",
+      counts[i], int(region.getLength()), solid, alpha, clipped);
+  }
+
+  return 0;
+}
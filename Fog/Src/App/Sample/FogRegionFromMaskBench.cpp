@@ -0,0 +1,149 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogRegionFromMaskBench]
+// ============================================================================
+
+// Converts a 3840x2160 A8 mask into a region using Region::fromMask() and
+// compares it with the region built by adding the runs of each scanline by
+// Region::union_(). The mask contains a few large ellipses (long runs and
+// many identical scanlines) and a noise pattern (short runs). The same shapes
+// are also converted by Region::fromPath(). The result is in conversions/s.
+
+using namespace Fog;
+
+enum
+{
+  MASK_WIDTH = 3840,
+  MASK_HEIGHT = 2160,
+
+  BENCH_QUANTITY = 20,
+  BENCH_QUANTITY_UNION = 2
+};
+
+static void prepareShapes(PathD& path)
+{
+  path.clear();
+
+  path.ellipse(EllipseD(PointD(1000.0,  800.0), PointD(700.0, 500.0)));
+  path.ellipse(EllipseD(PointD(2600.0, 1100.0), PointD(900.0, 800.0)));
+  path.rect(RectD(200.0, 1500.0, 3400.0, 400.0));
+}
+
+static void prepareMask(Image& mask, const PathD& path, bool noise)
+{
+  mask.create(SizeI(MASK_WIDTH, MASK_HEIGHT), IMAGE_FORMAT_A8);
+  mask.clear(Argb32(0x00000000));
+
+  Painter p(mask);
+  p.setSource(Argb32(0xFFFFFFFF));
+  p.fillPath(path);
+  p.end();
+
+  if (!noise)
+    return;
+
+  uint8_t* pixels = mask.getFirstX();
+  ssize_t stride = mask.getStride();
+  uint32_t seed = 1;
+
+  for (int y = 0; y < MASK_HEIGHT; y++, pixels += stride)
+  {
+    for (int x = 0; x < MASK_WIDTH; x += 8)
+    {
+      seed = seed * 1103515245U + 12345U;
+      if ((seed >> 28) == 0)
+        pixels[x] = 0xFF;
+    }
+  }
+}
+
+static double getConversionsPerSecond(double ms, int quantity)
+{
+  return ms > 0.0 ? double(quantity) * 1000.0 / ms : 0.0;
+}
+
+static double benchFromMask(Region& region, const ImageBits& bits)
+{
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+    region.fromMask(bits);
+
+  return getConversionsPerSecond((Time::now() - start).getMillisecondsD(), BENCH_QUANTITY);
+}
+
+static double benchUnion(Region& region, const ImageBits& bits)
+{
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY_UNION; i++)
+  {
+    const uint8_t* row = bits.getData();
+    region.clear();
+
+    for (int y = 0; y < MASK_HEIGHT; y++, row += bits.getStride())
+    {
+      int x = 0;
+      while (x < MASK_WIDTH)
+      {
+        while (x < MASK_WIDTH && row[x] < 0x80) x++;
+        if (x == MASK_WIDTH) break;
+
+        int x0 = x;
+        while (x < MASK_WIDTH && row[x] >= 0x80) x++;
+
+        region.union_(BoxI(x0, y, x, y + 1));
+      }
+    }
+  }
+
+  return getConversionsPerSecond((Time::now() - start).getMillisecondsD(), BENCH_QUANTITY_UNION);
+}
+
+static double benchFromPath(Region& region, const PathD& path)
+{
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+    region.fromPath(path, FILL_RULE_NON_ZERO);
+
+  return getConversionsPerSecond((Time::now() - start).getMillisecondsD(), BENCH_QUANTITY);
+}
+
+int main(int argc, char* argv[])
+{
+  PathD path;
+  prepareShapes(path);
+
+  printf("%-8s | %-10s | %12s | %8s | %5s\n", "Mask", "Method", "Conv/s", "Boxes", "Same");
+
+  for (int noise = 0; noise < 2; noise++)
+  {
+    const char* maskName = noise ? "Noise" : "Shapes";
+
+    Image mask;
+    prepareMask(mask, path, noise != 0);
+
+    ImageBits bits(mask.getSize(), mask.getFormat(), mask.getStride(), mask.getFirstX());
+
+    Region a;
+    Region b;
+    double r;
+
+    r = benchFromMask(a, bits);
+    printf("%-8s | %-10s | %12.2f | %8d | %5s\n", maskName, "FromMask", r, int(a.getLength()), "-");
+
+    r = benchUnion(b, bits);
+    printf("%-8s | %-10s | %12.2f | %8d | %5s\n", maskName, "Union", r, int(b.getLength()), a == b ? "Yes" : "No");
+  }
+
+  Region region;
+  double r = benchFromPath(region, path);
+  printf("%-8s | %-10s | %12.2f | %8d | %5s\n", "Path", "FromPath", r, int(region.getLength()), "-");
+
+  return 0;
+}
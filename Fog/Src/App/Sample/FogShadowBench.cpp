@@ -0,0 +1,113 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogShadowBench]
+// ============================================================================
+
+// Paints rounded rectangles with a drop-shadow using fillShapeWithShadow(),
+// which blurs only an A8 buffer covering the shadow, and using a PRGB32 layer
+// of the canvas size, which is blurred as a whole by filterAll() and blitted.
+// The result is in shapes/s for several blur radii.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_WIDTH = 640,
+  BENCH_HEIGHT = 480,
+  BENCH_QUANTITY = 200
+};
+
+static RoundF getRound(int i)
+{
+  float x = float((i * 37) % (BENCH_WIDTH - 120));
+  float y = float((i * 53) % (BENCH_HEIGHT - 80));
+
+  return RoundF(x, y, 96.0f, 56.0f, 8.0f);
+}
+
+static double benchShadow(Image& image, float radius)
+{
+  Painter p(image);
+  p.setSource(Argb32(0xFFF0F0F0));
+
+  PointF offset(4.0f, 4.0f);
+  Color shadowColor(Argb32(0x80000000));
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    RoundF round = getRound(i);
+    p.fillShapeWithShadow(ShapeF(&round), offset, radius, shadowColor);
+  }
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+static double benchLayer(Image& image, float radius)
+{
+  Image layer;
+  if (layer.create(image.getSize(), IMAGE_FORMAT_PRGB32) != ERR_OK)
+    return 0.0;
+
+  Painter p(image);
+  FeBlur blur(FE_BLUR_TYPE_STACK, radius);
+
+  Time start(Time::now());
+
+  for (int i = 0; i < BENCH_QUANTITY; i++)
+  {
+    RoundF round = getRound(i);
+
+    layer.clear(Argb32(0x00000000));
+    {
+      Painter lp(layer);
+      lp.setSource(Argb32(0x80000000));
+      lp.fillRound(RoundF(round.rect.x + 4.0f, round.rect.y + 4.0f, round.rect.w, round.rect.h, 8.0f));
+      lp.filterAll(blur);
+      lp.end();
+    }
+    p.blitImage(PointI(0, 0), layer);
+
+    p.setSource(Argb32(0xFFF0F0F0));
+    p.fillRound(round);
+  }
+
+  p.end();
+
+  double ms = (Time::now() - start).getMillisecondsD();
+  return ms > 0.0 ? double(BENCH_QUANTITY) * 1000.0 / ms : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  Image image;
+  if (image.create(SizeI(BENCH_WIDTH, BENCH_HEIGHT), IMAGE_FORMAT_PRGB32) != ERR_OK)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  static const float radii[] = { 2.0f, 8.0f, 24.0f };
+
+  printf("%-8s | %12s | %12s\n", "Radius", "Shadow", "Layer");
+  for (size_t i = 0; i < FOG_ARRAY_SIZE(radii); i++)
+  {
+    image.clear(Argb32(0xFF4080C0));
+    double shadowRate = benchShadow(image, radii[i]);
+
+    image.clear(Argb32(0xFF4080C0));
+    double layerRate = benchLayer(image, radii[i]);
+
+    printf("%-8.1f | %12.1f | %12.1f\n", radii[i], shadowRate, layerRate);
+  }
+
+  return 0;
+}
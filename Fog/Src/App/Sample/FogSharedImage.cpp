@@ -0,0 +1,133 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// ============================================================================
+// [FogSharedImage]
+// ============================================================================
+
+// Producer / consumer sample using Fog::IMAGE_TYPE_SHARED. The parent process
+// renders into a shared image and exports it, the child process imports the
+// file descriptor, verifies the pixels and writes its answer to the last
+// scanline. Neither side copies the pixel data.
+
+using namespace Fog;
+
+static uint32_t getPattern(int x, int y)
+{
+  return 0xFF000000U | ((uint32_t)(x & 0xFF) << 16) | ((uint32_t)(y & 0xFF) << 8) | (uint32_t)((x ^ y) & 0xFF);
+}
+
+static int runConsumer(const ImageSharedInfo& info)
+{
+  Image image;
+  err_t err = image.importShared(info);
+
+  if (err != ERR_OK)
+  {
+    printf("Consumer: importShared() failed (error=%u).\n", err);
+    return 1;
+  }
+
+  int w = image.getWidth();
+  int h = image.getHeight();
+
+  for (int y = 0; y < h - 1; y++)
+  {
+    const uint32_t* p = reinterpret_cast<const uint32_t*>(image.getScanline(y));
+    for (int x = 0; x < w; x++)
+    {
+      if (p[x] != getPattern(x, y))
+      {
+        printf("Consumer: Pixel mismatch at [%d, %d].\n", x, y);
+        return 1;
+      }
+    }
+  }
+
+  // Answer, visible to the producer through the same memory.
+  uint32_t* last = reinterpret_cast<uint32_t*>(image.getFirstX() + (ssize_t)(h - 1) * image.getStride());
+  for (int x = 0; x < w; x++)
+    last[x] = ~getPattern(x, h - 1);
+
+  printf("Consumer: %dx%d image verified.\n", w, h);
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  Image image;
+  err_t err = image.create(SizeI(256, 256), IMAGE_FORMAT_PRGB32, IMAGE_TYPE_SHARED);
+
+  if (err != ERR_OK)
+  {
+    printf("Producer: create() failed (error=%u).\n", err);
+    return 1;
+  }
+
+  int w = image.getWidth();
+  int h = image.getHeight();
+
+  uint8_t* pixels = image.getFirstX();
+  ssize_t stride = image.getStride();
+
+  for (int y = 0; y < h; y++)
+  {
+    uint32_t* p = reinterpret_cast<uint32_t*>(pixels + (ssize_t)y * stride);
+    for (int x = 0; x < w; x++)
+      p[x] = getPattern(x, y);
+  }
+
+  ImageSharedInfo info;
+  err = image.exportShared(info, IMAGE_SHARED_SEAL);
+
+  // Sealing is available only for memfd, try again without it.
+  if (err != ERR_OK)
+    err = image.exportShared(info);
+
+  if (err != ERR_OK)
+  {
+    printf("Producer: exportShared() failed (error=%u).\n", err);
+    return 1;
+  }
+
+  pid_t pid = ::fork();
+  if (pid == -1)
+  {
+    printf("Producer: fork() failed.\n");
+    return 1;
+  }
+
+  if (pid == 0)
+  {
+    // Drop the inherited image, the consumer must use only the descriptor.
+    image.reset();
+    ::_exit(runConsumer(info));
+  }
+
+  ::close(info.getFd());
+
+  int status;
+  if (::waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+  {
+    printf("Producer: Consumer failed.\n");
+    return 1;
+  }
+
+  const uint32_t* last = reinterpret_cast<const uint32_t*>(image.getScanline(h - 1));
+  for (int x = 0; x < w; x++)
+  {
+    if (last[x] != ~getPattern(x, h - 1))
+    {
+      printf("Producer: Consumer's answer doesn't match at [%d].\n", x);
+      return 1;
+    }
+  }
+
+  printf("Producer: Consumer's answer verified.\n");
+  return 0;
+}
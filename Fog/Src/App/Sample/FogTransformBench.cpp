@@ -0,0 +1,158 @@
+#include <Fog/Core.h>
+#include <Fog/G2d.h>
+
+#include <stdio.h>
+
+// ============================================================================
+// [FogTransformBench]
+// ============================================================================
+
+// Maps 100000 points by each transform type (float, float to double, and
+// double) using Transform::mapPoints() and Transform::mapPointsAndBox(). The
+// functions are dispatched through the same API tables as in the rest of the
+// library, so the result reflects the best kernel available for the CPU
+// (C, SSE, SSE2 or AVX2). The result is in millions of points/s.
+
+using namespace Fog;
+
+enum
+{
+  BENCH_QUANTITY = 200,
+  POINT_COUNT = 100000
+};
+
+static const char* typeNames[] =
+{
+  "Identity",
+  "Translation",
+  "Scaling",
+  "Swap",
+  "Rotation",
+  "Affine",
+  "Projection"
+};
+
+static void prepareTransform(TransformD& tr, uint32_t type)
+{
+  tr.reset();
+
+  switch (type)
+  {
+    case TRANSFORM_TYPE_IDENTITY:
+      break;
+
+    case TRANSFORM_TYPE_TRANSLATION:
+      tr.translate(PointD(10.0, 20.0));
+      break;
+
+    case TRANSFORM_TYPE_SCALING:
+      tr.translate(PointD(10.0, 20.0));
+      tr.scale(PointD(1.5, 2.5));
+      break;
+
+    case TRANSFORM_TYPE_SWAP:
+      tr.setData(0.0, 2.0, 3.0, 0.0, 10.0, 20.0);
+      break;
+
+    case TRANSFORM_TYPE_ROTATION:
+      tr.translate(PointD(10.0, 20.0));
+      tr.rotate(0.5);
+      break;
+
+    case TRANSFORM_TYPE_AFFINE:
+      tr.translate(PointD(10.0, 20.0));
+      tr.rotate(0.5);
+      tr.scale(PointD(1.5, 2.5));
+      break;
+
+    case TRANSFORM_TYPE_PROJECTION:
+      tr.setData(1.0, 0.1, 0.001, 0.2, 1.0, 0.002, 10.0, 20.0, 1.0);
+      break;
+  }
+}
+
+static double getMPointsPerSecond(double ms)
+{
+  return ms > 0.0 ? double(BENCH_QUANTITY) * double(POINT_COUNT) / (ms * 1000.0) : 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+  PointF* srcF = static_cast<PointF*>(MemMgr::alloc(POINT_COUNT * sizeof(PointF)));
+  PointD* srcD = static_cast<PointD*>(MemMgr::alloc(POINT_COUNT * sizeof(PointD)));
+  PointF* dstF = static_cast<PointF*>(MemMgr::alloc(POINT_COUNT * sizeof(PointF)));
+  PointD* dstD = static_cast<PointD*>(MemMgr::alloc(POINT_COUNT * sizeof(PointD)));
+
+  if (srcF == NULL || srcD == NULL || dstF == NULL || dstD == NULL)
+  {
+    printf("Out of memory.\n");
+    return 1;
+  }
+
+  for (int i = 0; i < POINT_COUNT; i++)
+  {
+    double x = double(i % 1000) * 0.5;
+    double y = double(i / 1000) * 0.5;
+
+    srcF[i].set(float(x), float(y));
+    srcD[i].set(x, y);
+  }
+
+  printf("%-12s | %10s | %10s | %10s | %10s | %10s\n",
+    "Type", "F", "F->D", "D", "F+Box", "D+Box");
+
+  for (uint32_t type = 0; type < FOG_ARRAY_SIZE(typeNames); type++)
+  {
+    TransformD trD;
+    prepareTransform(trD, type);
+
+    TransformF trF(trD);
+
+    if (trD.getType() != type)
+    {
+      printf("%-12s | Unexpected transform type %u.\n", typeNames[type], trD.getType());
+      continue;
+    }
+
+    double result[5];
+    BoxF boxF;
+    BoxD boxD;
+    Time start;
+    int i;
+
+    start = Time::now();
+    for (i = 0; i < BENCH_QUANTITY; i++)
+      trF.mapPoints(dstF, srcF, POINT_COUNT);
+    result[0] = getMPointsPerSecond((Time::now() - start).getMillisecondsD());
+
+    start = Time::now();
+    for (i = 0; i < BENCH_QUANTITY; i++)
+      trD.mapPoints(dstD, srcF, POINT_COUNT);
+    result[1] = getMPointsPerSecond((Time::now() - start).getMillisecondsD());
+
+    start = Time::now();
+    for (i = 0; i < BENCH_QUANTITY; i++)
+      trD.mapPoints(dstD, srcD, POINT_COUNT);
+    result[2] = getMPointsPerSecond((Time::now() - start).getMillisecondsD());
+
+    start = Time::now();
+    for (i = 0; i < BENCH_QUANTITY; i++)
+      trF.mapPointsAndBox(dstF, srcF, POINT_COUNT, boxF);
+    result[3] = getMPointsPerSecond((Time::now() - start).getMillisecondsD());
+
+    start = Time::now();
+    for (i = 0; i < BENCH_QUANTITY; i++)
+      trD.mapPointsAndBox(dstD, srcD, POINT_COUNT, boxD);
+    result[4] = getMPointsPerSecond((Time::now() - start).getMillisecondsD());
+
+    printf("%-12s | %10.1f | %10.1f | %10.1f | %10.1f | %10.1f\n",
+      typeNames[type], result[0], result[1], result[2], result[3], result[4]);
+  }
+
+  MemMgr::free(dstD);
+  MemMgr::free(dstF);
+  MemMgr::free(srcD);
+  MemMgr::free(srcF);
+
+  return 0;
+}
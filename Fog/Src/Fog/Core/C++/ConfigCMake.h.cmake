@@ -70,6 +70,9 @@
 //! @brief Enable support for x86/x64 SSSE3 instructions.
 #cmakedefine FOG_OPTIMIZE_SSSE3
 
+//! @brief Enable support for x86/x64 AVX2 and FMA3 instructions.
+#cmakedefine FOG_OPTIMIZE_AVX2
+
 //! @brief Enable support for ARM Neon instructions.
 #cmakedefine FOG_OPTIMIZE_NEON
 
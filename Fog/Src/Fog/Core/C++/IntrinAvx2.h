@@ -0,0 +1,17 @@
+// [Fog-Core]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_CORE_CPP_INTRINAVX2_H
+#define _FOG_CORE_CPP_INTRINAVX2_H
+
+// [Dependencies]
+#include <Fog/Core/C++/Base.h>
+#include <Fog/Core/C++/IntrinSsse3.h>
+
+#include <immintrin.h>
+
+// [Guard]
+#endif // _FOG_CORE_CPP_INTRINAVX2_H
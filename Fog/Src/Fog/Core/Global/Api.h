@@ -1719,6 +1719,8 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_METHOD(err_t, pathf_appendTransformedPathF)(PathF* self, const PathF* path, const TransformF* tr, const Range* range);
   FOG_CAPI_METHOD(err_t, pathf_getBoundingBox)(const PathF* self, BoxF* dst, const TransformF* transform);
   FOG_CAPI_METHOD(bool, pathf_hitTest)(const PathF* self, const PointF* pt, uint32_t fillRule);
+  FOG_CAPI_METHOD(void, pathf_hitTestPoints)(const PathF* self, bool* dst, const PointF* pts, size_t count, uint32_t fillRule);
+  FOG_CAPI_METHOD(bool, pathf_hitTestDirect)(const PathF* self, const PointF* pt, uint32_t fillRule);
   FOG_CAPI_METHOD(size_t, pathf_getClosestVertex)(const PathF* self, const PointF* pt, float maxDistance, float* distance);
   FOG_CAPI_METHOD(err_t, pathf_translate)(PathF* self, const PointF* pt, const Range* range);
   FOG_CAPI_METHOD(err_t, pathf_transform)(PathF* self, const TransformF* tr, const Range* range);
@@ -1728,8 +1730,11 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_METHOD(err_t, pathf_flipY)(PathF* self, float y0, float y1);
   FOG_CAPI_METHOD(err_t, pathf_flatten)(PathF* dst, const PathF* src, const PathFlattenParamsF* params, const Range* range);
   FOG_CAPI_METHOD(const PathInfoF*, pathf_getPathInfo)(const PathF* self);
+  FOG_CAPI_METHOD(const PathHitIndexF*, pathf_getHitIndex)(const PathF* self);
+  FOG_CAPI_METHOD(const PathHitIndexF*, pathf_getHitIndexLazy)(const PathF* self);
 
   FOG_CAPI_STATIC(bool, pathf_eq)(const PathF* a, const PathF* b);
+  FOG_CAPI_STATIC(err_t, pathf_combine)(PathF* dst, const PathF* a, const PathF* b, uint32_t op, uint32_t fillRule);
   FOG_CAPI_STATIC(PathDataF*, pathf_dCreate)(size_t capacity);
   FOG_CAPI_STATIC(PathDataF*, pathf_dAdopt)(void* address, size_t capacity);
   FOG_CAPI_STATIC(void, pathf_dFree)(PathDataF* d);
@@ -1807,6 +1812,8 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_METHOD(err_t, pathd_appendTransformedPathD)(PathD* self, const PathD* path, const TransformD* tr, const Range* range);
   FOG_CAPI_METHOD(err_t, pathd_getBoundingBox)(const PathD* self, BoxD* dst, const TransformD* transform);
   FOG_CAPI_METHOD(bool, pathd_hitTest)(const PathD* self, const PointD* pt, uint32_t fillRule);
+  FOG_CAPI_METHOD(void, pathd_hitTestPoints)(const PathD* self, bool* dst, const PointD* pts, size_t count, uint32_t fillRule);
+  FOG_CAPI_METHOD(bool, pathd_hitTestDirect)(const PathD* self, const PointD* pt, uint32_t fillRule);
   FOG_CAPI_METHOD(size_t, pathd_getClosestVertex)(const PathD* self, const PointD* pt, double maxDistance, double* distance);
   FOG_CAPI_METHOD(err_t, pathd_translate)(PathD* self, const PointD* pt, const Range* range);
   FOG_CAPI_METHOD(err_t, pathd_transform)(PathD* self, const TransformD* tr, const Range* range);
@@ -1816,8 +1823,11 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_METHOD(err_t, pathd_flipY)(PathD* self, double y0, double y1);
   FOG_CAPI_METHOD(err_t, pathd_flatten)(PathD* dst, const PathD* src, const PathFlattenParamsD* params, const Range* range);
   FOG_CAPI_METHOD(const PathInfoD*, pathd_getPathInfo)(const PathD* self);
+  FOG_CAPI_METHOD(const PathHitIndexD*, pathd_getHitIndex)(const PathD* self);
+  FOG_CAPI_METHOD(const PathHitIndexD*, pathd_getHitIndexLazy)(const PathD* self);
 
   FOG_CAPI_STATIC(bool, pathd_eq)(const PathD* a, const PathD* b);
+  FOG_CAPI_STATIC(err_t, pathd_combine)(PathD* dst, const PathD* a, const PathD* b, uint32_t op, uint32_t fillRule);
   FOG_CAPI_STATIC(PathDataD*, pathd_dCreate)(size_t capacity);
   FOG_CAPI_STATIC(PathDataD*, pathd_dAdopt)(void* address, size_t capacity);
   FOG_CAPI_STATIC(void, pathd_dFree)(PathDataD* d);
@@ -1844,16 +1854,42 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_METHOD(err_t, pathclipperd_clipPath)(PathClipperD* self, PathD* dst, const PathD* src, const TransformD* tr);
   FOG_CAPI_METHOD(err_t, pathclipperd_clipBox)(PathClipperD* self, PathD* dst, const BoxD* src, const TransformD* tr);
 
+  // --------------------------------------------------------------------------
+  // [G2d/Geometry - PathHitIndexF]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_METHOD(int, pathhitindexf_getWinding)(const PathHitIndexF* self, const PointF* pt);
+  FOG_CAPI_METHOD(void, pathhitindexf_hitTestPoints)(const PathHitIndexF* self, bool* dst, const PointF* pts, size_t count, uint32_t fillRule);
+  FOG_CAPI_METHOD(float, pathhitindexf_getDistance)(const PathHitIndexF* self, const PointF* pt, float maxDistance);
+
+  FOG_CAPI_STATIC(PathHitIndexF*, pathhitindexf_generate)(const PathF* path);
+
+  // --------------------------------------------------------------------------
+  // [G2d/Geometry - PathHitIndexD]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_METHOD(int, pathhitindexd_getWinding)(const PathHitIndexD* self, const PointD* pt);
+  FOG_CAPI_METHOD(void, pathhitindexd_hitTestPoints)(const PathHitIndexD* self, bool* dst, const PointD* pts, size_t count, uint32_t fillRule);
+  FOG_CAPI_METHOD(double, pathhitindexd_getDistance)(const PathHitIndexD* self, const PointD* pt, double maxDistance);
+
+  FOG_CAPI_STATIC(PathHitIndexD*, pathhitindexd_generate)(const PathD* path);
+
   // --------------------------------------------------------------------------
   // [G2d/Geometry - PathInfoF]
   // --------------------------------------------------------------------------
 
+  FOG_CAPI_METHOD(err_t, pathinfof_getPointAtDistance)(const PathInfoF* self, const PathF* path, PointF* dstPt, PointF* dstTangent, float distance, PathInfoCursor* cursor);
+  FOG_CAPI_METHOD(err_t, pathinfof_getSegment)(const PathInfoF* self, const PathF* path, PathF* dst, float from, float to);
+
   FOG_CAPI_STATIC(PathInfoF*, pathinfof_generate)(const PathF* path);
 
   // --------------------------------------------------------------------------
   // [G2d/Geometry - PathInfoD]
   // --------------------------------------------------------------------------
 
+  FOG_CAPI_METHOD(err_t, pathinfod_getPointAtDistance)(const PathInfoD* self, const PathD* path, PointD* dstPt, PointD* dstTangent, double distance, PathInfoCursor* cursor);
+  FOG_CAPI_METHOD(err_t, pathinfod_getSegment)(const PathInfoD* self, const PathD* path, PathD* dst, double from, double to);
+
   FOG_CAPI_STATIC(PathInfoD*, pathinfod_generate)(const PathD* path);
 
   // --------------------------------------------------------------------------
@@ -1955,6 +1991,9 @@ struct FOG_NO_EXPORT Api
   typedef void (FOG_CDECL* TransformF_MapPointsF)(const TransformF* self, PointF* dst, const PointF* src, size_t length);
   TransformF_MapPointsF transformf_mapPointsF[TRANSFORM_TYPE_COUNT];
 
+  typedef void (FOG_CDECL* TransformF_MapPointsAndBoxF)(const TransformF* self, PointF* dst, const PointF* src, size_t length, BoxF* box);
+  TransformF_MapPointsAndBoxF transformf_mapPointsAndBoxF[TRANSFORM_TYPE_COUNT];
+
   FOG_CAPI_METHOD(err_t, transformf_mapPathF)(const TransformF* self, PathF* dst, const PathF* src, uint32_t cntOp);
   FOG_CAPI_METHOD(err_t, transformf_mapPathDataF)(const TransformF* self, PathF* dst, const uint8_t* srcCmd, const PointF* srcPts, size_t length, uint32_t cntOp);
   FOG_CAPI_METHOD(void, transformf_mapBoxF)(const TransformF* self, BoxF* dst, const BoxF* src);
@@ -1983,6 +2022,12 @@ struct FOG_NO_EXPORT Api
   TransformD_MapPointsF transformd_mapPointsF[TRANSFORM_TYPE_COUNT];
   TransformD_MapPointsD transformd_mapPointsD[TRANSFORM_TYPE_COUNT];
 
+  typedef void (FOG_CDECL* TransformD_MapPointsAndBoxF)(const TransformD* self, PointD* dst, const PointF* src, size_t length, BoxD* box);
+  typedef void (FOG_CDECL* TransformD_MapPointsAndBoxD)(const TransformD* self, PointD* dst, const PointD* src, size_t length, BoxD* box);
+
+  TransformD_MapPointsAndBoxF transformd_mapPointsAndBoxF[TRANSFORM_TYPE_COUNT];
+  TransformD_MapPointsAndBoxD transformd_mapPointsAndBoxD[TRANSFORM_TYPE_COUNT];
+
   FOG_CAPI_METHOD(err_t, transformd_mapPathF)(const TransformD* self, PathD* dst, const PathF* src, uint32_t cntOp);
   FOG_CAPI_METHOD(err_t, transformd_mapPathD)(const TransformD* self, PathD* dst, const PathD* src, uint32_t cntOp);
   FOG_CAPI_METHOD(err_t, transformd_mapPathDataF)(const TransformD* self, PathD* dst, const uint8_t* srcCmd, const PointF* srcPts, size_t length, uint32_t cntOp);
@@ -2081,6 +2126,23 @@ struct FOG_NO_EXPORT Api
 
   Image* image_oEmpty;
 
+  // --------------------------------------------------------------------------
+  // [G2d/Imaging - ImageBufferPool]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_STATIC(void*, imagebufferpool_alloc)(size_t size);
+  FOG_CAPI_STATIC(void, imagebufferpool_release)(void* p);
+  FOG_CAPI_STATIC(void, imagebufferpool_trim)(size_t keepBytes);
+
+  FOG_CAPI_STATIC(size_t, imagebufferpool_getBudget)(void);
+  FOG_CAPI_STATIC(void, imagebufferpool_setBudget)(size_t budget);
+
+  FOG_CAPI_STATIC(uint32_t, imagebufferpool_getFlags)(void);
+  FOG_CAPI_STATIC(void, imagebufferpool_setFlags)(uint32_t flags);
+
+  FOG_CAPI_STATIC(void, imagebufferpool_getStats)(ImageBufferPoolStats* stats);
+  FOG_CAPI_STATIC(void, imagebufferpool_resetStats)(void);
+
   // --------------------------------------------------------------------------
   // [G2d/Imaging - ImageConverter]
   // --------------------------------------------------------------------------
@@ -2114,6 +2176,8 @@ struct FOG_NO_EXPORT Api
     void* dst, const void* src, int w, const PointI* ditherOrigin);
   FOG_CAPI_METHOD(void, imageconverter_blitRect)(const ImageConverter* self,
     void* dst, size_t dstStride, const void* src, size_t srcStride, int w, int h, const PointI* ditherOrigin);
+  FOG_CAPI_METHOD(err_t, imageconverter_convertImage)(const ImageConverter* self,
+    Image* dst, const Image* src);
 
   FOG_CAPI_STATIC(ImageConverterData*, imageconverter_dCreate)(void);
   FOG_CAPI_STATIC(void, imageconverter_dFree)(ImageConverterData* d);
@@ -2175,6 +2239,12 @@ struct FOG_NO_EXPORT Api
 
   ImagePalette* imagepalette_oEmpty;
 
+  // --------------------------------------------------------------------------
+  // [G2d/Imaging/Filters - FeBase]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_METHOD(void, febase_getExtents)(const FeBase* self, PointF* extents);
+
   // --------------------------------------------------------------------------
   // [G2d/Imaging/Filters - FeBlur]
   // --------------------------------------------------------------------------
@@ -2367,6 +2437,15 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_METHOD(err_t, region_fromHRGN)(Region* self, HRGN hrgn);
 #endif // FOG_OS_WINDOWS
 
+  // --------------------------------------------------------------------------
+  // [G2d/OS - PosixUtil / Support]
+  // --------------------------------------------------------------------------
+
+#if defined(FOG_OS_POSIX)
+  FOG_CAPI_METHOD(err_t, image_exportShared)(const Image* self, ImageSharedInfo* info, uint32_t flags);
+  FOG_CAPI_METHOD(err_t, image_importShared)(Image* self, const ImageSharedInfo* info);
+#endif // FOG_OS_POSIX
+
   // --------------------------------------------------------------------------
   // [G2d/OS - MacUtil / Support]
   // --------------------------------------------------------------------------
@@ -2409,6 +2488,20 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_METHOD(err_t, color_parseA)(Color* self, const StubA* str, uint32_t flags);
   FOG_CAPI_METHOD(err_t, color_parseW)(Color* self, const StubW* str, uint32_t flags);
 
+  // --------------------------------------------------------------------------
+  // [G2d/Source - ColorStopCache]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_STATIC(ColorStopCache*, colorstopcache_getShared)(const ColorStop* stops, size_t length, uint32_t format, uint32_t cacheLength);
+  FOG_CAPI_STATIC(ColorStopCache*, colorstopcache_putShared)(const ColorStop* stops, size_t length, ColorStopCache* cache);
+  FOG_CAPI_STATIC(void, colorstopcache_trim)(size_t keepBytes);
+
+  FOG_CAPI_STATIC(size_t, colorstopcache_getBudget)(void);
+  FOG_CAPI_STATIC(void, colorstopcache_setBudget)(size_t budget);
+
+  FOG_CAPI_STATIC(void, colorstopcache_getStats)(ColorStopCacheStats* stats);
+  FOG_CAPI_STATIC(void, colorstopcache_resetStats)(void);
+
   // --------------------------------------------------------------------------
   // [G2d/Source - ColorStopList]
   // --------------------------------------------------------------------------
@@ -2726,6 +2819,10 @@ struct FOG_NO_EXPORT Api
 
   FOG_CAPI_METHOD(bool, region_eq)(const Region* a, const Region* b);
 
+  FOG_CAPI_METHOD(err_t, region_fromMask)(Region* self, const ImageBits* mask, uint32_t threshold);
+  FOG_CAPI_METHOD(err_t, region_fromPathF)(Region* self, const PathF* path, uint32_t fillRule, const TransformF* tr, uint32_t threshold);
+  FOG_CAPI_METHOD(err_t, region_fromPathD)(Region* self, const PathD* path, uint32_t fillRule, const TransformD* tr, uint32_t threshold);
+
   FOG_CAPI_STATIC(RegionData*, region_dCreate)(size_t capacity);
   FOG_CAPI_STATIC(RegionData*, region_dCreateBox)(size_t capacity, const BoxI* box);
   FOG_CAPI_STATIC(RegionData*, region_dCreateRegion)(size_t capacity, const BoxI* data, size_t count, const BoxI* extent);
@@ -2746,6 +2843,42 @@ struct FOG_NO_EXPORT Api
   FOG_CAPI_STATIC(const BoxI*, regionutil_getClosestBox)(const BoxI* data, size_t length, int y);
   FOG_CAPI_STATIC(bool, regionutil_isBoxListSorted)(const BoxI* data, size_t length);
   FOG_CAPI_STATIC(bool, regionutil_isRectListSorted)(const RectI* data, size_t length);
+
+  // --------------------------------------------------------------------------
+  // [G2d/Tools - RTreeF]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_CTOR(rtreef_ctor)(RTreeF* self);
+  FOG_CAPI_DTOR(rtreef_dtor)(RTreeF* self);
+
+  FOG_CAPI_METHOD(err_t, rtreef_getBoundingBox)(const RTreeF* self, BoxF* dst);
+  FOG_CAPI_METHOD(void, rtreef_clear)(RTreeF* self);
+  FOG_CAPI_METHOD(err_t, rtreef_build)(RTreeF* self, const RTreeItemF* items, size_t length);
+  FOG_CAPI_METHOD(err_t, rtreef_insert)(RTreeF* self, const BoxF* box, void* data);
+  FOG_CAPI_METHOD(err_t, rtreef_remove)(RTreeF* self, const BoxF* box, void* data);
+  FOG_CAPI_METHOD(err_t, rtreef_update)(RTreeF* self, const BoxF* oldBox, const BoxF* newBox, void* data);
+  FOG_CAPI_METHOD(size_t, rtreef_findNearest)(const RTreeF* self, RTreeItemF* dst, float* dstDistance, size_t count, const PointF* pt, float maxDistance);
+
+  FOG_CAPI_METHOD(bool, rtreeiteratorf_start)(RTreeIteratorF* self, const RTreeF* tree, const BoxF* box, uint32_t queryType);
+  FOG_CAPI_METHOD(bool, rtreeiteratorf_next)(RTreeIteratorF* self);
+
+  // --------------------------------------------------------------------------
+  // [G2d/Tools - RTreeD]
+  // --------------------------------------------------------------------------
+
+  FOG_CAPI_CTOR(rtreed_ctor)(RTreeD* self);
+  FOG_CAPI_DTOR(rtreed_dtor)(RTreeD* self);
+
+  FOG_CAPI_METHOD(err_t, rtreed_getBoundingBox)(const RTreeD* self, BoxD* dst);
+  FOG_CAPI_METHOD(void, rtreed_clear)(RTreeD* self);
+  FOG_CAPI_METHOD(err_t, rtreed_build)(RTreeD* self, const RTreeItemD* items, size_t length);
+  FOG_CAPI_METHOD(err_t, rtreed_insert)(RTreeD* self, const BoxD* box, void* data);
+  FOG_CAPI_METHOD(err_t, rtreed_remove)(RTreeD* self, const BoxD* box, void* data);
+  FOG_CAPI_METHOD(err_t, rtreed_update)(RTreeD* self, const BoxD* oldBox, const BoxD* newBox, void* data);
+  FOG_CAPI_METHOD(size_t, rtreed_findNearest)(const RTreeD* self, RTreeItemD* dst, double* dstDistance, size_t count, const PointD* pt, double maxDistance);
+
+  FOG_CAPI_METHOD(bool, rtreeiteratord_start)(RTreeIteratorD* self, const RTreeD* tree, const BoxD* box, uint32_t queryType);
+  FOG_CAPI_METHOD(bool, rtreeiteratord_next)(RTreeIteratorD* self);
 };
 
 //! @}
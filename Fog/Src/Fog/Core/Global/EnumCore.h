@@ -1232,6 +1232,8 @@ enum CPU_FEATURE
   CPU_FEATURE_SSE4_1 = 1U << 19,
   //! @brief Cpu has SSE4.2.
   CPU_FEATURE_SSE4_2 = 1U << 20,
+  //! @brief Cpu has AVX2 and FMA3, and the OS saves the YMM registers.
+  CPU_FEATURE_AVX2 = 1U << 21,
   //! @brief Cpu has AVX.
   CPU_FEATURE_AVX = 1U << 22,
   //! @brief Cpu has Misaligned SSE (MSSE).
@@ -2029,9 +2031,21 @@ enum STREAM_DEVICE_FLAGS
   STREAM_IS_HFILE    = (1 << 16),
   STREAM_IS_FD       = (1 << 17),
   STREAM_IS_MEMORY   = (1 << 18),
-  STREAM_IS_GROWABLE = (1 << 19)
+  STREAM_IS_GROWABLE = (1 << 19),
+  STREAM_IS_BUFFERED = (1 << 20)
 };
 
+// ============================================================================
+// [Fog::STREAM_BUFFER]
+// ============================================================================
+
+//! @brief Default size of buffer used by buffered stream device (see
+//! @c Stream::openBuffered()).
+static const size_t STREAM_BUFFER_DEFAULT_SIZE = 65536;
+
+//! @brief Minimum size of buffer used by buffered stream device.
+static const size_t STREAM_BUFFER_MIN_SIZE = 4096;
+
 // ============================================================================
 // [Fog::STREAM_OPEN_FLAGS]
 // ============================================================================
@@ -50,6 +50,20 @@ enum AXIS
   AXIS_Z = 0x4
 };
 
+// ============================================================================
+// [Fog::BLIT_ITEM_FLAGS]
+// ============================================================================
+
+//! @brief Flags used by @c BlitItem.
+enum BLIT_ITEM_FLAGS
+{
+  //! @brief No flags, the fragment is blitted unscaled to the destination point.
+  BLIT_ITEM_NO_FLAGS = 0x00,
+
+  //! @brief The fragment is scaled to the destination rectangle.
+  BLIT_ITEM_SCALED = 0x01
+};
+
 // ============================================================================
 // [Fog::CLIP_OP]
 // ============================================================================
@@ -281,6 +295,42 @@ enum COLOR_MIX_OP
   COLOR_MIX_OP_COUNT = 13
 };
 
+// ============================================================================
+// [Fog::COLOR_STOP_CACHE]
+// ============================================================================
+
+//! @brief Global color-stop cache limits.
+enum COLOR_STOP_CACHE_LIMITS
+{
+  //! @brief Count of hash buckets of the global color-stop cache.
+  COLOR_STOP_CACHE_BUCKET_COUNT = 256,
+
+  //! @brief Default byte budget of the global color-stop cache.
+  COLOR_STOP_CACHE_DEFAULT_BUDGET = 1024 * 1024
+};
+
+// ============================================================================
+// [Fog::COLOR_SPACE]
+// ============================================================================
+
+//! @brief The color space in which the compositing is done, used by @c Painter.
+enum COLOR_SPACE
+{
+  //! @brief Compositing is done directly using sRGB encoded values (fastest).
+  COLOR_SPACE_SRGB = 0,
+  //! @brief Compositing is done using linear-light values.
+  //!
+  //! Both, the source and the destination pixels are converted to linear
+  //! light, composited, and converted back to sRGB. This removes dark fringes
+  //! of antialiased edges and blurs, but it's slower.
+  COLOR_SPACE_LINEAR = 1,
+
+  //! @brief Default color space, @c COLOR_SPACE_SRGB.
+  COLOR_SPACE_DEFAULT = COLOR_SPACE_SRGB,
+  //! @brief Count of color spaces.
+  COLOR_SPACE_COUNT = 2
+};
+
 // ============================================================================
 // [Fog::COMPOSITE_OP]
 // ============================================================================
@@ -640,7 +690,9 @@ enum COMPOSITE_OP
 enum DITHER_TYPE
 {
   DITHER_TYPE_NONE = 0,
-  DITHER_TYPE_PATTERN = 1
+  DITHER_TYPE_PATTERN = 1,
+  //! @brief Floyd-Steinberg error diffusion (used only by 8-bit converters).
+  DITHER_TYPE_ERROR_DIFFUSION = 2
 };
 
 // ============================================================================
@@ -1649,13 +1701,39 @@ enum IMAGE_TYPE
   //! @note This is Mac-only image type.
   IMAGE_TYPE_MAC_CG = 2,
 
+  //! @brief Image is a shared memory segment (memfd or POSIX shm).
+  //!
+  //! The pixel data are mapped using @c mmap() so the image can be exported
+  //! as a file descriptor and imported (mapped) by another process without
+  //! copying. See @c Image::exportShared() and @c Image::importShared().
+  //!
+  //! @note This is POSIX-only image type.
+  IMAGE_TYPE_SHARED = 3,
+
   //! @brief Count of image types.
-  IMAGE_TYPE_COUNT = 3,
+  IMAGE_TYPE_COUNT = 4,
 
   //! @brief Ignore the image type (used by some functions inside @c Image).
   IMAGE_TYPE_IGNORE = 0xFF
 };
 
+// ============================================================================
+// [Fog::IMAGE_SHARED_FLAGS]
+// ============================================================================
+
+//! @brief Flags used by @c Image::exportShared().
+enum IMAGE_SHARED_FLAGS
+{
+  //! @brief No flags.
+  IMAGE_SHARED_NO_FLAGS = 0x00,
+
+  //! @brief Seal the size of the shared memory (memfd only).
+  //!
+  //! The consumer is then guaranteed that the segment can't be truncated by
+  //! the producer (accessing truncated mapping would raise @c SIGBUS).
+  IMAGE_SHARED_SEAL = 0x01
+};
+
 // ============================================================================
 // [Fog::IMAGE_COMPONENT]
 // ============================================================================
@@ -1692,6 +1770,40 @@ enum IMAGE_COMPONENT
   IMAGE_COMPONENT_ARGB = IMAGE_COMPONENT_ALPHA | IMAGE_COMPONENT_RGB
 };
 
+// ============================================================================
+// [Fog::IMAGE_BUFFER_POOL]
+// ============================================================================
+
+//! @brief Image buffer pool flags (see @c ImageBufferPool).
+enum IMAGE_BUFFER_POOL_FLAGS
+{
+  //! @brief No flags.
+  IMAGE_BUFFER_POOL_NO_FLAGS = 0x00,
+
+  //! @brief Back large buffers by huge pages (if supported by the OS).
+  IMAGE_BUFFER_POOL_HUGE_PAGES = 0x01,
+
+  //! @brief Don't use per-thread caches, all buffers are recycled through
+  //! the global size-class lists.
+  IMAGE_BUFFER_POOL_NO_THREAD_CACHE = 0x02
+};
+
+//! @brief Image buffer pool limits.
+enum IMAGE_BUFFER_POOL_LIMITS
+{
+  //! @brief Alignment of buffers returned by @c ImageBufferPool::alloc().
+  IMAGE_BUFFER_POOL_ALIGNMENT = 64,
+
+  //! @brief Count of size classes.
+  IMAGE_BUFFER_POOL_CLASS_COUNT = 64,
+
+  //! @brief Default byte budget of cached (unused) buffers.
+  IMAGE_BUFFER_POOL_DEFAULT_BUDGET = 64 * 1024 * 1024,
+
+  //! @brief Maximum count of bytes cached by one thread.
+  IMAGE_BUFFER_POOL_THREAD_BUDGET = 8 * 1024 * 1024
+};
+
 // ============================================================================
 // [Fog::IMAGE_CODEC]
 // ============================================================================
@@ -2324,12 +2436,19 @@ enum PAINTER_PARAMETER
   PAINTER_PARAMETER_FILTER_SCALE_F = 34,
   PAINTER_PARAMETER_FILTER_SCALE_D = 35,
 
+  // --------------------------------------------------------------------------
+  // [Color Space]
+  // --------------------------------------------------------------------------
+
+  //! @brief Color space used by compositing, see @c COLOR_SPACE.
+  PAINTER_PARAMETER_COLOR_SPACE_I = 36,
+
   // --------------------------------------------------------------------------
   // [...]
   // --------------------------------------------------------------------------
 
   //! @brief Count of painter parameters.
-  PAINTER_PARAMETER_COUNT = 36
+  PAINTER_PARAMETER_COUNT = 37
 };
 
 // ============================================================================
@@ -2476,6 +2595,53 @@ enum PATH_FLATTEN
   PATH_FLATTEN_COUNT = 3
 };
 
+// ============================================================================
+// [Fog::PATH_OP]
+// ============================================================================
+
+//! @brief Path boolean operator, used by @c PathF::combine() and
+//! @c PathD::combine().
+enum PATH_OP
+{
+  //! @brief Union (A | B).
+  PATH_OP_UNION = 0,
+  //! @brief Intersection (A & B).
+  PATH_OP_INTERSECT = 1,
+  //! @brief Difference (A - B).
+  PATH_OP_SUBTRACT = 2,
+  //! @brief Reversed difference (B - A).
+  PATH_OP_SUBTRACT_REV = 3,
+  //! @brief Symmetric difference (A ^ B).
+  PATH_OP_XOR = 4,
+
+  //! @brief Count of path boolean operators.
+  PATH_OP_COUNT = 5
+};
+
+// ============================================================================
+// [Fog::PATH_STROKER_MODE]
+// ============================================================================
+
+//! @brief How the @c PathStrokerF and @c PathStrokerD stroke Bezier curves.
+enum PATH_STROKER_MODE
+{
+  //! @brief Flatten the source path and offset the line segments (default).
+  //!
+  //! Resulting path contains only lines.
+  PATH_STROKER_MODE_FLATTEN = 0,
+
+  //! @brief Offset the quadratic and cubic Bezier curves directly.
+  //!
+  //! Each curve is approximated by one or more curves of the same degree,
+  //! which are subdivided until the offset error is within the tolerance
+  //! derived from the flatness and the transform scale. Round joins and caps
+  //! are emitted as cubic arcs. Dashed strokes always use the flatten mode.
+  PATH_STROKER_MODE_CURVES = 1,
+
+  //! @brief Count of stroker modes.
+  PATH_STROKER_MODE_COUNT = 2
+};
+
 // ============================================================================
 // [Fog::PATTERN_TYPE]
 // ============================================================================
@@ -2811,6 +2977,43 @@ enum RENDER_QUALITY
   RENDER_QUALITY_DEFAULT = RENDER_QUALITY_GREY_16
 };
 
+// ============================================================================
+// [Fog::RTREE_LIMITS]
+// ============================================================================
+
+//! @brief R-tree limits.
+enum RTREE_LIMITS
+{
+  //! @brief Maximum count of entries of a single node.
+  RTREE_NODE_CAPACITY = 16,
+
+  //! @brief Minimum count of entries of a node created by a split, nodes
+  //! which drop under this count by a removal are reinserted.
+  RTREE_NODE_MINIMUM = 6,
+
+  //! @brief Maximum height of the tree (the bound of the iterator stack).
+  RTREE_MAX_HEIGHT = 32
+};
+
+// ============================================================================
+// [Fog::RTREE_QUERY]
+// ============================================================================
+
+//! @brief R-tree query type, used by @c RTreeIteratorF and @c RTreeIteratorD.
+enum RTREE_QUERY
+{
+  //! @brief Match all entries whose box contains the point (the same rule
+  //! as @c BoxF::hitTest(), the right and bottom edges are excluded).
+  RTREE_QUERY_POINT = 0,
+
+  //! @brief Match all entries whose box intersects the box, boxes which only
+  //! touch the query are matched as well.
+  RTREE_QUERY_BOX = 1,
+
+  //! @brief Count of R-tree query types.
+  RTREE_QUERY_COUNT = 2
+};
+
 // ============================================================================
 // [Fog::SHAPE_TYPE]
 // ============================================================================
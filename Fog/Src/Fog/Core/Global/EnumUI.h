@@ -53,7 +53,11 @@ enum UI_ENGINE_BUFFER
   UI_ENGINE_BUFFER_X11_XIMAGE = 16,
 
   //! @brief Double-buffer is XSHM-Image (UI/X11).
-  UI_ENGINE_BUFFER_X11_XSHMIMAGE = 17
+  UI_ENGINE_BUFFER_X11_XSHMIMAGE = 17,
+
+  //! @brief Double-buffer is XSHM-Image attached by file descriptor, the
+  //! pixels are stored in @c IMAGE_TYPE_SHARED image (UI/X11).
+  UI_ENGINE_BUFFER_X11_XSHMFDIMAGE = 18
 };
 
 // ============================================================================
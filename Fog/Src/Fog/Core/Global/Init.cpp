@@ -122,6 +122,7 @@ FOG_CAPI_DECLARE void _fog_init(void)
 #endif // FOG_OS_WINDOWS
 
   RegionUtil_init();
+  RTree_init();
 
   // [G2d/Geometry]
   Line_init();
@@ -138,12 +139,15 @@ FOG_CAPI_DECLARE void _fog_init(void)
   Shape_init();
 
   Transform_init();
+  PathBoolean_init();
   PathClipper_init();
   PathStroker_init();
+  PathHitIndex_init();
   PathInfo_init();
 
   // [G2d/Source]
   Color_init();
+  ColorStopCache_init();
   ColorStopList_init();
   Gradient_init();
   Pattern_init();
@@ -151,6 +155,7 @@ FOG_CAPI_DECLARE void _fog_init(void)
   // [G2d/Imaging]
   ImageFormatDescription_init();
   ImagePalette_init();
+  ImageBufferPool_init();
   Image_init();
 
 #if defined(FOG_OS_WINDOWS)
@@ -161,6 +166,10 @@ FOG_CAPI_DECLARE void _fog_init(void)
   Image_init_mac();
 #endif // FOG_OS_MAC
 
+#if defined(FOG_OS_POSIX)
+  Image_init_posix();
+#endif // FOG_OS_POSIX
+
   ImageResize_init();
   ImageConverter_init();
   ImageFilter_init();
@@ -207,6 +216,10 @@ FOG_CAPI_DECLARE void _fog_fini(void)
 
   // [G2d/Imaging]
   ImageCodecProvider_fini();
+  ImageBufferPool_fini();
+
+  // [G2d/Source]
+  ColorStopCache_fini();
 
   // [Core/Application]
   Application_fini();
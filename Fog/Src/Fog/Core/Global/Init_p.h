@@ -133,11 +133,16 @@ FOG_NO_EXPORT void Path_init(void);
 FOG_NO_EXPORT void Shape_init(void);
 
 FOG_NO_EXPORT void Transform_init(void);
+FOG_NO_EXPORT void PathBoolean_init(void);
 FOG_NO_EXPORT void PathClipper_init(void);
 FOG_NO_EXPORT void PathStroker_init(void);
+FOG_NO_EXPORT void PathHitIndex_init(void);
 FOG_NO_EXPORT void PathInfo_init(void);
 
 // [Fog/G2d/Imaging]
+FOG_NO_EXPORT void ImageBufferPool_init(void);
+FOG_NO_EXPORT void ImageBufferPool_fini(void);
+
 FOG_NO_EXPORT void Image_init(void);
 
 #if defined(FOG_OS_WINDOWS)
@@ -148,6 +153,10 @@ FOG_NO_EXPORT void Image_init_win(void);
 FOG_NO_EXPORT void Image_init_mac(void);
 #endif // FOG_OS_MAC
 
+#if defined(FOG_OS_POSIX)
+FOG_NO_EXPORT void Image_init_posix(void);
+#endif // FOG_OS_POSIX
+
 FOG_NO_EXPORT void ImageResize_init(void);
 FOG_NO_EXPORT void ImagePalette_init(void);
 FOG_NO_EXPORT void ImageConverter_init(void);
@@ -183,6 +192,8 @@ FOG_NO_EXPORT void Rasterizer_init(void);
 
 // [Fog/G2d/Source]
 FOG_NO_EXPORT void Color_init(void);
+FOG_NO_EXPORT void ColorStopCache_init(void);
+FOG_NO_EXPORT void ColorStopCache_fini(void);
 FOG_NO_EXPORT void ColorStopList_init(void);
 FOG_NO_EXPORT void Gradient_init(void);
 FOG_NO_EXPORT void Pattern_init(void);
@@ -197,6 +208,7 @@ FOG_NO_EXPORT void Region_init_win(void);
 #endif // FOG_OS_WINDOWS
 
 FOG_NO_EXPORT void RegionUtil_init(void);
+FOG_NO_EXPORT void RTree_init(void);
 
 // [Fog/G2d/Text]
 FOG_NO_EXPORT void Font_init(void);
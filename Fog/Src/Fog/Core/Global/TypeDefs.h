@@ -175,6 +175,11 @@ struct PathDataF;
 struct PathDataD;
 struct PathFlattenParamsF;
 struct PathFlattenParamsD;
+struct PathHitIndexF;
+struct PathHitIndexD;
+struct PathHitIndexEdgeF;
+struct PathHitIndexEdgeD;
+struct PathInfoCursor;
 struct PathInfoF;
 struct PathInfoD;
 struct PathInfoFigureF;
@@ -220,6 +225,9 @@ struct TriangleD;
 // Fog/G2d/Imaging.
 struct Image;
 struct ImageBits;
+struct ImageBufferPool;
+struct ImageBufferPoolStats;
+struct ImageSharedInfo;
 struct ImageCodec;
 struct ImageCodecProvider;
 struct ImageConverter;
@@ -283,6 +291,7 @@ struct Color;
 struct ColorBase;
 struct ColorStop;
 struct ColorStopCache;
+struct ColorStopCacheStats;
 struct ColorStopList;
 struct ColorStopListData;
 struct ConicalGradientF;
@@ -387,6 +396,14 @@ struct MatrixDataF;
 struct MatrixDataD;
 struct Region;
 struct RegionData;
+struct RTreeF;
+struct RTreeD;
+struct RTreeItemF;
+struct RTreeItemD;
+struct RTreeIteratorF;
+struct RTreeIteratorD;
+struct RTreeNodeF;
+struct RTreeNodeD;
 
 #if defined(FOG_BUILD_UI)
 // Fog/UI/Engine.
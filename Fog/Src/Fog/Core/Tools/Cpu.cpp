@@ -72,18 +72,20 @@ union FOG_NO_EXPORT CpuId
 };
 
 #if defined(FOG_CC_MSC)
-static void FOG_CDECL Cpu_cpuid(uint32_t in, CpuId* out)
+static void FOG_CDECL Cpu_cpuid(uint32_t in, uint32_t sub, CpuId* out)
 {
-#if _MSC_VER >= 1400
+#if _MSC_VER >= 1500
   // Done by intrinsics.
-  __cpuid(reinterpret_cast<int*>(out->i), in);
-#else // _MSC_VER < 1400
+  __cpuidex(reinterpret_cast<int*>(out->i), in, sub);
+#else // _MSC_VER < 1500
   uint32_t cpuid_in = in;
+  uint32_t cpuid_sub = sub;
   uint32_t* cpuid_out = out->i;
 
   __asm
   {
     mov     eax, cpuid_in
+    mov     ecx, cpuid_sub
     mov     edi, cpuid_out
     cpuid
     mov     dword ptr[edi +  0], eax
@@ -91,31 +93,60 @@ static void FOG_CDECL Cpu_cpuid(uint32_t in, CpuId* out)
     mov     dword ptr[edi +  8], ecx
     mov     dword ptr[edi + 12], edx
   }
-#endif // _MSC_VER < 1400
+#endif // _MSC_VER < 1500
+}
+
+static uint32_t FOG_CDECL Cpu_xgetbv(uint32_t in)
+{
+#if _MSC_FULL_VER >= 160040219
+  return static_cast<uint32_t>(_xgetbv(in));
+#else
+  // XGETBV is not supported by the compiler, AVX2 is never used.
+  FOG_UNUSED(in);
+  return 0;
+#endif // _MSC_FULL_VER
 }
 #endif // FOG_CC_MSC
 
 #if defined(FOG_CC_GNU) || defined(FOG_CC_CLANG)
-static void FOG_CDECL Cpu_cpuid(uint32_t in, CpuId* out)
+static void FOG_CDECL Cpu_cpuid(uint32_t in, uint32_t sub, CpuId* out)
 {
 // When using GCC inline assembly it's needed to preserve EBX or RBX register.
 #if defined(FOG_ARCH_X86)
-#define _Cpuid(a, b, c, d, inp) \
+#define _Cpuid(a, b, c, d, inp, sub) \
   asm("mov %%ebx, %%edi\n"    \
       "cpuid\n"               \
       "xchg %%edi, %%ebx\n"   \
-      : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp))
+      : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp), "c" (sub))
 #else
-#define _Cpuid(a, b, c, d, inp) \
+#define _Cpuid(a, b, c, d, inp, sub) \
   asm("mov %%rbx, %%rdi\n"    \
       "cpuid\n"               \
       "xchg %%rdi, %%rbx\n"   \
-      : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp))
+      : "=a" (a), "=D" (b), "=c" (c), "=d" (d) : "a" (inp), "c" (sub))
 #endif
-  _Cpuid(out->eax, out->ebx, out->ecx, out->edx, in);
+  _Cpuid(out->eax, out->ebx, out->ecx, out->edx, in, sub);
+}
+
+static uint32_t FOG_CDECL Cpu_xgetbv(uint32_t in)
+{
+  uint32_t lo;
+  uint32_t hi;
+
+  // XGETBV encoded as bytes, older assemblers don't know the mnemonic.
+  asm(".byte 0x0F, 0x01, 0xD0\n"
+      : "=a" (lo), "=d" (hi) : "c" (in));
+
+  FOG_UNUSED(hi);
+  return lo;
 }
 #endif // FOG_CC_GNU
 
+static FOG_INLINE void Cpu_cpuid(uint32_t in, CpuId* out)
+{
+  Cpu_cpuid(in, 0, out);
+}
+
 #endif // FOG_ARCH_X86) || FOG_ARCH_X86_64
 
 // ============================================================================
@@ -205,8 +236,9 @@ static void Cpu_detect(Cpu* cpu)
   uint32_t a;
   CpuId out;
 
-  // Get vendor string.
+  // Get vendor string and the highest standard function.
   Cpu_cpuid(0, &out);
+  uint32_t maxId = out.eax;
 
   reinterpret_cast<uint32_t*>(cpu->_vendor)[0] = out.ebx;
   reinterpret_cast<uint32_t*>(cpu->_vendor)[1] = out.edx;
@@ -247,6 +279,11 @@ static void Cpu_detect(Cpu* cpu)
   if (out.ecx & 0x00800000U) features |= CPU_FEATURE_POPCNT;
   if (out.ecx & 0x10000000U) features |= CPU_FEATURE_AVX;
 
+  // AVX2 code also uses FMA3, both require the OS to save the YMM registers
+  // (OSXSAVE set and XCR0 having the XMM and YMM state enabled).
+  bool hasFma = (out.ecx & 0x00001000U) != 0;
+  bool hasYmm = (out.ecx & 0x18000000U) == 0x18000000U && (Cpu_xgetbv(0) & 0x6U) == 0x6U;
+
   if (out.edx & 0x00000010U) features |= CPU_FEATURE_RDTSC;
   if (out.edx & 0x00000100U) features |= CPU_FEATURE_CMPXCHG8B;
   if (out.edx & 0x00008000U) features |= CPU_FEATURE_CMOV;
@@ -262,6 +299,15 @@ static void Cpu_detect(Cpu* cpu)
     if (cpu->_numberOfProcessors == 1) cpu->_numberOfProcessors = 2;
   }
 
+  // Get structured extended feature flags.
+  if (maxId >= 7)
+  {
+    Cpu_cpuid(7, 0, &out);
+
+    if ((out.ebx & 0x00000020U) && hasFma && hasYmm)
+      features |= CPU_FEATURE_AVX2;
+  }
+
   // AMD-Opteron Rev.E lock-bug detection.
   if (cpu->_vendorId == CPU_VENDOR_AMD &&
       cpu->_family == 15 &&
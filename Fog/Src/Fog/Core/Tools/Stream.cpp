@@ -79,6 +79,64 @@ StringA StreamDevice::getBuffer() const
   return StringA();
 }
 
+size_t StreamDevice::peek(const uint8_t** data, size_t size)
+{
+  *data = NULL;
+  return 0;
+}
+
+size_t StreamDevice::skip(size_t size)
+{
+  if (size == 0)
+    return 0;
+
+  if ((flags & STREAM_IS_SEEKABLE) != 0)
+  {
+    int64_t pos = tell();
+    int64_t total;
+
+    if (pos != -1 && getSize(&total) == ERR_OK)
+    {
+      // Don't skip past the end of the stream, seek() allows it on files.
+      if (pos >= total)
+        return 0;
+
+      if ((uint64_t)size > (uint64_t)(total - pos))
+        size = (size_t)(total - pos);
+
+      if (seek((int64_t)size, STREAM_SEEK_CUR) == -1)
+        return 0;
+
+      return size;
+    }
+  }
+
+  // Non-seekable stream, read and discard.
+  uint8_t tmp[1024];
+  size_t done = 0;
+
+  while (done < size)
+  {
+    size_t count = Math::min<size_t>(size - done, FOG_ARRAY_SIZE(tmp));
+    size_t n = read(tmp, count);
+
+    if (n == 0 || n == (size_t)-1)
+      break;
+
+    done += n;
+    if (n != count)
+      break;
+  }
+
+  return done;
+}
+
+const uint8_t* StreamDevice::getMappedData(size_t* size) const
+{
+  *size = 0;
+  return NULL;
+}
+
 // ============================================================================
 // [Fog::NullStreamDevice]
 // ============================================================================
@@ -518,7 +576,7 @@ int64_t FdStreamDevice::seek(int64_t offset, int whence)
 
 int64_t FdStreamDevice::tell() const
 {
-  int64_t result = ::lseek64(fd, 0, SEEK_SET);
+  int64_t result = ::lseek64(fd, 0, SEEK_CUR);
 
   if (result < FOG_INT64_C(0))
     return -1;
@@ -609,6 +667,11 @@ struct FOG_NO_EXPORT MemoryStreamDevice : public StreamDevice
 
   virtual StringA getBuffer() const;
 
+  virtual size_t peek(const uint8_t** data, size_t size);
+  virtual size_t skip(size_t size);
+
+  virtual const uint8_t* getMappedData(size_t* size) const;
+
   uint8_t* data;
   size_t size;
 
@@ -731,6 +794,30 @@ StringA MemoryStreamDevice::getBuffer() const
   return buffer;
 }
 
+size_t MemoryStreamDevice::peek(const uint8_t** data, size_t size)
+{
+  size_t remain = (size_t)(end - cur);
+  if (size > remain) size = remain;
+
+  *data = cur;
+  return size;
+}
+
+size_t MemoryStreamDevice::skip(size_t size)
+{
+  size_t remain = (size_t)(end - cur);
+  if (size > remain) size = remain;
+
+  cur += size;
+  return size;
+}
+
+const uint8_t* MemoryStreamDevice::getMappedData(size_t* size) const
+{
+  *size = this->size;
+  return data;
+}
+
 // ============================================================================
 // [Fog::ByteArrayStreamDevice]
 // ============================================================================
@@ -754,6 +841,11 @@ struct FOG_NO_EXPORT ByteArrayStreamDevice : public StreamDevice
 
   virtual StringA getBuffer() const;
 
+  virtual size_t peek(const uint8_t** data, size_t size);
+  virtual size_t skip(size_t size);
+
+  virtual const uint8_t* getMappedData(size_t* size) const;
+
   StringA data;
   size_t pos;
 };
@@ -888,6 +980,330 @@ StringA ByteArrayStreamDevice::getBuffer() const
   return data;
 }
 
+size_t ByteArrayStreamDevice::peek(const uint8_t** data, size_t size)
+{
+  size_t remain = this->data.getLength() - pos;
+  if (size > remain) size = remain;
+
+  *data = reinterpret_cast<const uint8_t*>(this->data.getData()) + pos;
+  return size;
+}
+
+size_t ByteArrayStreamDevice::skip(size_t size)
+{
+  size_t remain = data.getLength() - pos;
+  if (size > remain) size = remain;
+
+  pos += size;
+  return size;
+}
+
+const uint8_t* ByteArrayStreamDevice::getMappedData(size_t* size) const
+{
+  *size = data.getLength();
+  return reinterpret_cast<const uint8_t*>(data.getData());
+}
+
+// ============================================================================
+// [Fog::BufferedStreamDevice]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Read-ahead buffer on top of other stream device.
+//!
+//! All reads smaller than the buffer capacity are served from the buffer,
+//! which is refilled by a single read of the underlying device, so decoders
+//! which read few bytes at a time don't cause a system call for each read.
+//! Reads larger than the capacity go directly to the underlying device. Write,
+//! truncate and setSize discard the buffer and reposition the device first.
+struct FOG_NO_EXPORT BufferedStreamDevice : public StreamDevice
+{
+  BufferedStreamDevice(StreamDevice* base, size_t capacity);
+  virtual ~BufferedStreamDevice();
+
+  virtual int64_t seek(int64_t offset, int whence);
+  virtual int64_t tell() const;
+
+  virtual size_t read(void* buffer, size_t size);
+  virtual size_t write(const void* buffer, size_t size);
+
+  virtual err_t getSize(int64_t* size);
+  virtual err_t setSize(int64_t size);
+  virtual err_t truncate(int64_t offset);
+
+  virtual void close();
+
+  virtual size_t peek(const uint8_t** data, size_t size);
+  virtual size_t skip(size_t size);
+
+  virtual const uint8_t* getMappedData(size_t* size) const;
+
+  //! @brief Fill the buffer so it contains at least @a minimum bytes (if
+  //! possible), returns the count of bytes available.
+  size_t fill(size_t minimum);
+
+  //! @brief Discard the buffer and reposition the underlying device to the
+  //! logical position.
+  bool discard();
+
+  //! @brief Underlying device (referenced).
+  StreamDevice* base;
+
+  //! @brief Buffer data.
+  uint8_t* buffer;
+  //! @brief Buffer capacity.
+  size_t capacity;
+
+  //! @brief Current read position in buffer.
+  uint8_t* cur;
+  //! @brief End of valid data in buffer.
+  uint8_t* end;
+
+  //! @brief Position of the underlying device (matches @c end), or -1 if
+  //! the device is not seekable.
+  int64_t basePos;
+};
+
+BufferedStreamDevice::BufferedStreamDevice(StreamDevice* base, size_t capacity) :
+  base(base),
+  capacity(capacity)
+{
+  buffer = reinterpret_cast<uint8_t*>(MemMgr::alloc(capacity));
+  cur = buffer;
+  end = buffer;
+
+  basePos = (base->flags & STREAM_IS_SEEKABLE) ? base->tell() : -1;
+  flags = base->flags | STREAM_IS_BUFFERED;
+}
+
+BufferedStreamDevice::~BufferedStreamDevice()
+{
+  close();
+  base->deref();
+}
+
+int64_t BufferedStreamDevice::seek(int64_t offset, int whence)
+{
+  int64_t target;
+  int64_t result;
+
+  if (basePos != -1 && whence != STREAM_SEEK_END)
+  {
+    int64_t bufStart = basePos - (int64_t)(end - buffer);
+    int64_t bufCur = basePos - (int64_t)(end - cur);
+
+    target = (whence == STREAM_SEEK_SET) ? offset : bufCur + offset;
+
+    // Seek inside the buffer doesn't need to touch the device at all.
+    if (target >= bufStart && target <= basePos)
+    {
+      cur = buffer + (size_t)(target - bufStart);
+      return target;
+    }
+
+    result = base->seek(target, STREAM_SEEK_SET);
+  }
+  else
+  {
+    if (whence == STREAM_SEEK_CUR)
+      offset -= (int64_t)(end - cur);
+    result = base->seek(offset, whence);
+  }
+
+  cur = buffer;
+  end = buffer;
+
+  basePos = result;
+  return result;
+}
+
+int64_t BufferedStreamDevice::tell() const
+{
+  int64_t pos = (basePos != -1) ? basePos : base->tell();
+
+  if (pos == -1)
+    return -1;
+  else
+    return pos - (int64_t)(end - cur);
+}
+
+size_t BufferedStreamDevice::read(void* dst_, size_t size)
+{
+  uint8_t* dst = reinterpret_cast<uint8_t*>(dst_);
+  size_t done = 0;
+
+  for (;;)
+  {
+    size_t avail = (size_t)(end - cur);
+
+    if (size <= avail)
+    {
+      MemOps::copy(dst, cur, size);
+      cur += size;
+      return done + size;
+    }
+
+    if (avail != 0)
+    {
+      MemOps::copy(dst, cur, avail);
+      cur = end;
+
+      dst += avail;
+      size -= avail;
+      done += avail;
+    }
+
+    // Large read, don't copy through the buffer.
+    if (size >= capacity)
+    {
+      size_t n = base->read(dst, size);
+      if (n == (size_t)-1)
+        return done ? done : n;
+
+      if (basePos != -1)
+        basePos += (int64_t)n;
+      return done + n;
+    }
+
+    if (fill(1) == 0)
+      return done;
+  }
+}
+
+size_t BufferedStreamDevice::write(const void* buffer, size_t size)
+{
+  if (!discard())
+    return 0;
+
+  size_t n = base->write(buffer, size);
+  if (basePos != -1 && n != (size_t)-1)
+    basePos += (int64_t)n;
+  return n;
+}
+
+err_t BufferedStreamDevice::getSize(int64_t* size)
+{
+  return base->getSize(size);
+}
+
+err_t BufferedStreamDevice::setSize(int64_t size)
+{
+  if (!discard())
+    return ERR_IO_CANT_RESIZE;
+  return base->setSize(size);
+}
+
+err_t BufferedStreamDevice::truncate(int64_t offset)
+{
+  if (!discard())
+    return ERR_IO_CANT_TRUNCATE;
+
+  err_t err = base->truncate(offset);
+  basePos = (base->flags & STREAM_IS_SEEKABLE) ? base->tell() : -1;
+  return err;
+}
+
+void BufferedStreamDevice::close()
+{
+  // The underlying device is closed when the last reference is released,
+  // it can be still shared by other stream.
+  if (buffer != NULL)
+  {
+    MemMgr::free(buffer);
+
+    buffer = NULL;
+    capacity = 0;
+
+    cur = NULL;
+    end = NULL;
+  }
+}
+
+size_t BufferedStreamDevice::peek(const uint8_t** data, size_t size)
+{
+  size_t avail = (size_t)(end - cur);
+  if (avail < size)
+    avail = fill(size);
+
+  *data = cur;
+  return Math::min(size, avail);
+}
+
+size_t BufferedStreamDevice::skip(size_t size)
+{
+  size_t avail = (size_t)(end - cur);
+
+  if (size <= avail)
+  {
+    cur += size;
+    return size;
+  }
+
+  cur = buffer;
+  end = buffer;
+
+  size_t n = base->skip(size - avail);
+  if (basePos != -1)
+    basePos += (int64_t)n;
+  return avail + n;
+}
+
+const uint8_t* BufferedStreamDevice::getMappedData(size_t* size) const
+{
+  return base->getMappedData(size);
+}
+
+size_t BufferedStreamDevice::fill(size_t minimum)
+{
+  size_t avail = (size_t)(end - cur);
+  if (minimum > capacity)
+    minimum = capacity;
+
+  // Move the remaining data to the beginning of the buffer.
+  if (cur != buffer)
+  {
+    if (avail != 0)
+      MemOps::move(buffer, cur, avail);
+
+    cur = buffer;
+    end = buffer + avail;
+  }
+
+  while (avail < minimum)
+  {
+    size_t n = base->read(end, capacity - avail);
+    if (n == 0 || n == (size_t)-1)
+      break;
+
+    if (basePos != -1)
+      basePos += (int64_t)n;
+
+    end += n;
+    avail += n;
+  }
+
+  return avail;
+}
+
+bool BufferedStreamDevice::discard()
+{
+  size_t avail = (size_t)(end - cur);
+
+  cur = buffer;
+  end = buffer;
+
+  if (avail == 0)
+    return true;
+
+  int64_t result = base->seek(-(int64_t)avail, STREAM_SEEK_CUR);
+  if (result == -1)
+    return false;
+
+  basePos = result;
+  return true;
+}
+
 // ============================================================================
 // [Fog::NullStreamDevice]
 // ============================================================================
@@ -1119,6 +1535,45 @@ err_t Stream::openBuffer(void* buffer, size_t size, uint32_t openFlags)
   return ERR_OK;
 }
 
+err_t Stream::openBuffered(const Stream& stream, size_t bufferSize)
+{
+  // Can be called on itself, so reference the device first.
+  StreamDevice* base = stream._d->addRef();
+
+  // Null, memory and already buffered streams are used as is.
+  if (base == _dnull || (base->flags & (STREAM_IS_MEMORY | STREAM_IS_BUFFERED)) != 0)
+  {
+    atomicPtrXchg(&_d, base)->deref();
+    return ERR_OK;
+  }
+
+  if (bufferSize < STREAM_BUFFER_MIN_SIZE)
+    bufferSize = STREAM_BUFFER_MIN_SIZE;
+
+  BufferedStreamDevice* newd = fog_new BufferedStreamDevice(base, bufferSize);
+  if (FOG_IS_NULL(newd))
+  {
+    base->deref();
+    return ERR_RT_OUT_OF_MEMORY;
+  }
+
+  if (FOG_IS_NULL(newd->buffer))
+  {
+    fog_delete(newd);
+    return ERR_RT_OUT_OF_MEMORY;
+  }
+
+#if defined(FOG_OS_POSIX) && defined(POSIX_FADV_SEQUENTIAL)
+  // Let the kernel know that we are going to read the file sequentially, it
+  // doubles the read-ahead window on Linux.
+  if ((base->flags & STREAM_IS_FD) != 0)
+    ::posix_fadvise(static_cast<FdStreamDevice*>(base)->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif // FOG_OS_POSIX && POSIX_FADV_SEQUENTIAL
+
+  atomicPtrXchg<StreamDevice>(&_d, newd)->deref();
+  return ERR_OK;
+}
+
 int64_t Stream::seek(int64_t offset, int whence)
 {
   return _d->seek(offset, whence);
@@ -1219,6 +1674,16 @@ size_t Stream::write(const StringA& data)
   return _d->write((const void*)data.getData(), data.getLength());
 }
 
+size_t Stream::peek(const uint8_t** data, size_t size)
+{
+  return _d->peek(data, size);
+}
+
+size_t Stream::skip(size_t size)
+{
+  return _d->skip(size);
+}
+
 err_t Stream::getSize(int64_t* size)
 {
   return _d->getSize(size);
@@ -1244,6 +1709,11 @@ StringA Stream::getBuffer() const
   return _d->getBuffer();
 }
 
+const uint8_t* Stream::getMappedData(size_t* size) const
+{
+  return _d->getMappedData(size);
+}
+
 Stream& Stream::operator=(const Stream& other)
 {
   atomicPtrXchg(&_d, other._d->addRef())->deref();
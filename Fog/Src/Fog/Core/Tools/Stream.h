@@ -58,6 +58,15 @@ struct FOG_API StreamDevice
 
   virtual StringA getBuffer() const;
 
+  // --------------------------------------------------------------------------
+  // [Zero-Copy]
+  // --------------------------------------------------------------------------
+
+  virtual size_t peek(const uint8_t** data, size_t size);
+  virtual size_t skip(size_t size);
+
+  virtual const uint8_t* getMappedData(size_t* size) const;
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
@@ -113,6 +122,7 @@ struct FOG_API Stream
   FOG_INLINE bool isFD()       const { return (_d->flags & STREAM_IS_FD      ) != 0; }
   FOG_INLINE bool isMemory()   const { return (_d->flags & STREAM_IS_MEMORY  ) != 0; }
   FOG_INLINE bool isGrowable() const { return (_d->flags & STREAM_IS_GROWABLE) != 0; }
+  FOG_INLINE bool isBuffered() const { return (_d->flags & STREAM_IS_BUFFERED) != 0; }
 
   void setSeekable(bool seekable);
 
@@ -135,6 +145,14 @@ struct FOG_API Stream
   err_t openBuffer(const StringA& buffer);
   err_t openBuffer(void* buffer, size_t size, uint32_t openFlags);
 
+  //! @brief Open a read-ahead buffered stream on top of @a stream.
+  //!
+  //! Reading from the returned stream is served from an internal buffer of
+  //! @a bufferSize bytes which is refilled by a single read of the underlying
+  //! device. Streams which are already memory based (@c openBuffer(),
+  //! @c openMMap()) are not wrapped, because they can't benefit from it.
+  err_t openBuffered(const Stream& stream, size_t bufferSize = STREAM_BUFFER_DEFAULT_SIZE);
+
   // --------------------------------------------------------------------------
   // [Seek / Tell]
   // --------------------------------------------------------------------------
@@ -153,6 +171,22 @@ struct FOG_API Stream
   size_t write(const void* buffer, size_t size);
   size_t write(const StringA& data);
 
+  // --------------------------------------------------------------------------
+  // [Peek / Skip]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get pointer to next @a size bytes without advancing the stream
+  //! position.
+  //!
+  //! Returns the count of bytes available at @a data, which can be less than
+  //! @a size. Only memory and buffered streams support peeking, other streams
+  //! always return zero.
+  size_t peek(const uint8_t** data, size_t size);
+
+  //! @brief Advance the stream position by @a size bytes, returning the count
+  //! of bytes really skipped.
+  size_t skip(size_t size);
+
   // --------------------------------------------------------------------------
   // [GetSize, SetSize, Truncate]
   // --------------------------------------------------------------------------
@@ -180,6 +214,14 @@ struct FOG_API Stream
   //! If stream was open by @c StringA instance, this method will return it.
   StringA getBuffer() const;
 
+  //! @brief Get pointer to the whole stream content, if the stream is memory
+  //! based (@c openBuffer() or @c openMMap()).
+  //!
+  //! Returned pointer is valid until the stream is closed or written into,
+  //! the current position can be obtained by @c tell(). Returns @c NULL if
+  //! the stream is not memory based.
+  const uint8_t* getMappedData(size_t* size) const;
+
   // --------------------------------------------------------------------------
   // [Operator Overload]
   // --------------------------------------------------------------------------
@@ -81,6 +81,7 @@
 
 #include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Imaging/ImageBits.h>
+#include <Fog/G2d/Imaging/ImageBufferPool.h>
 #include <Fog/G2d/Imaging/ImageCodec.h>
 #include <Fog/G2d/Imaging/ImageCodecProvider.h>
 #include <Fog/G2d/Imaging/ImageConverter.h>
@@ -208,6 +209,7 @@
 #include <Fog/G2d/Tools/Dpi.h>
 #include <Fog/G2d/Tools/Matrix.h>
 #include <Fog/G2d/Tools/Region.h>
+#include <Fog/G2d/Tools/RTree.h>
 
 // [Guard]
 #endif // _FOG_G2D_H
@@ -75,7 +75,7 @@ static FOG_INLINE void p32OpOverA8(uint32_t& dst0, const uint32_t& x0, const uin
   
   p32Add(t0, x0, y0);
   p32MulDiv255SBW(t1, x0, y0);
-  p32Sub(t0, t0, t1);
+  p32Sub(dst0, t0, t1);
 }
 
 // ============================================================================
@@ -24,6 +24,7 @@
 #include <Fog/G2d/Geometry/Box.h>
 #include <Fog/G2d/Geometry/Internals_p.h>
 #include <Fog/G2d/Geometry/Math2d.h>
+#include <Fog/G2d/Geometry/PathHitIndex.h>
 #include <Fog/G2d/Geometry/PathInfo.h>
 #include <Fog/G2d/Geometry/Point.h>
 #include <Fog/G2d/Geometry/PointArray.h>
@@ -60,15 +61,43 @@ FOG_STATIC_INLINE_T PathDataD* PathT_getDEmpty<double>() { return &PathD_dEmpty;
 // [Fog::Path - Helpers]
 // ============================================================================
 
+//! @internal
+//!
+//! @brief Minimum length of the path to use the hit-index by @c hitTest().
+#define PATH_HIT_INDEX_MIN_LENGTH 128
+
+template<typename NumT>
+static FOG_INLINE void PathT_destroyCache(NumT_(PathData)* d)
+{
+  if (AtomicCore<NumT_(PathInfo)*>::get((NumT_(PathInfo)**)&d->info) != NULL)
+  {
+    NumT_(PathInfo)* info = AtomicCore<NumT_(PathInfo)*>::setXchg((NumT_(PathInfo)**)&d->info, NULL);
+    if (info != NULL)
+      info->release();
+  }
+
+  if (AtomicCore<NumT_(PathHitIndex)*>::get((NumT_(PathHitIndex)**)&d->hitIndex) != NULL)
+  {
+    NumT_(PathHitIndex)* hitIndex = AtomicCore<NumT_(PathHitIndex)*>::setXchg((NumT_(PathHitIndex)**)&d->hitIndex, NULL);
+    if (hitIndex != NULL)
+      hitIndex->release();
+  }
+
+  d->hitIndexPending = 0;
+}
+
+//! @internal
+//!
+//! @brief Destroy the path-info and hit-index if the path was modified in
+//! place after they were created (@c PATH_FLAG_DIRTY_INFO).
 template<typename NumT>
-static FOG_INLINE void PathT_destroyPathInfo(NumT_(PathData)* d)
+static FOG_INLINE void PathT_validateCache(NumT_(PathData)* d)
 {
-  if (AtomicCore<NumT_(PathInfo)*>::get((NumT_(PathInfo)**)&d->info) == NULL)
+  if ((d->vType & PATH_FLAG_DIRTY_INFO) == 0)
     return;
 
-  NumT_(PathInfo)* info = AtomicCore<NumT_(PathInfo)*>::setXchg((NumT_(PathInfo)**)&d->info, NULL);
-  if (info != NULL)
-    info->release();
+  PathT_destroyCache<NumT>(d);
+  d->vType &= ~PATH_FLAG_DIRTY_INFO;
 }
 
 template<typename NumT>
@@ -111,7 +140,7 @@ static FOG_INLINE void PathT_updateDataPointers(
       if (FOG_LIKELY(d->reference.get() == 1 && _Count_ <= _remain)) \
       { \
         d->length += _Count_; \
-        PathT_destroyPathInfo<NumT>(d); \
+        PathT_destroyCache<NumT>(d); \
       } \
       else \
       { \
@@ -149,6 +178,8 @@ static NumT_(PathData)* FOG_CDECL PathT_dCreate(size_t capacity)
 
   newd->boundingBox.reset();
   newd->info = NULL;
+  newd->hitIndex = NULL;
+  newd->hitIndexPending = 0;
 
   PathT_updateDataPointers<NumT>(newd, capacity);
   return newd;
@@ -168,6 +199,8 @@ static NumT_(PathData)* FOG_CDECL PathT_dAdopt(void* address, size_t capacity)
 
   newd->boundingBox.reset();
   newd->info = NULL;
+  newd->hitIndex = NULL;
+  newd->hitIndexPending = 0;
 
   PathT_updateDataPointers<NumT>(newd, capacity);
   return newd;
@@ -193,6 +226,8 @@ static NumT_(PathData)* FOG_CDECL PathT_dRealloc(NumT_(PathData)* d, size_t capa
 
   newd->boundingBox = d->boundingBox;
   newd->info = d->info ? d->info->addRef() : NULL;
+  newd->hitIndex = d->hitIndex ? d->hitIndex->addRef() : NULL;
+  newd->hitIndexPending = 0;
 
   PathT_updateDataPointers<NumT>(newd, capacity);
   MemOps::copy(newd->commands, d->commands, length);
@@ -222,6 +257,8 @@ static NumT_(PathData)* FOG_CDECL PathT_dCopy(const NumT_(PathData)* d)
 
   newd->boundingBox = d->boundingBox;
   newd->info = d->info ? d->info->addRef() : NULL;
+  newd->hitIndex = d->hitIndex ? d->hitIndex->addRef() : NULL;
+  newd->hitIndexPending = 0;
 
   PathT_updateDataPointers<NumT>(newd, length);
   MemOps::copy(newd->commands, d->commands, length);
@@ -324,7 +361,7 @@ static size_t FOG_CDECL PathT_prepare(NumT_(Path)* self, uint32_t cntOp, size_t
   if (d->reference.get() == 1 && count <= remain)
   {
     d->length = start + count;
-    PathT_destroyPathInfo<NumT>(d);
+    PathT_destroyCache<NumT>(d);
   }
   else
   {
@@ -365,7 +402,7 @@ static size_t FOG_CDECL PathT_add(NumT_(Path)* self, size_t count)
   if (d->reference.get() == 1 && count <= remain)
   {
     d->length += count;
-    PathT_destroyPathInfo<NumT>(d);
+    PathT_destroyCache<NumT>(d);
   }
   else
   {
@@ -409,7 +446,7 @@ static void FOG_CDECL PathT_clear(NumT_(Path)* self)
     d->length = 0;
     d->vType &= ~PATH_FLAG_MASK;
     d->boundingBox.reset();
-    PathT_destroyPathInfo<NumT>(d);
+    PathT_destroyCache<NumT>(d);
   }
 }
 
@@ -512,7 +549,7 @@ static err_t FOG_CDECL PathT_setVertex(NumT_(Path)* self, size_t index, const Nu
     return ERR_RT_INVALID_ARGUMENT;
 
   FOG_RETURN_ON_ERROR(self->detach());
-  PathT_destroyPathInfo<NumT>(self->_d);
+  PathT_destroyCache<NumT>(self->_d);
 
   self->_d->vertices[index] = *pt;
   self->_d->vType |= PATH_FLAG_DIRTY_BBOX;
@@ -2930,12 +2967,68 @@ _Invalid:
   return ERR_GEOMETRY_INVALID;
 }
 
+// ============================================================================
+// [Fog::Path - Hit-Index]
+// ============================================================================
+
+template<typename NumT>
+static const NumT_(PathHitIndex)* FOG_CDECL PathT_getHitIndex(const NumT_(Path)* self)
+{
+  NumT_(PathData)* d = self->_d;
+  PathT_validateCache<NumT>(d);
+
+  NumT_(PathHitIndex)* hitIndex = AtomicCore<NumT_(PathHitIndex)*>::get((NumT_(PathHitIndex)**)&d->hitIndex);
+
+  if (hitIndex != NULL)
+    return hitIndex;
+
+  NumT_(PathHitIndex)* newIndex = NumI_(PathHitIndex)::generate(*self);
+
+  if (newIndex == NULL)
+    return NULL;
+
+  if (!AtomicCore<NumT_(PathHitIndex)*>::cmpXchg((NumT_(PathHitIndex)**)&d->hitIndex, (NumT_(PathHitIndex)*)NULL, newIndex))
+  {
+    MemMgr::free(newIndex);
+    newIndex = AtomicCore<NumT_(PathHitIndex)*>::get((NumT_(PathHitIndex)**)&d->hitIndex);
+  }
+
+  return newIndex;
+}
+
+// The hit-index is built by the second hit-test of the path since it was
+// modified (hitIndexPending is set by the first one), so temporary paths,
+// which are tested only once (for example stroked paths), don't pay for it.
+template<typename NumT>
+static const NumT_(PathHitIndex)* FOG_CDECL PathT_getHitIndexLazy(const NumT_(Path)* self)
+{
+  NumT_(PathData)* d = self->_d;
+
+  if (d->length < PATH_HIT_INDEX_MIN_LENGTH)
+    return NULL;
+
+  PathT_validateCache<NumT>(d);
+
+  NumT_(PathHitIndex)* hitIndex = AtomicCore<NumT_(PathHitIndex)*>::get((NumT_(PathHitIndex)**)&d->hitIndex);
+
+  if (hitIndex != NULL)
+    return hitIndex;
+
+  if (d->hitIndexPending == 0)
+  {
+    d->hitIndexPending = 1;
+    return NULL;
+  }
+
+  return PathT_getHitIndex<NumT>(self);
+}
+
 // ============================================================================
 // [Fog::Path - HitTest]
 // ============================================================================
 
 template<typename NumT>
-static bool FOG_CDECL PathT_hitTest(
+static bool FOG_CDECL PathT_hitTestDirect(
   const NumT_(Path)* self,
   const NumT_(Point)* pt, uint32_t fillRule)
 {
@@ -3307,6 +3400,42 @@ _Invalid:
   return false;
 }
 
+template<typename NumT>
+static bool FOG_CDECL PathT_hitTest(
+  const NumT_(Path)* self,
+  const NumT_(Point)* pt, uint32_t fillRule)
+{
+  const NumT_(PathHitIndex)* hitIndex = PathT_getHitIndexLazy<NumT>(self);
+  if (hitIndex != NULL)
+    return hitIndex->hitTest(*pt, fillRule);
+
+  return PathT_hitTestDirect<NumT>(self, pt, fillRule);
+}
+
+template<typename NumT>
+static void FOG_CDECL PathT_hitTestPoints(
+  const NumT_(Path)* self,
+  bool* dst, const NumT_(Point)* pts, size_t count, uint32_t fillRule)
+{
+  if (count == 0)
+    return;
+
+  // Building the hit-index costs approximately the same as a single query
+  // walking the whole path, so it's used for any batch of more points.
+  const NumT_(PathHitIndex)* hitIndex = NULL;
+  if (count > 1)
+    hitIndex = PathT_getHitIndex<NumT>(self);
+
+  if (hitIndex != NULL)
+  {
+    hitIndex->hitTest(dst, pts, count, fillRule);
+    return;
+  }
+
+  for (size_t i = 0; i < count; i++)
+    dst[i] = PathT_hitTest<NumT>(self, &pts[i], fillRule);
+}
+
 // ============================================================================
 // [Fog::Path - GetClosestVertex]
 // ============================================================================
@@ -3470,7 +3599,28 @@ static err_t FOG_CDECL PathT_transform(
       if (length == 0) return ERR_OK;
 
       FOG_RETURN_ON_ERROR(self->detach());
-      tr->_mapPoints(self->_d->vertices, self->_d->vertices, self->_d->length);
+
+      // The bounding-box of a path without curves is the bounding-box of its
+      // vertices, so it's calculated together with the mapping.
+      if (!self->hasBeziers())
+      {
+        NumT_(Box) box(UNINITIALIZED);
+        tr->_mapPointsAndBox(self->_d->vertices, self->_d->vertices, length, box);
+
+        if (box.x0 <= box.x1)
+        {
+          self->_d->boundingBox = box;
+          self->_d->vType = (self->_d->vType & ~PATH_FLAG_DIRTY_BBOX) |
+                            PATH_FLAG_HAS_BBOX | PATH_FLAG_DIRTY_INFO;
+        }
+        else
+        {
+          self->_d->vType |= PATH_FLAG_DIRTY_BBOX | PATH_FLAG_DIRTY_INFO;
+        }
+        return ERR_OK;
+      }
+
+      tr->_mapPoints(self->_d->vertices, self->_d->vertices, length);
 
       self->_d->vType |= PATH_FLAG_DIRTY_BBOX | PATH_FLAG_DIRTY_INFO;
       return ERR_OK;
@@ -3746,6 +3896,8 @@ template<typename NumT>
 const NumT_(PathInfo)* FOG_CDECL PathT_getPathInfo(const NumT_(Path)* self)
 {
   NumT_(PathData)* d = self->_d;
+  PathT_validateCache<NumT>(d);
+
   NumT_(PathInfo)* info = AtomicCore<NumT_(PathInfo)*>::get((NumT_(PathInfo)**)&d->info);
 
   if (info != NULL)
@@ -3793,6 +3945,9 @@ static void FOG_CDECL PathT_dFree(NumT_(PathData)* d)
   if (d->info != NULL)
     const_cast<NumT_(PathInfo)*>(d->info)->release();
 
+  if (d->hitIndex != NULL)
+    const_cast<NumT_(PathHitIndex)*>(d->hitIndex)->release();
+
   if ((d->vType & VAR_FLAG_STATIC) == 0)
     MemMgr::free(d);
 }
@@ -3866,6 +4021,8 @@ FOG_NO_EXPORT void Path_init(void)
   fog_api.pathf_flatten = PathT_flatten<float>;
   fog_api.pathf_getBoundingBox = PathT_getBoundingBox<float>;
   fog_api.pathf_hitTest = PathT_hitTest<float>;
+  fog_api.pathf_hitTestPoints = PathT_hitTestPoints<float>;
+  fog_api.pathf_hitTestDirect = PathT_hitTestDirect<float>;
   fog_api.pathf_getClosestVertex = PathT_getClosestVertex<float>;
   fog_api.pathf_translate = PathT_translate<float>;
   fog_api.pathf_transform = PathT_transform<float>;
@@ -3874,6 +4031,8 @@ FOG_NO_EXPORT void Path_init(void)
   fog_api.pathf_flipX = PathT_flipX<float>;
   fog_api.pathf_flipY = PathT_flipY<float>;
   fog_api.pathf_getPathInfo = PathT_getPathInfo<float>;
+  fog_api.pathf_getHitIndex = PathT_getHitIndex<float>;
+  fog_api.pathf_getHitIndexLazy = PathT_getHitIndexLazy<float>;
   fog_api.pathf_eq = PathT_eq<float>;
   fog_api.pathf_dCreate = PathT_dCreate<float>;
   fog_api.pathf_dAdopt = PathT_dAdopt<float>;
@@ -3946,6 +4105,8 @@ FOG_NO_EXPORT void Path_init(void)
   fog_api.pathd_flatten = PathT_flatten<double>;
   fog_api.pathd_getBoundingBox = PathT_getBoundingBox<double>;
   fog_api.pathd_hitTest = PathT_hitTest<double>;
+  fog_api.pathd_hitTestPoints = PathT_hitTestPoints<double>;
+  fog_api.pathd_hitTestDirect = PathT_hitTestDirect<double>;
   fog_api.pathd_getClosestVertex = PathT_getClosestVertex<double>;
   fog_api.pathd_translate = PathT_translate<double>;
   fog_api.pathd_transform = PathT_transform<double>;
@@ -3954,6 +4115,8 @@ FOG_NO_EXPORT void Path_init(void)
   fog_api.pathd_flipX = PathT_flipX<double>;
   fog_api.pathd_flipY = PathT_flipY<double>;
   fog_api.pathd_getPathInfo = PathT_getPathInfo<double>;
+  fog_api.pathd_getHitIndex = PathT_getHitIndex<double>;
+  fog_api.pathd_getHitIndexLazy = PathT_getHitIndexLazy<double>;
   fog_api.pathd_eq = PathT_eq<double>;
   fog_api.pathd_dCreate = PathT_dCreate<double>;
   fog_api.pathd_dAdopt = PathT_dAdopt<double>;
@@ -19,6 +19,7 @@
 #include <Fog/G2d/Geometry/Ellipse.h>
 #include <Fog/G2d/Geometry/Line.h>
 #include <Fog/G2d/Geometry/Math2d.h>
+#include <Fog/G2d/Geometry/PathHitIndex.h>
 #include <Fog/G2d/Geometry/PathInfo.h>
 #include <Fog/G2d/Geometry/Point.h>
 #include <Fog/G2d/Geometry/QBezier.h>
@@ -235,6 +236,11 @@ struct FOG_NO_EXPORT PathDataF
 
   //! @brief Link to the path info.
   const PathInfoF* info;
+  //! @brief Link to the path hit-index.
+  const PathHitIndexF* hitIndex;
+  //! @brief Whether the path was hit-tested without the hit-index since it
+  //! was modified, see @c PathF::getHitIndexLazy().
+  volatile uint32_t hitIndexPending;
 
   //! @brief Vertices data (aligned to 16 bytes).
   PointF* vertices;
@@ -298,6 +304,11 @@ struct FOG_NO_EXPORT PathDataD
 
   //! @brief Link to the path info.
   const PathInfoD* info;
+  //! @brief Link to the path hit-index.
+  const PathHitIndexD* hitIndex;
+  //! @brief Whether the path was hit-tested without the hit-index since it
+  //! was modified, see @c PathD::getHitIndexLazy().
+  volatile uint32_t hitIndexPending;
 
   //! @brief Vertices data (aligned to 16 bytes).
   PointD* vertices;
@@ -1162,11 +1173,28 @@ struct FOG_NO_EXPORT PathF
   // [HitTest]
   // --------------------------------------------------------------------------
 
+  //! @brief Hit-test the point @a pt using @a fillRule.
+  //!
+  //! @note When the same large path is hit-tested repeatedly, the hit-index
+  //! is built and used to answer the query, see @c getHitIndexLazy().
   FOG_INLINE bool hitTest(const PointF& pt, uint32_t fillRule) const
   {
     return fog_api.pathf_hitTest(this, &pt, fillRule);
   }
 
+  //! @brief Hit-test @a count points at @a pts, storing the results to @a dst.
+  FOG_INLINE void hitTest(bool* dst, const PointF* pts, size_t count, uint32_t fillRule) const
+  {
+    fog_api.pathf_hitTestPoints(this, dst, pts, count, fillRule);
+  }
+
+  //! @brief Hit-test the point @a pt using @a fillRule, without using or
+  //! building the hit-index (see @c getHitIndexLazy()).
+  FOG_INLINE bool hitTestDirect(const PointF& pt, uint32_t fillRule) const
+  {
+    return fog_api.pathf_hitTestDirect(this, &pt, fillRule);
+  }
+
   // --------------------------------------------------------------------------
   // [GetClosestVertex]
   // --------------------------------------------------------------------------
@@ -1249,6 +1277,76 @@ struct FOG_NO_EXPORT PathF
     return fog_api.pathf_getPathInfo(this);
   }
 
+  //! @brief Get the point at @a distance from the start of the path.
+  //!
+  //! The path-info is built by the first query and cached by the path until
+  //! it's modified, see @c PathInfoF::getPointAtDistance().
+  FOG_INLINE err_t getPointAtDistance(PointF& dst, float distance) const
+  {
+    const PathInfoF* info = fog_api.pathf_getPathInfo(this);
+    if (FOG_IS_NULL(info))
+      return ERR_GEOMETRY_NONE;
+
+    return info->getPointAtDistance(dst, *this, distance);
+  }
+
+  //! @brief Get the unit tangent at @a distance from the start of the path.
+  FOG_INLINE err_t getTangentAtDistance(PointF& dst, float distance) const
+  {
+    const PathInfoF* info = fog_api.pathf_getPathInfo(this);
+    if (FOG_IS_NULL(info))
+      return ERR_GEOMETRY_NONE;
+
+    return info->getTangentAtDistance(dst, *this, distance);
+  }
+
+  //! @brief Get the point and the unit tangent at @a distance from the start
+  //! of the path, @a cursor speeds up queries of increasing distances.
+  FOG_INLINE err_t getPointAtDistance(PointF* dstPt, PointF* dstTangent, float distance, PathInfoCursor* cursor) const
+  {
+    const PathInfoF* info = fog_api.pathf_getPathInfo(this);
+    if (FOG_IS_NULL(info))
+      return ERR_GEOMETRY_NONE;
+
+    return info->getPointAtDistance(dstPt, dstTangent, *this, distance, cursor);
+  }
+
+  //! @brief Append the part of the path between the distances @a from and
+  //! @a to to @a dst.
+  FOG_INLINE err_t getSegment(PathF& dst, float from, float to) const
+  {
+    const PathInfoF* info = fog_api.pathf_getPathInfo(this);
+    if (FOG_IS_NULL(info))
+      return ERR_GEOMETRY_NONE;
+
+    return info->getSegment(dst, *this, from, to);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Hit-Index]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the hit-index of the flattened path, building it if needed.
+  //!
+  //! The hit-index is cached by the path and it's destroyed when the path is
+  //! modified. @c NULL is returned if the path is empty or invalid.
+  FOG_INLINE const PathHitIndexF* getHitIndex() const
+  {
+    return fog_api.pathf_getHitIndex(this);
+  }
+
+  //! @brief Get the hit-index of the path, which was already hit-tested.
+  //!
+  //! The first call since the path was modified only marks the path and
+  //! returns @c NULL, the caller is expected to use the direct hit-test
+  //! (@c hitTestDirect()). The next call builds the hit-index. This is used
+  //! by @c hitTest(), so paths tested only once don't pay for building the
+  //! hit-index. @c NULL is also returned for small paths.
+  FOG_INLINE const PathHitIndexF* getHitIndexLazy() const
+  {
+    return fog_api.pathf_getHitIndexLazy(this);
+  }
+
   // --------------------------------------------------------------------------
   // [Equality]
   // --------------------------------------------------------------------------
@@ -1263,7 +1361,7 @@ struct FOG_NO_EXPORT PathF
   // --------------------------------------------------------------------------
 
   //! @brief Must be called when the path was modified to invalidate the cached
-  //! bounding-box, path type, and path-info.
+  //! bounding-box, path type, path-info, and hit-index.
   FOG_INLINE void _modified()
   {
     FOG_ASSERT(isDetached());
@@ -1271,7 +1369,7 @@ struct FOG_NO_EXPORT PathF
   }
 
   //! @brief Called when the path vertices were manually modified, invalidating
-  //! bounding-box and path-info cache.
+  //! bounding-box, path-info, and hit-index cache.
   FOG_INLINE void _modifiedVertices() const
   {
     FOG_ASSERT(isDetached());
@@ -1311,6 +1409,21 @@ struct FOG_NO_EXPORT PathF
     return (EqFunc)fog_api.pathf_eq;
   }
 
+  // --------------------------------------------------------------------------
+  // [Statics - Combine]
+  // --------------------------------------------------------------------------
+
+  //! @brief Combine paths @a a and @a b using boolean operator @a op and
+  //! store the result into @a dst.
+  //!
+  //! Both inputs are filled using @a fillRule. The result is a set of closed,
+  //! non-overlapping polygons (curves are flattened), so it can be filled by
+  //! any fill rule. The @a dst path can be the same instance as @a a or @a b.
+  static FOG_INLINE err_t combine(PathF& dst, const PathF& a, const PathF& b, uint32_t op, uint32_t fillRule = FILL_RULE_NON_ZERO)
+  {
+    return fog_api.pathf_combine(&dst, &a, &b, op, fillRule);
+  }
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
@@ -2238,11 +2351,28 @@ struct FOG_NO_EXPORT PathD
   // [HitTest]
   // --------------------------------------------------------------------------
 
+  //! @brief Hit-test the point @a pt using @a fillRule.
+  //!
+  //! @note When the same large path is hit-tested repeatedly, the hit-index
+  //! is built and used to answer the query, see @c getHitIndexLazy().
   FOG_INLINE bool hitTest(const PointD& pt, uint32_t fillRule) const
   {
     return fog_api.pathd_hitTest(this, &pt, fillRule);
   }
 
+  //! @brief Hit-test @a count points at @a pts, storing the results to @a dst.
+  FOG_INLINE void hitTest(bool* dst, const PointD* pts, size_t count, uint32_t fillRule) const
+  {
+    fog_api.pathd_hitTestPoints(this, dst, pts, count, fillRule);
+  }
+
+  //! @brief Hit-test the point @a pt using @a fillRule, without using or
+  //! building the hit-index (see @c getHitIndexLazy()).
+  FOG_INLINE bool hitTestDirect(const PointD& pt, uint32_t fillRule) const
+  {
+    return fog_api.pathd_hitTestDirect(this, &pt, fillRule);
+  }
+
   // --------------------------------------------------------------------------
   // [GetClosestVertex]
   // --------------------------------------------------------------------------
@@ -2325,6 +2455,76 @@ struct FOG_NO_EXPORT PathD
     return fog_api.pathd_getPathInfo(this);
   }
 
+  //! @brief Get the point at @a distance from the start of the path.
+  //!
+  //! The path-info is built by the first query and cached by the path until
+  //! it's modified, see @c PathInfoD::getPointAtDistance().
+  FOG_INLINE err_t getPointAtDistance(PointD& dst, double distance) const
+  {
+    const PathInfoD* info = fog_api.pathd_getPathInfo(this);
+    if (FOG_IS_NULL(info))
+      return ERR_GEOMETRY_NONE;
+
+    return info->getPointAtDistance(dst, *this, distance);
+  }
+
+  //! @brief Get the unit tangent at @a distance from the start of the path.
+  FOG_INLINE err_t getTangentAtDistance(PointD& dst, double distance) const
+  {
+    const PathInfoD* info = fog_api.pathd_getPathInfo(this);
+    if (FOG_IS_NULL(info))
+      return ERR_GEOMETRY_NONE;
+
+    return info->getTangentAtDistance(dst, *this, distance);
+  }
+
+  //! @brief Get the point and the unit tangent at @a distance from the start
+  //! of the path, @a cursor speeds up queries of increasing distances.
+  FOG_INLINE err_t getPointAtDistance(PointD* dstPt, PointD* dstTangent, double distance, PathInfoCursor* cursor) const
+  {
+    const PathInfoD* info = fog_api.pathd_getPathInfo(this);
+    if (FOG_IS_NULL(info))
+      return ERR_GEOMETRY_NONE;
+
+    return info->getPointAtDistance(dstPt, dstTangent, *this, distance, cursor);
+  }
+
+  //! @brief Append the part of the path between the distances @a from and
+  //! @a to to @a dst.
+  FOG_INLINE err_t getSegment(PathD& dst, double from, double to) const
+  {
+    const PathInfoD* info = fog_api.pathd_getPathInfo(this);
+    if (FOG_IS_NULL(info))
+      return ERR_GEOMETRY_NONE;
+
+    return info->getSegment(dst, *this, from, to);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Hit-Index]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the hit-index of the flattened path, building it if needed.
+  //!
+  //! The hit-index is cached by the path and it's destroyed when the path is
+  //! modified. @c NULL is returned if the path is empty or invalid.
+  FOG_INLINE const PathHitIndexD* getHitIndex() const
+  {
+    return fog_api.pathd_getHitIndex(this);
+  }
+
+  //! @brief Get the hit-index of the path, which was already hit-tested.
+  //!
+  //! The first call since the path was modified only marks the path and
+  //! returns @c NULL, the caller is expected to use the direct hit-test
+  //! (@c hitTestDirect()). The next call builds the hit-index. This is used
+  //! by @c hitTest(), so paths tested only once don't pay for building the
+  //! hit-index. @c NULL is also returned for small paths.
+  FOG_INLINE const PathHitIndexD* getHitIndexLazy() const
+  {
+    return fog_api.pathd_getHitIndexLazy(this);
+  }
+
   // --------------------------------------------------------------------------
   // [Equality]
   // --------------------------------------------------------------------------
@@ -2339,7 +2539,7 @@ struct FOG_NO_EXPORT PathD
   // --------------------------------------------------------------------------
 
   //! @brief Must be called when the path was modified to invalidate the cached
-  //! bounding-box, path type, and path-info.
+  //! bounding-box, path type, path-info, and hit-index.
   FOG_INLINE void _modified()
   {
     FOG_ASSERT(isDetached());
@@ -2347,7 +2547,7 @@ struct FOG_NO_EXPORT PathD
   }
 
   //! @brief Called when the path vertices were manually modified, invalidating
-  //! bounding-box and path-info cache.
+  //! bounding-box, path-info, and hit-index cache.
   FOG_INLINE void _modifiedVertices() const
   {
     FOG_ASSERT(isDetached());
@@ -2396,6 +2596,21 @@ struct FOG_NO_EXPORT PathD
     return (EqFunc)fog_api.pathd_eq;
   }
 
+  // --------------------------------------------------------------------------
+  // [Statics - Combine]
+  // --------------------------------------------------------------------------
+
+  //! @brief Combine paths @a a and @a b using boolean operator @a op and
+  //! store the result into @a dst.
+  //!
+  //! Both inputs are filled using @a fillRule. The result is a set of closed,
+  //! non-overlapping polygons (curves are flattened), so it can be filled by
+  //! any fill rule. The @a dst path can be the same instance as @a a or @a b.
+  static FOG_INLINE err_t combine(PathD& dst, const PathD& a, const PathD& b, uint32_t op, uint32_t fillRule = FILL_RULE_NON_ZERO)
+  {
+    return fog_api.pathd_combine(&dst, &a, &b, op, fillRule);
+  }
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
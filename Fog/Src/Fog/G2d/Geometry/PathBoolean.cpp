@@ -0,0 +1,1085 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Math/Constants.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Tools/Algorithm.h>
+#include <Fog/G2d/Geometry/Box.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Geometry/PathClipper.h>
+#include <Fog/G2d/Geometry/PathTmp_p.h>
+#include <Fog/G2d/Geometry/Point.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::PathBoolean - Overview]
+// ============================================================================
+
+// Boolean operations are computed by a sweep-line (scan-beam) algorithm
+// similar to Vatti's polygon clipper, working on the flattened input in
+// double precision:
+//
+// 1. All non-horizontal edges of both paths are collected (figures are
+//    implicitly closed), each edge remembers its winding direction and the
+//    source path.
+//
+// 2. The plane is divided to scan-beams by the Y coordinates of all vertices.
+//    Each scan-beam is further split at the Y coordinate of the first edge
+//    intersection (found by comparing the order of active edges at the top
+//    and bottom of the beam), so there is no intersection inside of a beam.
+//
+// 3. Active edges are walked from left to right, winding numbers of both
+//    paths are accumulated and the result of the boolean operator is
+//    evaluated for each gap between edges. Edge where the result changes is
+//    a boundary of the result. Coincident edges are processed as a group.
+//
+// 4. Horizontal parts of the boundary are created at each beam boundary from
+//    the difference of the inside intervals below and above the line.
+//
+// 5. Boundary segments are oriented (outer contours and holes wind in the
+//    opposite directions) and linked to closed contours by their end-points,
+//    collinear segments which come from the same edge are merged.
+//
+// The result contains non-overlapping contours which can be filled using
+// both FILL_RULE_NON_ZERO and FILL_RULE_EVEN_ODD.
+
+// ============================================================================
+// [Fog::PathBooleanArray<>]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Simple growable array of POD items used by the boolean operations.
+template<typename ItemT>
+struct PathBooleanArray
+{
+  FOG_INLINE PathBooleanArray() :
+    data(NULL),
+    length(0),
+    capacity(0)
+  {
+  }
+
+  FOG_INLINE ~PathBooleanArray()
+  {
+    if (data != NULL)
+      MemMgr::free(data);
+  }
+
+  FOG_INLINE ItemT* add()
+  {
+    if (FOG_UNLIKELY(length == capacity) && !_grow())
+      return NULL;
+    return &data[length++];
+  }
+
+  FOG_NO_INLINE bool _grow()
+  {
+    size_t newCapacity = capacity < 64 ? 64 : capacity * 2;
+    ItemT* newData = reinterpret_cast<ItemT*>(MemMgr::realloc(data, newCapacity * sizeof(ItemT)));
+
+    if (FOG_IS_NULL(newData))
+      return false;
+
+    data = newData;
+    capacity = newCapacity;
+    return true;
+  }
+
+  FOG_INLINE void clear()
+  {
+    length = 0;
+  }
+
+  FOG_INLINE void swap(PathBooleanArray<ItemT>& other)
+  {
+    swapValue(data, other.data);
+    swapValue(length, other.length);
+    swapValue(capacity, other.capacity);
+  }
+
+  template<typename T>
+  static FOG_INLINE void swapValue(T& a, T& b)
+  {
+    T t(a); a = b; b = t;
+  }
+
+  ItemT* data;
+  size_t length;
+  size_t capacity;
+};
+
+// ============================================================================
+// [Fog::PathBooleanEdge]
+// ============================================================================
+
+//! @internal
+struct PathBooleanEdge
+{
+  //! @brief Get the X coordinate of the edge at @a y.
+  //!
+  //! The result is deterministic, the same Y always produces the same X, this
+  //! is required to link segments of adjacent beams.
+  FOG_INLINE double getX(double y) const
+  {
+    if (y <= y0) return x0;
+    if (y >= y1) return x1;
+    return x0 + (y - y0) * dxdy;
+  }
+
+  //! @brief Start point (y0 is always lower than y1).
+  double x0, y0;
+  //! @brief End point.
+  double x1, y1;
+  //! @brief Inverted slope.
+  double dxdy;
+
+  //! @brief X at the bottom (ya) and top (yb) of the current beam.
+  double xa, xb;
+
+  //! @brief Winding direction (1 or -1).
+  int winding;
+  //! @brief Source path (0 or 1).
+  uint32_t src;
+  //! @brief Edge id (used to merge collinear segments).
+  uint32_t id;
+
+  //! @brief Index of the last segment emitted by this edge (or -1).
+  size_t segIndex;
+};
+
+// ============================================================================
+// [Fog::PathBooleanSegment]
+// ============================================================================
+
+//! @internal
+struct PathBooleanSegment
+{
+  double x0, y0;
+  double x1, y1;
+
+  uint32_t id;
+  uint32_t used;
+};
+
+//! @internal
+//!
+//! @brief Id flag used by horizontal segments.
+static const uint32_t PATH_BOOLEAN_ID_HORZ = 0x80000000U;
+
+// ============================================================================
+// [Fog::PathBooleanVertex]
+// ============================================================================
+
+//! @internal
+struct PathBooleanVertex
+{
+  double x, y;
+  uint32_t id;
+};
+
+// ============================================================================
+// [Fog::PathBoolean - Helpers]
+// ============================================================================
+
+static int FOG_CDECL PathBoolean_compareEdge(const void* _a, const void* _b)
+{
+  const PathBooleanEdge* a = reinterpret_cast<const PathBooleanEdge*>(_a);
+  const PathBooleanEdge* b = reinterpret_cast<const PathBooleanEdge*>(_b);
+
+  if (a->y0 < b->y0) return -1;
+  if (a->y0 > b->y0) return 1;
+  return 0;
+}
+
+static int FOG_CDECL PathBoolean_compareDouble(const void* _a, const void* _b)
+{
+  double a = *reinterpret_cast<const double*>(_a);
+  double b = *reinterpret_cast<const double*>(_b);
+
+  if (a < b) return -1;
+  if (a > b) return 1;
+  return 0;
+}
+
+static int FOG_CDECL PathBoolean_compareSegment(const void* _a, const void* _b)
+{
+  const PathBooleanSegment* a = reinterpret_cast<const PathBooleanSegment*>(_a);
+  const PathBooleanSegment* b = reinterpret_cast<const PathBooleanSegment*>(_b);
+
+  if (a->y0 < b->y0) return -1;
+  if (a->y0 > b->y0) return 1;
+  if (a->x0 < b->x0) return -1;
+  if (a->x0 > b->x0) return 1;
+  return 0;
+}
+
+static FOG_INLINE bool PathBoolean_isInside(int winding, uint32_t fillRule)
+{
+  if (fillRule == FILL_RULE_EVEN_ODD)
+    return (winding & 1) != 0;
+  else
+    return winding != 0;
+}
+
+static FOG_INLINE bool PathBoolean_op(uint32_t op, bool a, bool b)
+{
+  switch (op)
+  {
+    case PATH_OP_UNION       : return a || b;
+    case PATH_OP_INTERSECT   : return a && b;
+    case PATH_OP_SUBTRACT    : return a && !b;
+    case PATH_OP_SUBTRACT_REV: return b && !a;
+    case PATH_OP_XOR         : return a != b;
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+      return false;
+  }
+}
+
+// ============================================================================
+// [Fog::PathBooleanContext]
+// ============================================================================
+
+//! @internal
+struct PathBooleanContext
+{
+  FOG_INLINE PathBooleanContext(uint32_t op, uint32_t fillRule) :
+    op(op),
+    fillRule(fillRule),
+    eps(0.0)
+  {
+  }
+
+  template<typename NumT>
+  err_t addPath(const NumT_(Path)& path, uint32_t src);
+  err_t addEdge(double x0, double y0, double x1, double y1, uint32_t src);
+
+  err_t sweep();
+  err_t addBeam(double ya, double yb);
+  err_t addHorizontal(double y, const PathBooleanArray<double>& below, const PathBooleanArray<double>& above);
+  err_t addSegment(double x0, double y0, double x1, double y1, uint32_t id);
+
+  template<typename NumT>
+  err_t trace(NumT_(Path)& dst);
+
+  uint32_t op;
+  uint32_t fillRule;
+
+  //! @brief Epsilon used to compare X coordinates and to split beams.
+  double eps;
+
+  PathBooleanArray<PathBooleanEdge> edges;
+  PathBooleanArray<PathBooleanEdge*> active;
+  PathBooleanArray<PathBooleanSegment> segments;
+
+  //! @brief Inside intervals at the top of the previous beam.
+  PathBooleanArray<double> prevTop;
+  //! @brief Inside intervals at the bottom / top of the current beam.
+  PathBooleanArray<double> curBottom;
+  PathBooleanArray<double> curTop;
+
+  //! @brief Temporary events used by addHorizontal().
+  PathBooleanArray<double> events;
+};
+
+template<typename NumT>
+err_t PathBooleanContext::addPath(const NumT_(Path)& path, uint32_t src)
+{
+  const uint8_t* commands = path.getCommands();
+  const NumT_(Point)* vertices = path.getVertices();
+  size_t i, length = path.getLength();
+
+  double startX = 0.0, startY = 0.0;
+  double lastX = 0.0, lastY = 0.0;
+  bool hasFigure = false;
+
+  for (i = 0; i < length; i++)
+  {
+    uint8_t cmd = commands[i];
+
+    if (PathCmd::isLineTo(cmd) && hasFigure)
+    {
+      double x = double(vertices[i].x);
+      double y = double(vertices[i].y);
+
+      FOG_RETURN_ON_ERROR(addEdge(lastX, lastY, x, y, src));
+      lastX = x;
+      lastY = y;
+    }
+    else if (PathCmd::isMoveTo(cmd) || PathCmd::isLineTo(cmd))
+    {
+      // Figures are always closed (fill semantics).
+      if (hasFigure)
+        FOG_RETURN_ON_ERROR(addEdge(lastX, lastY, startX, startY, src));
+
+      startX = lastX = double(vertices[i].x);
+      startY = lastY = double(vertices[i].y);
+      hasFigure = true;
+    }
+    else if (PathCmd::isClose(cmd))
+    {
+      if (hasFigure)
+        FOG_RETURN_ON_ERROR(addEdge(lastX, lastY, startX, startY, src));
+      hasFigure = false;
+    }
+  }
+
+  if (hasFigure)
+    FOG_RETURN_ON_ERROR(addEdge(lastX, lastY, startX, startY, src));
+
+  return ERR_OK;
+}
+
+err_t PathBooleanContext::addEdge(double x0, double y0, double x1, double y1, uint32_t src)
+{
+  // Horizontal edges don't contribute to the winding, the horizontal parts
+  // of the result are generated by addHorizontal().
+  if (y0 == y1)
+    return ERR_OK;
+
+  // Skip invalid coordinates (NaN, Inf).
+  if (!Math::isFinite(x0) || !Math::isFinite(y0) || !Math::isFinite(x1) || !Math::isFinite(y1))
+    return ERR_OK;
+
+  PathBooleanEdge* edge = edges.add();
+  if (FOG_IS_NULL(edge))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  if (y0 < y1)
+  {
+    edge->x0 = x0; edge->y0 = y0;
+    edge->x1 = x1; edge->y1 = y1;
+    edge->winding = 1;
+  }
+  else
+  {
+    edge->x0 = x1; edge->y0 = y1;
+    edge->x1 = x0; edge->y1 = y0;
+    edge->winding = -1;
+  }
+
+  edge->dxdy = (edge->x1 - edge->x0) / (edge->y1 - edge->y0);
+  edge->src = src;
+  edge->segIndex = INVALID_INDEX;
+  return ERR_OK;
+}
+
+err_t PathBooleanContext::sweep()
+{
+  size_t i;
+  size_t edgeCount = edges.length;
+
+  if (edgeCount == 0)
+    return ERR_OK;
+
+  // Sort edges by y0, assign ids and compute the epsilon from the extents.
+  Algorithm::qsort(edges.data, edgeCount, sizeof(PathBooleanEdge), PathBoolean_compareEdge);
+
+  PathBooleanArray<double> ys;
+  double extent = 0.0;
+
+  for (i = 0; i < edgeCount; i++)
+  {
+    PathBooleanEdge& edge = edges.data[i];
+    edge.id = (uint32_t)i;
+
+    double* y = ys.add();
+    if (FOG_IS_NULL(y))
+      return ERR_RT_OUT_OF_MEMORY;
+    y[0] = edge.y0;
+
+    y = ys.add();
+    if (FOG_IS_NULL(y))
+      return ERR_RT_OUT_OF_MEMORY;
+    y[0] = edge.y1;
+
+    extent = Math::max(extent, Math::abs(edge.x0), Math::abs(edge.x1));
+    extent = Math::max(extent, Math::abs(edge.y0), Math::abs(edge.y1));
+  }
+
+  eps = (extent + 1.0) * 1e-12;
+
+  // Sort and remove duplicates from scan-beam Y coordinates.
+  Algorithm::qsort(ys.data, ys.length, sizeof(double), PathBoolean_compareDouble);
+
+  size_t yCount = 1;
+  for (i = 1; i < ys.length; i++)
+  {
+    if (ys.data[i] != ys.data[yCount - 1])
+      ys.data[yCount++] = ys.data[i];
+  }
+
+  size_t nextEdge = 0;
+  double prevY = ys.data[0];
+
+  prevTop.clear();
+
+  for (i = 0; i + 1 < yCount; i++)
+  {
+    double ya = ys.data[i];
+    double ybEnd = ys.data[i + 1];
+
+    // Remove finished edges.
+    {
+      size_t j, k = 0;
+      for (j = 0; j < active.length; j++)
+      {
+        if (active.data[j]->y1 > ya)
+          active.data[k++] = active.data[j];
+      }
+      active.length = k;
+    }
+
+    // Insert new edges.
+    while (nextEdge < edgeCount && edges.data[nextEdge].y0 <= ya)
+    {
+      PathBooleanEdge** p = active.add();
+      if (FOG_IS_NULL(p))
+        return ERR_RT_OUT_OF_MEMORY;
+      *p = &edges.data[nextEdge++];
+    }
+
+    // Gap between beams, close the previous intervals.
+    if (prevY != ya && prevTop.length != 0)
+    {
+      curBottom.clear();
+      FOG_RETURN_ON_ERROR(addHorizontal(prevY, prevTop, curBottom));
+      prevTop.clear();
+    }
+
+    // Process the beam, split at intersections.
+    while (ya < ybEnd)
+    {
+      double yb = ybEnd;
+      size_t count = active.length;
+      PathBooleanEdge** list = active.data;
+
+      size_t j;
+      for (j = 0; j < count; j++)
+      {
+        list[j]->xa = list[j]->getX(ya);
+        list[j]->xb = list[j]->getX(yb);
+      }
+
+      // Insertion sort by X at ya (ties are sorted by X at yb). The active
+      // list is almost sorted from the previous beam.
+      for (j = 1; j < count; j++)
+      {
+        PathBooleanEdge* e = list[j];
+        size_t k = j;
+
+        while (k > 0)
+        {
+          PathBooleanEdge* p = list[k - 1];
+          bool less = (e->xa < p->xa - eps) || (e->xa <= p->xa + eps && e->xb < p->xb);
+
+          if (!less)
+            break;
+
+          list[k] = p;
+          k--;
+        }
+
+        list[k] = e;
+      }
+
+      // Find the first intersection of adjacent edges.
+      for (j = 0; j + 1 < count; j++)
+      {
+        PathBooleanEdge* e0 = list[j];
+        PathBooleanEdge* e1 = list[j + 1];
+
+        if (e0->xb > e1->xb + eps && e0->dxdy > e1->dxdy)
+        {
+          double y = ya + (e1->xa - e0->xa) / (e0->dxdy - e1->dxdy);
+          if (y > ya + eps && y < yb)
+            yb = y;
+        }
+      }
+
+      if (yb != ybEnd)
+      {
+        for (j = 0; j < count; j++)
+          list[j]->xb = list[j]->getX(yb);
+      }
+
+      FOG_RETURN_ON_ERROR(addBeam(ya, yb));
+
+      // Horizontal boundary between the previous and the current beam.
+      FOG_RETURN_ON_ERROR(addHorizontal(ya, prevTop, curBottom));
+
+      // The top of this beam becomes the previous one.
+      prevTop.swap(curTop);
+
+      prevY = yb;
+      ya = yb;
+    }
+  }
+
+  // Close the last intervals.
+  if (prevTop.length != 0)
+  {
+    curBottom.clear();
+    FOG_RETURN_ON_ERROR(addHorizontal(prevY, prevTop, curBottom));
+    prevTop.clear();
+  }
+
+  return ERR_OK;
+}
+
+err_t PathBooleanContext::addBeam(double ya, double yb)
+{
+  PathBooleanEdge** list = active.data;
+  size_t i = 0;
+  size_t count = active.length;
+
+  int windings[2] = { 0, 0 };
+  bool inside = false;
+
+  curBottom.clear();
+  curTop.clear();
+
+  while (i < count)
+  {
+    PathBooleanEdge* e = list[i];
+
+    // Process coincident edges as a group.
+    do {
+      windings[list[i]->src] += list[i]->winding;
+      i++;
+    } while (i < count &&
+             Math::abs(list[i]->xa - e->xa) <= eps &&
+             Math::abs(list[i]->xb - e->xb) <= eps);
+
+    bool newInside = PathBoolean_op(op,
+      PathBoolean_isInside(windings[0], fillRule),
+      PathBoolean_isInside(windings[1], fillRule));
+
+    if (newInside == inside)
+      continue;
+
+    inside = newInside;
+
+    double* ia = curBottom.add();
+    double* ib = curTop.add();
+
+    if (FOG_IS_NULL(ia) || FOG_IS_NULL(ib))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    *ia = e->xa;
+    *ib = e->xb;
+
+    // Interior on the right side goes down, on the left side goes up. The
+    // segment emitted by the same edge in the previous beam is extended if
+    // it ends here, this keeps the count of segments low.
+    PathBooleanSegment* seg = NULL;
+    if (e->segIndex != INVALID_INDEX)
+      seg = &segments.data[e->segIndex];
+
+    if (inside)
+    {
+      if (seg != NULL && seg->x0 == e->xa && seg->y0 == ya && seg->y1 < seg->y0)
+      {
+        seg->x0 = e->xb;
+        seg->y0 = yb;
+        continue;
+      }
+
+      e->segIndex = segments.length;
+      FOG_RETURN_ON_ERROR(addSegment(e->xb, yb, e->xa, ya, e->id));
+    }
+    else
+    {
+      if (seg != NULL && seg->x1 == e->xa && seg->y1 == ya && seg->y1 > seg->y0)
+      {
+        seg->x1 = e->xb;
+        seg->y1 = yb;
+        continue;
+      }
+
+      e->segIndex = segments.length;
+      FOG_RETURN_ON_ERROR(addSegment(e->xa, ya, e->xb, yb, e->id));
+    }
+  }
+
+  // Unterminated interval (can happen only if the windings are broken).
+  if (curBottom.length & 1)
+  {
+    curBottom.length--;
+    curTop.length--;
+  }
+
+  return ERR_OK;
+}
+
+err_t PathBooleanContext::addHorizontal(double y,
+  const PathBooleanArray<double>& below,
+  const PathBooleanArray<double>& above)
+{
+  if (below.length == 0 && above.length == 0)
+    return ERR_OK;
+
+  // Fast-path - the same intervals.
+  if (below.length == above.length)
+  {
+    size_t i;
+    for (i = 0; i < below.length; i++)
+    {
+      if (below.data[i] != above.data[i])
+        break;
+    }
+
+    if (i == below.length)
+      return ERR_OK;
+  }
+
+  // Events are stored as pairs [x, type], where type is:
+  //   0 - below start, 1 - below end, 2 - above start, 3 - above end.
+  events.clear();
+
+  size_t i;
+  for (i = 0; i < below.length; i++)
+  {
+    double* e0 = events.add();
+    double* e1 = events.add();
+    if (FOG_IS_NULL(e0) || FOG_IS_NULL(e1))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    *e0 = below.data[i];
+    *e1 = double(i & 1);
+  }
+
+  for (i = 0; i < above.length; i++)
+  {
+    double* e0 = events.add();
+    double* e1 = events.add();
+    if (FOG_IS_NULL(e0) || FOG_IS_NULL(e1))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    *e0 = above.data[i];
+    *e1 = double(2 + (i & 1));
+  }
+
+  Algorithm::qsort(events.data, events.length / 2, sizeof(double) * 2, PathBoolean_compareDouble);
+
+  int inBelow = 0;
+  int inAbove = 0;
+
+  size_t count = events.length / 2;
+  i = 0;
+
+  while (i < count)
+  {
+    double x = events.data[i * 2];
+
+    do {
+      switch ((int)events.data[i * 2 + 1])
+      {
+        case 0: inBelow++; break;
+        case 1: inBelow--; break;
+        case 2: inAbove++; break;
+        case 3: inAbove--; break;
+      }
+      i++;
+    } while (i < count && events.data[i * 2] == x);
+
+    if (i == count)
+      break;
+
+    double xNext = events.data[i * 2];
+
+    // Interior above goes right, interior below goes left. Intervals can
+    // overlap slightly near intersections so the count of segments is the
+    // difference of both coverages, otherwise the contours won't be closed.
+    int n = inAbove - inBelow;
+
+    for (; n > 0; n--)
+      FOG_RETURN_ON_ERROR(addSegment(x, y, xNext, y, PATH_BOOLEAN_ID_HORZ));
+
+    for (; n < 0; n++)
+      FOG_RETURN_ON_ERROR(addSegment(xNext, y, x, y, PATH_BOOLEAN_ID_HORZ | 1));
+  }
+
+  return ERR_OK;
+}
+
+err_t PathBooleanContext::addSegment(double x0, double y0, double x1, double y1, uint32_t id)
+{
+  if (x0 == x1 && y0 == y1)
+    return ERR_OK;
+
+  PathBooleanSegment* seg = segments.add();
+  if (FOG_IS_NULL(seg))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  seg->x0 = x0;
+  seg->y0 = y0;
+  seg->x1 = x1;
+  seg->y1 = y1;
+  seg->id = id;
+  seg->used = 0;
+
+  return ERR_OK;
+}
+
+template<typename NumT>
+err_t PathBooleanContext::trace(NumT_(Path)& dst)
+{
+  size_t count = segments.length;
+  if (count == 0)
+    return ERR_OK;
+
+  PathBooleanSegment* data = segments.data;
+  Algorithm::qsort(data, count, sizeof(PathBooleanSegment), PathBoolean_compareSegment);
+
+  PathBooleanArray<PathBooleanVertex> contour;
+  size_t first = 0;
+
+  for (;;)
+  {
+    // Find the first unused segment.
+    while (first < count && data[first].used)
+      first++;
+
+    if (first == count)
+      break;
+
+    PathBooleanSegment* seg = &data[first];
+    double startX = seg->x0;
+    double startY = seg->y0;
+
+    contour.clear();
+
+    PathBooleanVertex* v = contour.add();
+    if (FOG_IS_NULL(v))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    v->x = startX;
+    v->y = startY;
+    v->id = seg->id;
+
+    for (;;)
+    {
+      seg->used = 1;
+
+      // Merge collinear segments of the same edge and drop segments shorter
+      // than epsilon (created near intersections), the vertex keeps its id so
+      // it's not merged with the following segment.
+      PathBooleanVertex* last = &contour.data[contour.length - 1];
+
+      if (contour.length >= 2 && (last->id == seg->id ||
+          (Math::abs(last->x - seg->x1) <= eps && Math::abs(last->y - seg->y1) <= eps)))
+      {
+        last->x = seg->x1;
+        last->y = seg->y1;
+      }
+      else
+      {
+        v = contour.add();
+        if (FOG_IS_NULL(v))
+          return ERR_RT_OUT_OF_MEMORY;
+
+        v->x = seg->x1;
+        v->y = seg->y1;
+        v->id = seg->id;
+      }
+
+      if (seg->x1 == startX && seg->y1 == startY)
+        break;
+
+      // Find the next segment (starts where this one ends).
+      size_t lo = 0;
+      size_t hi = count;
+
+      while (lo < hi)
+      {
+        size_t mid = (lo + hi) >> 1;
+        const PathBooleanSegment* m = &data[mid];
+
+        if (m->y0 < seg->y1 || (m->y0 == seg->y1 && m->x0 < seg->x1))
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+      PathBooleanSegment* next = NULL;
+      for (; lo < count && data[lo].y0 == seg->y1 && data[lo].x0 == seg->x1; lo++)
+      {
+        if (!data[lo].used)
+        {
+          next = &data[lo];
+          break;
+        }
+      }
+
+      // Dangling segment (numerical problem), close the contour.
+      if (next == NULL)
+        break;
+
+      seg = next;
+    }
+
+    // The last vertex is the same as the first one (closed contour), and the
+    // first vertex can be in the middle of a collinear run.
+    size_t length = contour.length;
+    PathBooleanVertex* vertices = contour.data;
+
+    if (length >= 2 && vertices[length - 1].x == vertices[0].x && vertices[length - 1].y == vertices[0].y)
+    {
+      length--;
+
+      if (length >= 2 && vertices[length].id == vertices[1].id)
+      {
+        vertices++;
+        length--;
+      }
+    }
+
+    if (length < 3)
+      continue;
+
+    FOG_RETURN_ON_ERROR(dst.moveTo(NumT_(Point)(NumT(vertices[0].x), NumT(vertices[0].y))));
+    for (size_t i = 1; i < length; i++)
+      FOG_RETURN_ON_ERROR(dst.lineTo(NumT_(Point)(NumT(vertices[i].x), NumT(vertices[i].y))));
+    FOG_RETURN_ON_ERROR(dst.close());
+  }
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::PathBoolean - Box]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Get whether the path is a single axis-aligned rectangle.
+//!
+//! The edges must alternate between horizontal and vertical ones, so the
+//! vertices 0 and 2 (and 1 and 3) are opposite corners, and the area must not
+//! be zero. Degenerate figures, like (0, 0), (10, 0), (10, 10), (10, 0), which
+//! have only axis-aligned edges, are not rectangles.
+template<typename NumT>
+static bool PathBooleanT_getBox(const NumT_(Path)& path, NumT_(Box)& box)
+{
+  const uint8_t* commands = path.getCommands();
+  const NumT_(Point)* vertices = path.getVertices();
+  size_t length = path.getLength();
+
+  if (length > 0 && PathCmd::isClose(commands[length - 1]))
+    length--;
+
+  // Optional closing vertex.
+  if (length == 5 && vertices[4] == vertices[0])
+    length--;
+
+  if (length != 4 || !PathCmd::isMoveTo(commands[0]))
+    return false;
+
+  for (size_t i = 1; i < 4; i++)
+  {
+    if (!PathCmd::isLineTo(commands[i]))
+      return false;
+  }
+
+  const NumT_(Point)& p0 = vertices[0];
+  const NumT_(Point)& p1 = vertices[1];
+  const NumT_(Point)& p2 = vertices[2];
+  const NumT_(Point)& p3 = vertices[3];
+
+  // Horizontal first (p0-p1 is horizontal) or vertical first.
+  bool hFirst = p0.y == p1.y && p1.x == p2.x && p2.y == p3.y && p3.x == p0.x;
+  bool vFirst = p0.x == p1.x && p1.y == p2.y && p2.x == p3.x && p3.y == p0.y;
+
+  if (!hFirst && !vFirst)
+    return false;
+
+  if (p0.x == p2.x || p0.y == p2.y)
+    return false;
+
+  box.x0 = Math::min(vertices[0].x, vertices[2].x);
+  box.y0 = Math::min(vertices[0].y, vertices[2].y);
+  box.x1 = Math::max(vertices[0].x, vertices[2].x);
+  box.y1 = Math::max(vertices[0].y, vertices[2].y);
+
+  return box.isValid();
+}
+
+// ============================================================================
+// [Fog::PathBoolean - Sweep]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Combine @a a and @a b by the sweep, @a b can be @c NULL.
+template<typename NumT>
+static err_t PathBooleanT_sweep(NumT_(Path)& dst,
+  const NumT_(Path)* a, const NumT_(Path)* b, uint32_t op, uint32_t fillRule)
+{
+  PathBooleanContext ctx(op, fillRule);
+
+  if (a->hasBeziers())
+  {
+    NumT_T1(PathTmp, 256) flat;
+    FOG_RETURN_ON_ERROR(NumI_(Path)::flatten(flat, *a, MathConstant<NumT>::getDefaultFlatness()));
+    FOG_RETURN_ON_ERROR(ctx.addPath<NumT>(flat, 0));
+  }
+  else
+  {
+    FOG_RETURN_ON_ERROR(ctx.addPath<NumT>(*a, 0));
+  }
+
+  if (b != NULL)
+  {
+    if (b->hasBeziers())
+    {
+      NumT_T1(PathTmp, 256) flat;
+      FOG_RETURN_ON_ERROR(NumI_(Path)::flatten(flat, *b, MathConstant<NumT>::getDefaultFlatness()));
+      FOG_RETURN_ON_ERROR(ctx.addPath<NumT>(flat, 1));
+    }
+    else
+    {
+      FOG_RETURN_ON_ERROR(ctx.addPath<NumT>(*b, 1));
+    }
+  }
+
+  FOG_RETURN_ON_ERROR(ctx.sweep());
+
+  NumT_(Path) tmp;
+  FOG_RETURN_ON_ERROR(ctx.trace<NumT>(tmp));
+
+  dst = tmp;
+  return ERR_OK;
+}
+
+//! @internal
+//!
+//! @brief Normalize @a src to non-overlapping contours.
+//!
+//! Used by the fast-paths, which return the input (or its clipped part) as is.
+//! The input can contain self-overlapping figures, which would be filled
+//! differently by the non-zero and even-odd fill rules. An empty path and
+//! a rectangle are already normalized.
+template<typename NumT>
+static err_t PathBooleanT_normalize(NumT_(Path)& dst, const NumT_(Path)& src, uint32_t fillRule)
+{
+  NumT_(Box) box(UNINITIALIZED);
+
+  if (src.isEmpty() || PathBooleanT_getBox<NumT>(src, box))
+  {
+    dst = src;
+    return ERR_OK;
+  }
+
+  return PathBooleanT_sweep<NumT>(dst, &src, NULL, PATH_OP_UNION, fillRule);
+}
+
+// ============================================================================
+// [Fog::PathBoolean - Combine]
+// ============================================================================
+
+template<typename NumT>
+static err_t FOG_CDECL PathT_combine(NumT_(Path)* dst,
+  const NumT_(Path)* a, const NumT_(Path)* b, uint32_t op, uint32_t fillRule)
+{
+  if (op >= PATH_OP_COUNT || fillRule >= FILL_RULE_COUNT)
+    return ERR_RT_INVALID_ARGUMENT;
+
+  NumT_(Box) aBox(UNINITIALIZED);
+  NumT_(Box) bBox(UNINITIALIZED);
+
+  bool aEmpty = a->getBoundingBox(aBox) != ERR_OK;
+  bool bEmpty = b->getBoundingBox(bBox) != ERR_OK;
+
+  // --------------------------------------------------------------------------
+  // [Fast-Paths]
+  // --------------------------------------------------------------------------
+
+  // Disjoint (or empty) inputs, the result is one of the inputs or both. The
+  // inputs don't interact, so each one is normalized alone. BoxF/BoxD::overlaps()
+  // doesn't test the intersection of two boxes, intersect() must be used.
+  NumT_(Box) abBox(UNINITIALIZED);
+
+  if (aEmpty || bEmpty || !NumI_(Box)::intersect(abBox, aBox, bBox))
+  {
+    NumT_(Path) tmp;
+
+    switch (op)
+    {
+      case PATH_OP_UNION:
+      case PATH_OP_XOR:
+      {
+        NumT_(Path) tmpB;
+        FOG_RETURN_ON_ERROR(PathBooleanT_normalize<NumT>(tmp, *a, fillRule));
+        FOG_RETURN_ON_ERROR(PathBooleanT_normalize<NumT>(tmpB, *b, fillRule));
+        FOG_RETURN_ON_ERROR(tmp.append(tmpB));
+        break;
+      }
+
+      case PATH_OP_INTERSECT:
+        break;
+
+      case PATH_OP_SUBTRACT:
+        FOG_RETURN_ON_ERROR(PathBooleanT_normalize<NumT>(tmp, *a, fillRule));
+        break;
+
+      case PATH_OP_SUBTRACT_REV:
+        FOG_RETURN_ON_ERROR(PathBooleanT_normalize<NumT>(tmp, *b, fillRule));
+        break;
+    }
+
+    *dst = tmp;
+    return ERR_OK;
+  }
+
+  // Intersection with a rectangle is done by PathClipper, the windings of
+  // the clipped path are preserved and the (smaller) clipped path is then
+  // normalized.
+  if (op == PATH_OP_INTERSECT)
+  {
+    NumT_(Box) clipBox(UNINITIALIZED);
+    const NumT_(Path)* src = NULL;
+
+    if (PathBooleanT_getBox<NumT>(*b, clipBox))
+      src = a;
+    else if (PathBooleanT_getBox<NumT>(*a, clipBox))
+      src = b;
+
+    if (src != NULL)
+    {
+      NumT_(PathClipper) clipper(clipBox);
+      NumT_(Path) tmp;
+
+      FOG_RETURN_ON_ERROR(clipper.clipPath(tmp, *src));
+      return PathBooleanT_normalize<NumT>(*dst, tmp, fillRule);
+    }
+  }
+
+  return PathBooleanT_sweep<NumT>(*dst, a, b, op, fillRule);
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void PathBoolean_init(void)
+{
+  fog_api.pathf_combine = PathT_combine<float>;
+  fog_api.pathd_combine = PathT_combine<double>;
+}
+
+} // Fog namespace
@@ -19,6 +19,7 @@
 #include <Fog/G2d/Geometry/Internals_p.h>
 #include <Fog/G2d/Geometry/Path.h>
 #include <Fog/G2d/Geometry/PathClipper.h>
+#include <Fog/G2d/Geometry/PathClipper_p.h>
 #include <Fog/G2d/Geometry/PathTmp_p.h>
 #include <Fog/G2d/Geometry/Rect.h>
 #include <Fog/G2d/Geometry/Transform.h>
@@ -169,6 +170,73 @@ _RemoveLoop:
   return ++pts;
 }
 
+// ============================================================================
+// [Fog::PathClipper - Helpers - Source]
+// ============================================================================
+
+// The source vertices are read by the clipper through a source policy. The
+// default policy reads the vertices as is, the affine one maps each vertex
+// when it's read, so the transformed path is clipped and emitted in one pass
+// without being stored into a temporary path first.
+template<typename NumT>
+struct FOG_NO_EXPORT PathClipperSourceT
+{
+  FOG_INLINE NumT_(Point) get(const NumT_(Point)* p) const
+  {
+    return p[0];
+  }
+
+  FOG_INLINE const NumT_(Point)* load(NumT_(Point)* buf, const NumT_(Point)* p, size_t length) const
+  {
+    FOG_UNUSED(buf);
+    FOG_UNUSED(length);
+
+    return p;
+  }
+
+  FOG_INLINE void copy(NumT_(Point)* dst, const NumT_(Point)* src, size_t length) const
+  {
+    MemOps::copy(dst, src, length * sizeof(NumT_(Point)));
+  }
+};
+
+// All vertices are mapped by get(), including the ones copied by the
+// detect-loop, so a vertex classified as visible is also emitted as visible
+// (a different mapping kernel, like FMA, may round differently).
+template<typename NumT>
+struct FOG_NO_EXPORT PathClipperAffineSourceT
+{
+  FOG_INLINE PathClipperAffineSourceT(const NumT_(Transform)* tr) :
+    _00(tr->_00), _01(tr->_01),
+    _10(tr->_10), _11(tr->_11),
+    _20(tr->_20), _21(tr->_21)
+  {
+  }
+
+  FOG_INLINE NumT_(Point) get(const NumT_(Point)* p) const
+  {
+    return NumT_(Point)(p->x * _00 + p->y * _10 + _20,
+                        p->x * _01 + p->y * _11 + _21);
+  }
+
+  FOG_INLINE const NumT_(Point)* load(NumT_(Point)* buf, const NumT_(Point)* p, size_t length) const
+  {
+    for (size_t i = 0; i < length; i++)
+      buf[i] = get(p + i);
+    return buf;
+  }
+
+  FOG_INLINE void copy(NumT_(Point)* dst, const NumT_(Point)* src, size_t length) const
+  {
+    for (size_t i = 0; i < length; i++)
+      dst[i] = get(src + i);
+  }
+
+  NumT _00, _01;
+  NumT _10, _11;
+  NumT _20, _21;
+};
+
 // ============================================================================
 // [Fog::PathClipper - Helpers - T]
 // ============================================================================
@@ -368,9 +436,10 @@ static err_t FOG_CDECL PathClipperT_continuePath(NumT_(PathClipper)* self,
   }
 }
 
-template<typename NumT>
-static err_t FOG_CDECL PathClipperT_continuePathData(NumT_(PathClipper)* self,
-  NumT_(Path)* dst, const NumT_(Point)* srcPts, const uint8_t* srcCmd, size_t srcLength)
+template<typename NumT, typename SourceT>
+static err_t PathClipperT_clipData(NumT_(PathClipper)* self,
+  NumT_(Path)* dst, const NumT_(Point)* srcPts, const uint8_t* srcCmd, size_t srcLength,
+  const SourceT& source)
 {
   size_t i = srcLength;
   if (i == 0)
@@ -405,10 +474,10 @@ static err_t FOG_CDECL PathClipperT_continuePathData(NumT_(PathClipper)* self,
 
     if (srcCmd[-1] != PATH_CMD_CLOSE)
     {
-      FOG_ASSERT(srcPts[-1].x >= clipBox.x0);
-      FOG_ASSERT(srcPts[-1].y >= clipBox.y0);
-      FOG_ASSERT(srcPts[-1].x <= clipBox.x1);
-      FOG_ASSERT(srcPts[-1].y <= clipBox.y1);
+      FOG_ASSERT(source.get(srcPts - 1).x >= clipBox.x0);
+      FOG_ASSERT(source.get(srcPts - 1).y >= clipBox.y0);
+      FOG_ASSERT(source.get(srcPts - 1).x <= clipBox.x1);
+      FOG_ASSERT(source.get(srcPts - 1).y <= clipBox.y1);
 
       initialFlags = CLIP_SIDE_NONE;
       initialPoint = self->_lastMoveTo;
@@ -436,12 +505,12 @@ _DetectLoopDo:
           goto _ClipLoop;
 
         initialFlags = NO_INITIAL_FLAGS;
-        currentFlags = PathClipperT_getFlags<NumT>(srcPts[0], clipBox);
+        initialPoint = source.get(srcPts);
+        currentFlags = PathClipperT_getFlags<NumT>(initialPoint, clipBox);
 
         if (currentFlags != CLIP_SIDE_NONE)
           goto _ClipLoop;
 
-        initialPoint = srcPts[0];
         initialFlags = currentFlags;
 
         i--;
@@ -457,7 +526,7 @@ _DetectLoopDo:
         if (FOG_UNLIKELY(initialFlags == NO_INITIAL_FLAGS))
           goto _Invalid;
 
-        currentFlags = PathClipperT_getFlags<NumT>(srcPts[0], clipBox);
+        currentFlags = PathClipperT_getFlags<NumT>(source.get(srcPts), clipBox);
         if (currentFlags != CLIP_SIDE_NONE)
           goto _ClipLoop;
 
@@ -475,8 +544,8 @@ _DetectLoopDo:
         if (FOG_UNLIKELY(initialFlags == NO_INITIAL_FLAGS))
           goto _Invalid;
 
-        currentFlags = PathClipperT_getFlags<NumT>(srcPts[0], clipBox) |
-                       PathClipperT_getFlags<NumT>(srcPts[1], clipBox) ;
+        currentFlags = PathClipperT_getFlags<NumT>(source.get(srcPts    ), clipBox) |
+                       PathClipperT_getFlags<NumT>(source.get(srcPts + 1), clipBox) ;
         if (currentFlags != CLIP_SIDE_NONE)
           goto _ClipLoop;
 
@@ -494,9 +563,9 @@ _DetectLoopDo:
         if (FOG_UNLIKELY(initialFlags == NO_INITIAL_FLAGS))
           goto _Invalid;
 
-        currentFlags = PathClipperT_getFlags<NumT>(srcPts[0], clipBox) |
-                       PathClipperT_getFlags<NumT>(srcPts[1], clipBox) |
-                       PathClipperT_getFlags<NumT>(srcPts[2], clipBox) ;
+        currentFlags = PathClipperT_getFlags<NumT>(source.get(srcPts    ), clipBox) |
+                       PathClipperT_getFlags<NumT>(source.get(srcPts + 1), clipBox) |
+                       PathClipperT_getFlags<NumT>(source.get(srcPts + 2), clipBox) ;
         if (currentFlags != CLIP_SIDE_NONE)
           goto _ClipLoop;
 
@@ -540,11 +609,13 @@ _ClipLoop:
     if ((dstIndex = dst->_add(copyLength)) == INVALID_INDEX)
       goto _OutOfMemory;
 
-    MemOps::copy(dst->getVerticesX() + dstIndex, srcPts - copyLength, copyLength * sizeof(NumT_(Point)));
+    source.copy(dst->getVerticesX() + dstIndex, srcPts - copyLength, copyLength);
     MemOps::copy(dst->getCommandsX() + dstIndex, srcCmd - copyLength, copyLength);
   }
 
-  if (i)
+  // Also enter the clip-loop if the detect-loop consumed the whole path, but
+  // the last figure isn't closed and its initial point is outside.
+  if (i || (initialFlags != NO_INITIAL_FLAGS && (initialFlags | previousFlags) != CLIP_SIDE_NONE))
   {
     uint8_t* dstCmd;
     NumT_(Point)* dstMark = NULL;
@@ -556,6 +627,10 @@ _ClipLoop:
     uint32_t lf;
     uint32_t uf;
 
+    // Vertices read through the source (used by the line and move-to cases).
+    NumT_(Point) lp;
+    NumT_(Point) up;
+
     // Reset the current flags, they will be calculated again.
     currentFlags = CLIP_SIDE_NONE;
 
@@ -590,6 +665,9 @@ _ClipRealloc:
       // omit buffer-overflow checks in the main loop. Now it's safe to
       // use the "dstIndex >= dstCapacity" comparison in the main loop.
       dstMax = dst->getVerticesX() + dst->getCapacity() - 40;
+
+      if (i == 0)
+        goto _ClipEndPath;
       goto _ClipLoopDo;
     }
 
@@ -632,23 +710,25 @@ _ClipLoopDo:
             }
             else
             {
+              lp = source.get(srcPts - 1);
+
               lf = previousFlags;uf = initialFlags;
-              lx = srcPts[-1].x; ux = initialPoint.x;
-              ly = srcPts[-1].y; uy = initialPoint.y;
+              lx = lp.x; ux = initialPoint.x;
+              ly = lp.y; uy = initialPoint.y;
 
               initialFlags = NO_INITIAL_FLAGS;
               goto _ClipLineCmd;
             }
           }
 
-          currentFlags = PathClipperT_getFlags<NumT>(srcPts[0], clipBox);
-          initialPoint = srcPts[0];
+          initialPoint = source.get(srcPts);
+          currentFlags = PathClipperT_getFlags<NumT>(initialPoint, clipBox);
           initialFlags = currentFlags;
 
           dstPts = PathClipperT_removeRedundantLines<NumT>(dstMark, (size_t)(dstPts - dstMark));
           dstCmd = dst->getCommandsX() + (size_t)(dstPts - dst->getVertices());
 
-          dstPts[0] = srcPts[0];
+          dstPts[0] = initialPoint;
           dstCmd[0] = PATH_CMD_MOVE_TO;
           PathClipperT_clipPoint<NumT>(dstPts[0], clipBox);
           dstPts++;
@@ -668,12 +748,13 @@ _ClipLoopDo:
 
         case PATH_CMD_LINE_TO:
         {
-          currentFlags = PathClipperT_getFlags<NumT>(srcPts[0], clipBox);
+          up = source.get(srcPts);
+          currentFlags = PathClipperT_getFlags<NumT>(up, clipBox);
 
           // Fully visible, finish here and jump to detection loop.
           if ((previousFlags | currentFlags) == 0)
           {
-            dstPts[0] = srcPts[0];
+            dstPts[0] = up;
             dstCmd[0] = PATH_CMD_LINE_TO;
 
             dstPts = PathClipperT_removeRedundantLines<NumT>(dstMark, (size_t)(dstPts + 1 - dstMark));
@@ -688,9 +769,11 @@ _ClipLoopDo:
           }
 
           // Initialize coordinates.
+          lp = source.get(srcPts - 1);
+
           lf = previousFlags;uf = currentFlags;
-          lx = srcPts[-1].x; ux = srcPts[0].x;
-          ly = srcPts[-1].y; uy = srcPts[0].y;
+          lx = lp.x; ux = up.x;
+          ly = lp.y; uy = up.y;
 
           i--;
           srcPts++;
@@ -894,7 +977,8 @@ _ClipLineCmd_Done:
 
         case PATH_CMD_QUAD_TO:
         {
-          const NumT_(Point)* p = srcPts - 1;
+          NumT_(Point) pBuf[3];
+          const NumT_(Point)* p = source.load(pBuf, srcPts - 1, 3);
 
           uint32_t cp1 = PathClipperT_getFlags<NumT>(p[1], clipBox);
           currentFlags = PathClipperT_getFlags<NumT>(p[2], clipBox);
@@ -907,8 +991,8 @@ _ClipLineCmd_Done:
             dstPts = PathClipperT_removeRedundantLines<NumT>(dstMark, (size_t)(dstPts - dstMark));
             dstCmd = dst->getCommandsX() + (size_t)(dstPts - dst->getVertices());
 
-            dstPts[0] = srcPts[0];
-            dstPts[1] = srcPts[1];
+            dstPts[0] = p[1];
+            dstPts[1] = p[2];
             dstPts += 2;
 
             dstCmd[0] = PATH_CMD_QUAD_TO;
@@ -929,7 +1013,7 @@ _ClipLineCmd_Done:
           // Not visible.
           if ((previousFlags & cp1 & currentFlags) != CLIP_SIDE_NONE)
           {
-            dstPts[0] = srcPts[1];
+            dstPts[0] = p[2];
             dstCmd[0] = PATH_CMD_LINE_TO;
             PathClipperT_clipPoint<NumT>(dstPts[0], clipBox);
             dstPts++;
@@ -1145,7 +1229,8 @@ _ClipQuadCmd_EvaluateY:
 
         case PATH_CMD_CUBIC_TO:
         {
-          const NumT_(Point)* p = srcPts - 1;
+          NumT_(Point) pBuf[4];
+          const NumT_(Point)* p = source.load(pBuf, srcPts - 1, 4);
 
           uint32_t cp1 = PathClipperT_getFlags<NumT>(p[1], clipBox);
           uint32_t cp2 = PathClipperT_getFlags<NumT>(p[2], clipBox);
@@ -1159,9 +1244,9 @@ _ClipQuadCmd_EvaluateY:
             dstPts = PathClipperT_removeRedundantLines<NumT>(dstMark, (size_t)(dstPts - dstMark));
             dstCmd = dst->getCommandsX() + (size_t)(dstPts - dst->getVertices());
 
-            dstPts[0] = srcPts[0];
-            dstPts[1] = srcPts[1];
-            dstPts[2] = srcPts[2];
+            dstPts[0] = p[1];
+            dstPts[1] = p[2];
+            dstPts[2] = p[3];
             dstPts += 3;
 
             dstCmd[0] = PATH_CMD_CUBIC_TO;
@@ -1183,7 +1268,7 @@ _ClipQuadCmd_EvaluateY:
           // Not visible.
           if ((previousFlags & cp1 & cp2 & currentFlags) != CLIP_SIDE_NONE)
           {
-            dstPts[0] = srcPts[2];
+            dstPts[0] = p[3];
             dstCmd[0] = PATH_CMD_LINE_TO;
             PathClipperT_clipPoint<NumT>(dstPts[0], clipBox);
             dstPts++;
@@ -1422,15 +1507,17 @@ _ClipCubicCmd_EvaluateY:
         {
           if (initialFlags != NO_INITIAL_FLAGS)
           {
+            lp = source.get(srcPts - 1);
+
             lf = previousFlags;uf = initialFlags;
-            lx = srcPts[-1].x; ux = initialPoint.x;
-            ly = srcPts[-1].y; uy = initialPoint.y;
+            lx = lp.x; ux = initialPoint.x;
+            ly = lp.y; uy = initialPoint.y;
 
             initialFlags = NO_INITIAL_FLAGS;
             goto _ClipLineCmd;
           }
 
-          dstPts[0] = srcPts[0];
+          dstPts[0] = source.get(srcPts);
           dstPts++;
 
           dstCmd[0] = PATH_CMD_CLOSE;
@@ -1448,12 +1535,19 @@ _ClipCubicCmd_EvaluateY:
       previousFlags = currentFlags;
     }
 
-    // Handle the End-Path case.
-    if (initialFlags != NO_INITIAL_FLAGS && (initialFlags | previousFlags) != CLIP_SIDE_NONE)
+_ClipEndPath:
+    // Handle the End-Path case. Like in the move-to case, the closing line is
+    // not needed if both points are clipped in the same region, so the path
+    // clipped at once and the path clipped per figures are equal.
+    if (initialFlags != NO_INITIAL_FLAGS &&
+        (initialFlags | previousFlags) != CLIP_SIDE_NONE &&
+        (initialFlags & previousFlags) == CLIP_SIDE_NONE)
     {
+      lp = source.get(srcPts - 1);
+
       lf = previousFlags;uf = initialFlags;
-      lx = srcPts[-1].x; ux = initialPoint.x;
-      ly = srcPts[-1].y; uy = initialPoint.y;
+      lx = lp.x; ux = initialPoint.x;
+      ly = lp.y; uy = initialPoint.y;
 
       initialFlags = NO_INITIAL_FLAGS;
       goto _ClipLineCmd;
@@ -1478,73 +1572,30 @@ _OutOfMemory:
   return ERR_RT_OUT_OF_MEMORY;
 }
 
-// ============================================================================
-// [Fog::PathClipper - ClipPath]
-// ============================================================================
-
 template<typename NumT>
-static err_t FOG_CDECL PathClipperT_clipPath(NumT_(PathClipper)* self,
-  NumT_(Path)* dst, const NumT_(Path)* src, const NumT_(Transform)* tr)
+static err_t FOG_CDECL PathClipperT_continuePathData(NumT_(PathClipper)* self,
+  NumT_(Path)* dst, const NumT_(Point)* srcPts, const uint8_t* srcCmd, size_t srcLength)
 {
-  self->_lastIndex = INVALID_INDEX;
-
-  uint32_t transformType = (tr != NULL) ? tr->getType() : TRANSFORM_TYPE_IDENTITY;
-
-  switch (transformType)
-  {
-    // If there is no transform the continuePath() is safe and fast.
-    case TRANSFORM_TYPE_IDENTITY:
-    {
-      return self->continuePath(*dst, *src);
-    }
-
-    // Translation and Scaling may be considered as a rect-to-rect transform.
-    // It is safe to do transformation as a second step. If the path is
-    // heavily clipped then we save some CPU cycles, if the path isn't clipped
-    // then it is the same as continuePath().
-    case TRANSFORM_TYPE_TRANSLATION:
-    case TRANSFORM_TYPE_SCALING:
-    {
-      NumT_(Transform) inv(UNINITIALIZED);
-
-      if (NumI_(Transform)::invert(inv, *tr))
-      {
-        // Save the clip box and create new.
-        NumT_(Box) box(self->_clipBox);
-        inv.mapBox(self->_clipBox, self->_clipBox);
-
-        // Clip and transform.
-        size_t dstIndex = dst->getLength();
-        err_t err = self->continuePath(*dst, *src);
-        dst->transform(*tr, Range(dstIndex, DETECT_LENGTH));
-
-        // Restore the clip box and return possible error.
-        self->_clipBox = box;
-        return err;
-      }
-      // ... Fall through ...
-    }
+  return PathClipperT_clipData<NumT>(self, dst, srcPts, srcCmd, srcLength,
+    PathClipperSourceT<NumT>());
+}
 
-    // TODO: Specialize the SWAP/ROTATION/AFFINE case.
-    default:
-    {
-      if (dst == src)
-      {
-        // This is an incorrect use.
-        NumT_(Path) tmp;
-        FOG_RETURN_ON_ERROR(tr->mapPath(tmp, *src));
+// ============================================================================
+// [Fog::PathClipper - ClipMappedData]
+// ============================================================================
 
-        return self->continuePath(*dst, tmp);
-      }
-      else
-      {
-        NumT_T1(PathTmp, 200) tmp;
-        FOG_RETURN_ON_ERROR(tr->mapPath(tmp, *src));
+FOG_NO_EXPORT err_t PathClipperF_clipMappedData(PathClipperF* self,
+  PathF* dst, const PointF* srcPts, const uint8_t* srcCmd, size_t srcLength, const TransformF* tr)
+{
+  return PathClipperT_clipData<float>(self, dst, srcPts, srcCmd, srcLength,
+    PathClipperAffineSourceT<float>(tr));
+}
 
-        return self->continuePathData(*dst, tmp.getVertices(), tmp.getCommands(), tmp.getLength());
-      }
-    }
-  }
+FOG_NO_EXPORT err_t PathClipperD_clipMappedData(PathClipperD* self,
+  PathD* dst, const PointD* srcPts, const uint8_t* srcCmd, size_t srcLength, const TransformD* tr)
+{
+  return PathClipperT_clipData<double>(self, dst, srcPts, srcCmd, srcLength,
+    PathClipperAffineSourceT<double>(tr));
 }
 
 // ============================================================================
@@ -1623,13 +1674,13 @@ FOG_NO_EXPORT void PathClipper_init(void)
   fog_api.pathclipperf_measurePath = PathClipperT_measurePath<float>;
   fog_api.pathclipperf_continuePath = PathClipperT_continuePath<float>;
   fog_api.pathclipperf_continuePathData = PathClipperT_continuePathData<float>;
-  fog_api.pathclipperf_clipPath = PathClipperT_clipPath<float>;
+  fog_api.pathclipperf_clipPath = PathClipperT_clipPath<float, PathClipperScannerT<float> >;
   fog_api.pathclipperf_clipBox = PathClipperT_clipBox<float>;
 
   fog_api.pathclipperd_measurePath = PathClipperT_measurePath<double>;
   fog_api.pathclipperd_continuePath = PathClipperT_continuePath<double>;
   fog_api.pathclipperd_continuePathData = PathClipperT_continuePathData<double>;
-  fog_api.pathclipperd_clipPath = PathClipperT_clipPath<double>;
+  fog_api.pathclipperd_clipPath = PathClipperT_clipPath<double, PathClipperScannerT<double> >;
   fog_api.pathclipperd_clipBox = PathClipperT_clipBox<double>;
 
   // --------------------------------------------------------------------------
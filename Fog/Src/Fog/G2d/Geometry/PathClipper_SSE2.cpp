@@ -9,6 +9,7 @@
 #endif // FOG_PRECOMP
 
 // [Dependencies]
+#include <Fog/Core/Acc/AccC.h>
 #include <Fog/Core/Acc/AccSse.h>
 #include <Fog/Core/Acc/AccSse2.h>
 #include <Fog/Core/Math/Math.h>
@@ -16,6 +17,7 @@
 #include <Fog/G2d/Geometry/Internals_p.h>
 #include <Fog/G2d/Geometry/Path.h>
 #include <Fog/G2d/Geometry/PathClipper.h>
+#include <Fog/G2d/Geometry/PathClipper_p.h>
 #include <Fog/G2d/Geometry/Rect.h>
 #include <Fog/G2d/Geometry/Transform.h>
 
@@ -389,13 +391,159 @@ _Invalid:
   return PATH_CLIPPER_MEASURE_INVALID;
 }
 
+// ============================================================================
+// [Fog::PathClipper - ClipPath (SSE2)]
+// ============================================================================
+
+// Only the figure scan (the end of the figure and its bounding box) is done
+// by SSE2. The accepted figures are mapped by the Transform kernels and the
+// clipped ones by the scalar PathClipperT_clipMappedData().
+
+// Get the index of the first move-to or close command in [i, length), the
+// commands are checked 16 at a time.
+static FOG_INLINE size_t PathClipper_findFigureEnd_SSE2(const uint8_t* cmd, size_t i, size_t length)
+{
+  __m128i xmmZero;
+  __m128i xmmClose;
+
+  Acc::m128iZero(xmmZero);
+  Acc::m128iCvtSI128FromSI(xmmClose, PATH_CMD_CLOSE);
+  Acc::m128iExtendPI8FromSI8(xmmClose, xmmClose);
+
+  while (i + 16 <= length)
+  {
+    __m128i xmm0, xmm1;
+    int msk;
+
+    Acc::m128iLoad16u(xmm0, cmd + i);
+    Acc::m128iCmpEqPI8(xmm1, xmm0, xmmClose);
+    Acc::m128iCmpEqPI8(xmm0, xmm0, xmmZero);
+    Acc::m128iOr(xmm0, xmm0, xmm1);
+    Acc::m128iMoveMaskPI8(msk, xmm0);
+
+    if (msk != 0)
+    {
+      uint32_t index;
+      Acc::p32CTZ(index, (uint32_t)msk);
+      return i + index;
+    }
+
+    i += 16;
+  }
+
+  while (i < length && cmd[i] != PATH_CMD_MOVE_TO && cmd[i] != PATH_CMD_CLOSE)
+    i++;
+
+  return i;
+}
+
+//! @internal
+//!
+//! @brief Figure scanner (SSE2 - float).
+struct FOG_NO_EXPORT PathClipperScannerF_SSE2
+{
+  static FOG_INLINE size_t getFigure(const uint8_t* cmd, const PointF* pts,
+    size_t i, size_t length, BoxF& box)
+  {
+    size_t end = PathClipper_findFigureEnd_SSE2(cmd, i + 1, length);
+
+    __m128f xmmMin;
+    __m128f xmmMax;
+    __m128f xmm0;
+
+    // Each register contains two points [x0, y0, x1, y1].
+    Acc::m128fZero(xmmMin);
+    Acc::m128fLoad8Lo(xmmMin, pts + i);
+    Acc::m128fShuffle<1, 0, 1, 0>(xmmMin, xmmMin, xmmMin);
+    Acc::m128fCopy(xmmMax, xmmMin);
+
+    for (i++; i + 2 <= end; i += 2)
+    {
+      Acc::m128fLoad16u(xmm0, pts + i);
+      Acc::m128fMinPS(xmmMin, xmm0, xmmMin);
+      Acc::m128fMaxPS(xmmMax, xmm0, xmmMax);
+    }
+
+    if (i < end)
+    {
+      Acc::m128fZero(xmm0);
+      Acc::m128fLoad8Lo(xmm0, pts + i);
+      Acc::m128fShuffle<1, 0, 1, 0>(xmm0, xmm0, xmm0);
+      Acc::m128fMinPS(xmmMin, xmm0, xmmMin);
+      Acc::m128fMaxPS(xmmMax, xmm0, xmmMax);
+    }
+
+    Acc::m128fMoveHL(xmm0, xmmMin, xmmMin);
+    Acc::m128fMinPS(xmmMin, xmm0, xmmMin);
+    Acc::m128fStore8Lo(&box.x0, xmmMin);
+
+    Acc::m128fMoveHL(xmm0, xmmMax, xmmMax);
+    Acc::m128fMaxPS(xmmMax, xmm0, xmmMax);
+    Acc::m128fStore8Lo(&box.x1, xmmMax);
+
+    return (end < length && cmd[end] == PATH_CMD_CLOSE) ? end + 1 : end;
+  }
+};
+
+//! @internal
+//!
+//! @brief Figure scanner (SSE2 - double).
+struct FOG_NO_EXPORT PathClipperScannerD_SSE2
+{
+  static FOG_INLINE size_t getFigure(const uint8_t* cmd, const PointD* pts,
+    size_t i, size_t length, BoxD& box)
+  {
+    size_t end = PathClipper_findFigureEnd_SSE2(cmd, i + 1, length);
+
+    __m128d xmmMin0, xmmMin1;
+    __m128d xmmMax0, xmmMax1;
+    __m128d xmm0, xmm1;
+
+    // Each register contains one point [x, y], two accumulators are used to
+    // break the dependency chain.
+    Acc::m128dLoad16u(xmmMin0, pts + i);
+    xmmMin1 = xmmMin0;
+    xmmMax0 = xmmMin0;
+    xmmMax1 = xmmMin0;
+
+    for (i++; i + 2 <= end; i += 2)
+    {
+      Acc::m128dLoad16u(xmm0, pts + i);
+      Acc::m128dLoad16u(xmm1, pts + i + 1);
+
+      Acc::m128dMinPD(xmmMin0, xmm0, xmmMin0);
+      Acc::m128dMaxPD(xmmMax0, xmm0, xmmMax0);
+      Acc::m128dMinPD(xmmMin1, xmm1, xmmMin1);
+      Acc::m128dMaxPD(xmmMax1, xmm1, xmmMax1);
+    }
+
+    if (i < end)
+    {
+      Acc::m128dLoad16u(xmm0, pts + i);
+      Acc::m128dMinPD(xmmMin0, xmm0, xmmMin0);
+      Acc::m128dMaxPD(xmmMax0, xmm0, xmmMax0);
+    }
+
+    Acc::m128dMinPD(xmmMin0, xmmMin1, xmmMin0);
+    Acc::m128dMaxPD(xmmMax0, xmmMax1, xmmMax0);
+
+    Acc::m128dStore16u(&box.x0, xmmMin0);
+    Acc::m128dStore16u(&box.x1, xmmMax0);
+
+    return (end < length && cmd[end] == PATH_CMD_CLOSE) ? end + 1 : end;
+  }
+};
+
 // ============================================================================
 // [Init / Fini]
 // ============================================================================
 
 FOG_NO_EXPORT void PathClipper_init_SSE2(void)
 {
+  fog_api.pathclipperf_clipPath = PathClipperT_clipPath<float, PathClipperScannerF_SSE2>;
+
   fog_api.pathclipperd_measurePath = PathClipperD_measurePath_SSE2;
+  fog_api.pathclipperd_clipPath = PathClipperT_clipPath<double, PathClipperScannerD_SSE2>;
 }
 
 } // Fog namespace
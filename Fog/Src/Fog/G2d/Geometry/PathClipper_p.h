@@ -0,0 +1,334 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_GEOMETRY_PATHCLIPPER_P_H
+#define _FOG_G2D_GEOMETRY_PATHCLIPPER_P_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Tools/Swap.h>
+#include <Fog/G2d/Geometry/Box.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Geometry/PathClipper.h>
+#include <Fog/G2d/Geometry/PathTmp_p.h>
+#include <Fog/G2d/Geometry/Transform.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Geometry
+//! @{
+
+// ============================================================================
+// [Fog::PathClipper - Figure]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief How the figure (or a run of figures) is processed by the clipper.
+enum PATH_CLIPPER_FIGURE
+{
+  //! @brief Figure is outside of the clip-box, it's skipped.
+  PATH_CLIPPER_FIGURE_REJECT = 0,
+  //! @brief Figure is inside the clip-box, it's only transformed.
+  PATH_CLIPPER_FIGURE_ACCEPT = 1,
+  //! @brief Figure intersects the clip-box, it's transformed and clipped.
+  PATH_CLIPPER_FIGURE_CLIP = 2
+};
+
+//! @internal
+//!
+//! @brief Figure scanner (C).
+//!
+//! Returns the end of the figure starting at @a i (the index of the next
+//! move-to or the index after the close command) and the bounding box of its
+//! vertices (including control points) in @a box.
+template<typename NumT>
+struct FOG_NO_EXPORT PathClipperScannerT
+{
+  static FOG_INLINE size_t getFigure(const uint8_t* cmd, const NumT_(Point)* pts,
+    size_t i, size_t length, NumT_(Box)& box)
+  {
+    box.setBox(pts[i].x, pts[i].y, pts[i].x, pts[i].y);
+
+    while (++i < length)
+    {
+      uint32_t c = cmd[i];
+
+      if (c == PATH_CMD_MOVE_TO)
+        break;
+
+      if (c == PATH_CMD_CLOSE)
+        return i + 1;
+
+      if (pts[i].x < box.x0) box.x0 = pts[i].x;
+      if (pts[i].y < box.y0) box.y0 = pts[i].y;
+      if (pts[i].x > box.x1) box.x1 = pts[i].x;
+      if (pts[i].y > box.y1) box.y1 = pts[i].y;
+    }
+
+    return i;
+  }
+};
+
+//! @internal
+//!
+//! @brief Map the bounding-box @a src of a figure by the affine transform
+//! @a tr and classify the result against the clip-box.
+//!
+//! The mapped box is enlarged by the rounding error of the transform, so the
+//! accepted figure is inside the clip-box even if its vertices are mapped by
+//! a different kernel (SSE2, FMA).
+template<typename NumT>
+static FOG_INLINE uint32_t PathClipperT_classifyFigure(const NumT_(Box)& clipBox,
+  const NumT_(Box)& src, const NumT_(Transform)* tr)
+{
+  NumT ax0 = src.x0 * tr->_00, ax1 = src.x1 * tr->_00;
+  NumT ay0 = src.y0 * tr->_10, ay1 = src.y1 * tr->_10;
+  NumT bx0 = src.x0 * tr->_01, bx1 = src.x1 * tr->_01;
+  NumT by0 = src.y0 * tr->_11, by1 = src.y1 * tr->_11;
+
+  if (ax0 > ax1) swap(ax0, ax1);
+  if (ay0 > ay1) swap(ay0, ay1);
+  if (bx0 > bx1) swap(bx0, bx1);
+  if (by0 > by1) swap(by0, by1);
+
+  NumT mx = Math::max(Math::abs(src.x0), Math::abs(src.x1));
+  NumT my = Math::max(Math::abs(src.y0), Math::abs(src.y1));
+
+  NumT e = (mx * (Math::abs(tr->_00) + Math::abs(tr->_01)) +
+            my * (Math::abs(tr->_10) + Math::abs(tr->_11)) +
+            Math::abs(tr->_20) + Math::abs(tr->_21)) * MathConstant<NumT>::getDistanceEpsilon();
+
+  NumT x0 = ax0 + ay0 + tr->_20 - e;
+  NumT y0 = bx0 + by0 + tr->_21 - e;
+  NumT x1 = ax1 + ay1 + tr->_20 + e;
+  NumT y1 = bx1 + by1 + tr->_21 + e;
+
+  if (x1 < clipBox.x0 || y1 < clipBox.y0 || x0 > clipBox.x1 || y0 > clipBox.y1)
+    return PATH_CLIPPER_FIGURE_REJECT;
+
+  if (x0 >= clipBox.x0 && y0 >= clipBox.y0 && x1 <= clipBox.x1 && y1 <= clipBox.y1)
+    return PATH_CLIPPER_FIGURE_ACCEPT;
+
+  // Also used if the box contains NaN, the clipper then reports the error.
+  return PATH_CLIPPER_FIGURE_CLIP;
+}
+
+// ============================================================================
+// [Fog::PathClipper - ClipMappedData]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Map the path data by the affine transform @a tr and clip them, in
+//! one pass (implemented in PathClipper.cpp).
+//!
+//! Each vertex is mapped when it's read by the clipper, the transformed data
+//! are never stored into a temporary path.
+FOG_NO_EXPORT err_t PathClipperF_clipMappedData(PathClipperF* self,
+  PathF* dst, const PointF* srcPts, const uint8_t* srcCmd, size_t srcLength, const TransformF* tr);
+
+//! @internal
+//!
+//! @brief Map the path data by the affine transform @a tr and clip them, in
+//! one pass (implemented in PathClipper.cpp).
+FOG_NO_EXPORT err_t PathClipperD_clipMappedData(PathClipperD* self,
+  PathD* dst, const PointD* srcPts, const uint8_t* srcCmd, size_t srcLength, const TransformD* tr);
+
+static FOG_INLINE err_t PathClipperT_clipMappedData(PathClipperF* self,
+  PathF* dst, const PointF* srcPts, const uint8_t* srcCmd, size_t srcLength, const TransformF* tr)
+{
+  return PathClipperF_clipMappedData(self, dst, srcPts, srcCmd, srcLength, tr);
+}
+
+static FOG_INLINE err_t PathClipperT_clipMappedData(PathClipperD* self,
+  PathD* dst, const PointD* srcPts, const uint8_t* srcCmd, size_t srcLength, const TransformD* tr)
+{
+  return PathClipperD_clipMappedData(self, dst, srcPts, srcCmd, srcLength, tr);
+}
+
+// ============================================================================
+// [Fog::PathClipper - ClipFigures]
+// ============================================================================
+
+template<typename NumT>
+static FOG_INLINE err_t PathClipperT_emitFigures(NumT_(PathClipper)* self,
+  NumT_(Path)* dst, const NumT_(Transform)* tr, uint32_t figure,
+  const uint8_t* cmd, const NumT_(Point)* pts, size_t length)
+{
+  if (length == 0)
+    return ERR_OK;
+
+  switch (figure)
+  {
+    case PATH_CLIPPER_FIGURE_ACCEPT:
+      return tr->mapPathData(*dst, cmd, pts, length, CONTAINER_OP_APPEND);
+
+    case PATH_CLIPPER_FIGURE_CLIP:
+      return PathClipperT_clipMappedData(self, dst, pts, cmd, length, tr);
+
+    default:
+      return ERR_OK;
+  }
+}
+
+//! @internal
+//!
+//! @brief Transform and clip the path using the affine transform (SWAP,
+//! ROTATION or AFFINE).
+//!
+//! The path is rejected or accepted as a whole if its bounding box is known.
+//! Otherwise each figure is classified by its transformed bounding box before
+//! any per-vertex work, so rejected figures are never transformed and the
+//! accepted ones are transformed directly into @a dst. The figures that
+//! intersect the clip-box are mapped, clipped and emitted in one pass by
+//! @c PathClipperT_clipMappedData(). Consecutive figures of the same kind
+//! are processed by a single call.
+//!
+//! The @a ScannerT only finds the figures and their bounding boxes, the
+//! vertices of clipped figures are mapped by the scalar clipper.
+template<typename NumT, typename ScannerT>
+static err_t PathClipperT_clipPathAffine(NumT_(PathClipper)* self,
+  NumT_(Path)* dst, const NumT_(Path)* src, const NumT_(Transform)* tr)
+{
+  // Appending to the source path is an incorrect use, keep the source by a
+  // (reference counted) copy.
+  if (FOG_UNLIKELY(dst == src))
+  {
+    NumT_(Path) copy(*src);
+    return PathClipperT_clipPathAffine<NumT, ScannerT>(self, dst, &copy, tr);
+  }
+
+  const NumT_(Box)& clipBox = self->_clipBox;
+
+  if (src->_d->hasBoundingBox())
+  {
+    switch (PathClipperT_classifyFigure<NumT>(clipBox, src->_d->boundingBox, tr))
+    {
+      case PATH_CLIPPER_FIGURE_REJECT:
+        return ERR_OK;
+
+      case PATH_CLIPPER_FIGURE_ACCEPT:
+        return tr->mapPath(*dst, *src, CONTAINER_OP_APPEND);
+    }
+  }
+
+  size_t length = src->getLength();
+  const uint8_t* cmd = src->getCommands();
+  const NumT_(Point)* pts = src->getVertices();
+
+  size_t i = 0;
+  size_t runStart = 0;
+  uint32_t runFigure = PATH_CLIPPER_FIGURE_REJECT;
+
+  NumT_(Box) box(UNINITIALIZED);
+
+  while (i < length)
+  {
+    size_t end = ScannerT::getFigure(cmd, pts, i, length, box);
+    uint32_t figure = PathClipperT_classifyFigure<NumT>(clipBox, box, tr);
+
+    if (figure != runFigure)
+    {
+      FOG_RETURN_ON_ERROR(PathClipperT_emitFigures<NumT>(self, dst, tr, runFigure,
+        cmd + runStart, pts + runStart, i - runStart));
+
+      runStart = i;
+      runFigure = figure;
+    }
+
+    i = end;
+  }
+
+  return PathClipperT_emitFigures<NumT>(self, dst, tr, runFigure,
+    cmd + runStart, pts + runStart, length - runStart);
+}
+
+// ============================================================================
+// [Fog::PathClipper - ClipPath]
+// ============================================================================
+
+template<typename NumT, typename ScannerT>
+static err_t FOG_CDECL PathClipperT_clipPath(NumT_(PathClipper)* self,
+  NumT_(Path)* dst, const NumT_(Path)* src, const NumT_(Transform)* tr)
+{
+  self->_lastIndex = INVALID_INDEX;
+
+  uint32_t transformType = (tr != NULL) ? tr->getType() : TRANSFORM_TYPE_IDENTITY;
+
+  switch (transformType)
+  {
+    // If there is no transform the continuePath() is safe and fast.
+    case TRANSFORM_TYPE_IDENTITY:
+    {
+      return self->continuePath(*dst, *src);
+    }
+
+    // Translation and Scaling may be considered as a rect-to-rect transform.
+    // It is safe to do transformation as a second step. If the path is
+    // heavily clipped then we save some CPU cycles, if the path isn't clipped
+    // then it is the same as continuePath().
+    case TRANSFORM_TYPE_TRANSLATION:
+    case TRANSFORM_TYPE_SCALING:
+    {
+      NumT_(Transform) inv(UNINITIALIZED);
+
+      if (NumI_(Transform)::invert(inv, *tr))
+      {
+        // Save the clip box and create new.
+        NumT_(Box) box(self->_clipBox);
+        inv.mapBox(self->_clipBox, self->_clipBox);
+
+        // Clip and transform.
+        size_t dstIndex = dst->getLength();
+        err_t err = self->continuePath(*dst, *src);
+        dst->transform(*tr, Range(dstIndex, DETECT_LENGTH));
+
+        // Restore the clip box and return possible error.
+        self->_clipBox = box;
+        return err;
+      }
+
+      return PathClipperT_clipPathAffine<NumT, ScannerT>(self, dst, src, tr);
+    }
+
+    // Map, classify and clip each figure, see PathClipperT_clipPathAffine().
+    case TRANSFORM_TYPE_SWAP:
+    case TRANSFORM_TYPE_ROTATION:
+    case TRANSFORM_TYPE_AFFINE:
+    {
+      return PathClipperT_clipPathAffine<NumT, ScannerT>(self, dst, src, tr);
+    }
+
+    default:
+    {
+      if (dst == src)
+      {
+        // This is an incorrect use.
+        NumT_(Path) tmp;
+        FOG_RETURN_ON_ERROR(tr->mapPath(tmp, *src));
+
+        return self->continuePath(*dst, tmp);
+      }
+      else
+      {
+        NumT_T1(PathTmp, 200) tmp;
+        FOG_RETURN_ON_ERROR(tr->mapPath(tmp, *src));
+
+        return self->continuePathData(*dst, tmp.getVertices(), tmp.getCommands(), tmp.getLength());
+      }
+    }
+  }
+}
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_GEOMETRY_PATHCLIPPER_P_H
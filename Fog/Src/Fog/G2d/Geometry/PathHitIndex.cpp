@@ -0,0 +1,532 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/G2d/Geometry/Box.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Geometry/PathHitIndex.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::PathHitIndexT - Constants]
+// ============================================================================
+
+enum
+{
+  //! @brief Maximum number of bands.
+  PATH_HIT_INDEX_MAX_BANDS = 16384,
+
+  //! @brief Maximum average number of bands referencing a single edge. The
+  //! number of bands is halved until the index fits.
+  PATH_HIT_INDEX_MAX_REFERENCES = 8
+};
+
+// ============================================================================
+// [Fog::PathHitIndexT - Helpers]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Get the band at @a y.
+//!
+//! The same function is used to build and to query the index, and it's
+//! monotone in @a y, so an edge spanning [y0, y1] is always found in the
+//! band of any y between y0 and y1.
+template<typename NumT>
+static FOG_INLINE size_t PathHitIndexT_getBand(const NumT_(PathHitIndex)* self, NumT y)
+{
+  NumT b = (y - self->_boundingBox.y0) * self->_bandScale;
+
+  if (!(b > NumT(0)))
+    return 0;
+
+  if (b >= NumT(double(self->_bandCount)))
+    return self->_bandCount - 1;
+
+  return (size_t)b;
+}
+
+template<typename NumT>
+static FOG_INLINE void PathHitIndexT_getBandRange(const NumT_(PathHitIndex)* self,
+  const NumT_(PathHitIndexEdge)& edge, size_t& b0, size_t& b1)
+{
+  if (edge.y0 < edge.y1)
+  {
+    b0 = PathHitIndexT_getBand<NumT>(self, edge.y0);
+    b1 = PathHitIndexT_getBand<NumT>(self, edge.y1);
+  }
+  else
+  {
+    b0 = PathHitIndexT_getBand<NumT>(self, edge.y1);
+    b1 = PathHitIndexT_getBand<NumT>(self, edge.y0);
+  }
+}
+
+template<typename NumT>
+static FOG_INLINE void PathHitIndexT_addEdge(NumT_(PathHitIndexEdge)* edge,
+  const NumT_(Point)& p0, const NumT_(Point)& p1, uint32_t isImplicitClose)
+{
+  edge->x0 = p0.x;
+  edge->y0 = p0.y;
+  edge->x1 = p1.x;
+  edge->y1 = p1.y;
+
+  if (p0.y < p1.y)
+    edge->winding = 1;
+  else if (p0.y > p1.y)
+    edge->winding = -1;
+  else
+    edge->winding = 0;
+
+  edge->flags.packed = 0;
+  edge->flags.isImplicitClose = isImplicitClose;
+}
+
+// ============================================================================
+// [Fog::PathHitIndexT - Generate]
+// ============================================================================
+
+template<typename NumT>
+static NumT_(PathHitIndex)* FOG_CDECL PathHitIndexT_generate(const NumT_(Path)* path)
+{
+  NumT_(Path) flat;
+
+  if (path->hasBeziers())
+  {
+    if (NumI_(Path)::flatten(flat, *path, NumT_(PathFlattenParams)()) != ERR_OK)
+      return NULL;
+    path = &flat;
+  }
+
+  size_t length = path->getLength();
+  if (length == 0)
+    return NULL;
+
+  const NumT_(Point)* pts = path->getVertices();
+  const uint8_t* cmd = path->getCommands();
+
+  // --------------------------------------------------------------------------
+  // [Count Edges]
+  // --------------------------------------------------------------------------
+
+  // Each vertex except move-to adds one edge and each figure adds at most one
+  // edge which closes it.
+  size_t edgeCount = 0;
+  size_t i;
+
+  for (i = 0; i < length; i++)
+  {
+    if (PathCmd::isMoveTo(cmd[i]))
+      edgeCount++;
+    else if (PathCmd::isLineTo(cmd[i]))
+      edgeCount++;
+    else if (!PathCmd::isClose(cmd[i]))
+      return NULL;
+  }
+
+  if (edgeCount >= UINT32_MAX)
+    return NULL;
+
+  size_t memSize = sizeof(NumT_(PathHitIndex)) + edgeCount * sizeof(NumT_(PathHitIndexEdge));
+
+  NumT_(PathHitIndex)* self = reinterpret_cast<NumT_(PathHitIndex)*>(MemMgr::alloc(memSize));
+  if (FOG_IS_NULL(self))
+    return NULL;
+
+  NumT_(PathHitIndexEdge)* edges = reinterpret_cast<NumT_(PathHitIndexEdge)*>(
+    (uint8_t*)self + sizeof(NumT_(PathHitIndex)));
+
+  // --------------------------------------------------------------------------
+  // [Collect Edges]
+  // --------------------------------------------------------------------------
+
+  {
+    NumT_(PathHitIndexEdge)* edge = edges;
+    NumT_(Point) start;
+    bool hasMoveTo = false;
+
+    for (i = 0; i < length; i++)
+    {
+      switch (cmd[i])
+      {
+        case PATH_CMD_MOVE_TO:
+          if (hasMoveTo && pts[i - 1] != start)
+            PathHitIndexT_addEdge<NumT>(edge++, pts[i - 1], start, 1);
+
+          start = pts[i];
+          hasMoveTo = true;
+          break;
+
+        case PATH_CMD_LINE_TO:
+          if (FOG_UNLIKELY(!hasMoveTo))
+            goto _Invalid;
+
+          PathHitIndexT_addEdge<NumT>(edge++, pts[i - 1], pts[i], 0);
+          break;
+
+        case PATH_CMD_CLOSE:
+          if (hasMoveTo && pts[i - 1] != start)
+            PathHitIndexT_addEdge<NumT>(edge++, pts[i - 1], start, 0);
+
+          hasMoveTo = false;
+          break;
+
+        default:
+          FOG_ASSERT_NOT_REACHED();
+      }
+    }
+
+    if (hasMoveTo && pts[length - 1] != start)
+      PathHitIndexT_addEdge<NumT>(edge++, pts[length - 1], start, 1);
+
+    edgeCount = (size_t)(edge - edges);
+  }
+
+  if (edgeCount == 0)
+    goto _Invalid;
+
+  // --------------------------------------------------------------------------
+  // [Choose Bands]
+  // --------------------------------------------------------------------------
+
+  {
+    NumT_(Box) box(edges[0].x0, edges[0].y0, edges[0].x0, edges[0].y0);
+
+    for (i = 0; i < edgeCount; i++)
+    {
+      const NumT_(PathHitIndexEdge)& edge = edges[i];
+
+      if (box.x0 > edge.x1) box.x0 = edge.x1;
+      if (box.y0 > edge.y1) box.y0 = edge.y1;
+      if (box.x1 < edge.x1) box.x1 = edge.x1;
+      if (box.y1 < edge.y1) box.y1 = edge.y1;
+    }
+
+    if (!Math::isFinite(box.x0) || !Math::isFinite(box.y0) ||
+        !Math::isFinite(box.x1) || !Math::isFinite(box.y1))
+    {
+      goto _Invalid;
+    }
+
+    NumT height = box.y1 - box.y0;
+    size_t bandCount = Math::min<size_t>(edgeCount / 2 + 1, PATH_HIT_INDEX_MAX_BANDS);
+
+    if (!(height > NumT(0)))
+      bandCount = 1;
+
+    self->_edgeCount = edgeCount;
+    self->_boundingBox = box;
+
+    // Halve the number of bands until the edges spanning many bands fit.
+    size_t refCount;
+
+    for (;;)
+    {
+      self->_bandCount = bandCount;
+      self->_bandScale = bandCount > 1 ? NumT(double(bandCount)) / height : NumT(0);
+
+      refCount = 0;
+      for (i = 0; i < edgeCount; i++)
+      {
+        size_t b0, b1;
+        PathHitIndexT_getBandRange<NumT>(self, edges[i], b0, b1);
+        refCount += b1 - b0 + 1;
+      }
+
+      if (bandCount == 1 || refCount <= edgeCount * PATH_HIT_INDEX_MAX_REFERENCES)
+        break;
+
+      bandCount >>= 1;
+    }
+
+    if (refCount >= UINT32_MAX)
+      goto _Invalid;
+
+    // ------------------------------------------------------------------------
+    // [Build Bands]
+    // ------------------------------------------------------------------------
+
+    size_t edgesSize = sizeof(NumT_(PathHitIndex)) + edgeCount * sizeof(NumT_(PathHitIndexEdge));
+    size_t newSize = edgesSize + (bandCount + 1 + refCount) * sizeof(uint32_t);
+
+    NumT_(PathHitIndex)* newSelf = reinterpret_cast<NumT_(PathHitIndex)*>(MemMgr::realloc(self, newSize));
+    if (FOG_IS_NULL(newSelf))
+      goto _Invalid;
+
+    self = newSelf;
+    edges = reinterpret_cast<NumT_(PathHitIndexEdge)*>((uint8_t*)self + sizeof(NumT_(PathHitIndex)));
+
+    uint32_t* bandData = reinterpret_cast<uint32_t*>((uint8_t*)self + edgesSize);
+    uint32_t* bandEdges = bandData + bandCount + 1;
+
+    self->_reference.init(1);
+    self->_edgeData = edges;
+    self->_bandData = bandData;
+    self->_bandEdges = bandEdges;
+
+    // Count the edges of each band and convert the counts into positions.
+    size_t b;
+
+    for (b = 0; b <= bandCount; b++)
+      bandData[b] = 0;
+
+    for (i = 0; i < edgeCount; i++)
+    {
+      size_t b0, b1;
+      PathHitIndexT_getBandRange<NumT>(self, edges[i], b0, b1);
+
+      for (b = b0; b <= b1; b++)
+        bandData[b]++;
+    }
+
+    uint32_t position = 0;
+    for (b = 0; b < bandCount; b++)
+    {
+      uint32_t count = bandData[b];
+      bandData[b] = position;
+      position += count;
+    }
+
+    // Fill the bands, each bandData[b] is advanced to the start of b + 1.
+    for (i = 0; i < edgeCount; i++)
+    {
+      size_t b0, b1;
+      PathHitIndexT_getBandRange<NumT>(self, edges[i], b0, b1);
+
+      for (b = b0; b <= b1; b++)
+        bandEdges[bandData[b]++] = (uint32_t)i;
+    }
+
+    for (b = bandCount; b > 0; b--)
+      bandData[b] = bandData[b - 1];
+    bandData[0] = 0;
+
+    return self;
+  }
+
+_Invalid:
+  MemMgr::free(self);
+  return NULL;
+}
+
+// ============================================================================
+// [Fog::PathHitIndexT - HitTest]
+// ============================================================================
+
+template<typename NumT>
+static FOG_INLINE int PathHitIndexT_getWindingInline(const NumT_(PathHitIndex)* self, NumT px, NumT py)
+{
+  // The same half-open interval as used by Path::hitTest(), the edges ending
+  // at py are not counted.
+  if (!(py >= self->_boundingBox.y0 && py < self->_boundingBox.y1) || px < self->_boundingBox.x0)
+    return 0;
+
+  size_t b = PathHitIndexT_getBand<NumT>(self, py);
+
+  const NumT_(PathHitIndexEdge)* edges = self->_edgeData;
+  const uint32_t* p = self->_bandEdges + self->_bandData[b];
+  const uint32_t* end = self->_bandEdges + self->_bandData[b + 1];
+
+  int windingNumber = 0;
+
+  for (; p != end; p++)
+  {
+    const NumT_(PathHitIndexEdge)& edge = edges[p[0]];
+
+    if (edge.winding > 0)
+    {
+      if (py >= edge.y0 && py < edge.y1)
+      {
+        NumT ix = edge.x0 + (py - edge.y0) * (edge.x1 - edge.x0) / (edge.y1 - edge.y0);
+        windingNumber += (px >= ix);
+      }
+    }
+    else if (edge.winding < 0)
+    {
+      if (py >= edge.y1 && py < edge.y0)
+      {
+        NumT ix = edge.x0 + (py - edge.y0) * (edge.x1 - edge.x0) / (edge.y1 - edge.y0);
+        windingNumber -= (px >= ix);
+      }
+    }
+  }
+
+  return windingNumber;
+}
+
+template<typename NumT>
+static int FOG_CDECL PathHitIndexT_getWinding(const NumT_(PathHitIndex)* self, const NumT_(Point)* pt)
+{
+  return PathHitIndexT_getWindingInline<NumT>(self, pt->x, pt->y);
+}
+
+template<typename NumT>
+static void FOG_CDECL PathHitIndexT_hitTestPoints(const NumT_(PathHitIndex)* self,
+  bool* dst, const NumT_(Point)* pts, size_t count, uint32_t fillRule)
+{
+  int mask = (fillRule == FILL_RULE_EVEN_ODD) ? 1 : -1;
+
+  for (size_t i = 0; i < count; i++)
+    dst[i] = (PathHitIndexT_getWindingInline<NumT>(self, pts[i].x, pts[i].y) & mask) != 0;
+}
+
+// ============================================================================
+// [Fog::PathHitIndexT - Distance]
+// ============================================================================
+
+template<typename NumT>
+static FOG_INLINE void PathHitIndexT_mergeDistance(const NumT_(PathHitIndexEdge)& edge,
+  NumT px, NumT py, NumT& best, NumT& bestSquared)
+{
+  if (edge.flags.isImplicitClose)
+    return;
+
+  // Reject edges whose bounding box is farther than the best distance found.
+  if (Math::min(edge.x0, edge.x1) - px >= best || px - Math::max(edge.x0, edge.x1) >= best ||
+      Math::min(edge.y0, edge.y1) - py >= best || py - Math::max(edge.y0, edge.y1) >= best)
+  {
+    return;
+  }
+
+  NumT dx = edge.x1 - edge.x0;
+  NumT dy = edge.y1 - edge.y0;
+
+  NumT vx = px - edge.x0;
+  NumT vy = py - edge.y0;
+
+  NumT lengthSquared = dx * dx + dy * dy;
+
+  if (lengthSquared > NumT(0))
+  {
+    NumT t = (vx * dx + vy * dy) / lengthSquared;
+
+    if (t >= NumT(1))
+    {
+      vx -= dx;
+      vy -= dy;
+    }
+    else if (t > NumT(0))
+    {
+      vx -= dx * t;
+      vy -= dy * t;
+    }
+  }
+
+  NumT dSquared = vx * vx + vy * vy;
+  if (dSquared < bestSquared)
+  {
+    bestSquared = dSquared;
+    best = Math::sqrt(dSquared);
+  }
+}
+
+template<typename NumT>
+static FOG_INLINE void PathHitIndexT_mergeBand(const NumT_(PathHitIndex)* self, size_t b,
+  NumT px, NumT py, NumT& best, NumT& bestSquared)
+{
+  const NumT_(PathHitIndexEdge)* edges = self->_edgeData;
+  const uint32_t* p = self->_bandEdges + self->_bandData[b];
+  const uint32_t* end = self->_bandEdges + self->_bandData[b + 1];
+
+  for (; p != end; p++)
+    PathHitIndexT_mergeDistance<NumT>(edges[p[0]], px, py, best, bestSquared);
+}
+
+template<typename NumT>
+static NumT FOG_CDECL PathHitIndexT_getDistance(const NumT_(PathHitIndex)* self,
+  const NumT_(Point)* pt, NumT maxDistance)
+{
+  NumT px = pt->x;
+  NumT py = pt->y;
+
+  const NumT_(Box)& box = self->_boundingBox;
+
+  if (!(maxDistance > NumT(0)) ||
+      px <= box.x0 - maxDistance || px >= box.x1 + maxDistance ||
+      py <= box.y0 - maxDistance || py >= box.y1 + maxDistance)
+  {
+    return maxDistance;
+  }
+
+  NumT best = maxDistance;
+  NumT bestSquared = maxDistance * maxDistance;
+
+  const NumT_(PathHitIndexEdge)* edges = self->_edgeData;
+  size_t bandCount = self->_bandCount;
+
+  size_t b0 = PathHitIndexT_getBand<NumT>(self, py - maxDistance);
+  size_t b1 = PathHitIndexT_getBand<NumT>(self, py + maxDistance);
+
+  if ((b1 - b0 + 1) * 2 > bandCount)
+  {
+    // Walk all edges once if the range covers most of the bands, the edges
+    // would be visited several times otherwise.
+    size_t count = self->_edgeCount;
+
+    for (size_t i = 0; i < count; i++)
+      PathHitIndexT_mergeDistance<NumT>(edges[i], px, py, best, bestSquared);
+  }
+  else
+  {
+    // Start by the band of the point and continue by the neighbouring bands
+    // in both directions. The range of the bands, which can contain a closer
+    // edge, shrinks with the best distance found.
+    size_t lo = PathHitIndexT_getBand<NumT>(self, py);
+    size_t hi = lo;
+
+    PathHitIndexT_mergeBand<NumT>(self, lo, px, py, best, bestSquared);
+
+    for (;;)
+    {
+      bool more = false;
+
+      if (lo > PathHitIndexT_getBand<NumT>(self, py - best))
+      {
+        PathHitIndexT_mergeBand<NumT>(self, --lo, px, py, best, bestSquared);
+        more = true;
+      }
+
+      if (hi < PathHitIndexT_getBand<NumT>(self, py + best))
+      {
+        PathHitIndexT_mergeBand<NumT>(self, ++hi, px, py, best, bestSquared);
+        more = true;
+      }
+
+      if (!more)
+        break;
+    }
+  }
+
+  return best;
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void PathHitIndex_init(void)
+{
+  fog_api.pathhitindexf_getWinding = PathHitIndexT_getWinding<float>;
+  fog_api.pathhitindexf_hitTestPoints = PathHitIndexT_hitTestPoints<float>;
+  fog_api.pathhitindexf_getDistance = PathHitIndexT_getDistance<float>;
+  fog_api.pathhitindexf_generate = PathHitIndexT_generate<float>;
+
+  fog_api.pathhitindexd_getWinding = PathHitIndexT_getWinding<double>;
+  fog_api.pathhitindexd_hitTestPoints = PathHitIndexT_hitTestPoints<double>;
+  fog_api.pathhitindexd_getDistance = PathHitIndexT_getDistance<double>;
+  fog_api.pathhitindexd_generate = PathHitIndexT_generate<double>;
+}
+
+} // Fog namespace
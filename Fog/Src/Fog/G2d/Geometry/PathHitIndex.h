@@ -0,0 +1,332 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_GEOMETRY_PATHHITINDEX_H
+#define _FOG_G2D_GEOMETRY_PATHHITINDEX_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Threading/Atomic.h>
+#include <Fog/G2d/Geometry/Box.h>
+#include <Fog/G2d/Geometry/Point.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Geometry
+//! @{
+
+// ============================================================================
+// [Fog::PathHitIndexEdgeFlags]
+// ============================================================================
+
+union FOG_NO_EXPORT PathHitIndexEdgeFlags
+{
+  struct
+  {
+    //! @brief The edge closes an open figure (used by the winding query, but
+    //! not by the distance query).
+    uint32_t isImplicitClose : 1;
+    uint32_t reserved : 31;
+  };
+
+  uint32_t packed;
+};
+
+// ============================================================================
+// [Fog::PathHitIndexEdgeF]
+// ============================================================================
+
+struct FOG_NO_EXPORT PathHitIndexEdgeF
+{
+  float x0, y0;
+  float x1, y1;
+
+  //! @brief Winding direction, 1 (down), -1 (up) or 0 (horizontal).
+  int winding;
+  PathHitIndexEdgeFlags flags;
+};
+
+// ============================================================================
+// [Fog::PathHitIndexEdgeD]
+// ============================================================================
+
+struct FOG_NO_EXPORT PathHitIndexEdgeD
+{
+  double x0, y0;
+  double x1, y1;
+
+  //! @brief Winding direction, 1 (down), -1 (up) or 0 (horizontal).
+  int winding;
+  PathHitIndexEdgeFlags flags;
+};
+
+// ============================================================================
+// [Fog::PathHitIndexF]
+// ============================================================================
+
+//! @brief Path hit-index (float).
+//!
+//! The hit-index contains the edges of the flattened path bucketed into
+//! horizontal bands of the same height. Each band references all edges
+//! which intersect it, so the winding number at a given point is computed
+//! only from the edges of the band the point lies in, instead of walking
+//! the whole path.
+//!
+//! The hit-index is created by @c PathF::getHitIndex() on demand and it's
+//! cached by the path until it's modified.
+struct FOG_NO_EXPORT PathHitIndexF
+{
+  // --------------------------------------------------------------------------
+  // [AddRef / Release]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE PathHitIndexF* addRef() const
+  {
+    _reference.inc();
+    return const_cast<PathHitIndexF*>(this);
+  }
+
+  FOG_INLINE void release()
+  {
+    if (_reference.deref())
+      MemMgr::free(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE size_t getReference() const { return _reference.get(); }
+  FOG_INLINE size_t getEdgeCount() const { return _edgeCount; }
+  FOG_INLINE size_t getBandCount() const { return _bandCount; }
+  FOG_INLINE const BoxF& getBoundingBox() const { return _boundingBox; }
+
+  FOG_INLINE const PathHitIndexEdgeF* getEdgeData() const { return _edgeData; }
+  FOG_INLINE const uint32_t* getBandData() const { return _bandData; }
+  FOG_INLINE const uint32_t* getBandEdges() const { return _bandEdges; }
+
+  // --------------------------------------------------------------------------
+  // [HitTest]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the winding number at @a pt.
+  FOG_INLINE int getWinding(const PointF& pt) const
+  {
+    return fog_api.pathhitindexf_getWinding(this, &pt);
+  }
+
+  FOG_INLINE bool hitTest(const PointF& pt, uint32_t fillRule) const
+  {
+    int winding = fog_api.pathhitindexf_getWinding(this, &pt);
+
+    if (fillRule == FILL_RULE_EVEN_ODD)
+      winding &= 1;
+    return winding != 0;
+  }
+
+  //! @brief Hit-test @a count points at @a pts, storing the results to @a dst.
+  FOG_INLINE void hitTest(bool* dst, const PointF* pts, size_t count, uint32_t fillRule) const
+  {
+    fog_api.pathhitindexf_hitTestPoints(this, dst, pts, count, fillRule);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Distance]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the distance between @a pt and the closest edge of the path,
+  //! or @a maxDistance if no edge is closer.
+  //!
+  //! The edges closing open figures are not considered, so the result is the
+  //! distance to the outline the path stroker strokes.
+  FOG_INLINE float getDistance(const PointF& pt, float maxDistance) const
+  {
+    return fog_api.pathhitindexf_getDistance(this, &pt, maxDistance);
+  }
+
+  //! @brief Get whether the @a pt is within a stroke of @a lineWidth.
+  //!
+  //! The result is exact for round line-joins and line-caps, other styles
+  //! must be handled by the caller.
+  FOG_INLINE bool hitTestStroke(const PointF& pt, float lineWidth) const
+  {
+    float halfWidth = lineWidth * 0.5f;
+    return fog_api.pathhitindexf_getDistance(this, &pt, halfWidth) < halfWidth;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Statics]
+  // --------------------------------------------------------------------------
+
+  static FOG_INLINE PathHitIndexF* generate(const PathF& path)
+  {
+    return fog_api.pathhitindexf_generate(&path);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Reference count.
+  mutable Atomic<size_t> _reference;
+
+  //! @brief Number of edges.
+  size_t _edgeCount;
+  //! @brief Number of bands.
+  size_t _bandCount;
+
+  //! @brief Bounding box of all edges.
+  BoxF _boundingBox;
+  //! @brief Scale used to convert a y coordinate into the band index.
+  float _bandScale;
+
+  //! @brief Edges.
+  PathHitIndexEdgeF* _edgeData;
+  //! @brief Start of each band in @c _bandEdges (@c _bandCount + 1 items).
+  uint32_t* _bandData;
+  //! @brief Edge indexes of all bands.
+  uint32_t* _bandEdges;
+};
+
+// ============================================================================
+// [Fog::PathHitIndexD]
+// ============================================================================
+
+//! @brief Path hit-index (double).
+//!
+//! @sa PathHitIndexF.
+struct FOG_NO_EXPORT PathHitIndexD
+{
+  // --------------------------------------------------------------------------
+  // [AddRef / Release]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE PathHitIndexD* addRef() const
+  {
+    _reference.inc();
+    return const_cast<PathHitIndexD*>(this);
+  }
+
+  FOG_INLINE void release()
+  {
+    if (_reference.deref())
+      MemMgr::free(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE size_t getReference() const { return _reference.get(); }
+  FOG_INLINE size_t getEdgeCount() const { return _edgeCount; }
+  FOG_INLINE size_t getBandCount() const { return _bandCount; }
+  FOG_INLINE const BoxD& getBoundingBox() const { return _boundingBox; }
+
+  FOG_INLINE const PathHitIndexEdgeD* getEdgeData() const { return _edgeData; }
+  FOG_INLINE const uint32_t* getBandData() const { return _bandData; }
+  FOG_INLINE const uint32_t* getBandEdges() const { return _bandEdges; }
+
+  // --------------------------------------------------------------------------
+  // [HitTest]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the winding number at @a pt.
+  FOG_INLINE int getWinding(const PointD& pt) const
+  {
+    return fog_api.pathhitindexd_getWinding(this, &pt);
+  }
+
+  FOG_INLINE bool hitTest(const PointD& pt, uint32_t fillRule) const
+  {
+    int winding = fog_api.pathhitindexd_getWinding(this, &pt);
+
+    if (fillRule == FILL_RULE_EVEN_ODD)
+      winding &= 1;
+    return winding != 0;
+  }
+
+  //! @brief Hit-test @a count points at @a pts, storing the results to @a dst.
+  FOG_INLINE void hitTest(bool* dst, const PointD* pts, size_t count, uint32_t fillRule) const
+  {
+    fog_api.pathhitindexd_hitTestPoints(this, dst, pts, count, fillRule);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Distance]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the distance between @a pt and the closest edge of the path,
+  //! or @a maxDistance if no edge is closer.
+  //!
+  //! The edges closing open figures are not considered, so the result is the
+  //! distance to the outline the path stroker strokes.
+  FOG_INLINE double getDistance(const PointD& pt, double maxDistance) const
+  {
+    return fog_api.pathhitindexd_getDistance(this, &pt, maxDistance);
+  }
+
+  //! @brief Get whether the @a pt is within a stroke of @a lineWidth.
+  //!
+  //! The result is exact for round line-joins and line-caps, other styles
+  //! must be handled by the caller.
+  FOG_INLINE bool hitTestStroke(const PointD& pt, double lineWidth) const
+  {
+    double halfWidth = lineWidth * 0.5;
+    return fog_api.pathhitindexd_getDistance(this, &pt, halfWidth) < halfWidth;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Statics]
+  // --------------------------------------------------------------------------
+
+  static FOG_INLINE PathHitIndexD* generate(const PathD& path)
+  {
+    return fog_api.pathhitindexd_generate(&path);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Reference count.
+  mutable Atomic<size_t> _reference;
+
+  //! @brief Number of edges.
+  size_t _edgeCount;
+  //! @brief Number of bands.
+  size_t _bandCount;
+
+  //! @brief Bounding box of all edges.
+  BoxD _boundingBox;
+  //! @brief Scale used to convert a y coordinate into the band index.
+  double _bandScale;
+
+  //! @brief Edges.
+  PathHitIndexEdgeD* _edgeData;
+  //! @brief Start of each band in @c _bandEdges (@c _bandCount + 1 items).
+  uint32_t* _bandData;
+  //! @brief Edge indexes of all bands.
+  uint32_t* _bandEdges;
+};
+
+// ============================================================================
+// [Fog::PathHitIndexT<> / Fog::PathHitIndexEdgeT<>]
+// ============================================================================
+
+_FOG_NUM_T(PathHitIndex)
+_FOG_NUM_T(PathHitIndexEdge)
+_FOG_NUM_F(PathHitIndex)
+_FOG_NUM_F(PathHitIndexEdge)
+_FOG_NUM_D(PathHitIndex)
+_FOG_NUM_D(PathHitIndexEdge)
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_GEOMETRY_PATHHITINDEX_H
@@ -44,6 +44,178 @@ _FOG_NUM_T(PathInfoFigureItem)
 _FOG_NUM_F(PathInfoFigureItem)
 _FOG_NUM_D(PathInfoFigureItem)
 
+// ============================================================================
+// [Fog::PathInfoT - Arc Length]
+// ============================================================================
+
+enum
+{
+  //! @brief Count of equal parameter intervals a curve is integrated in.
+  //!
+  //! The 5-point Gauss-Legendre rule is exact for polynomials of degree 9,
+  //! but the speed of a curve is a square root of a polynomial, which isn't
+  //! smooth near cusps. Integrating short intervals keeps the error small
+  //! there as well.
+  PATH_INFO_CURVE_INTERVALS = 8,
+
+  //! @brief Maximum count of Newton iterations to find a curve parameter.
+  PATH_INFO_MAX_ITERATIONS = 16
+};
+
+//! @internal
+//!
+//! @brief Abscissae and weights of the 5-point Gauss-Legendre rule.
+static const double PathInfo_glAbscissa[5] =
+{
+  -0.9061798459386639927976269,
+  -0.5384693101056830910363144,
+   0.0,
+   0.5384693101056830910363144,
+   0.9061798459386639927976269
+};
+
+static const double PathInfo_glWeight[5] =
+{
+  0.2369268850561890875142640,
+  0.4786286704993664680412915,
+  0.5688888888888888888888889,
+  0.4786286704993664680412915,
+  0.2369268850561890875142640
+};
+
+//! @internal
+//!
+//! @brief Get the derivative of a quadratic (@a degree 2) or cubic (@a degree
+//! 3) curve at @a t.
+template<typename NumT>
+static FOG_INLINE void PathInfoT_getDerivative(const NumT_(Point)* p, uint32_t degree, double t,
+  double& dx, double& dy)
+{
+  double tInv = 1.0 - t;
+
+  if (degree == 2)
+  {
+    dx = 2.0 * (tInv * double(p[1].x - p[0].x) + t * double(p[2].x - p[1].x));
+    dy = 2.0 * (tInv * double(p[1].y - p[0].y) + t * double(p[2].y - p[1].y));
+  }
+  else
+  {
+    double a = tInv * tInv;
+    double b = 2.0 * t * tInv;
+    double c = t * t;
+
+    dx = 3.0 * (a * double(p[1].x - p[0].x) + b * double(p[2].x - p[1].x) + c * double(p[3].x - p[2].x));
+    dy = 3.0 * (a * double(p[1].y - p[0].y) + b * double(p[2].y - p[1].y) + c * double(p[3].y - p[2].y));
+  }
+}
+
+template<typename NumT>
+static FOG_INLINE double PathInfoT_getSpeed(const NumT_(Point)* p, uint32_t degree, double t)
+{
+  double dx, dy;
+  PathInfoT_getDerivative<NumT>(p, degree, t, dx, dy);
+  return Math::sqrt(dx * dx + dy * dy);
+}
+
+//! @internal
+//!
+//! @brief Get the arc length of a curve between the parameters @a t0 and @a t1.
+template<typename NumT>
+static double PathInfoT_integrate(const NumT_(Point)* p, uint32_t degree, double t0, double t1)
+{
+  double h = (t1 - t0) * 0.5;
+  double m = (t1 + t0) * 0.5;
+  double sum = 0.0;
+
+  for (uint32_t i = 0; i < 5; i++)
+    sum += PathInfo_glWeight[i] * PathInfoT_getSpeed<NumT>(p, degree, m + h * PathInfo_glAbscissa[i]);
+
+  return sum * h;
+}
+
+//! @internal
+//!
+//! @brief Get the arc length of a curve.
+//!
+//! The same quadrature is used by @c PathInfoT_getCurveParameter(), so the
+//! distances stored in the path-info and the distance queries agree.
+template<typename NumT>
+static double PathInfoT_getCurveLength(const NumT_(Point)* p, uint32_t degree)
+{
+  double length = 0.0;
+  double step = 1.0 / double(PATH_INFO_CURVE_INTERVALS);
+
+  for (uint32_t i = 0; i < PATH_INFO_CURVE_INTERVALS; i++)
+    length += PathInfoT_integrate<NumT>(p, degree, double(i) * step, double(i + 1) * step);
+
+  return length;
+}
+
+//! @internal
+//!
+//! @brief Get the parameter of a curve at the arc length @a s.
+//!
+//! The interval containing @a s is found first, then the parameter is found
+//! by Newton's method (the derivative of the arc length is the speed) guarded
+//! by bisection.
+template<typename NumT>
+static double PathInfoT_getCurveParameter(const NumT_(Point)* p, uint32_t degree, double s)
+{
+  if (!(s > 0.0))
+    return 0.0;
+
+  double step = 1.0 / double(PATH_INFO_CURVE_INTERVALS);
+  double t0 = 0.0;
+  double t1 = step;
+  double piece = 0.0;
+
+  for (uint32_t i = 0; i < PATH_INFO_CURVE_INTERVALS; i++)
+  {
+    t0 = double(i) * step;
+    t1 = double(i + 1) * step;
+    piece = PathInfoT_integrate<NumT>(p, degree, t0, t1);
+
+    if (s <= piece)
+      break;
+
+    if (i == PATH_INFO_CURVE_INTERVALS - 1)
+      return 1.0;
+
+    s -= piece;
+  }
+
+  if (!(piece > 0.0))
+    return t0;
+
+  double lo = t0;
+  double hi = t1;
+  double t = t0 + (t1 - t0) * (s / piece);
+  double epsilon = piece * 1e-9;
+
+  for (uint32_t i = 0; i < PATH_INFO_MAX_ITERATIONS; i++)
+  {
+    double f = PathInfoT_integrate<NumT>(p, degree, t0, t) - s;
+
+    if (Math::abs(f) <= epsilon)
+      break;
+
+    if (f > 0.0)
+      hi = t;
+    else
+      lo = t;
+
+    double v = PathInfoT_getSpeed<NumT>(p, degree, t);
+    double tNext = v > 0.0 ? t - f / v : lo;
+
+    if (!(tNext > lo && tNext < hi))
+      tNext = (lo + hi) * 0.5;
+
+    t = tNext;
+  }
+
+  return t;
+}
+
 // ============================================================================
 // [Fog::PathInfoT - Generate]
 // ============================================================================
@@ -191,7 +363,7 @@ static NumT_(PathInfo)* FOG_CDECL PathInfoT_generate(const NumT_(Path)* path)
 
     size_t memSize = sizeof(NumT_(PathInfo)) +
                      numberOfFigures * sizeof(NumT_(PathInfoFigure)) +
-                     length * sizeof(NumT);
+                     length * sizeof(NumT) * 2;
 
     info = reinterpret_cast<NumT_(PathInfo)*>(MemMgr::alloc(memSize));
     if (FOG_IS_NULL(info))
@@ -207,8 +379,11 @@ static NumT_(PathInfo)* FOG_CDECL PathInfoT_generate(const NumT_(Path)* path)
     NumT* distanceData = reinterpret_cast<NumT*>(
       (uint8_t*)figureData + numberOfFigures * sizeof(NumT_(PathInfoFigure)));
 
+    NumT* cumulativeData = distanceData + length;
+
     info->_figureData = figureData;
     info->_distanceData = distanceData;
+    info->_cumulativeData = cumulativeData;
 
     // Whole path properties.
     double pathLength = NumT(0);
@@ -268,12 +443,12 @@ static NumT_(PathInfo)* FOG_CDECL PathInfoT_generate(const NumT_(Path)* path)
                 boundingBox.x1 < srcPts[i + 0].x || boundingBox.y1 < srcPts[i + 0].y)
             {
               NumT_(Box) bezierBox(UNINITIALIZED);
-              if (FOG_IS_ERROR(reinterpret_cast<const NumT_(QBezier)*>(srcPts - 1)->getBoundingBox(bezierBox)))
+              if (FOG_IS_ERROR(reinterpret_cast<const NumT_(QBezier)*>(srcPts + i - 1)->getBoundingBox(bezierBox)))
                 goto _Invalid;
               NumI_(Box)::bound(boundingBox, boundingBox, bezierBox);
             }
 
-            commandDistance = reinterpret_cast<const NumT_(QBezier)*>(srcPts - 1)->getLength();
+            commandDistance = NumT(PathInfoT_getCurveLength<NumT>(srcPts + i - 1, 2));
             distanceData[i + 0] = NumT(commandDistance);
             distanceData[i + 1] = NumT(0);
 
@@ -294,18 +469,18 @@ static NumT_(PathInfo)* FOG_CDECL PathInfoT_generate(const NumT_(Path)* path)
                 boundingBox.x1 < srcPts[i + 1].x || boundingBox.y1 < srcPts[i + 1].y)
             {
               NumT_(Box) bezierBox(UNINITIALIZED);
-              if (FOG_IS_ERROR(reinterpret_cast<const NumT_(CBezier)*>(srcPts - 1)->getBoundingBox(bezierBox)))
+              if (FOG_IS_ERROR(reinterpret_cast<const NumT_(CBezier)*>(srcPts + i - 1)->getBoundingBox(bezierBox)))
                 goto _Invalid;
               NumI_(Box)::bound(boundingBox, boundingBox, bezierBox);
             }
 
-            commandDistance = reinterpret_cast<const NumT_(CBezier)*>(srcPts - 1)->getLength();
+            commandDistance = NumT(PathInfoT_getCurveLength<NumT>(srcPts + i - 1, 3));
             distanceData[i + 0] = NumT(commandDistance);
             distanceData[i + 1] = NumT(0);
             distanceData[i + 2] = NumT(0);
 
             // Inflection points.
-            reinterpret_cast<const NumT_(CBezier)*>(srcPts - 1)->getInflectionPoints(&distanceData[i + 1]);
+            reinterpret_cast<const NumT_(CBezier)*>(srcPts + i - 1)->getInflectionPoints(&distanceData[i + 1]);
 
             if (!hasAcuteEdges)
               hasAcuteEdges |= PathInfoT_isAcute<NumT>(srcPts[i - 1], srcPts[i], srcPts[i + 1]);
@@ -350,6 +525,28 @@ static NumT_(PathInfo)* FOG_CDECL PathInfoT_generate(const NumT_(Path)* path)
         NumI_(Box)::bound(pathBoundingBox, pathBoundingBox, boundingBox);
     }
 
+    // Fill the trailing gap.
+    while (i < length)
+    {
+      distanceData[i] = NumT(0);
+      i++;
+    }
+
+    // Cumulative distances, the data of curves have the distance of their
+    // command and move-to has the distance of the preceding figure's end.
+    double cumulative = 0.0;
+
+    for (i = 0; i < length; i++)
+    {
+      if (PathCmd::isLineTo(srcCmd[i]) || PathCmd::isQuadTo(srcCmd[i]) ||
+          PathCmd::isCubicTo(srcCmd[i]) || PathCmd::isClose(srcCmd[i]))
+      {
+        cumulative += double(distanceData[i]);
+      }
+
+      cumulativeData[i] = NumT(cumulative);
+    }
+
     info->_pathLength = NumT(pathLength);
     path->_d->boundingBox = pathBoundingBox;
     path->_d->vType = newFlags | PATH_FLAG_HAS_BBOX;
@@ -368,13 +565,412 @@ _Invalid:
   return NULL;
 }
 
+// ============================================================================
+// [Fog::PathInfoT - Distance Queries]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Get the index of the first command which ends at or after
+//! @a distance (cumulative data are non-decreasing).
+template<typename NumT>
+static FOG_INLINE size_t PathInfoT_findCommand(const NumT* cumulativeData, size_t lo, size_t hi, NumT distance)
+{
+  while (lo < hi)
+  {
+    size_t mid = (lo + hi) >> 1;
+
+    if (cumulativeData[mid] < distance)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return lo;
+}
+
+//! @internal
+//!
+//! @brief Get the index of the move-to which starts the figure containing the
+//! command at @a index.
+template<typename NumT>
+static size_t PathInfoT_findFigureStart(const NumT_(PathInfo)* self, size_t index)
+{
+  const NumT_(PathInfoFigure)* figureData = self->_figureData;
+
+  size_t lo = 0;
+  size_t hi = self->_numberOfFigures;
+
+  while (lo < hi)
+  {
+    size_t mid = (lo + hi) >> 1;
+
+    if (figureData[mid].end <= index)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  FOG_ASSERT(lo < self->_numberOfFigures);
+  return figureData[lo].start;
+}
+
+//! @internal
+//!
+//! @brief Get the unit vector of (@a dx, @a dy) or zero vector.
+template<typename NumT>
+static FOG_INLINE void PathInfoT_setTangent(NumT_(Point)* dst, double dx, double dy)
+{
+  double length = Math::sqrt(dx * dx + dy * dy);
+
+  if (length > 0.0)
+    dst->set(NumT(dx / length), NumT(dy / length));
+  else
+    dst->reset();
+}
+
+template<typename NumT>
+static err_t FOG_CDECL PathInfoT_getPointAtDistance(const NumT_(PathInfo)* self, const NumT_(Path)* path,
+  NumT_(Point)* dstPt, NumT_(Point)* dstTangent, NumT distance, PathInfoCursor* cursor)
+{
+  const NumT_(PathData)* d = path->_d;
+  size_t length = d->length;
+
+  if (length != self->_distanceCapacity)
+    return ERR_RT_INVALID_ARGUMENT;
+
+  const NumT_(Point)* srcPts = d->vertices;
+  const uint8_t* srcCmd = d->commands;
+
+  const NumT* distanceData = self->_distanceData;
+  const NumT* cumulativeData = self->_cumulativeData;
+
+  NumT pathLength = cumulativeData[length - 1];
+
+  if (!(distance > NumT(0)))
+    distance = NumT(0);
+  else if (distance > pathLength)
+    distance = pathLength;
+
+  // --------------------------------------------------------------------------
+  // [Find Command]
+  // --------------------------------------------------------------------------
+
+  size_t i = length;
+
+  if (cursor != NULL && cursor->_index < length)
+  {
+    size_t c = cursor->_index;
+
+    if (cumulativeData[c] >= distance)
+    {
+      if (c == 0 || cumulativeData[c - 1] < distance)
+        i = c;
+    }
+    else
+    {
+      // Queries of increasing distances usually end in the same or one of the
+      // following commands, try a few of them before the binary search.
+      size_t end = Math::min<size_t>(c + 8, length);
+
+      while (++c < end)
+      {
+        if (cumulativeData[c] >= distance)
+        {
+          i = c;
+          break;
+        }
+      }
+
+      if (i == length)
+        i = PathInfoT_findCommand<NumT>(cumulativeData, c, length, distance);
+    }
+  }
+
+  if (i == length)
+    i = PathInfoT_findCommand<NumT>(cumulativeData, 0, length, distance);
+
+  if (cursor != NULL)
+    cursor->_index = i;
+
+  // Distance zero (or zero-length commands at the start) can end at move-to,
+  // the point is then at the start of the first drawing command.
+  NumT commandStart = i > 0 ? cumulativeData[i - 1] : NumT(0);
+
+  while (i < length && PathCmd::isMoveTo(srcCmd[i]))
+    i++;
+
+  if (i >= length)
+  {
+    // No drawing command, the path consists of move-to commands only.
+    if (dstPt != NULL)
+      *dstPt = srcPts[0];
+    if (dstTangent != NULL)
+      dstTangent->reset();
+    return ERR_OK;
+  }
+
+  double s = double(distance) - double(commandStart);
+  if (s < 0.0)
+    s = 0.0;
+
+  // --------------------------------------------------------------------------
+  // [Evaluate Command]
+  // --------------------------------------------------------------------------
+
+  switch (srcCmd[i])
+  {
+    case PATH_CMD_LINE_TO:
+    case PATH_CMD_CLOSE:
+    {
+      NumT_(Point) p0 = srcPts[i - 1];
+      NumT_(Point) p1 = PathCmd::isClose(srcCmd[i])
+        ? srcPts[PathInfoT_findFigureStart<NumT>(self, i)]
+        : srcPts[i];
+
+      double len = double(distanceData[i]);
+      double t = len > 0.0 ? Math::min(s / len, 1.0) : 0.0;
+
+      double dx = double(p1.x) - double(p0.x);
+      double dy = double(p1.y) - double(p0.y);
+
+      if (dstPt != NULL)
+        dstPt->set(NumT(double(p0.x) + dx * t), NumT(double(p0.y) + dy * t));
+      if (dstTangent != NULL)
+        PathInfoT_setTangent<NumT>(dstTangent, dx, dy);
+      return ERR_OK;
+    }
+
+    case PATH_CMD_QUAD_TO:
+    case PATH_CMD_CUBIC_TO:
+    {
+      const NumT_(Point)* p = srcPts + i - 1;
+      uint32_t degree = PathCmd::isQuadTo(srcCmd[i]) ? 2 : 3;
+
+      double t = PathInfoT_getCurveParameter<NumT>(p, degree, s);
+
+      if (dstPt != NULL)
+      {
+        if (degree == 2)
+          NumI_(QBezier)::evaluate(p, dstPt, NumT(t));
+        else
+          NumI_(CBezier)::evaluate(p, dstPt, NumT(t));
+      }
+
+      if (dstTangent != NULL)
+      {
+        double dx, dy;
+        PathInfoT_getDerivative<NumT>(p, degree, t, dx, dy);
+
+        // The derivative is zero at the end of a degenerated control polygon,
+        // use the chord of the curve in such case.
+        if (dx == 0.0 && dy == 0.0)
+        {
+          dx = double(p[degree].x) - double(p[0].x);
+          dy = double(p[degree].y) - double(p[0].y);
+        }
+
+        PathInfoT_setTangent<NumT>(dstTangent, dx, dy);
+      }
+      return ERR_OK;
+    }
+
+    default:
+      return ERR_RT_INVALID_STATE;
+  }
+}
+
+template<typename NumT>
+static err_t PathInfoT_appendSegment(const NumT_(PathInfo)* self, const NumT_(Path)* path,
+  NumT_(Path)* dst, NumT from, NumT to)
+{
+  const NumT_(PathData)* d = path->_d;
+  size_t length = d->length;
+
+  const NumT_(Point)* srcPts = d->vertices;
+  const uint8_t* srcCmd = d->commands;
+
+  const NumT* distanceData = self->_distanceData;
+  const NumT* cumulativeData = self->_cumulativeData;
+
+  size_t i = PathInfoT_findCommand<NumT>(cumulativeData, 0, length, from);
+  size_t figureStart = PathCmd::isMoveTo(srcCmd[i]) ? i : PathInfoT_findFigureStart<NumT>(self, i);
+
+  bool needMoveTo = true;
+  bool canClose = false;
+
+  while (i < length)
+  {
+    uint8_t cmd = srcCmd[i];
+
+    if (PathCmd::isMoveTo(cmd))
+    {
+      figureStart = i++;
+      needMoveTo = true;
+      continue;
+    }
+
+    size_t count = PathCmd::isQuadTo(cmd) ? 2 : PathCmd::isCubicTo(cmd) ? 3 : 1;
+
+    NumT a = cumulativeData[i - 1];
+    NumT b = cumulativeData[i];
+
+    if (a > to || (a == to && a < b))
+      break;
+
+    // Skip commands which end at the start of the range.
+    if (b < from || (b == from && a < b))
+    {
+      i += count;
+      continue;
+    }
+
+    double len = double(distanceData[i]);
+    double s0 = Math::max(double(from) - double(a), 0.0);
+    double s1 = Math::min(double(to) - double(a), len);
+    bool isFull = s0 <= 0.0 && s1 >= len;
+
+    NumT_(Point) seg[4];
+
+    if (PathCmd::isLineTo(cmd) || PathCmd::isClose(cmd))
+    {
+      NumT_(Point) p0 = srcPts[i - 1];
+      NumT_(Point) p1 = PathCmd::isClose(cmd) ? srcPts[figureStart] : srcPts[i];
+
+      if (isFull)
+      {
+        seg[0] = p0;
+        seg[1] = p1;
+      }
+      else
+      {
+        double t0 = len > 0.0 ? s0 / len : 0.0;
+        double t1 = len > 0.0 ? s1 / len : 0.0;
+
+        double dx = double(p1.x) - double(p0.x);
+        double dy = double(p1.y) - double(p0.y);
+
+        seg[0].set(NumT(double(p0.x) + dx * t0), NumT(double(p0.y) + dy * t0));
+        seg[1].set(NumT(double(p0.x) + dx * t1), NumT(double(p0.y) + dy * t1));
+      }
+    }
+    else
+    {
+      const NumT_(Point)* p = srcPts + i - 1;
+      uint32_t degree = (uint32_t)count;
+
+      if (isFull)
+      {
+        for (uint32_t j = 0; j <= degree; j++)
+          seg[j] = p[j];
+      }
+      else
+      {
+        double t0 = s0 > 0.0 ? PathInfoT_getCurveParameter<NumT>(p, degree, s0) : 0.0;
+        double t1 = s1 < len ? PathInfoT_getCurveParameter<NumT>(p, degree, s1) : 1.0;
+
+        NumT_(Point) left[4];
+        NumT_(Point) rght[4];
+
+        // Split at t1 first, the left part is then split at t0 relative to t1.
+        if (degree == 2)
+          NumI_(QBezier)::splitAt(p, left, rght, NumT(t1));
+        else
+          NumI_(CBezier)::splitAt(p, left, rght, NumT(t1));
+
+        if (t0 > 0.0 && t1 > 0.0)
+        {
+          NumT tRel = NumT(Math::min(t0 / t1, 1.0));
+
+          if (degree == 2)
+            NumI_(QBezier)::splitAt(left, rght, seg, tRel);
+          else
+            NumI_(CBezier)::splitAt(left, rght, seg, tRel);
+        }
+        else
+        {
+          for (uint32_t j = 0; j <= degree; j++)
+            seg[j] = left[j];
+        }
+      }
+    }
+
+    if (needMoveTo)
+    {
+      FOG_RETURN_ON_ERROR(dst->moveTo(seg[0]));
+
+      needMoveTo = false;
+      canClose = isFull && cumulativeData[figureStart] >= from;
+    }
+
+    switch (cmd)
+    {
+      case PATH_CMD_LINE_TO:
+        FOG_RETURN_ON_ERROR(dst->lineTo(seg[1]));
+        break;
+
+      case PATH_CMD_QUAD_TO:
+        FOG_RETURN_ON_ERROR(dst->quadTo(seg[1], seg[2]));
+        break;
+
+      case PATH_CMD_CUBIC_TO:
+        FOG_RETURN_ON_ERROR(dst->cubicTo(seg[1], seg[2], seg[3]));
+        break;
+
+      case PATH_CMD_CLOSE:
+        // Close the figure only if the whole figure is part of the segment.
+        if (canClose && isFull)
+          FOG_RETURN_ON_ERROR(dst->close());
+        else
+          FOG_RETURN_ON_ERROR(dst->lineTo(seg[1]));
+        break;
+    }
+
+    i += count;
+  }
+
+  return ERR_OK;
+}
+
+template<typename NumT>
+static err_t FOG_CDECL PathInfoT_getSegment(const NumT_(PathInfo)* self, const NumT_(Path)* path,
+  NumT_(Path)* dst, NumT from, NumT to)
+{
+  size_t length = path->_d->length;
+
+  if (length != self->_distanceCapacity || !(from <= to))
+    return ERR_RT_INVALID_ARGUMENT;
+
+  NumT pathLength = self->_cumulativeData[length - 1];
+
+  if (from < NumT(0)) from = NumT(0);
+  if (to > pathLength) to = pathLength;
+
+  if (from >= to)
+    return ERR_OK;
+
+  if (dst == path)
+  {
+    NumT_(Path) tmp;
+    FOG_RETURN_ON_ERROR(PathInfoT_appendSegment<NumT>(self, path, &tmp, from, to));
+    return dst->append(tmp);
+  }
+
+  return PathInfoT_appendSegment<NumT>(self, path, dst, from, to);
+}
+
 // ============================================================================
 // [Init / Fini]
 // ============================================================================
 
 FOG_NO_EXPORT void PathInfo_init(void)
 {
+  fog_api.pathinfof_getPointAtDistance = PathInfoT_getPointAtDistance<float>;
+  fog_api.pathinfof_getSegment = PathInfoT_getSegment<float>;
   fog_api.pathinfof_generate = PathInfoT_generate<float>;
+
+  fog_api.pathinfod_getPointAtDistance = PathInfoT_getPointAtDistance<double>;
+  fog_api.pathinfod_getSegment = PathInfoT_getSegment<double>;
   fog_api.pathinfod_generate = PathInfoT_generate<double>;
 }
 
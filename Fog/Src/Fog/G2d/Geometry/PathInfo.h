@@ -36,6 +36,25 @@ union FOG_NO_EXPORT PathInfoFigureFlags
   uint32_t packed;
 };
 
+// ============================================================================
+// [Fog::PathInfoCursor]
+// ============================================================================
+
+//! @brief Position of the last distance query of a path-info.
+//!
+//! Passing the same cursor to queries of increasing distances (animation along
+//! a path, placing glyphs or markers) makes the next query a short forward
+//! scan from the previous position instead of a binary search. The cursor is
+//! only a hint, a position which doesn't match the query is ignored.
+struct FOG_NO_EXPORT PathInfoCursor
+{
+  FOG_INLINE PathInfoCursor() : _index(0) {}
+  FOG_INLINE void reset() { _index = 0; }
+
+  //! @brief Index of the command found by the last query.
+  size_t _index;
+};
+
 // ============================================================================
 // [Fog::PathInfoFigureF]
 // ============================================================================
@@ -106,6 +125,46 @@ struct FOG_NO_EXPORT PathInfoF
 
   FOG_INLINE const PathInfoFigureF* getFigureData() const { return _figureData; }
   FOG_INLINE const float* getDistanceData() const { return _distanceData; }
+  FOG_INLINE const float* getCumulativeData() const { return _cumulativeData; }
+
+  // --------------------------------------------------------------------------
+  // [Distance Queries]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the point at @a distance from the start of @a path.
+  //!
+  //! The @a path must be the path the info was generated from. The distance
+  //! is clamped to the path length and the figures follow each other, like
+  //! they do in @c getPathLength(). Curves are parameterized by their arc
+  //! length, so equal steps of the distance give equal steps along a curve.
+  FOG_INLINE err_t getPointAtDistance(PointF& dst, const PathF& path, float distance) const
+  {
+    return fog_api.pathinfof_getPointAtDistance(this, &path, &dst, NULL, distance, NULL);
+  }
+
+  //! @brief Get the unit tangent at @a distance from the start of @a path.
+  FOG_INLINE err_t getTangentAtDistance(PointF& dst, const PathF& path, float distance) const
+  {
+    return fog_api.pathinfof_getPointAtDistance(this, &path, NULL, &dst, distance, NULL);
+  }
+
+  //! @brief Get the point and the unit tangent at @a distance from the start
+  //! of @a path, both @a dstPt and @a dstTangent can be @c NULL.
+  FOG_INLINE err_t getPointAtDistance(PointF* dstPt, PointF* dstTangent,
+    const PathF& path, float distance, PathInfoCursor* cursor) const
+  {
+    return fog_api.pathinfof_getPointAtDistance(this, &path, dstPt, dstTangent, distance, cursor);
+  }
+
+  //! @brief Append the part of @a path between the distances @a from and
+  //! @a to to @a dst.
+  //!
+  //! Each figure (or its part) starts by move-to, partial curves are split
+  //! at the parameters of the given distances.
+  FOG_INLINE err_t getSegment(PathF& dst, const PathF& path, float from, float to) const
+  {
+    return fog_api.pathinfof_getSegment(this, &path, &dst, from, to);
+  }
 
   // --------------------------------------------------------------------------
   // [Statics]
@@ -135,6 +194,9 @@ struct FOG_NO_EXPORT PathInfoF
   PathInfoFigureF* _figureData;
   //! @brief Distances between individual points.
   float* _distanceData;
+  //! @brief Distances from the start of the path to the end of each command
+  //! (non-decreasing, used by the binary search of distance queries).
+  float* _cumulativeData;
 };
 
 // ============================================================================
@@ -171,6 +233,46 @@ struct FOG_NO_EXPORT PathInfoD
 
   FOG_INLINE const PathInfoFigureD* getFigureData() const { return _figureData; }
   FOG_INLINE const double* getDistanceData() const { return _distanceData; }
+  FOG_INLINE const double* getCumulativeData() const { return _cumulativeData; }
+
+  // --------------------------------------------------------------------------
+  // [Distance Queries]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the point at @a distance from the start of @a path.
+  //!
+  //! The @a path must be the path the info was generated from. The distance
+  //! is clamped to the path length and the figures follow each other, like
+  //! they do in @c getPathLength(). Curves are parameterized by their arc
+  //! length, so equal steps of the distance give equal steps along a curve.
+  FOG_INLINE err_t getPointAtDistance(PointD& dst, const PathD& path, double distance) const
+  {
+    return fog_api.pathinfod_getPointAtDistance(this, &path, &dst, NULL, distance, NULL);
+  }
+
+  //! @brief Get the unit tangent at @a distance from the start of @a path.
+  FOG_INLINE err_t getTangentAtDistance(PointD& dst, const PathD& path, double distance) const
+  {
+    return fog_api.pathinfod_getPointAtDistance(this, &path, NULL, &dst, distance, NULL);
+  }
+
+  //! @brief Get the point and the unit tangent at @a distance from the start
+  //! of @a path, both @a dstPt and @a dstTangent can be @c NULL.
+  FOG_INLINE err_t getPointAtDistance(PointD* dstPt, PointD* dstTangent,
+    const PathD& path, double distance, PathInfoCursor* cursor) const
+  {
+    return fog_api.pathinfod_getPointAtDistance(this, &path, dstPt, dstTangent, distance, cursor);
+  }
+
+  //! @brief Append the part of @a path between the distances @a from and
+  //! @a to to @a dst.
+  //!
+  //! Each figure (or its part) starts by move-to, partial curves are split
+  //! at the parameters of the given distances.
+  FOG_INLINE err_t getSegment(PathD& dst, const PathD& path, double from, double to) const
+  {
+    return fog_api.pathinfod_getSegment(this, &path, &dst, from, to);
+  }
 
   // --------------------------------------------------------------------------
   // [Statics]
@@ -200,6 +302,9 @@ struct FOG_NO_EXPORT PathInfoD
   PathInfoFigureD* _figureData;
   //! @brief Distances between individual points.
   double* _distanceData;
+  //! @brief Distances from the start of the path to the end of each command
+  //! (non-decreasing, used by the binary search of distance queries).
+  double* _cumulativeData;
 };
 
 // ============================================================================
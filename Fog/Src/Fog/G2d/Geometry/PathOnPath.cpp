@@ -9,18 +9,421 @@
 #endif // FOG_PRECOMP
 
 // [Dependencies]
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Math/Constants.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/G2d/Geometry/PathInfo.h>
 #include <Fog/G2d/Geometry/PathOnPath.h>
 #include <Fog/G2d/Geometry/Transform.h>
 
 namespace Fog {
 
+// ============================================================================
+// [Fog::PathOnPathGuide]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Guide lookup used by @c PathOnPath::process().
+//!
+//! Maps a distance along the guide to a position and normal. The segment of
+//! the previous lookup is remembered so sorted input (which is the common
+//! case, glyphs are placed from left to right) needs no search at all.
+struct PathOnPathGuide
+{
+  FOG_INLINE PathOnPathGuide(const PathOnPath* self) :
+    pts(self->getPath().getVertices()),
+    normals(reinterpret_cast<const PointD*>(self->getNormals().getData())),
+    dist(self->getDistances().getData()),
+    count(self->getPath().getLength()),
+    length(self->getCalcLength()),
+    closed(self->isClosed()),
+    cursor(0)
+  {
+  }
+
+  //! @brief Get whether the distance @a d is in the segment @a k.
+  //!
+  //! Forward search matches [dist[k], dist[k + 1]), backward search matches
+  //! (dist[k], dist[k + 1]]. The first and the last segment of an open guide
+  //! are extended to infinity.
+  FOG_INLINE bool isInSegment(size_t k, double d, bool backward) const
+  {
+    bool first = k == 0 && !closed;
+    bool last = k + 2 == count && !closed;
+
+    if (backward)
+      return (first || d > dist[k]) && (last || d <= dist[k + 1]);
+    else
+      return (first || d >= dist[k]) && (last || d < dist[k + 1]);
+  }
+
+  //! @brief Find the segment of the distance @a d.
+  //!
+  //! On return @a d is relative to the guide start and @a base contains the
+  //! distance which was subtracted (a closed guide repeats itself).
+  FOG_INLINE size_t find(double& d, double& base, bool backward)
+  {
+    base = 0.0;
+
+    if (closed)
+    {
+      base = Math::floor(d / length) * length;
+      d -= base;
+
+      // Handle rounding errors and the end of the period in backward mode.
+      if (d >= length)
+      {
+        d -= length;
+        base += length;
+      }
+
+      if (backward && d <= 0.0)
+      {
+        d += length;
+        base -= length;
+      }
+    }
+
+    // Sorted input - the same or the next segment.
+    size_t k = cursor;
+
+    if (isInSegment(k, d, backward))
+      return k;
+
+    if (!backward && k + 2 < count && isInSegment(k + 1, d, backward))
+    {
+      cursor = k + 1;
+      return k + 1;
+    }
+
+    if (backward && k > 0 && isInSegment(k - 1, d, backward))
+    {
+      cursor = k - 1;
+      return k - 1;
+    }
+
+    // Binary search.
+    size_t lo = 0;
+    size_t hi = count - 2;
+
+    while (lo < hi)
+    {
+      size_t mid = (lo + hi + 1) >> 1;
+
+      if (backward ? dist[mid] < d : dist[mid] <= d)
+        lo = mid;
+      else
+        hi = mid - 1;
+    }
+
+    cursor = lo;
+    return lo;
+  }
+
+  //! @brief Get the normal at the relative distance @a d of segment @a k.
+  //!
+  //! The normal of the segment is used, except of a window of size |y| near
+  //! the vertices, where it's blended with the normal of the vertex. This
+  //! makes the mapping continuous, the offset curve is rounded at corners.
+  FOG_INLINE PointD getNormal(size_t k, double d, double y) const
+  {
+    const PointD& p0 = pts[k];
+    const PointD& p1 = pts[k + 1];
+
+    double segLength = dist[k + 1] - dist[k];
+    PointD n(-(p1.y - p0.y) / segLength, (p1.x - p0.x) / segLength);
+
+    double w = Math::min(Math::abs(y), segLength * 0.5);
+    if (w <= 0.0)
+      return n;
+
+    double ds = d - dist[k];
+    double de = dist[k + 1] - d;
+
+    const PointD* v = NULL;
+    double f = 0.0;
+
+    if (ds < w)
+    {
+      v = &normals[k];
+      f = Math::max(ds, 0.0) / w;
+    }
+    else if (de < w)
+    {
+      v = &normals[k + 1];
+      f = Math::max(de, 0.0) / w;
+    }
+
+    if (v != NULL)
+    {
+      n.x = v->x + (n.x - v->x) * f;
+      n.y = v->y + (n.y - v->y) * f;
+    }
+
+    return n;
+  }
+
+  //! @brief Map the relative distance @a d and offset @a y using segment @a k.
+  FOG_INLINE PointD map(size_t k, double d, double y) const
+  {
+    const PointD& p0 = pts[k];
+    const PointD& p1 = pts[k + 1];
+
+    double t = (d - dist[k]) / (dist[k + 1] - dist[k]);
+    PointD n = getNormal(k, d, y);
+
+    return PointD(p0.x + (p1.x - p0.x) * t + n.x * y,
+                  p0.y + (p1.y - p0.y) * t + n.y * y);
+  }
+
+  //! @brief Get the count of pieces a line, which lies in the window of
+  //! vertex @a v and changes its offset by @a dy, has to be split to.
+  FOG_INLINE int getSubdivision(size_t k, size_t v, double dy, double flatness) const
+  {
+    const PointD& p0 = pts[k];
+    const PointD& p1 = pts[k + 1];
+
+    double segLength = dist[k + 1] - dist[k];
+    double nx = -(p1.y - p0.y) / segLength - normals[v].x;
+    double ny =  (p1.x - p0.x) / segLength - normals[v].y;
+
+    // Both the offset and the normal change linearly in the window, so the
+    // mapped line is a parabola. Its distance from the chord is at most
+    // |dy| * |n1 - n0| / 4, which decreases quadratically with the count of
+    // pieces.
+    double err = Math::abs(dy) * Math::euclideanDistance(nx, ny) * 0.25;
+
+    if (err <= flatness)
+      return 1;
+
+    return Math::bound<int>(Math::iceil(Math::sqrt(err / flatness)), 1, 256);
+  }
+
+  const PointD* pts;
+  const PointD* normals;
+  const double* dist;
+
+  size_t count;
+  double length;
+  bool closed;
+
+  //! @brief Segment of the last lookup.
+  size_t cursor;
+};
+
+// ============================================================================
+// [Fog::PathOnPath - Helpers]
+// ============================================================================
+
+template<typename NumT>
+static err_t PathOnPathT_mapLine(PathOnPathGuide& guide, NumT_(Path)& dst,
+  double x0, double y0, double x1, double y1, double flatness)
+{
+  double dx = x1 - x0;
+  double dy = y1 - y0;
+
+  // Vertical line in source coordinates, it's mapped to a line along the
+  // normal.
+  if (dx == 0.0)
+  {
+    double base;
+    double d = x1;
+
+    size_t k = guide.find(d, base, false);
+    PointD pt = guide.map(k, d, y1);
+    return dst.lineTo(NumT_(Point)(NumT(pt.x), NumT(pt.y)));
+  }
+
+  bool backward = dx < 0.0;
+
+  double d = x0;
+  double base;
+  double rel = d;
+
+  size_t k = guide.find(rel, base, backward);
+
+  // Lines are split at the guide vertices so they follow the guide. Segments
+  // are walked by index, this guarantees the progress also if the distance
+  // of the vertex is rounded.
+  for (;;)
+  {
+    double end;
+
+    if (!backward)
+    {
+      bool last = k + 2 == guide.count && !guide.closed;
+      end = last ? x1 : Math::min(base + guide.dist[k + 1], x1);
+    }
+    else
+    {
+      bool first = k == 0 && !guide.closed;
+      end = first ? x1 : Math::max(base + guide.dist[k], x1);
+    }
+
+    double ya = y0 + (d - x0) * dy / dx;
+    double yb = y0 + (end - x0) * dy / dx;
+    double yMax = Math::max(Math::abs(ya), Math::abs(yb));
+
+    // Split the part at the vertex windows, the mapping between them is
+    // affine, inside of them it's subdivided adaptively.
+    double segStart = base + guide.dist[k];
+    double segEnd = base + guide.dist[k + 1];
+    double w = Math::min(yMax, (segEnd - segStart) * 0.5);
+
+    double splits[4];
+    splits[0] = d;
+    splits[1] = backward ? segEnd - w : segStart + w;
+    splits[2] = backward ? segStart + w : segEnd - w;
+    splits[3] = end;
+
+    double u = d;
+    for (int j = 1; j < 4; j++)
+    {
+      double v = splits[j];
+
+      if (j < 3)
+      {
+        if (backward ? (v >= u || v <= end) : (v <= u || v >= end))
+          continue;
+      }
+
+      double mid = (u + v) * 0.5;
+      double yDelta = (v - u) * dy / dx;
+      int n = 1;
+
+      if (mid < segStart + w)
+        n = guide.getSubdivision(k, k, yDelta, flatness);
+      else if (mid > segEnd - w)
+        n = guide.getSubdivision(k, k + 1, yDelta, flatness);
+
+      double step = (v - u) / double(n);
+
+      for (int i = 1; i <= n; i++)
+      {
+        double dd = (i == n) ? v : u + step * double(i);
+        double yy = y0 + (dd - x0) * dy / dx;
+
+        PointD pt = guide.map(k, dd - base, yy);
+        FOG_RETURN_ON_ERROR(dst.lineTo(NumT_(Point)(NumT(pt.x), NumT(pt.y))));
+      }
+
+      u = v;
+    }
+
+    if (end == x1)
+      break;
+
+    d = end;
+
+    if (!backward)
+    {
+      if (++k == guide.count - 1)
+      {
+        k = 0;
+        base += guide.length;
+      }
+    }
+    else
+    {
+      if (k == 0)
+      {
+        k = guide.count - 1;
+        base -= guide.length;
+      }
+      k--;
+    }
+  }
+
+  guide.cursor = k;
+  return ERR_OK;
+}
+
+template<typename NumT>
+static err_t PathOnPathT_process(const PathOnPath* self, NumT_(Path)& dst, const NumT_(Path)& src)
+{
+  if (self->getPath().getLength() < 2)
+    return ERR_RT_INVALID_STATE;
+
+  // Source curves are flattened, the result is always a polyline.
+  double flatness = MathConstant<double>::getDefaultFlatness();
+
+  NumT_(Path) flat;
+  const NumT_(Path)* s = &src;
+
+  if (src.hasBeziers())
+  {
+    FOG_RETURN_ON_ERROR(NumI_(Path)::flatten(flat, src, NumT(flatness)));
+    s = &flat;
+  }
+
+  PathOnPathGuide guide(self);
+
+  double scale = 1.0;
+  if (self->getBaseLength() > 0.0)
+    scale = self->getCalcLength() / self->getBaseLength();
+
+  const uint8_t* commands = s->getCommands();
+  const NumT_(Point)* vertices = s->getVertices();
+  size_t i, length = s->getLength();
+
+  NumT_(Path) tmp;
+  FOG_RETURN_ON_ERROR(tmp.reserve(length * 2));
+
+  double startX = 0.0, startY = 0.0;
+  double lastX = 0.0, lastY = 0.0;
+  bool hasFigure = false;
+
+  for (i = 0; i < length; i++)
+  {
+    uint8_t cmd = commands[i];
+
+    if (PathCmd::isMoveTo(cmd))
+    {
+      startX = lastX = double(vertices[i].x) * scale;
+      startY = lastY = double(vertices[i].y);
+
+      double base;
+      double d = startX;
+
+      size_t k = guide.find(d, base, false);
+      PointD pt = guide.map(k, d, startY);
+
+      FOG_RETURN_ON_ERROR(tmp.moveTo(NumT_(Point)(NumT(pt.x), NumT(pt.y))));
+      hasFigure = true;
+    }
+    else if (PathCmd::isLineTo(cmd) && hasFigure)
+    {
+      double x = double(vertices[i].x) * scale;
+      double y = double(vertices[i].y);
+
+      FOG_RETURN_ON_ERROR(PathOnPathT_mapLine<NumT>(guide, tmp, lastX, lastY, x, y, flatness));
+      lastX = x;
+      lastY = y;
+    }
+    else if (PathCmd::isClose(cmd) && hasFigure)
+    {
+      // The closing line has to follow the guide as well.
+      if (lastX != startX || lastY != startY)
+        FOG_RETURN_ON_ERROR(PathOnPathT_mapLine<NumT>(guide, tmp, lastX, lastY, startX, startY, flatness));
+
+      FOG_RETURN_ON_ERROR(tmp.close());
+      lastX = startX;
+      lastY = startY;
+    }
+  }
+
+  return dst.setPath(tmp);
+}
+
 // ============================================================================
 // [Fog::PathOnPath]
 // ============================================================================
 
 PathOnPath::PathOnPath() :
   _calcLength(0.0),
-  _baseLength(0.0)
+  _baseLength(0.0),
+  _isClosed(false)
 {
 }
 
@@ -30,33 +433,120 @@ PathOnPath::~PathOnPath()
 
 err_t PathOnPath::process(PathF& dst, const PathF& src) const
 {
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
+  return PathOnPathT_process<float>(this, dst, src);
 }
 
 err_t PathOnPath::process(PathD& dst, const PathD& src) const
 {
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
+  return PathOnPathT_process<double>(this, dst, src);
 }
 
 err_t PathOnPath::setPath(const PathD& path, const TransformD* matrix)
 {
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
-#if 0
+  reset();
+
   // Use larger scaling factor to increase path-on-path precision.
   double scalingFactor = 3.0;
-  if (matrix) scalingFactor *= matrix->getAverageScaling();
+  if (matrix != NULL)
+    scalingFactor *= matrix->getAverageScaling();
+
+  PathD flat;
+  FOG_RETURN_ON_ERROR(PathD::flatten(flat, path,
+    PathFlattenParamsD(MathConstant<double>::getDefaultFlatness() / scalingFactor, matrix)));
+
+  // Build the cumulative distance table from the first figure.
+  const PathInfoD* info = flat.getPathInfo();
+  if (info == NULL || info->getNumberOfFigures() == 0)
+    return ERR_GEOMETRY_NONE;
+
+  const PathInfoFigureD* figure = info->getFigureData();
+  const double* segDist = info->getDistanceData();
+
+  const uint8_t* commands = flat.getCommands();
+  const PointD* vertices = flat.getVertices();
+
+  size_t i;
+  size_t start = figure->start;
+  size_t end = figure->end;
+
+  double total = 0.0;
+
+  FOG_RETURN_ON_ERROR(_path.reserve(end - start + 1));
+  FOG_RETURN_ON_ERROR(_path.moveTo(vertices[start]));
+  FOG_RETURN_ON_ERROR(_dist.append(0.0));
+
+  for (i = start + 1; i < end; i++)
+  {
+    // Zero-length segments are skipped, their normal is undefined.
+    double d = segDist[i];
+    if (!(d > 0.0))
+      continue;
+
+    // The close command has distance to the start vertex.
+    const PointD& pt = PathCmd::isClose(commands[i]) ? vertices[start] : vertices[i];
+
+    total += d;
+    FOG_RETURN_ON_ERROR(_path.lineTo(pt));
+    FOG_RETURN_ON_ERROR(_dist.append(total));
+  }
 
-  err_t err = path.flattenSubPathTo(_path, 0, matrix, scalingFactor);
-  if (FOG_IS_ERROR(err)) return err;
+  size_t count = _path.getLength();
+  if (count < 2 || !Math::isFinite(total))
+  {
+    reset();
+    return ERR_GEOMETRY_DEGENERATE;
+  }
 
-  if (_path.isEmpty()) return ERR_OK;
-  _dist.resize(_path.getLength());
+  _calcLength = total;
+  _isClosed = figure->flags.isClosed != 0;
+
+  // Normals of the vertices, average of the adjacent segment normals.
+  const PointD* pts = _path.getVertices();
+  const double* dist = _dist.getData();
+
+  for (i = 0; i < count; i++)
+  {
+    size_t kPrev = i - 1;
+    size_t kNext = i;
+
+    if (i == 0)
+      kPrev = _isClosed ? count - 2 : 0;
+
+    if (i == count - 1)
+    {
+      kNext = _isClosed ? 0 : count - 2;
+      if (!_isClosed) kPrev = count - 2;
+    }
+
+    double lPrev = dist[kPrev + 1] - dist[kPrev];
+    double lNext = dist[kNext + 1] - dist[kNext];
+
+    double nx0 = -(pts[kPrev + 1].y - pts[kPrev].y) / lPrev;
+    double ny0 =  (pts[kPrev + 1].x - pts[kPrev].x) / lPrev;
+    double nx1 = -(pts[kNext + 1].y - pts[kNext].y) / lNext;
+    double ny1 =  (pts[kNext + 1].x - pts[kNext].x) / lNext;
+
+    double nx = nx0 + nx1;
+    double ny = ny0 + ny1;
+    double nl = Math::euclideanDistance(nx, ny);
+
+    // Reversed direction (180 degrees), use the normal of the next segment.
+    if (nl < MathConstant<double>::getDistanceEpsilon())
+    {
+      nx = nx1;
+      ny = ny1;
+    }
+    else
+    {
+      nx /= nl;
+      ny /= nl;
+    }
+
+    FOG_RETURN_ON_ERROR(_normal.append(nx));
+    FOG_RETURN_ON_ERROR(_normal.append(ny));
+  }
 
   return ERR_OK;
-#endif // 0
 }
 
 err_t PathOnPath::setBaseLength(double baseLength)
@@ -65,4 +555,14 @@ err_t PathOnPath::setBaseLength(double baseLength)
   return ERR_OK;
 }
 
+void PathOnPath::reset()
+{
+  _path.clear();
+  _dist.clear();
+  _normal.clear();
+
+  _calcLength = 0.0;
+  _isClosed = false;
+}
+
 } // Fog namespace
@@ -24,6 +24,12 @@ namespace Fog {
 // [Fog::PathOnPath]
 // ============================================================================
 
+//! @brief Path effect which maps a path along another path (guide).
+//!
+//! The X coordinate of the source path is mapped to the distance along the
+//! guide and the Y coordinate is mapped to the offset along the normal of the
+//! guide. If the base length is set then the X coordinate is scaled so the
+//! base length matches the length of the guide.
 struct FOG_API PathOnPath : public PathEffect
 {
   PathOnPath();
@@ -35,16 +41,33 @@ struct FOG_API PathOnPath : public PathEffect
   FOG_INLINE const PathD& getPath() const { return _path; }
   FOG_INLINE double getCalcLength() const { return _calcLength; }
   FOG_INLINE double getBaseLength() const { return _baseLength; }
+  FOG_INLINE bool isClosed() const { return _isClosed; }
 
+  //! @brief Get cumulative distances of the guide vertices.
+  FOG_INLINE const List<double>& getDistances() const { return _dist; }
+  //! @brief Get normals of the guide vertices, stored as [x, y] pairs.
+  FOG_INLINE const List<double>& getNormals() const { return _normal; }
+
+  //! @brief Set the guide path.
+  //!
+  //! Only the first figure of @a path is used. Curves are flattened and the
+  //! optional @a matrix is applied before the distance table is built.
   err_t setPath(const PathD& path, const TransformD* matrix = NULL);
   err_t setBaseLength(double baseLength);
 
+  void reset();
+
 protected:
+  //! @brief Flattened guide (the start vertex is repeated if it's closed).
   PathD _path;
+  //! @brief Cumulative distance of each vertex of _path.
   List<double> _dist;
+  //! @brief Normal of each vertex of _path ([x, y] pairs).
+  List<double> _normal;
 
   double _calcLength;
   double _baseLength;
+  bool _isClosed;
 
 private:
   FOG_NO_COPY(PathOnPath)
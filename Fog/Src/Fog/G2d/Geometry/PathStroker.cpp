@@ -40,7 +40,8 @@ struct PathStrokerContextT
     stroker(stroker),
     dst(dst),
     distances(NULL),
-    distancesAlloc(0)
+    distancesAlloc(0),
+    dashCount(0)
   {
     dstInitial = dst->getLength();
   }
@@ -94,6 +95,51 @@ struct PathStrokerContextT
 
   err_t strokePathFigure(const NumT_(Point)* src, size_t count, bool outline);
 
+  // --------------------------------------------------------------------------
+  // [Dash]
+  // --------------------------------------------------------------------------
+
+  void _initDash();
+  void _advanceDash(NumT dist);
+  bool _clipDash(const NumT_(Point)& p0, NumT dx, NumT dy, NumT& t0, NumT& t1) const;
+  err_t _emitDash(bool& isFirst);
+
+  err_t dashPathFigure(const NumT_(Point)* src, size_t count, bool closed);
+
+  // --------------------------------------------------------------------------
+  // [Curves]
+  // --------------------------------------------------------------------------
+
+  err_t strokePathCurves(const NumT_(Path)* src);
+  err_t strokeCurveFigure(const uint8_t* cmd, const NumT_(Point)* pts, size_t count, bool closed);
+
+  err_t _curveBegin(const NumT_(Point)& p, const NumT_(Point)& d, uint32_t lineJoin);
+  err_t _curveJoin(NumT_(Path)& side, const NumT_(Point)& p,
+    const NumT_(Point)& d0, const NumT_(Point)& d1, NumT s, uint32_t lineJoin);
+  err_t _curveArc(NumT_(Path)& side, const NumT_(Point)& c,
+    const NumT_(Point)& u, const NumT_(Point)& v, const NumT_(Point)& hint, NumT r);
+  err_t _curveCap(NumT_(Path)& side, const NumT_(Point)& p,
+    const NumT_(Point)& o, uint32_t cap);
+
+  err_t _curveLine(const NumT_(Point)* p, uint32_t lineJoin);
+  err_t _curveQuad(const NumT_(Point)* p, uint32_t lineJoin);
+  err_t _curveCubic(const NumT_(Point)* p, uint32_t lineJoin);
+
+  err_t _offsetQuad(NumT_(Path)& side, const NumT_(Point)* p, NumT s, int depth, NumT_(Point)& dir);
+  err_t _offsetCubic(NumT_(Path)& side, const NumT_(Point)* p, NumT s, int depth, NumT_(Point)& dir);
+
+  err_t _appendReversed(NumT_(Path)& path, const NumT_(Path)& side, bool skipFirst);
+
+  FOG_INLINE NumT getDash(size_t index) const
+  {
+    return dashList[index < dashListLength ? index : index - dashListLength];
+  }
+
+  FOG_INLINE bool isDashOn() const
+  {
+    return (dashIndex & 1) == 0;
+  }
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
@@ -114,6 +160,51 @@ struct PathStrokerContextT
 
   NumT* distances;
   size_t distancesAlloc;
+
+  //! @brief Dash-list (not repeated).
+  const NumT* dashList;
+  //! @brief Length of dash-list.
+  size_t dashListLength;
+  //! @brief Count of dash items (even, odd dash-list is repeated), zero if
+  //! dashing is disabled.
+  size_t dashCount;
+  //! @brief Sum of all dash items.
+  NumT dashPeriod;
+
+  //! @brief Dash index and remaining length at the start of each figure.
+  size_t dashStartIndex;
+  NumT dashStartRemain;
+
+  //! @brief Current dash index, even index means dash, odd means gap.
+  size_t dashIndex;
+  //! @brief Remaining length of the current dash item.
+  NumT dashRemain;
+
+  //! @brief Whether to clip dashes by @c dashClipBox.
+  bool dashClip;
+  //! @brief Clip-box in source coordinates, expanded by the stroke extent.
+  NumT_(Box) dashClipBox;
+
+  //! @brief The current dash.
+  NumT_T1(PathTmp, 64) dashPath;
+  //! @brief The first dash of closed figure (it can be connected to the last).
+  NumT_T1(PathTmp, 64) dashFirst;
+
+  //! @brief Both sides of the figure stroked by offsetting curves, the first
+  //! one is offset by w, the second one by -w.
+  NumT_T1(PathTmp, 128) curveL;
+  NumT_T1(PathTmp, 128) curveR;
+
+  //! @brief Start point and direction of the figure.
+  NumT_(Point) curveFirstPt;
+  NumT_(Point) curveFirstDir;
+
+  //! @brief End point and direction of the last segment.
+  NumT_(Point) curveLastPt;
+  NumT_(Point) curveLastDir;
+
+  //! @brief Whether the figure contains a non-degenerate segment.
+  bool curveHasSegment;
 };
 
 // ============================================================================
@@ -138,6 +229,22 @@ err_t PathStrokerContextT<NumT>::strokeShape(uint32_t shapeType, const void* sha
 template<typename NumT>
 err_t PathStrokerContextT<NumT>::strokePath(const NumT_(Path)* src)
 {
+  _initDash();
+
+  // Offset curves directly, dashes are always created from the flattened path.
+  if (stroker->_strokeMode == PATH_STROKER_MODE_CURVES && dashCount == 0 && src->hasBeziers())
+  {
+    // Stroking to the source path is an incorrect use, keep the source by a
+    // (reference counted) copy.
+    if (dst == src)
+    {
+      NumT_(Path) copy(*src);
+      return strokePathCurves(&copy);
+    }
+
+    return strokePathCurves(src);
+  }
+
   // We need:
   // - the Path instances have to be different.
   // - source path must be flat.
@@ -181,9 +288,10 @@ err_t PathStrokerContextT<NumT>::strokePathPrivate(const NumT_(Path)* src)
         size_t subStart = (size_t)(subCommand - commands);
         size_t subLength = (size_t)(curCommand - subCommand);
 
-        FOG_RETURN_ON_ERROR(
-          strokePathFigure(vertices + subStart, subLength, false)
-        );
+        if (dashCount != 0)
+          FOG_RETURN_ON_ERROR(dashPathFigure(vertices + subStart, subLength, false));
+        else
+          FOG_RETURN_ON_ERROR(strokePathFigure(vertices + subStart, subLength, false));
       }
 
       // Advance to new subpath.
@@ -197,9 +305,10 @@ err_t PathStrokerContextT<NumT>::strokePathPrivate(const NumT_(Path)* src)
         size_t subStart = (size_t)(subCommand - commands);
         size_t subLength = (size_t)(curCommand - subCommand);
 
-        FOG_RETURN_ON_ERROR(
-          strokePathFigure(vertices + subStart, subLength, subLength > 2)
-        );
+        if (dashCount != 0)
+          FOG_RETURN_ON_ERROR(dashPathFigure(vertices + subStart, subLength, true));
+        else
+          FOG_RETURN_ON_ERROR(strokePathFigure(vertices + subStart, subLength, subLength > 2));
       }
 
       // We clear beginning mark, because we expect PATH_MOVE_TO command from now.
@@ -216,9 +325,10 @@ err_t PathStrokerContextT<NumT>::strokePathPrivate(const NumT_(Path)* src)
     size_t subStart = (size_t)(subCommand - commands);
     size_t subLength = (size_t)(curCommand - subCommand);
 
-    FOG_RETURN_ON_ERROR(
-      strokePathFigure(vertices + subStart, subLength, false)
-    );
+    if (dashCount != 0)
+      FOG_RETURN_ON_ERROR(dashPathFigure(vertices + subStart, subLength, false));
+    else
+      FOG_RETURN_ON_ERROR(strokePathFigure(vertices + subStart, subLength, false));
   }
 
   return ERR_OK;
@@ -1090,6 +1200,1128 @@ _Pen2Done:
   return ERR_OK;
 }
 
+// ============================================================================
+// [Fog::PathStrokerContextT<> - Dash]
+// ============================================================================
+
+// Dashing follows the SVG stroke-dasharray and stroke-dashoffset semantics:
+//
+// - Negative value in the dash-list or zero sum of all values disables the
+//   dashing (the stroke is painted solid).
+// - Odd dash-list is repeated to get an even number of items.
+// - Dash pattern restarts at the beginning of each figure.
+// - The first and the last dash of a closed figure are connected if they
+//   meet at the figure start.
+//
+// Dashes are generated while walking the flattened figure and each dash is
+// passed directly to strokePathFigure(), the dashed path is never created.
+// Parts of the figure outside of the clip-box (expanded by the stroke extent)
+// are skipped by advancing the dash state (including skipping whole periods)
+// so the cost depends only on the number of visible dashes.
+
+template<typename NumT>
+void PathStrokerContextT<NumT>::_initDash()
+{
+  const NumT_(PathStrokerParams)& params = stroker->_params();
+  const List<NumT>& list = params.getDashList();
+
+  size_t i;
+  size_t length = list.getLength();
+
+  dashCount = 0;
+  if (length == 0)
+    return;
+
+  const NumT* data = list.getData();
+  NumT period = NumT(0.0);
+
+  for (i = 0; i < length; i++)
+  {
+    // Also catches NaN.
+    if (!(data[i] >= NumT(0.0)))
+      return;
+    period += data[i];
+  }
+
+  if (!(period > MathConstant<NumT>::getDistanceEpsilon()) || !Math::isFinite(period))
+    return;
+
+  dashList = data;
+  dashListLength = length;
+  dashCount = length;
+
+  if (length & 1)
+  {
+    dashCount *= 2;
+    period *= NumT(2.0);
+  }
+
+  dashPeriod = period;
+
+  // Setup the initial state using the dash-offset.
+  NumT offset = Math::mod(params.getDashOffset(), period);
+
+  if (offset < NumT(0.0))
+    offset += period;
+  if (!(offset < period))
+    offset = NumT(0.0);
+
+  dashStartIndex = 0;
+  for (i = dashCount; i; i--)
+  {
+    NumT d = getDash(dashStartIndex);
+    if (offset < d)
+      break;
+
+    offset -= d;
+    if (++dashStartIndex == dashCount)
+      dashStartIndex = 0;
+  }
+  dashStartRemain = getDash(dashStartIndex) - offset;
+
+  // Setup the clip-box, mapped to source coordinates using inverted transform.
+  // Only affine transforms are supported, otherwise the clipping is disabled.
+  dashClip = false;
+
+  if (!stroker->isClippingEnabled() || !stroker->_clipBox.isValid())
+    return;
+
+  const NumT_(Transform)& tr = stroker->_transform();
+  uint32_t transformType = tr.getType();
+
+  if (transformType == TRANSFORM_TYPE_IDENTITY)
+  {
+    dashClipBox = stroker->_clipBox;
+  }
+  else
+  {
+    if (transformType > TRANSFORM_TYPE_AFFINE)
+      return;
+
+    NumT_(Transform) inv(tr);
+    if (!inv.invert())
+      return;
+
+    inv.mapBox(dashClipBox, stroker->_clipBox);
+  }
+
+  // The stroke can't be wider than a miter-join or a square-cap (sqrt(2)).
+  NumT extent = NumT(1.5);
+  uint32_t lineJoin = params.getLineJoin();
+
+  if (lineJoin == LINE_JOIN_MITER || lineJoin == LINE_JOIN_MITER_REVERT || lineJoin == LINE_JOIN_MITER_ROUND)
+    extent = Math::max<NumT>(extent, params.getMiterLimit());
+
+  extent *= stroker->_wAbs;
+
+  dashClipBox.x0 -= extent;
+  dashClipBox.y0 -= extent;
+  dashClipBox.x1 += extent;
+  dashClipBox.y1 += extent;
+
+  dashClip = true;
+}
+
+template<typename NumT>
+void PathStrokerContextT<NumT>::_advanceDash(NumT dist)
+{
+  if (dist < dashRemain)
+  {
+    dashRemain -= dist;
+    return;
+  }
+
+  dist -= dashRemain;
+  if (++dashIndex == dashCount)
+    dashIndex = 0;
+
+  // Skip all whole periods at once.
+  if (dist >= dashPeriod)
+    dist = Math::mod(dist, dashPeriod);
+
+  for (size_t i = dashCount; i; i--)
+  {
+    NumT d = getDash(dashIndex);
+    if (dist < d)
+      break;
+
+    dist -= d;
+    if (++dashIndex == dashCount)
+      dashIndex = 0;
+  }
+
+  dashRemain = getDash(dashIndex) - dist;
+}
+
+template<typename NumT>
+bool PathStrokerContextT<NumT>::_clipDash(const NumT_(Point)& p0, NumT dx, NumT dy, NumT& t0, NumT& t1) const
+{
+  // Liang-Barsky, t0 and t1 are parametric positions in [0, 1] range.
+  NumT p[4] = { -dx, dx, -dy, dy };
+  NumT q[4] =
+  {
+    p0.x - dashClipBox.x0,
+    dashClipBox.x1 - p0.x,
+    p0.y - dashClipBox.y0,
+    dashClipBox.y1 - p0.y
+  };
+
+  t0 = NumT(0.0);
+  t1 = NumT(1.0);
+
+  for (uint k = 0; k < 4; k++)
+  {
+    if (p[k] == NumT(0.0))
+    {
+      if (q[k] < NumT(0.0))
+        return false;
+      continue;
+    }
+
+    NumT r = q[k] / p[k];
+
+    if (p[k] < NumT(0.0))
+    {
+      if (r > t1)
+        return false;
+      if (r > t0)
+        t0 = r;
+    }
+    else
+    {
+      if (r < t0)
+        return false;
+      if (r < t1)
+        t1 = r;
+    }
+  }
+
+  return t0 < t1;
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_emitDash(bool& isFirst)
+{
+  err_t err = ERR_OK;
+
+  if (isFirst)
+  {
+    isFirst = false;
+    err = dashFirst.append(dashPath);
+  }
+  else
+  {
+    err = strokePathFigure(dashPath.getVertices(), dashPath.getLength(), false);
+  }
+
+  dashPath.clear();
+  return err;
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::dashPathFigure(const NumT_(Point)* src, size_t count, bool closed)
+{
+  if (count <= 1)
+    return ERR_OK;
+
+  dashIndex = dashStartIndex;
+  dashRemain = dashStartRemain;
+
+  dashPath.clear();
+  dashFirst.clear();
+
+  // The first dash of a closed figure is postponed, it's connected with the
+  // last dash if the last dash ends at the figure start.
+  bool isFirst = closed && isDashOn();
+
+  if (isDashOn())
+    FOG_RETURN_ON_ERROR(dashPath.moveTo(src[0]));
+
+  size_t i;
+  size_t segmentCount = closed ? count : count - 1;
+
+  for (i = 0; i < segmentCount; i++)
+  {
+    const NumT_(Point)& p0 = src[i];
+    const NumT_(Point)& p1 = src[i + 1 == count ? 0 : i + 1];
+
+    NumT dx = p1.x - p0.x;
+    NumT dy = p1.y - p0.y;
+    NumT len = Math::sqrt(dx * dx + dy * dy);
+
+    if (len <= MathConstant<NumT>::getDistanceEpsilon())
+      continue;
+
+    NumT t0 = NumT(0.0);
+    NumT t1 = len;
+
+    if (dashClip)
+    {
+      if (!_clipDash(p0, dx, dy, t0, t1))
+      {
+        // The whole segment is outside.
+        if (isDashOn())
+          FOG_RETURN_ON_ERROR(_emitDash(isFirst));
+
+        _advanceDash(len);
+
+        if (isDashOn())
+          FOG_RETURN_ON_ERROR(dashPath.moveTo(p1));
+        continue;
+      }
+
+      t0 *= len;
+      t1 *= len;
+    }
+
+    NumT ux = dx / len;
+    NumT uy = dy / len;
+
+    // Skip [0, t0].
+    if (t0 > NumT(0.0))
+    {
+      if (isDashOn())
+        FOG_RETURN_ON_ERROR(_emitDash(isFirst));
+
+      _advanceDash(t0);
+
+      if (isDashOn())
+        FOG_RETURN_ON_ERROR(dashPath.moveTo(NumT_(Point)(p0.x + ux * t0, p0.y + uy * t0)));
+    }
+
+    // Dash [t0, t1]. The position is accumulated in double, because a float
+    // position stops advancing by short dashes far from the segment start.
+    double pos = double(t0);
+    double end = double(t1);
+
+    while (end - pos > double(dashRemain))
+    {
+      double next = pos + double(dashRemain);
+
+      // The dash is too short to advance the position, the rest of the range
+      // is skipped at once (these dashes are not visible anyway). Zero length
+      // dash entries are valid (SVG) and are stepped over one by one.
+      if (dashRemain > NumT(0.0) && next == pos)
+      {
+        if (isDashOn())
+        {
+          FOG_RETURN_ON_ERROR(dashPath.lineTo(NumT_(Point)(NumT(p0.x + ux * pos), NumT(p0.y + uy * pos))));
+          FOG_RETURN_ON_ERROR(_emitDash(isFirst));
+        }
+
+        _advanceDash(NumT(end - pos));
+        pos = end;
+
+        if (isDashOn())
+          FOG_RETURN_ON_ERROR(dashPath.moveTo(NumT_(Point)(NumT(p0.x + ux * pos), NumT(p0.y + uy * pos))));
+        break;
+      }
+
+      pos = next;
+      NumT_(Point) pt(NumT(p0.x + ux * pos), NumT(p0.y + uy * pos));
+
+      if (isDashOn())
+      {
+        FOG_RETURN_ON_ERROR(dashPath.lineTo(pt));
+        FOG_RETURN_ON_ERROR(_emitDash(isFirst));
+      }
+
+      if (++dashIndex == dashCount)
+        dashIndex = 0;
+      dashRemain = getDash(dashIndex);
+
+      if (isDashOn())
+        FOG_RETURN_ON_ERROR(dashPath.moveTo(pt));
+    }
+
+    dashRemain -= NumT(end - pos);
+
+    // Skip [t1, len].
+    if (t1 < len)
+    {
+      if (isDashOn())
+      {
+        FOG_RETURN_ON_ERROR(dashPath.lineTo(NumT_(Point)(p0.x + ux * t1, p0.y + uy * t1)));
+        FOG_RETURN_ON_ERROR(_emitDash(isFirst));
+      }
+
+      _advanceDash(len - t1);
+
+      if (isDashOn())
+        FOG_RETURN_ON_ERROR(dashPath.moveTo(p1));
+    }
+    else if (isDashOn())
+    {
+      FOG_RETURN_ON_ERROR(dashPath.lineTo(p1));
+    }
+  }
+
+  if (isDashOn())
+  {
+    // The first dash was never finished, the dash covers the whole figure.
+    if (isFirst)
+      return strokePathFigure(src, count, count > 2);
+
+    if (closed && !dashFirst.isEmpty())
+      FOG_RETURN_ON_ERROR(dashPath.append(dashFirst, Range(1, dashFirst.getLength())));
+
+    FOG_RETURN_ON_ERROR(strokePathFigure(dashPath.getVertices(), dashPath.getLength(), false));
+  }
+  else if (!dashFirst.isEmpty())
+  {
+    FOG_RETURN_ON_ERROR(strokePathFigure(dashFirst.getVertices(), dashFirst.getLength(), false));
+  }
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::PathStrokerContextT<> - Curves]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Maximum subdivision depth of a curve which is offset.
+//!
+//! The piece of the curve at this depth is stroked by a line and a round join.
+//! The depth is reached only around cusps, where the curvature radius drops
+//! below the tolerance.
+#define PATH_STROKER_CURVE_RECURSION_LIMIT 10
+
+//! @internal
+//!
+//! @brief Get point @a p offset by @a s in the normal direction of @a d.
+template<typename NumT>
+static FOG_INLINE NumT_(Point) PathStrokerT_offset(const NumT_(Point)& p, const NumT_(Point)& d, NumT s)
+{
+  return NumT_(Point)(p.x + d.y * s, p.y - d.x * s);
+}
+
+//! @internal
+//!
+//! @brief Get the unit vector of (@a x, @a y), returns false if it's degenerate.
+template<typename NumT>
+static FOG_INLINE bool PathStrokerT_unit(NumT_(Point)& dst, NumT x, NumT y)
+{
+  NumT len = Math::sqrt(x * x + y * y);
+  if (len <= MathConstant<NumT>::getDistanceEpsilon())
+    return false;
+
+  dst.set(x / len, y / len);
+  return true;
+}
+
+template<typename NumT>
+static FOG_INLINE bool PathStrokerT_getQuadTangents(const NumT_(Point)* p,
+  NumT_(Point)& d0, NumT_(Point)& d1)
+{
+  if (!PathStrokerT_unit<NumT>(d0, p[1].x - p[0].x, p[1].y - p[0].y) &&
+      !PathStrokerT_unit<NumT>(d0, p[2].x - p[0].x, p[2].y - p[0].y))
+    return false;
+
+  if (!PathStrokerT_unit<NumT>(d1, p[2].x - p[1].x, p[2].y - p[1].y) &&
+      !PathStrokerT_unit<NumT>(d1, p[2].x - p[0].x, p[2].y - p[0].y))
+    return false;
+
+  return true;
+}
+
+template<typename NumT>
+static FOG_INLINE bool PathStrokerT_getCubicTangents(const NumT_(Point)* p,
+  NumT_(Point)& d0, NumT_(Point)& d1)
+{
+  if (!PathStrokerT_unit<NumT>(d0, p[1].x - p[0].x, p[1].y - p[0].y) &&
+      !PathStrokerT_unit<NumT>(d0, p[2].x - p[0].x, p[2].y - p[0].y) &&
+      !PathStrokerT_unit<NumT>(d0, p[3].x - p[0].x, p[3].y - p[0].y))
+    return false;
+
+  if (!PathStrokerT_unit<NumT>(d1, p[3].x - p[2].x, p[3].y - p[2].y) &&
+      !PathStrokerT_unit<NumT>(d1, p[3].x - p[1].x, p[3].y - p[1].y) &&
+      !PathStrokerT_unit<NumT>(d1, p[3].x - p[0].x, p[3].y - p[0].y))
+    return false;
+
+  return true;
+}
+
+//! @internal
+//!
+//! @brief Approximate the offset of the quadratic curve @a p by @a s.
+//!
+//! The control point is the intersection of the offset tangents, returns
+//! false if the tangents are parallel and the curve turns back.
+template<typename NumT>
+static FOG_INLINE bool PathStrokerT_offsetQuad(NumT_(Point)* q, const NumT_(Point)* p,
+  const NumT_(Point)& d0, const NumT_(Point)& d1, NumT s)
+{
+  q[0] = PathStrokerT_offset<NumT>(p[0], d0, s);
+  q[2] = PathStrokerT_offset<NumT>(p[2], d1, s);
+
+  NumT dot = d0.x * d1.x + d0.y * d1.y;
+  NumT cross = d0.x * d1.y - d0.y * d1.x;
+
+  if (Math::abs(cross) <= MathConstant<NumT>::getDistanceEpsilon())
+  {
+    if (dot < NumT(0.0))
+      return false;
+
+    q[1].set((q[0].x + q[2].x) * NumT(0.5), (q[0].y + q[2].y) * NumT(0.5));
+    return true;
+  }
+
+  NumT t = ((q[2].x - q[0].x) * d1.y - (q[2].y - q[0].y) * d1.x) / cross;
+  q[1].set(q[0].x + d0.x * t, q[0].y + d0.y * t);
+  return true;
+}
+
+//! @internal
+//!
+//! @brief Approximate the offset of the cubic curve @a p by @a s.
+//!
+//! The end-points are offset in the normal direction and the control points
+//! are moved along the tangents so the curvature of the offset at the
+//! end-points matches the curvature of the source curve (the length of each
+//! tangent is multiplied by 1 + s * k, where k is the signed curvature).
+template<typename NumT>
+static FOG_INLINE void PathStrokerT_offsetCubic(NumT_(Point)* q, const NumT_(Point)* p,
+  const NumT_(Point)& d0, const NumT_(Point)& d1, NumT s)
+{
+  NumT h0x = p[1].x - p[0].x;
+  NumT h0y = p[1].y - p[0].y;
+  NumT h1x = p[2].x - p[3].x;
+  NumT h1y = p[2].y - p[3].y;
+
+  NumT k0 = NumT(1.0);
+  NumT k1 = NumT(1.0);
+
+  NumT len0 = Math::sqrt(h0x * h0x + h0y * h0y);
+  NumT len1 = Math::sqrt(h1x * h1x + h1y * h1y);
+
+  if (len0 > MathConstant<NumT>::getDistanceEpsilon())
+  {
+    NumT ax = p[2].x - NumT(2.0) * p[1].x + p[0].x;
+    NumT ay = p[2].y - NumT(2.0) * p[1].y + p[0].y;
+    k0 += s * NumT(2.0 / 3.0) * (h0x * ay - h0y * ax) / (len0 * len0 * len0);
+  }
+
+  if (len1 > MathConstant<NumT>::getDistanceEpsilon())
+  {
+    NumT bx = p[3].x - NumT(2.0) * p[2].x + p[1].x;
+    NumT by = p[3].y - NumT(2.0) * p[2].y + p[1].y;
+    k1 -= s * NumT(2.0 / 3.0) * (h1x * by - h1y * bx) / (len1 * len1 * len1);
+  }
+
+  q[0] = PathStrokerT_offset<NumT>(p[0], d0, s);
+  q[3] = PathStrokerT_offset<NumT>(p[3], d1, s);
+
+  q[1].set(q[0].x + h0x * k0, q[0].y + h0y * k0);
+  q[2].set(q[3].x + h1x * k1, q[3].y + h1y * k1);
+}
+
+//! @internal
+//!
+//! @brief Check whether the quadratic curve @a q is within the @a tolerance
+//! of the offset of @a p by @a s.
+template<typename NumT>
+static FOG_INLINE bool PathStrokerT_checkQuad(const NumT_(Point)* q, const NumT_(Point)* p,
+  NumT s, NumT tolerance)
+{
+  NumT tol2 = tolerance * tolerance;
+
+  for (int i = 1; i <= 3; i++)
+  {
+    NumT t = NumT(i) * NumT(0.25);
+    NumT mt = NumT(1.0) - t;
+
+    NumT b0 = mt * mt;
+    NumT b1 = NumT(2.0) * mt * t;
+    NumT b2 = t * t;
+
+    NumT dx = mt * (p[1].x - p[0].x) + t * (p[2].x - p[1].x);
+    NumT dy = mt * (p[1].y - p[0].y) + t * (p[2].y - p[1].y);
+    NumT len = Math::sqrt(dx * dx + dy * dy);
+
+    if (len <= MathConstant<NumT>::getDistanceEpsilon())
+      return false;
+
+    len = s / len;
+
+    NumT ex = b0 * (q[0].x - p[0].x) + b1 * (q[1].x - p[1].x) + b2 * (q[2].x - p[2].x) - dy * len;
+    NumT ey = b0 * (q[0].y - p[0].y) + b1 * (q[1].y - p[1].y) + b2 * (q[2].y - p[2].y) + dx * len;
+
+    if (ex * ex + ey * ey > tol2)
+      return false;
+  }
+
+  return true;
+}
+
+//! @internal
+//!
+//! @brief Check whether the cubic curve @a q is within the @a tolerance of
+//! the offset of @a p by @a s.
+template<typename NumT>
+static FOG_INLINE bool PathStrokerT_checkCubic(const NumT_(Point)* q, const NumT_(Point)* p,
+  NumT s, NumT tolerance)
+{
+  NumT tol2 = tolerance * tolerance;
+
+  for (int i = 1; i <= 3; i++)
+  {
+    NumT t = NumT(i) * NumT(0.25);
+    NumT mt = NumT(1.0) - t;
+
+    NumT b0 = mt * mt * mt;
+    NumT b1 = NumT(3.0) * mt * mt * t;
+    NumT b2 = NumT(3.0) * mt * t * t;
+    NumT b3 = t * t * t;
+
+    NumT d0 = mt * mt;
+    NumT d1 = NumT(2.0) * mt * t;
+    NumT d2 = t * t;
+
+    NumT dx = d0 * (p[1].x - p[0].x) + d1 * (p[2].x - p[1].x) + d2 * (p[3].x - p[2].x);
+    NumT dy = d0 * (p[1].y - p[0].y) + d1 * (p[2].y - p[1].y) + d2 * (p[3].y - p[2].y);
+    NumT len = Math::sqrt(dx * dx + dy * dy);
+
+    if (len <= MathConstant<NumT>::getDistanceEpsilon())
+      return false;
+
+    len = s / len;
+
+    NumT ex = b0 * (q[0].x - p[0].x) + b1 * (q[1].x - p[1].x) +
+              b2 * (q[2].x - p[2].x) + b3 * (q[3].x - p[3].x) - dy * len;
+    NumT ey = b0 * (q[0].y - p[0].y) + b1 * (q[1].y - p[1].y) +
+              b2 * (q[2].y - p[2].y) + b3 * (q[3].y - p[3].y) + dx * len;
+
+    if (ex * ex + ey * ey > tol2)
+      return false;
+  }
+
+  return true;
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::strokePathCurves(const NumT_(Path)* src)
+{
+  const uint8_t* cmd = src->getCommands();
+  const NumT_(Point)* pts = src->getVertices();
+
+  size_t length = src->getLength();
+  size_t i = 0;
+
+  while (i < length)
+  {
+    // Everything between close and the next move-to is ignored, the same as
+    // in strokePathPrivate().
+    if (!PathCmd::isMoveTo(cmd[i]))
+    {
+      i++;
+      continue;
+    }
+
+    size_t start = i;
+    while (++i < length && !PathCmd::isMoveTo(cmd[i]) && !PathCmd::isClose(cmd[i]))
+      continue;
+
+    bool closed = (i < length && PathCmd::isClose(cmd[i]));
+    FOG_RETURN_ON_ERROR(strokeCurveFigure(cmd + start, pts + start, i - start, closed && i - start > 2));
+  }
+
+  return ERR_OK;
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::strokeCurveFigure(const uint8_t* cmd, const NumT_(Point)* pts, size_t count, bool closed)
+{
+  if (count <= 1)
+    return ERR_OK;
+
+  uint32_t lineJoin = stroker->_params->getLineJoin();
+  size_t i = 1;
+
+  curveL.clear();
+  curveR.clear();
+  curveHasSegment = false;
+
+  while (i < count)
+  {
+    switch (cmd[i])
+    {
+      case PATH_CMD_LINE_TO:
+        FOG_RETURN_ON_ERROR(_curveLine(pts + i - 1, lineJoin));
+        i += 1;
+        break;
+
+      case PATH_CMD_QUAD_TO:
+        if (FOG_UNLIKELY(i + 2 > count))
+          return ERR_GEOMETRY_INVALID;
+
+        FOG_RETURN_ON_ERROR(_curveQuad(pts + i - 1, lineJoin));
+        i += 2;
+        break;
+
+      case PATH_CMD_CUBIC_TO:
+        if (FOG_UNLIKELY(i + 3 > count))
+          return ERR_GEOMETRY_INVALID;
+
+        FOG_RETURN_ON_ERROR(_curveCubic(pts + i - 1, lineJoin));
+        i += 3;
+        break;
+
+      default:
+        return ERR_GEOMETRY_INVALID;
+    }
+  }
+
+  if (closed)
+  {
+    NumT_(Point) line[2];
+    line[0] = pts[count - 1];
+    line[1] = pts[0];
+    FOG_RETURN_ON_ERROR(_curveLine(line, lineJoin));
+  }
+
+  // Nothing to stroke if all segments are degenerate.
+  if (!curveHasSegment)
+    return ERR_OK;
+
+  NumT w = stroker->_w;
+
+  if (closed)
+  {
+    // Outline - the first side and the reversed second side, each closed.
+    FOG_RETURN_ON_ERROR(_curveJoin(curveL, curveFirstPt, curveLastDir, curveFirstDir, w, lineJoin));
+    FOG_RETURN_ON_ERROR(_curveJoin(curveR, curveFirstPt, curveLastDir, curveFirstDir, -w, lineJoin));
+
+    FOG_RETURN_ON_ERROR(curveL.close());
+    FOG_RETURN_ON_ERROR(dst->append(curveL));
+    FOG_RETURN_ON_ERROR(_appendReversed(*dst, curveR, false));
+    return dst->close();
+  }
+  else
+  {
+    // Pen - the first side, the end cap, the reversed second side, and the
+    // start cap.
+    NumT_(Point) o(-curveFirstDir.x, -curveFirstDir.y);
+
+    FOG_RETURN_ON_ERROR(_curveCap(curveL, curveLastPt, curveLastDir, stroker->_params->getEndCap()));
+    FOG_RETURN_ON_ERROR(_appendReversed(curveL, curveR, true));
+    FOG_RETURN_ON_ERROR(_curveCap(curveL, curveFirstPt, o, stroker->_params->getStartCap()));
+
+    FOG_RETURN_ON_ERROR(curveL.close());
+    return dst->append(curveL);
+  }
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_curveBegin(const NumT_(Point)& p, const NumT_(Point)& d, uint32_t lineJoin)
+{
+  NumT w = stroker->_w;
+
+  if (!curveHasSegment)
+  {
+    curveHasSegment = true;
+    curveFirstPt = p;
+    curveFirstDir = d;
+
+    FOG_RETURN_ON_ERROR(curveL.moveTo(PathStrokerT_offset<NumT>(p, d, w)));
+    return curveR.moveTo(PathStrokerT_offset<NumT>(p, d, -w));
+  }
+
+  FOG_RETURN_ON_ERROR(_curveJoin(curveL, p, curveLastDir, d, w, lineJoin));
+  return _curveJoin(curveR, p, curveLastDir, d, -w, lineJoin);
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_curveJoin(NumT_(Path)& side, const NumT_(Point)& p,
+  const NumT_(Point)& d0, const NumT_(Point)& d1, NumT s, uint32_t lineJoin)
+{
+  NumT dot = d0.x * d1.x + d0.y * d1.y;
+  NumT cross = d0.x * d1.y - d0.y * d1.x;
+  NumT r = Math::abs(s);
+
+  // Skip the join if the gap between both offsets is not visible.
+  if (dot > NumT(0.0) && Math::abs(cross) * r <= stroker->_tolerance * NumT(0.25))
+    return ERR_OK;
+
+  NumT_(Point) a(PathStrokerT_offset<NumT>(p, d0, s));
+  NumT_(Point) b(PathStrokerT_offset<NumT>(p, d1, s));
+
+  // Inner join - connect both offsets through the pivot, so the stroke is
+  // covered even if the offset curves don't intersect (thick stroke of short
+  // segments or a curve which turns faster than the stroke width).
+  if (cross * s < NumT(0.0))
+  {
+    FOG_RETURN_ON_ERROR(side.lineTo(p));
+    return side.lineTo(b);
+  }
+
+  // Outer join.
+  switch (lineJoin)
+  {
+    case LINE_JOIN_MITER:
+    case LINE_JOIN_MITER_REVERT:
+    case LINE_JOIN_MITER_ROUND:
+    {
+      NumT limit = stroker->_params->getMiterLimit();
+      NumT c = Math::sqrt(Math::max((NumT(1.0) + dot) * NumT(0.5), NumT(0.0)));
+      NumT sn = Math::sqrt(Math::max((NumT(1.0) - dot) * NumT(0.5), NumT(0.0)));
+
+      // Inside the miter limit.
+      if (c * limit >= NumT(1.0))
+      {
+        NumT t = r * sn / c;
+        FOG_RETURN_ON_ERROR(side.lineTo(a.x + d0.x * t, a.y + d0.y * t));
+        return side.lineTo(b);
+      }
+
+      if (lineJoin == LINE_JOIN_MITER_REVERT)
+        return side.lineTo(b);
+
+      if (lineJoin == LINE_JOIN_MITER_ROUND)
+        goto _Round;
+
+      // Miter limit exceeded, truncate the miter at the miter limit.
+      if (sn > MathConstant<NumT>::getDistanceEpsilon())
+      {
+        NumT t = r * (limit - c) / sn;
+        if (t > NumT(0.0))
+        {
+          FOG_RETURN_ON_ERROR(side.lineTo(a.x + d0.x * t, a.y + d0.y * t));
+          FOG_RETURN_ON_ERROR(side.lineTo(b.x - d1.x * t, b.y - d1.y * t));
+        }
+      }
+      return side.lineTo(b);
+    }
+
+    case LINE_JOIN_ROUND:
+_Round:
+    {
+      NumT_(Point) u((a.x - p.x) / r, (a.y - p.y) / r);
+      NumT_(Point) v((b.x - p.x) / r, (b.y - p.y) / r);
+      return _curveArc(side, p, u, v, d0, r);
+    }
+
+    case LINE_JOIN_BEVEL:
+    default:
+      return side.lineTo(b);
+  }
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_curveArc(NumT_(Path)& side, const NumT_(Point)& c,
+  const NumT_(Point)& u, const NumT_(Point)& v, const NumT_(Point)& hint, NumT r)
+{
+  NumT dot = u.x * v.x + u.y * v.y;
+
+  // Split the arc larger than 90 degrees at the bisector, the @a hint is used
+  // when the arc has 180 degrees.
+  if (dot < NumT(0.0))
+  {
+    NumT_(Point) m(hint);
+    PathStrokerT_unit<NumT>(m, u.x + v.x, u.y + v.y);
+
+    FOG_RETURN_ON_ERROR(_curveArc(side, c, u, m, m, r));
+    return _curveArc(side, c, m, v, m, r);
+  }
+
+  // The cubic approximation of the arc, the length of the control vectors is
+  // 4/3 * tan(angle / 4) (half-angle formulas are used to get it from dot).
+  NumT ch = Math::sqrt(Math::max((NumT(1.0) + dot) * NumT(0.5), NumT(0.0)));
+  NumT sh = Math::sqrt(Math::max((NumT(1.0) - dot) * NumT(0.5), NumT(0.0)));
+  NumT k = NumT(4.0 / 3.0) * sh / (NumT(1.0) + ch);
+
+  if (u.x * v.y - u.y * v.x < NumT(0.0))
+    k = -k;
+
+  return side.cubicTo(
+    c.x + r * (u.x - k * u.y), c.y + r * (u.y + k * u.x),
+    c.x + r * (v.x + k * v.y), c.y + r * (v.y - k * v.x),
+    c.x + r * v.x            , c.y + r * v.y);
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_curveCap(NumT_(Path)& side, const NumT_(Point)& p,
+  const NumT_(Point)& o, uint32_t cap)
+{
+  // The cap goes from the offset of @a p by w to the offset by -w, @a o is
+  // the outward direction.
+  NumT w = stroker->_w;
+  NumT r = stroker->_wAbs;
+
+  NumT_(Point) s(PathStrokerT_offset<NumT>(p, o, w));
+  NumT_(Point) e(PathStrokerT_offset<NumT>(p, o, -w));
+
+  NumT ox = o.x * r;
+  NumT oy = o.y * r;
+
+  switch (cap)
+  {
+    case LINE_CAP_SQUARE:
+    {
+      FOG_RETURN_ON_ERROR(side.lineTo(s.x + ox, s.y + oy));
+      FOG_RETURN_ON_ERROR(side.lineTo(e.x + ox, e.y + oy));
+      return side.lineTo(e);
+    }
+
+    case LINE_CAP_ROUND:
+    {
+      NumT ws = w > NumT(0.0) ? NumT(1.0) : NumT(-1.0);
+      NumT_(Point) u( o.y * ws, -o.x * ws);
+      NumT_(Point) v(-o.y * ws,  o.x * ws);
+
+      FOG_RETURN_ON_ERROR(_curveArc(side, p, u, o, o, r));
+      return _curveArc(side, p, o, v, o, r);
+    }
+
+    case LINE_CAP_ROUND_REVERSE:
+    {
+      NumT ws = w > NumT(0.0) ? NumT(1.0) : NumT(-1.0);
+      NumT_(Point) u( o.y * ws, -o.x * ws);
+      NumT_(Point) v(-o.y * ws,  o.x * ws);
+
+      NumT_(Point) c(p.x + ox, p.y + oy);
+      NumT_(Point) h(-o.x, -o.y);
+
+      FOG_RETURN_ON_ERROR(side.lineTo(s.x + ox, s.y + oy));
+      FOG_RETURN_ON_ERROR(_curveArc(side, c, u, v, h, r));
+      return side.lineTo(e);
+    }
+
+    case LINE_CAP_TRIANGLE:
+    {
+      FOG_RETURN_ON_ERROR(side.lineTo(p.x + ox, p.y + oy));
+      return side.lineTo(e);
+    }
+
+    case LINE_CAP_TRIANGLE_REVERSE:
+    {
+      FOG_RETURN_ON_ERROR(side.lineTo(s.x + ox, s.y + oy));
+      FOG_RETURN_ON_ERROR(side.lineTo(p));
+      FOG_RETURN_ON_ERROR(side.lineTo(e.x + ox, e.y + oy));
+      return side.lineTo(e);
+    }
+
+    case LINE_CAP_BUTT:
+    default:
+    {
+      return side.lineTo(e);
+    }
+  }
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_curveLine(const NumT_(Point)* p, uint32_t lineJoin)
+{
+  NumT_(Point) d(UNINITIALIZED);
+  if (!PathStrokerT_unit<NumT>(d, p[1].x - p[0].x, p[1].y - p[0].y))
+    return ERR_OK;
+
+  NumT w = stroker->_w;
+
+  FOG_RETURN_ON_ERROR(_curveBegin(p[0], d, lineJoin));
+  FOG_RETURN_ON_ERROR(curveL.lineTo(PathStrokerT_offset<NumT>(p[1], d, w)));
+  FOG_RETURN_ON_ERROR(curveR.lineTo(PathStrokerT_offset<NumT>(p[1], d, -w)));
+
+  curveLastPt = p[1];
+  curveLastDir = d;
+  return ERR_OK;
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_curveQuad(const NumT_(Point)* p, uint32_t lineJoin)
+{
+  NumT_(Point) d0(UNINITIALIZED);
+  NumT_(Point) d1(UNINITIALIZED);
+
+  if (!PathStrokerT_getQuadTangents<NumT>(p, d0, d1))
+    return ERR_OK;
+
+  NumT w = stroker->_w;
+  NumT_(Point) dir(UNINITIALIZED);
+
+  FOG_RETURN_ON_ERROR(_curveBegin(p[0], d0, lineJoin));
+
+  // Both sides are subdivided independently, the side ends in the normal
+  // direction of the last piece, which differs from @a d1 only if the last
+  // piece was stroked by a line.
+  dir = d0;
+  FOG_RETURN_ON_ERROR(_offsetQuad(curveL, p, w, 0, dir));
+  FOG_RETURN_ON_ERROR(_curveJoin(curveL, p[2], dir, d1, w, LINE_JOIN_ROUND));
+
+  dir = d0;
+  FOG_RETURN_ON_ERROR(_offsetQuad(curveR, p, -w, 0, dir));
+  FOG_RETURN_ON_ERROR(_curveJoin(curveR, p[2], dir, d1, -w, LINE_JOIN_ROUND));
+
+  curveLastPt = p[2];
+  curveLastDir = d1;
+  return ERR_OK;
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_curveCubic(const NumT_(Point)* p, uint32_t lineJoin)
+{
+  NumT_(Point) d0(UNINITIALIZED);
+  NumT_(Point) d1(UNINITIALIZED);
+
+  if (!PathStrokerT_getCubicTangents<NumT>(p, d0, d1))
+    return ERR_OK;
+
+  NumT w = stroker->_w;
+  NumT_(Point) dir(UNINITIALIZED);
+
+  FOG_RETURN_ON_ERROR(_curveBegin(p[0], d0, lineJoin));
+
+  dir = d0;
+  FOG_RETURN_ON_ERROR(_offsetCubic(curveL, p, w, 0, dir));
+  FOG_RETURN_ON_ERROR(_curveJoin(curveL, p[3], dir, d1, w, LINE_JOIN_ROUND));
+
+  dir = d0;
+  FOG_RETURN_ON_ERROR(_offsetCubic(curveR, p, -w, 0, dir));
+  FOG_RETURN_ON_ERROR(_curveJoin(curveR, p[3], dir, d1, -w, LINE_JOIN_ROUND));
+
+  curveLastPt = p[3];
+  curveLastDir = d1;
+  return ERR_OK;
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_offsetQuad(NumT_(Path)& side, const NumT_(Point)* p,
+  NumT s, int depth, NumT_(Point)& dir)
+{
+  NumT_(Point) d0(UNINITIALIZED);
+  NumT_(Point) d1(UNINITIALIZED);
+
+  if (!PathStrokerT_getQuadTangents<NumT>(p, d0, d1))
+    return ERR_OK;
+
+  // Round join if the piece doesn't continue the previous one (cusp).
+  FOG_RETURN_ON_ERROR(_curveJoin(side, p[0], dir, d0, s, LINE_JOIN_ROUND));
+
+  if (depth < PATH_STROKER_CURVE_RECURSION_LIMIT)
+  {
+    NumT_(Point) q[3];
+
+    if (d0.x * d1.x + d0.y * d1.y >= NumT(0.0) &&
+        PathStrokerT_offsetQuad<NumT>(q, p, d0, d1, s) &&
+        PathStrokerT_checkQuad<NumT>(q, p, s, stroker->_tolerance))
+    {
+      dir = d1;
+      return side.quadTo(q[1], q[2]);
+    }
+
+    NumT_(Point) left[3];
+    NumT_(Point) rght[3];
+
+    NumI_(QBezier)::splitHalf(p, left, rght);
+    dir = d0;
+
+    FOG_RETURN_ON_ERROR(_offsetQuad(side, left, s, depth + 1, dir));
+    return _offsetQuad(side, rght, s, depth + 1, dir);
+  }
+  else
+  {
+    dir = d0;
+    return side.lineTo(PathStrokerT_offset<NumT>(p[2], d0, s));
+  }
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_offsetCubic(NumT_(Path)& side, const NumT_(Point)* p,
+  NumT s, int depth, NumT_(Point)& dir)
+{
+  NumT_(Point) d0(UNINITIALIZED);
+  NumT_(Point) d1(UNINITIALIZED);
+
+  if (!PathStrokerT_getCubicTangents<NumT>(p, d0, d1))
+    return ERR_OK;
+
+  // Round join if the piece doesn't continue the previous one (cusp).
+  FOG_RETURN_ON_ERROR(_curveJoin(side, p[0], dir, d0, s, LINE_JOIN_ROUND));
+
+  if (depth < PATH_STROKER_CURVE_RECURSION_LIMIT)
+  {
+    NumT_(Point) q[4];
+
+    if (d0.x * d1.x + d0.y * d1.y >= NumT(0.0))
+    {
+      PathStrokerT_offsetCubic<NumT>(q, p, d0, d1, s);
+      if (PathStrokerT_checkCubic<NumT>(q, p, s, stroker->_tolerance))
+      {
+        dir = d1;
+        return side.cubicTo(q[1], q[2], q[3]);
+      }
+    }
+
+    NumT_(Point) left[4];
+    NumT_(Point) rght[4];
+
+    NumI_(CBezier)::splitHalf(p, left, rght);
+    dir = d0;
+
+    FOG_RETURN_ON_ERROR(_offsetCubic(side, left, s, depth + 1, dir));
+    return _offsetCubic(side, rght, s, depth + 1, dir);
+  }
+  else
+  {
+    dir = d0;
+    return side.lineTo(PathStrokerT_offset<NumT>(p[3], d0, s));
+  }
+}
+
+template<typename NumT>
+err_t PathStrokerContextT<NumT>::_appendReversed(NumT_(Path)& path, const NumT_(Path)& side, bool skipFirst)
+{
+  size_t length = side.getLength();
+  if (length == 0)
+    return ERR_OK;
+
+  size_t pos = path._add(skipFirst ? length - 1 : length);
+  if (pos == INVALID_INDEX)
+    return ERR_RT_OUT_OF_MEMORY;
+
+  const uint8_t* srcCmd = side.getCommands();
+  const NumT_(Point)* srcPts = side.getVertices();
+
+  uint8_t* dstCmd = path.getCommandsX() + pos;
+  NumT_(Point)* dstPts = path.getVerticesX() + pos;
+
+  size_t i = length - 1;
+
+  if (!skipFirst)
+  {
+    dstCmd[0] = PATH_CMD_MOVE_TO;
+    dstPts[0] = srcPts[i];
+
+    dstCmd++;
+    dstPts++;
+  }
+
+  // The side contains a single figure without close. The vertices of each
+  // segment are reversed, but the commands of the segment are the same.
+  while (i > 0)
+  {
+    size_t n = 1;
+
+    if (srcCmd[i] == PATH_CMD_DATA)
+      n = (srcCmd[i - 1] == PATH_CMD_QUAD_TO) ? 2 : 3;
+
+    for (size_t k = 0; k < n; k++)
+    {
+      dstCmd[k] = srcCmd[i - n + 1 + k];
+      dstPts[k] = srcPts[i - 1 - k];
+    }
+
+    dstCmd += n;
+    dstPts += n;
+    i -= n;
+  }
+
+  path._d->vType |= PATH_FLAG_DIRTY_BBOX | PATH_FLAG_DIRTY_INFO |
+    (side._d->vType & (PATH_FLAG_HAS_QBEZIER | PATH_FLAG_HAS_CBEZIER));
+  return ERR_OK;
+}
+
 // ============================================================================
 // [Fog::PathStroker - Construction / Destruction]
 // ============================================================================
@@ -1106,11 +2338,13 @@ static void FOG_CDECL PathStrokerT_ctor(NumT_(PathStroker)* self)
   self->_wEps = NumT(0);
   self->_da = NumT(0);
   self->_flatness = MathConstant<NumT>::getDefaultFlatness();
+  self->_tolerance = self->_flatness;
   self->_wSign = 1;
   self->_isDirty = true;
   self->_isClippingEnabled = false;
   self->_isTransformSimple = true;
   self->_flattenType = PATH_FLATTEN_DISABLED;
+  self->_strokeMode = PATH_STROKER_MODE_FLATTEN;
 }
 
 template<typename NumT>
@@ -1125,11 +2359,13 @@ static void FOG_CDECL PathStrokerT_ctorCopy(NumT_(PathStroker)* self, const NumT
   self->_wEps = other->_wEps;
   self->_da = other->_da;
   self->_flatness = other->_flatness;
+  self->_tolerance = other->_tolerance;
   self->_wSign = other->_wSign;
   self->_isDirty = other->_isDirty;
   self->_isClippingEnabled = other->_isClippingEnabled;
   self->_isTransformSimple = other->_isTransformSimple;
   self->_flattenType = other->_flattenType;
+  self->_strokeMode = other->_strokeMode;
 }
 
 template<typename NumT>
@@ -1157,11 +2393,13 @@ static void FOG_CDECL PathStrokerT_ctorParams(NumT_(PathStroker)* self,
   self->_wEps = NumT(0);
   self->_da = NumT(0);
   self->_flatness = MathConstant<NumT>::getDefaultFlatness();
+  self->_tolerance = self->_flatness;
   self->_wSign = 1;
   self->_isDirty = true;
   self->_isClippingEnabled = false;
   self->_isTransformSimple = true;
   self->_flattenType = PATH_FLATTEN_DISABLED;
+  self->_strokeMode = PATH_STROKER_MODE_FLATTEN;
 }
 
 template<typename NumT>
@@ -1193,11 +2431,13 @@ static void FOG_CDECL PathStrokerT_setOther(NumT_(PathStroker)* self, const NumT
   self->_wEps = other->_wEps;
   self->_da = other->_da;
   self->_flatness = other->_flatness;
+  self->_tolerance = other->_tolerance;
   self->_wSign = other->_wSign;
   self->_isDirty = other->_isDirty;
   self->_isClippingEnabled = other->_isClippingEnabled;
   self->_isTransformSimple = other->_isTransformSimple;
   self->_flattenType = other->_flattenType;
+  self->_strokeMode = other->_strokeMode;
 }
 
 // ============================================================================
@@ -1290,6 +2530,15 @@ static void FOG_CDECL PathStrokerT_update(NumT_(PathStroker)* self)
   self->_wEps = self->_w / NumT(1024.0);
   self->_da = Math::acos(self->_wAbs / (self->_wAbs + NumT(0.125) * self->_flatness)) * NumT(2.0);
 
+  // The stroke is created in source coordinates and transformed afterwards,
+  // so the curve offsetting tolerance has to be scaled down by the transform
+  // to keep the error in device coordinates within the flatness.
+  NumT scale = self->_transform->getAverageScaling();
+  self->_tolerance = self->_flatness;
+
+  if (scale > MathConstant<NumT>::getDistanceEpsilon())
+    self->_tolerance /= scale;
+
   self->_isDirty = false;
   self->_isTransformSimple = self->_transform->getType() == TRANSFORM_TYPE_IDENTITY;
 }
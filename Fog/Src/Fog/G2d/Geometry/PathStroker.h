@@ -317,6 +317,21 @@ struct FOG_NO_EXPORT PathStrokerF
     _flattenType = (uint8_t)flattenType;
   }
 
+  // --------------------------------------------------------------------------
+  // [Stroke-Mode]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint32_t getStrokeMode() const
+  {
+    return _strokeMode;
+  }
+
+  FOG_INLINE void setStrokeMode(uint32_t strokeMode)
+  {
+    FOG_ASSERT(strokeMode < PATH_STROKER_MODE_COUNT);
+    _strokeMode = (uint8_t)strokeMode;
+  }
+
   // --------------------------------------------------------------------------
   // [Clipping]
   // --------------------------------------------------------------------------
@@ -429,6 +444,8 @@ struct FOG_NO_EXPORT PathStrokerF
   float _wEps;
   float _da;
   float _flatness;
+  //! @brief Curve offsetting tolerance (flatness in source coordinates).
+  float _tolerance;
 
   int _wSign;
 
@@ -436,6 +453,7 @@ struct FOG_NO_EXPORT PathStrokerF
   uint8_t _isClippingEnabled;
   uint8_t _isTransformSimple;
   uint8_t _flattenType;
+  uint8_t _strokeMode;
 };
 
 // ============================================================================
@@ -513,6 +531,21 @@ struct FOG_NO_EXPORT PathStrokerD
     _flattenType = (uint8_t)flattenType;
   }
 
+  // --------------------------------------------------------------------------
+  // [Stroke-Mode]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint32_t getStrokeMode() const
+  {
+    return _strokeMode;
+  }
+
+  FOG_INLINE void setStrokeMode(uint32_t strokeMode)
+  {
+    FOG_ASSERT(strokeMode < PATH_STROKER_MODE_COUNT);
+    _strokeMode = (uint8_t)strokeMode;
+  }
+
   // --------------------------------------------------------------------------
   // [Clipping]
   // --------------------------------------------------------------------------
@@ -625,6 +658,8 @@ struct FOG_NO_EXPORT PathStrokerD
   double _wEps;
   double _da;
   double _flatness;
+  //! @brief Curve offsetting tolerance (flatness in source coordinates).
+  double _tolerance;
 
   int _wSign;
 
@@ -632,6 +667,7 @@ struct FOG_NO_EXPORT PathStrokerD
   uint8_t _isClippingEnabled;
   uint8_t _isTransformSimple;
   uint8_t _flattenType;
+  uint8_t _strokeMode;
 };
 
 // ============================================================================
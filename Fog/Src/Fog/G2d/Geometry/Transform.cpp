@@ -3109,6 +3109,51 @@ static void FOG_CDECL TransformT_mapPointsT_Degenerate(const NumT_(Transform)* s
   for (size_t i = 0; i < length; i++) dst[i].reset();
 }
 
+// ============================================================================
+// [Fog::Transform - MapPointsAndBox]
+// ============================================================================
+
+// Number of points mapped at once by TransformT_mapPointsAndBoxT(), the mapped
+// points are still in L1 cache when the bounding box is updated.
+enum { TRANSFORM_MAP_BOX_CHUNK = 512 };
+
+template<typename NumT, typename SrcT>
+static void FOG_CDECL TransformT_mapPointsAndBoxT(const NumT_(Transform)* self,
+  NumT_(Point)* dst,
+  const SrcT_(Point)* src,
+  size_t length,
+  NumT_(Box)* box)
+{
+  NumT x0 = Math::getPInfT<NumT>();
+  NumT y0 = Math::getPInfT<NumT>();
+  NumT x1 = Math::getNInfT<NumT>();
+  NumT y1 = Math::getNInfT<NumT>();
+
+  while (length)
+  {
+    size_t chunk = Math::min<size_t>(length, TRANSFORM_MAP_BOX_CHUNK);
+    self->_mapPoints(dst, src, chunk);
+
+    // NaNs (close vertices) are skipped, because all comparisons fail.
+    for (size_t i = 0; i < chunk; i++)
+    {
+      NumT x = dst[i].x;
+      NumT y = dst[i].y;
+
+      if (x < x0) x0 = x;
+      if (x > x1) x1 = x;
+      if (y < y0) y0 = y;
+      if (y > y1) y1 = y;
+    }
+
+    dst += chunk;
+    src += chunk;
+    length -= chunk;
+  }
+
+  box->setBox(x0, y0, x1, y1);
+}
+
 // ============================================================================
 // [Fog::Transform - MapPath]
 // ============================================================================
@@ -3125,14 +3170,32 @@ static err_t FOG_CDECL TransformT_mapPathT(const NumT_(Transform)* self,
   {
     if (cntOp == CONTAINER_OP_REPLACE)
     {
+      // The bounding-box of a path without curves is the bounding-box of its
+      // vertices, so it's calculated together with the mapping.
+      const uint32_t curveMask = PATH_FLAG_DIRTY_CMD | PATH_FLAG_HAS_QBEZIER | PATH_FLAG_HAS_CBEZIER;
+      bool isFlat = srcLength != 0 && (src->_d->vType & curveMask) == 0;
+
       FOG_RETURN_ON_ERROR(dst->reserve(srcLength));
 
-      self->_mapPoints(dst->_d->vertices, src->_d->vertices, srcLength);
+      NumT_(Box) box(UNINITIALIZED);
+      if (isFlat)
+        self->_mapPointsAndBox(dst->_d->vertices, src->_d->vertices, srcLength, box);
+      else
+        self->_mapPoints(dst->_d->vertices, src->_d->vertices, srcLength);
+
       if (sizeof(NumT) != sizeof(SrcT) || (void*)dst->_d != (void*)src->_d)
       {
         MemOps::copy(dst->_d->commands, src->_d->commands, srcLength);
         dst->_d->length = srcLength;
       }
+
+      if (isFlat && box.x0 <= box.x1)
+      {
+        dst->_d->boundingBox = box;
+        dst->_d->vType = (dst->_d->vType & ~(curveMask | PATH_FLAG_DIRTY_BBOX)) |
+                         PATH_FLAG_HAS_BBOX | PATH_FLAG_DIRTY_INFO;
+        return ERR_OK;
+      }
     }
     else
     {
@@ -3691,6 +3754,7 @@ static NumT FOG_CDECL TransformT_getAverageScaling(const NumT_(Transform)* self)
 FOG_CPU_DECLARE_INITIALIZER_3DNOW( Transform_init_3dNow(void) )
 FOG_CPU_DECLARE_INITIALIZER_SSE( Transform_init_SSE(void) )
 FOG_CPU_DECLARE_INITIALIZER_SSE2( Transform_init_SSE2(void) )
+FOG_CPU_DECLARE_INITIALIZER_AVX2( Transform_init_AVX2(void) )
 
 FOG_NO_EXPORT void Transform_init(void)
 {
@@ -3762,6 +3826,13 @@ FOG_NO_EXPORT void Transform_init(void)
   fog_api.transformd_mapPointsD[TRANSFORM_TYPE_DEGENERATE ] = TransformT_mapPointsT_Degenerate <double, double>;
 #endif // FOG_TRANSFORM_INIT_C
 
+  for (uint32_t i = 0; i < TRANSFORM_TYPE_COUNT; i++)
+  {
+    fog_api.transformf_mapPointsAndBoxF[i] = TransformT_mapPointsAndBoxT<float, float>;
+    fog_api.transformd_mapPointsAndBoxF[i] = TransformT_mapPointsAndBoxT<double, float>;
+    fog_api.transformd_mapPointsAndBoxD[i] = TransformT_mapPointsAndBoxT<double, double>;
+  }
+
   // --------------------------------------------------------------------------
   // [Data]
   // --------------------------------------------------------------------------
@@ -3779,6 +3850,7 @@ FOG_NO_EXPORT void Transform_init(void)
   FOG_CPU_USE_INITIALIZER_3DNOW(Transform_init_3dNow())
   FOG_CPU_USE_INITIALIZER_SSE(Transform_init_SSE())
   FOG_CPU_USE_INITIALIZER_SSE2(Transform_init_SSE2())
+  FOG_CPU_USE_INITIALIZER_AVX2(Transform_init_AVX2())
 }
 
 } // Fog namespace
@@ -1115,6 +1115,23 @@ struct FOG_NO_EXPORT TransformF
     fog_api.transformf_mapPointsF[_type](this, dst, src, count);
   }
 
+  //! @brief Map @a count points from @a src to @a dst and store the bounding
+  //! box of the mapped points to @a box.
+  //!
+  //! Points mapped to NaN (the vertices of @c PATH_CMD_CLOSE commands) are not
+  //! included in the bounding box. If there is no such point then @a box is
+  //! invalid (@c x0 > @c x1).
+  FOG_INLINE void mapPointsAndBox(PointF* dst, const PointF* src, size_t count, BoxF& box) const
+  {
+    fog_api.transformf_mapPointsAndBoxF[getType()](this, dst, src, count, &box);
+  }
+
+  FOG_INLINE void _mapPointsAndBox(PointF* dst, const PointF* src, size_t count, BoxF& box) const
+  {
+    FOG_ASSERT(_type < TRANSFORM_TYPE_COUNT);
+    fog_api.transformf_mapPointsAndBoxF[_type](this, dst, src, count, &box);
+  }
+
   FOG_INLINE void mapBox(BoxF& dst, const BoxF& src) const
   {
     fog_api.transformf_mapBoxF(this, &dst, &src);
@@ -2354,6 +2371,32 @@ struct FOG_NO_EXPORT TransformD
     fog_api.transformd_mapPointsD[_type](this, dst, src, count);
   }
 
+  //! @brief Map @a count points from @a src to @a dst and store the bounding
+  //! box of the mapped points to @a box.
+  //!
+  //! @sa TransformF::mapPointsAndBox().
+  FOG_INLINE void mapPointsAndBox(PointD* dst, const PointF* src, size_t count, BoxD& box) const
+  {
+    fog_api.transformd_mapPointsAndBoxF[getType()](this, dst, src, count, &box);
+  }
+
+  FOG_INLINE void mapPointsAndBox(PointD* dst, const PointD* src, size_t count, BoxD& box) const
+  {
+    fog_api.transformd_mapPointsAndBoxD[getType()](this, dst, src, count, &box);
+  }
+
+  FOG_INLINE void _mapPointsAndBox(PointD* dst, const PointF* src, size_t count, BoxD& box) const
+  {
+    FOG_ASSERT(_type < TRANSFORM_TYPE_COUNT);
+    fog_api.transformd_mapPointsAndBoxF[_type](this, dst, src, count, &box);
+  }
+
+  FOG_INLINE void _mapPointsAndBox(PointD* dst, const PointD* src, size_t count, BoxD& box) const
+  {
+    FOG_ASSERT(_type < TRANSFORM_TYPE_COUNT);
+    fog_api.transformd_mapPointsAndBoxD[_type](this, dst, src, count, &box);
+  }
+
   FOG_INLINE err_t mapPath(PathD& dst, const PathF& src, uint32_t cntOp = CONTAINER_OP_REPLACE) const
   {
     return fog_api.transformd_mapPathF(this, &dst, &src, cntOp);
@@ -0,0 +1,602 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+#include <Fog/Core/C++/IntrinAvx2.h>
+#include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/G2d/Geometry/Box.h>
+#include <Fog/G2d/Geometry/Point.h>
+#include <Fog/G2d/Geometry/Transform.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::Transform - AVX2 - Ops]
+// ============================================================================
+
+// Each op maps 4 points (float) or 2 points (double) stored in one YMM
+// register, x and y interleaved like in PointF / PointD. The products are
+// accumulated by FMA, so the results can differ from the C kernels in the
+// last bit. The projection uses the same fuzzy-zero rule and the division
+// of the C kernel.
+
+//! @internal
+//!
+//! @brief Masks used to load / store 0 to 3 points (float), the mask of N
+//! points starts at @c TransformAVX2_maskPS[8 - N * 2].
+static const int32_t TransformAVX2_maskPS[16] =
+{
+  -1, -1, -1, -1, -1, -1, -1, -1,
+   0,  0,  0,  0,  0,  0,  0,  0
+};
+
+struct FOG_NO_EXPORT TransformPS_Identity_AVX2
+{
+  FOG_INLINE TransformPS_Identity_AVX2(const TransformF* self) {}
+  FOG_INLINE __m256 map(__m256 p) const { return p; }
+};
+
+struct FOG_NO_EXPORT TransformPS_Translation_AVX2
+{
+  FOG_INLINE TransformPS_Translation_AVX2(const TransformF* self)
+  {
+    m_20_21 = _mm256_setr_ps(self->_20, self->_21, self->_20, self->_21, self->_20, self->_21, self->_20, self->_21);
+  }
+
+  FOG_INLINE __m256 map(__m256 p) const
+  {
+    return _mm256_add_ps(p, m_20_21);
+  }
+
+  __m256 m_20_21;
+};
+
+struct FOG_NO_EXPORT TransformPS_Scaling_AVX2
+{
+  FOG_INLINE TransformPS_Scaling_AVX2(const TransformF* self)
+  {
+    m_00_11 = _mm256_setr_ps(self->_00, self->_11, self->_00, self->_11, self->_00, self->_11, self->_00, self->_11);
+    m_20_21 = _mm256_setr_ps(self->_20, self->_21, self->_20, self->_21, self->_20, self->_21, self->_20, self->_21);
+  }
+
+  FOG_INLINE __m256 map(__m256 p) const
+  {
+    return _mm256_fmadd_ps(p, m_00_11, m_20_21);
+  }
+
+  __m256 m_00_11;
+  __m256 m_20_21;
+};
+
+struct FOG_NO_EXPORT TransformPS_Swap_AVX2
+{
+  FOG_INLINE TransformPS_Swap_AVX2(const TransformF* self)
+  {
+    m_10_01 = _mm256_setr_ps(self->_10, self->_01, self->_10, self->_01, self->_10, self->_01, self->_10, self->_01);
+    m_20_21 = _mm256_setr_ps(self->_20, self->_21, self->_20, self->_21, self->_20, self->_21, self->_20, self->_21);
+  }
+
+  FOG_INLINE __m256 map(__m256 p) const
+  {
+    __m256 rev = _mm256_permute_ps(p, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_fmadd_ps(rev, m_10_01, m_20_21);
+  }
+
+  __m256 m_10_01;
+  __m256 m_20_21;
+};
+
+struct FOG_NO_EXPORT TransformPS_Affine_AVX2
+{
+  FOG_INLINE TransformPS_Affine_AVX2(const TransformF* self)
+  {
+    m_00_11 = _mm256_setr_ps(self->_00, self->_11, self->_00, self->_11, self->_00, self->_11, self->_00, self->_11);
+    m_10_01 = _mm256_setr_ps(self->_10, self->_01, self->_10, self->_01, self->_10, self->_01, self->_10, self->_01);
+    m_20_21 = _mm256_setr_ps(self->_20, self->_21, self->_20, self->_21, self->_20, self->_21, self->_20, self->_21);
+  }
+
+  FOG_INLINE __m256 map(__m256 p) const
+  {
+    // x' = x * _00 + (y * _10 + _20)
+    // y' = y * _11 + (x * _01 + _21)
+    __m256 rev = _mm256_permute_ps(p, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm256_fmadd_ps(p, m_00_11, _mm256_fmadd_ps(rev, m_10_01, m_20_21));
+  }
+
+  __m256 m_00_11;
+  __m256 m_10_01;
+  __m256 m_20_21;
+};
+
+struct FOG_NO_EXPORT TransformPS_Projection_AVX2 : public TransformPS_Affine_AVX2
+{
+  FOG_INLINE TransformPS_Projection_AVX2(const TransformF* self) :
+    TransformPS_Affine_AVX2(self)
+  {
+    m_02_12 = _mm256_setr_ps(self->_02, self->_12, self->_02, self->_12, self->_02, self->_12, self->_02, self->_12);
+    m_22 = _mm256_set1_ps(self->_22);
+  }
+
+  FOG_INLINE __m256 map(__m256 p) const
+  {
+    // w = x * _02 + y * _12 + _22, the same in both x and y lanes.
+    __m256 w = _mm256_mul_ps(p, m_02_12);
+    w = _mm256_add_ps(w, _mm256_permute_ps(w, _MM_SHUFFLE(2, 3, 0, 1)));
+    w = _mm256_add_ps(w, m_22);
+
+    __m256 eps = _mm256_set1_ps(MATH_EPSILON_F);
+    __m256 wAbs = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), w);
+
+    w = _mm256_blendv_ps(w, eps, _mm256_cmp_ps(wAbs, eps, _CMP_LE_OQ));
+    w = _mm256_div_ps(_mm256_set1_ps(1.0f), w);
+
+    return _mm256_mul_ps(TransformPS_Affine_AVX2::map(p), w);
+  }
+
+  __m256 m_02_12;
+  __m256 m_22;
+};
+
+struct FOG_NO_EXPORT TransformPD_Identity_AVX2
+{
+  FOG_INLINE TransformPD_Identity_AVX2(const TransformD* self) {}
+  FOG_INLINE __m256d map(__m256d p) const { return p; }
+};
+
+struct FOG_NO_EXPORT TransformPD_Translation_AVX2
+{
+  FOG_INLINE TransformPD_Translation_AVX2(const TransformD* self)
+  {
+    m_20_21 = _mm256_setr_pd(self->_20, self->_21, self->_20, self->_21);
+  }
+
+  FOG_INLINE __m256d map(__m256d p) const
+  {
+    return _mm256_add_pd(p, m_20_21);
+  }
+
+  __m256d m_20_21;
+};
+
+struct FOG_NO_EXPORT TransformPD_Scaling_AVX2
+{
+  FOG_INLINE TransformPD_Scaling_AVX2(const TransformD* self)
+  {
+    m_00_11 = _mm256_setr_pd(self->_00, self->_11, self->_00, self->_11);
+    m_20_21 = _mm256_setr_pd(self->_20, self->_21, self->_20, self->_21);
+  }
+
+  FOG_INLINE __m256d map(__m256d p) const
+  {
+    return _mm256_fmadd_pd(p, m_00_11, m_20_21);
+  }
+
+  __m256d m_00_11;
+  __m256d m_20_21;
+};
+
+struct FOG_NO_EXPORT TransformPD_Swap_AVX2
+{
+  FOG_INLINE TransformPD_Swap_AVX2(const TransformD* self)
+  {
+    m_10_01 = _mm256_setr_pd(self->_10, self->_01, self->_10, self->_01);
+    m_20_21 = _mm256_setr_pd(self->_20, self->_21, self->_20, self->_21);
+  }
+
+  FOG_INLINE __m256d map(__m256d p) const
+  {
+    __m256d rev = _mm256_permute_pd(p, 0x5);
+    return _mm256_fmadd_pd(rev, m_10_01, m_20_21);
+  }
+
+  __m256d m_10_01;
+  __m256d m_20_21;
+};
+
+struct FOG_NO_EXPORT TransformPD_Affine_AVX2
+{
+  FOG_INLINE TransformPD_Affine_AVX2(const TransformD* self)
+  {
+    m_00_11 = _mm256_setr_pd(self->_00, self->_11, self->_00, self->_11);
+    m_10_01 = _mm256_setr_pd(self->_10, self->_01, self->_10, self->_01);
+    m_20_21 = _mm256_setr_pd(self->_20, self->_21, self->_20, self->_21);
+  }
+
+  FOG_INLINE __m256d map(__m256d p) const
+  {
+    __m256d rev = _mm256_permute_pd(p, 0x5);
+    return _mm256_fmadd_pd(p, m_00_11, _mm256_fmadd_pd(rev, m_10_01, m_20_21));
+  }
+
+  __m256d m_00_11;
+  __m256d m_10_01;
+  __m256d m_20_21;
+};
+
+struct FOG_NO_EXPORT TransformPD_Projection_AVX2 : public TransformPD_Affine_AVX2
+{
+  FOG_INLINE TransformPD_Projection_AVX2(const TransformD* self) :
+    TransformPD_Affine_AVX2(self)
+  {
+    m_02_12 = _mm256_setr_pd(self->_02, self->_12, self->_02, self->_12);
+    m_22 = _mm256_set1_pd(self->_22);
+  }
+
+  FOG_INLINE __m256d map(__m256d p) const
+  {
+    __m256d w = _mm256_mul_pd(p, m_02_12);
+    w = _mm256_add_pd(w, _mm256_permute_pd(w, 0x5));
+    w = _mm256_add_pd(w, m_22);
+
+    __m256d eps = _mm256_set1_pd(MATH_EPSILON_D);
+    __m256d wAbs = _mm256_andnot_pd(_mm256_set1_pd(-0.0), w);
+
+    w = _mm256_blendv_pd(w, eps, _mm256_cmp_pd(wAbs, eps, _CMP_LE_OQ));
+    w = _mm256_div_pd(_mm256_set1_pd(1.0), w);
+
+    return _mm256_mul_pd(TransformPD_Affine_AVX2::map(p), w);
+  }
+
+  __m256d m_02_12;
+  __m256d m_22;
+};
+
+// ============================================================================
+// [Fog::Transform - AVX2 - Helpers]
+// ============================================================================
+
+static FOG_INLINE __m256d TransformAVX2_loadPD_1x(const PointD* src)
+{
+  return _mm256_insertf128_pd(_mm256_setzero_pd(), _mm_loadu_pd(&src->x), 0);
+}
+
+static FOG_INLINE __m256d TransformAVX2_loadPD_2xF(const PointF* src)
+{
+  return _mm256_cvtps_pd(_mm_loadu_ps(&src->x));
+}
+
+static FOG_INLINE __m256d TransformAVX2_loadPD_1xF(const PointF* src)
+{
+  return _mm256_cvtps_pd(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(src))));
+}
+
+static FOG_INLINE void TransformAVX2_storePD_1x(PointD* dst, __m256d p)
+{
+  _mm_storeu_pd(&dst->x, _mm256_castpd256_pd128(p));
+}
+
+// Points mapped to NaN are ignored by min/max, because the second operand is
+// returned if any of the operands is NaN.
+static FOG_INLINE void TransformAVX2_boxPS(__m256& mn, __m256& mx, __m256 p)
+{
+  mn = _mm256_min_ps(p, mn);
+  mx = _mm256_max_ps(p, mx);
+}
+
+static FOG_INLINE void TransformAVX2_boxPD(__m256d& mn, __m256d& mx, __m256d p)
+{
+  mn = _mm256_min_pd(p, mn);
+  mx = _mm256_max_pd(p, mx);
+}
+
+static FOG_INLINE void TransformAVX2_storeBoxPS(BoxF* box, __m256 mn, __m256 mx)
+{
+  __m128 mn4 = _mm_min_ps(_mm256_castps256_ps128(mn), _mm256_extractf128_ps(mn, 1));
+  __m128 mx4 = _mm_max_ps(_mm256_castps256_ps128(mx), _mm256_extractf128_ps(mx, 1));
+
+  mn4 = _mm_min_ps(mn4, _mm_movehl_ps(mn4, mn4));
+  mx4 = _mm_max_ps(mx4, _mm_movehl_ps(mx4, mx4));
+
+  _mm_storel_pi(reinterpret_cast<__m64*>(&box->x0), mn4);
+  _mm_storel_pi(reinterpret_cast<__m64*>(&box->x1), mx4);
+}
+
+static FOG_INLINE void TransformAVX2_storeBoxPD(BoxD* box, __m256d mn, __m256d mx)
+{
+  __m128d mn2 = _mm_min_pd(_mm256_castpd256_pd128(mn), _mm256_extractf128_pd(mn, 1));
+  __m128d mx2 = _mm_max_pd(_mm256_castpd256_pd128(mx), _mm256_extractf128_pd(mx, 1));
+
+  _mm_storeu_pd(&box->x0, mn2);
+  _mm_storeu_pd(&box->x1, mx2);
+}
+
+// ============================================================================
+// [Fog::Transform - AVX2 - MapPoints]
+// ============================================================================
+
+template<typename OpT>
+static void FOG_CDECL TransformF_mapPointsF_AVX2(const TransformF* self, PointF* dst, const PointF* src, size_t length)
+{
+  OpT op(self);
+  size_t i;
+
+  for (i = length >> 3; i; i--, dst += 8, src += 8)
+  {
+    __m256 src0 = _mm256_loadu_ps(&src[0].x);
+    __m256 src1 = _mm256_loadu_ps(&src[4].x);
+
+    _mm256_storeu_ps(&dst[0].x, op.map(src0));
+    _mm256_storeu_ps(&dst[4].x, op.map(src1));
+  }
+
+  if (length & 4)
+  {
+    __m256 src0 = _mm256_loadu_ps(&src[0].x);
+    _mm256_storeu_ps(&dst[0].x, op.map(src0));
+
+    dst += 4;
+    src += 4;
+  }
+
+  i = length & 3;
+  if (i)
+  {
+    __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&TransformAVX2_maskPS[8 - i * 2]));
+
+    __m256 src0 = _mm256_maskload_ps(&src[0].x, mask);
+    _mm256_maskstore_ps(&dst[0].x, mask, op.map(src0));
+  }
+}
+
+template<typename OpT>
+static void FOG_CDECL TransformD_mapPointsF_AVX2(const TransformD* self, PointD* dst, const PointF* src, size_t length)
+{
+  OpT op(self);
+  size_t i;
+
+  for (i = length >> 2; i; i--, dst += 4, src += 4)
+  {
+    __m256d src0 = TransformAVX2_loadPD_2xF(&src[0]);
+    __m256d src1 = TransformAVX2_loadPD_2xF(&src[2]);
+
+    _mm256_storeu_pd(&dst[0].x, op.map(src0));
+    _mm256_storeu_pd(&dst[2].x, op.map(src1));
+  }
+
+  if (length & 2)
+  {
+    __m256d src0 = TransformAVX2_loadPD_2xF(&src[0]);
+    _mm256_storeu_pd(&dst[0].x, op.map(src0));
+
+    dst += 2;
+    src += 2;
+  }
+
+  if (length & 1)
+  {
+    __m256d src0 = TransformAVX2_loadPD_1xF(&src[0]);
+    TransformAVX2_storePD_1x(&dst[0], op.map(src0));
+  }
+}
+
+template<typename OpT>
+static void FOG_CDECL TransformD_mapPointsD_AVX2(const TransformD* self, PointD* dst, const PointD* src, size_t length)
+{
+  OpT op(self);
+  size_t i;
+
+  for (i = length >> 2; i; i--, dst += 4, src += 4)
+  {
+    __m256d src0 = _mm256_loadu_pd(&src[0].x);
+    __m256d src1 = _mm256_loadu_pd(&src[2].x);
+
+    _mm256_storeu_pd(&dst[0].x, op.map(src0));
+    _mm256_storeu_pd(&dst[2].x, op.map(src1));
+  }
+
+  if (length & 2)
+  {
+    __m256d src0 = _mm256_loadu_pd(&src[0].x);
+    _mm256_storeu_pd(&dst[0].x, op.map(src0));
+
+    dst += 2;
+    src += 2;
+  }
+
+  if (length & 1)
+  {
+    __m256d src0 = TransformAVX2_loadPD_1x(&src[0]);
+    TransformAVX2_storePD_1x(&dst[0], op.map(src0));
+  }
+}
+
+// ============================================================================
+// [Fog::Transform - AVX2 - MapPointsAndBox]
+// ============================================================================
+
+template<typename OpT>
+static void FOG_CDECL TransformF_mapPointsAndBoxF_AVX2(const TransformF* self, PointF* dst, const PointF* src, size_t length, BoxF* box)
+{
+  OpT op(self);
+  size_t i;
+
+  __m256 mn = _mm256_set1_ps(Math::getPInfF());
+  __m256 mx = _mm256_set1_ps(Math::getNInfF());
+
+  for (i = length >> 3; i; i--, dst += 8, src += 8)
+  {
+    __m256 dst0 = op.map(_mm256_loadu_ps(&src[0].x));
+    __m256 dst1 = op.map(_mm256_loadu_ps(&src[4].x));
+
+    _mm256_storeu_ps(&dst[0].x, dst0);
+    _mm256_storeu_ps(&dst[4].x, dst1);
+
+    TransformAVX2_boxPS(mn, mx, dst0);
+    TransformAVX2_boxPS(mn, mx, dst1);
+  }
+
+  if (length & 4)
+  {
+    __m256 dst0 = op.map(_mm256_loadu_ps(&src[0].x));
+    _mm256_storeu_ps(&dst[0].x, dst0);
+    TransformAVX2_boxPS(mn, mx, dst0);
+
+    dst += 4;
+    src += 4;
+  }
+
+  i = length & 3;
+  if (i)
+  {
+    __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&TransformAVX2_maskPS[8 - i * 2]));
+    __m256 dst0 = op.map(_mm256_maskload_ps(&src[0].x, mask));
+
+    _mm256_maskstore_ps(&dst[0].x, mask, dst0);
+
+    // Unused lanes are replaced by NaN to be ignored by the bounding-box.
+    dst0 = _mm256_blendv_ps(_mm256_set1_ps(Math::getQNanF()), dst0, _mm256_castsi256_ps(mask));
+    TransformAVX2_boxPS(mn, mx, dst0);
+  }
+
+  TransformAVX2_storeBoxPS(box, mn, mx);
+}
+
+template<typename OpT>
+static void FOG_CDECL TransformD_mapPointsAndBoxF_AVX2(const TransformD* self, PointD* dst, const PointF* src, size_t length, BoxD* box)
+{
+  OpT op(self);
+  size_t i;
+
+  __m256d mn = _mm256_set1_pd(Math::getPInfD());
+  __m256d mx = _mm256_set1_pd(Math::getNInfD());
+
+  for (i = length >> 2; i; i--, dst += 4, src += 4)
+  {
+    __m256d dst0 = op.map(TransformAVX2_loadPD_2xF(&src[0]));
+    __m256d dst1 = op.map(TransformAVX2_loadPD_2xF(&src[2]));
+
+    _mm256_storeu_pd(&dst[0].x, dst0);
+    _mm256_storeu_pd(&dst[2].x, dst1);
+
+    TransformAVX2_boxPD(mn, mx, dst0);
+    TransformAVX2_boxPD(mn, mx, dst1);
+  }
+
+  if (length & 2)
+  {
+    __m256d dst0 = op.map(TransformAVX2_loadPD_2xF(&src[0]));
+    _mm256_storeu_pd(&dst[0].x, dst0);
+    TransformAVX2_boxPD(mn, mx, dst0);
+
+    dst += 2;
+    src += 2;
+  }
+
+  if (length & 1)
+  {
+    __m256d dst0 = op.map(TransformAVX2_loadPD_1xF(&src[0]));
+    TransformAVX2_storePD_1x(&dst[0], dst0);
+
+    dst0 = _mm256_blend_pd(dst0, _mm256_set1_pd(Math::getQNanD()), 0xC);
+    TransformAVX2_boxPD(mn, mx, dst0);
+  }
+
+  TransformAVX2_storeBoxPD(box, mn, mx);
+}
+
+template<typename OpT>
+static void FOG_CDECL TransformD_mapPointsAndBoxD_AVX2(const TransformD* self, PointD* dst, const PointD* src, size_t length, BoxD* box)
+{
+  OpT op(self);
+  size_t i;
+
+  __m256d mn = _mm256_set1_pd(Math::getPInfD());
+  __m256d mx = _mm256_set1_pd(Math::getNInfD());
+
+  for (i = length >> 2; i; i--, dst += 4, src += 4)
+  {
+    __m256d dst0 = op.map(_mm256_loadu_pd(&src[0].x));
+    __m256d dst1 = op.map(_mm256_loadu_pd(&src[2].x));
+
+    _mm256_storeu_pd(&dst[0].x, dst0);
+    _mm256_storeu_pd(&dst[2].x, dst1);
+
+    TransformAVX2_boxPD(mn, mx, dst0);
+    TransformAVX2_boxPD(mn, mx, dst1);
+  }
+
+  if (length & 2)
+  {
+    __m256d dst0 = op.map(_mm256_loadu_pd(&src[0].x));
+    _mm256_storeu_pd(&dst[0].x, dst0);
+    TransformAVX2_boxPD(mn, mx, dst0);
+
+    dst += 2;
+    src += 2;
+  }
+
+  if (length & 1)
+  {
+    __m256d dst0 = op.map(TransformAVX2_loadPD_1x(&src[0]));
+    TransformAVX2_storePD_1x(&dst[0], dst0);
+
+    dst0 = _mm256_blend_pd(dst0, _mm256_set1_pd(Math::getQNanD()), 0xC);
+    TransformAVX2_boxPD(mn, mx, dst0);
+  }
+
+  TransformAVX2_storeBoxPD(box, mn, mx);
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void Transform_init_AVX2(void)
+{
+  // Identity is not overridden, except the float to double conversion. The
+  // degenerate transform is not overridden at all.
+  fog_api.transformf_mapPointsF[TRANSFORM_TYPE_TRANSLATION] = TransformF_mapPointsF_AVX2<TransformPS_Translation_AVX2>;
+  fog_api.transformf_mapPointsF[TRANSFORM_TYPE_SCALING    ] = TransformF_mapPointsF_AVX2<TransformPS_Scaling_AVX2>;
+  fog_api.transformf_mapPointsF[TRANSFORM_TYPE_SWAP       ] = TransformF_mapPointsF_AVX2<TransformPS_Swap_AVX2>;
+  fog_api.transformf_mapPointsF[TRANSFORM_TYPE_ROTATION   ] = TransformF_mapPointsF_AVX2<TransformPS_Affine_AVX2>;
+  fog_api.transformf_mapPointsF[TRANSFORM_TYPE_AFFINE     ] = TransformF_mapPointsF_AVX2<TransformPS_Affine_AVX2>;
+  fog_api.transformf_mapPointsF[TRANSFORM_TYPE_PROJECTION ] = TransformF_mapPointsF_AVX2<TransformPS_Projection_AVX2>;
+
+  fog_api.transformd_mapPointsF[TRANSFORM_TYPE_IDENTITY   ] = TransformD_mapPointsF_AVX2<TransformPD_Identity_AVX2>;
+  fog_api.transformd_mapPointsF[TRANSFORM_TYPE_TRANSLATION] = TransformD_mapPointsF_AVX2<TransformPD_Translation_AVX2>;
+  fog_api.transformd_mapPointsF[TRANSFORM_TYPE_SCALING    ] = TransformD_mapPointsF_AVX2<TransformPD_Scaling_AVX2>;
+  fog_api.transformd_mapPointsF[TRANSFORM_TYPE_SWAP       ] = TransformD_mapPointsF_AVX2<TransformPD_Swap_AVX2>;
+  fog_api.transformd_mapPointsF[TRANSFORM_TYPE_ROTATION   ] = TransformD_mapPointsF_AVX2<TransformPD_Affine_AVX2>;
+  fog_api.transformd_mapPointsF[TRANSFORM_TYPE_AFFINE     ] = TransformD_mapPointsF_AVX2<TransformPD_Affine_AVX2>;
+  fog_api.transformd_mapPointsF[TRANSFORM_TYPE_PROJECTION ] = TransformD_mapPointsF_AVX2<TransformPD_Projection_AVX2>;
+
+  fog_api.transformd_mapPointsD[TRANSFORM_TYPE_TRANSLATION] = TransformD_mapPointsD_AVX2<TransformPD_Translation_AVX2>;
+  fog_api.transformd_mapPointsD[TRANSFORM_TYPE_SCALING    ] = TransformD_mapPointsD_AVX2<TransformPD_Scaling_AVX2>;
+  fog_api.transformd_mapPointsD[TRANSFORM_TYPE_SWAP       ] = TransformD_mapPointsD_AVX2<TransformPD_Swap_AVX2>;
+  fog_api.transformd_mapPointsD[TRANSFORM_TYPE_ROTATION   ] = TransformD_mapPointsD_AVX2<TransformPD_Affine_AVX2>;
+  fog_api.transformd_mapPointsD[TRANSFORM_TYPE_AFFINE     ] = TransformD_mapPointsD_AVX2<TransformPD_Affine_AVX2>;
+  fog_api.transformd_mapPointsD[TRANSFORM_TYPE_PROJECTION ] = TransformD_mapPointsD_AVX2<TransformPD_Projection_AVX2>;
+
+  fog_api.transformf_mapPointsAndBoxF[TRANSFORM_TYPE_IDENTITY   ] = TransformF_mapPointsAndBoxF_AVX2<TransformPS_Identity_AVX2>;
+  fog_api.transformf_mapPointsAndBoxF[TRANSFORM_TYPE_TRANSLATION] = TransformF_mapPointsAndBoxF_AVX2<TransformPS_Translation_AVX2>;
+  fog_api.transformf_mapPointsAndBoxF[TRANSFORM_TYPE_SCALING    ] = TransformF_mapPointsAndBoxF_AVX2<TransformPS_Scaling_AVX2>;
+  fog_api.transformf_mapPointsAndBoxF[TRANSFORM_TYPE_SWAP       ] = TransformF_mapPointsAndBoxF_AVX2<TransformPS_Swap_AVX2>;
+  fog_api.transformf_mapPointsAndBoxF[TRANSFORM_TYPE_ROTATION   ] = TransformF_mapPointsAndBoxF_AVX2<TransformPS_Affine_AVX2>;
+  fog_api.transformf_mapPointsAndBoxF[TRANSFORM_TYPE_AFFINE     ] = TransformF_mapPointsAndBoxF_AVX2<TransformPS_Affine_AVX2>;
+  fog_api.transformf_mapPointsAndBoxF[TRANSFORM_TYPE_PROJECTION ] = TransformF_mapPointsAndBoxF_AVX2<TransformPS_Projection_AVX2>;
+
+  fog_api.transformd_mapPointsAndBoxF[TRANSFORM_TYPE_IDENTITY   ] = TransformD_mapPointsAndBoxF_AVX2<TransformPD_Identity_AVX2>;
+  fog_api.transformd_mapPointsAndBoxF[TRANSFORM_TYPE_TRANSLATION] = TransformD_mapPointsAndBoxF_AVX2<TransformPD_Translation_AVX2>;
+  fog_api.transformd_mapPointsAndBoxF[TRANSFORM_TYPE_SCALING    ] = TransformD_mapPointsAndBoxF_AVX2<TransformPD_Scaling_AVX2>;
+  fog_api.transformd_mapPointsAndBoxF[TRANSFORM_TYPE_SWAP       ] = TransformD_mapPointsAndBoxF_AVX2<TransformPD_Swap_AVX2>;
+  fog_api.transformd_mapPointsAndBoxF[TRANSFORM_TYPE_ROTATION   ] = TransformD_mapPointsAndBoxF_AVX2<TransformPD_Affine_AVX2>;
+  fog_api.transformd_mapPointsAndBoxF[TRANSFORM_TYPE_AFFINE     ] = TransformD_mapPointsAndBoxF_AVX2<TransformPD_Affine_AVX2>;
+  fog_api.transformd_mapPointsAndBoxF[TRANSFORM_TYPE_PROJECTION ] = TransformD_mapPointsAndBoxF_AVX2<TransformPD_Projection_AVX2>;
+
+  fog_api.transformd_mapPointsAndBoxD[TRANSFORM_TYPE_IDENTITY   ] = TransformD_mapPointsAndBoxD_AVX2<TransformPD_Identity_AVX2>;
+  fog_api.transformd_mapPointsAndBoxD[TRANSFORM_TYPE_TRANSLATION] = TransformD_mapPointsAndBoxD_AVX2<TransformPD_Translation_AVX2>;
+  fog_api.transformd_mapPointsAndBoxD[TRANSFORM_TYPE_SCALING    ] = TransformD_mapPointsAndBoxD_AVX2<TransformPD_Scaling_AVX2>;
+  fog_api.transformd_mapPointsAndBoxD[TRANSFORM_TYPE_SWAP       ] = TransformD_mapPointsAndBoxD_AVX2<TransformPD_Swap_AVX2>;
+  fog_api.transformd_mapPointsAndBoxD[TRANSFORM_TYPE_ROTATION   ] = TransformD_mapPointsAndBoxD_AVX2<TransformPD_Affine_AVX2>;
+  fog_api.transformd_mapPointsAndBoxD[TRANSFORM_TYPE_AFFINE     ] = TransformD_mapPointsAndBoxD_AVX2<TransformPD_Affine_AVX2>;
+  fog_api.transformd_mapPointsAndBoxD[TRANSFORM_TYPE_PROJECTION ] = TransformD_mapPointsAndBoxD_AVX2<TransformPD_Projection_AVX2>;
+}
+
+} // Fog namespace
@@ -554,20 +554,29 @@ err_t BmpDecoder::readImage(Image& image)
 
   else if (_depth == 4 && bmpCompression == BMP_BI_RLE4)
   {
-    uint8_t* rleCur;
-    uint8_t* rleEnd;
+    const uint8_t* rleCur;
+    const uint8_t* rleEnd;
     uint8_t b0;
     uint8_t b1;
 
-    rleBuffer = reinterpret_cast<uint8_t*>(rleBufferStorage.alloc(bmpImageSize));
-    if (FOG_IS_NULL(rleBuffer))
-      goto _OutOfMemory;
+    // Decode directly from the stream data if they are in memory already.
+    if (_stream.peek(&rleCur, bmpImageSize) == bmpImageSize)
+    {
+      _stream.skip(bmpImageSize);
+    }
+    else
+    {
+      rleBuffer = reinterpret_cast<uint8_t*>(rleBufferStorage.alloc(bmpImageSize));
+      if (FOG_IS_NULL(rleBuffer))
+        goto _OutOfMemory;
 
-    if (_stream.read(rleBuffer, bmpImageSize) != bmpImageSize)
-      goto _Truncated;
+      if (_stream.read(rleBuffer, bmpImageSize) != bmpImageSize)
+        goto _Truncated;
+
+      rleCur = rleBuffer;
+    }
 
-    rleCur = rleBuffer;
-    rleEnd = rleBuffer + bmpImageSize;
+    rleEnd = rleCur + bmpImageSize;
 
 _Rle4Start:
     if (x >= (uint32_t)_size.w || y >= (uint32_t)_size.h) goto _RleError;
@@ -622,7 +631,7 @@ _Rle4Start:
           // FILL BITS (b1 == length).
           default:
           {
-            uint8_t* backup = rleCur;
+            const uint8_t* backup = rleCur;
             i = Math::min<uint32_t>(b1, _size.w - x);
 
             if (rleCur + ((b1 + 1) >> 1) > rleEnd)
@@ -696,19 +705,28 @@ _Rle4Start:
 
   else if (_depth == 8 && bmpCompression == BMP_BI_RLE8)
   {
-    uint8_t* rleCur;
-    uint8_t* rleEnd;
+    const uint8_t* rleCur;
+    const uint8_t* rleEnd;
     uint8_t b0;
     uint8_t b1;
 
-    if ((rleBuffer = (uint8_t *)rleBufferStorage.alloc(bmpImageSize)) == NULL)
-      goto _OutOfMemory;
+    // Decode directly from the stream data if they are in memory already.
+    if (_stream.peek(&rleCur, bmpImageSize) == bmpImageSize)
+    {
+      _stream.skip(bmpImageSize);
+    }
+    else
+    {
+      if ((rleBuffer = (uint8_t *)rleBufferStorage.alloc(bmpImageSize)) == NULL)
+        goto _OutOfMemory;
 
-    if (_stream.read(rleBuffer, bmpImageSize) != bmpImageSize)
-      goto _Truncated;
+      if (_stream.read(rleBuffer, bmpImageSize) != bmpImageSize)
+        goto _Truncated;
+
+      rleCur = rleBuffer;
+    }
 
-    rleCur = rleBuffer;
-    rleEnd = rleBuffer + bmpImageSize;
+    rleEnd = rleCur + bmpImageSize;
 
 _Rle8Start:
     if (x >= (uint32_t)_size.w || y >= (uint32_t)_size.h)
@@ -759,7 +777,7 @@ _Rle8Start:
           // FILL BITS (b1 == length).
           default:
           {
-            uint8_t* backup = rleCur;
+            const uint8_t* backup = rleCur;
 
             i = Math::min<uint32_t>(b1, _size.w - x);
             if (rleCur + b1 > rleEnd)
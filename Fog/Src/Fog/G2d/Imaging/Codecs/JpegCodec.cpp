@@ -203,6 +203,12 @@ struct MyJpegSourceMgr
 {
   struct jpeg_source_mgr pub;
   Stream* stream;
+
+  // Stream data if the stream is memory based (zero-copy), otherwise NULL
+  // and the data are read into the buffer.
+  const uint8_t* mapped;
+  size_t mappedSize;
+
   uint8_t buffer[INPUT_BUFFER_SIZE];
 };
 
@@ -217,10 +223,13 @@ static void FOG_CDECL MyJpegInitSource(j_decompress_ptr cinfo)
 static boolean FOG_CDECL MyJpegFillInputBuffer(j_decompress_ptr cinfo)
 {
   MyJpegSourceMgr* src = (MyJpegSourceMgr*)cinfo->src;
-  size_t nbytes;
+  size_t nbytes = 0;
+
+  // The whole stream was given to libjpeg at once when mapped.
+  if (src->mapped == NULL)
+    nbytes = src->stream->read(src->buffer, INPUT_BUFFER_SIZE);
 
-  nbytes = src->stream->read(src->buffer, INPUT_BUFFER_SIZE);
-  if (nbytes <= 0)
+  if (nbytes == 0 || nbytes == (size_t)-1)
   {
     // insert a fake EOI marker
     src->buffer[0] = (JOCTET)0xFF;
@@ -247,18 +256,30 @@ static boolean FOG_CDECL MyJpegFillInputBuffer(j_decompress_ptr cinfo)
 static void FOG_CDECL MyJpegSkipInputData(j_decompress_ptr cinfo, long num_bytes)
 {
   MyJpegSourceMgr* src = (MyJpegSourceMgr*) cinfo->src;
-  ssize_t remain = (ssize_t)( (uint8_t *)src->buffer + INPUT_BUFFER_SIZE - (uint8_t*)src->pub.next_input_byte );
+  size_t remain = src->pub.bytes_in_buffer;
 
-  if (num_bytes < remain)
+  if (num_bytes <= 0)
+    return;
+
+  if ((size_t)num_bytes <= remain)
   {
     src->pub.next_input_byte += num_bytes;
     src->pub.bytes_in_buffer -= num_bytes;
   }
+  else if (src->mapped != NULL)
+  {
+    // Skipped past the end of the data, fill_input_buffer() inserts EOI.
+    src->pub.next_input_byte += remain;
+    src->pub.bytes_in_buffer = 0;
+  }
   else
   {
-    src->stream->seek(num_bytes - remain, STREAM_SEEK_CUR);
+    src->stream->skip((size_t)num_bytes - remain);
 
     size_t nbytes = src->stream->read(src->buffer, INPUT_BUFFER_SIZE);
+    if (nbytes == (size_t)-1)
+      nbytes = 0;
+
     src->pub.next_input_byte = src->buffer;
     src->pub.bytes_in_buffer = nbytes;
   }
@@ -272,6 +293,50 @@ static void FOG_CDECL MyJpegTermSource(j_decompress_ptr cinfo)
   return;
 }
 
+static void MyJpegSetupSource(MyJpegSourceMgr* src, JpegLibrary& jpeg, Stream* stream)
+{
+  src->pub.init_source = MyJpegInitSource;
+  src->pub.fill_input_buffer = MyJpegFillInputBuffer;
+  src->pub.skip_input_data = MyJpegSkipInputData;
+  src->pub.resync_to_restart = jpeg.resync_to_restart;
+  src->pub.term_source = MyJpegTermSource;
+  src->pub.next_input_byte = src->buffer;
+  src->pub.bytes_in_buffer = 0;
+
+  src->stream = stream;
+  src->mapped = NULL;
+  src->mappedSize = 0;
+
+  // Memory based stream (mmap, buffer) can be passed to libjpeg directly.
+  size_t size;
+  const uint8_t* data = stream->getMappedData(&size);
+  int64_t pos = stream->tell();
+
+  if (data != NULL && pos >= 0 && (uint64_t)pos <= (uint64_t)size)
+  {
+    src->mapped = data + (size_t)pos;
+    src->mappedSize = size - (size_t)pos;
+
+    src->pub.next_input_byte = src->mapped;
+    src->pub.bytes_in_buffer = src->mappedSize;
+  }
+}
+
+// Advance the mapped stream by the count of bytes consumed by libjpeg.
+static void MyJpegSyncSource(MyJpegSourceMgr* src)
+{
+  if (src->mapped == NULL)
+    return;
+
+  const uint8_t* p = src->pub.next_input_byte;
+  size_t consumed = src->mappedSize;
+
+  if (p >= src->mapped && p <= src->mapped + src->mappedSize)
+    consumed = (size_t)(p - src->mapped);
+
+  src->stream->skip(consumed);
+}
+
 struct MyJpegErrorMgr
 {
   struct jpeg_error_mgr errmgr;
@@ -330,14 +395,7 @@ err_t JpegDecoder::readHeader()
   jpeg.create_decompress(&cinfo, /* version */ 62, sizeof(struct jpeg_decompress_struct));
 
   cinfo.src = (struct jpeg_source_mgr *)&srcmgr;
-  srcmgr.pub.init_source = MyJpegInitSource;
-  srcmgr.pub.fill_input_buffer = MyJpegFillInputBuffer;
-  srcmgr.pub.skip_input_data = MyJpegSkipInputData;
-  srcmgr.pub.resync_to_restart = jpeg.resync_to_restart;
-  srcmgr.pub.term_source = MyJpegTermSource;
-  srcmgr.pub.next_input_byte = srcmgr.buffer;
-  srcmgr.pub.bytes_in_buffer = 0;
-  srcmgr.stream = &_stream;
+  MyJpegSetupSource(&srcmgr, jpeg, &_stream);
 
   jpeg.read_header(&cinfo, true);
   jpeg.calc_output_dimensions(&cinfo);
@@ -405,14 +463,7 @@ err_t JpegDecoder::readImage(Image& image)
   jpeg.create_decompress(&cinfo, JPEG_LIB_VERSION, sizeof(struct jpeg_decompress_struct));
 
   cinfo.src = (struct jpeg_source_mgr *)&srcmgr;
-  srcmgr.pub.init_source = MyJpegInitSource;
-  srcmgr.pub.fill_input_buffer = MyJpegFillInputBuffer;
-  srcmgr.pub.skip_input_data = MyJpegSkipInputData;
-  srcmgr.pub.resync_to_restart = jpeg.resync_to_restart;
-  srcmgr.pub.term_source = MyJpegTermSource;
-  srcmgr.pub.next_input_byte = srcmgr.buffer;
-  srcmgr.pub.bytes_in_buffer = 0;
-  srcmgr.stream = &_stream;
+  MyJpegSetupSource(&srcmgr, jpeg, &_stream);
 
   jpeg.read_header(&cinfo, true);
   jpeg.calc_output_dimensions(&cinfo);
@@ -510,6 +561,7 @@ err_t JpegDecoder::readImage(Image& image)
   }
 
   jpeg.finish_decompress(&cinfo);
+  MyJpegSyncSource(&srcmgr);
 
 _End:
   jpeg.destroy_decompress(&cinfo);
@@ -27,6 +27,16 @@ struct FOG_NO_EXPORT FeBase
 
   FOG_INLINE uint32_t getFeType() const { return _feType; }
 
+  //! @brief Get the horizontal and vertical distance (in pixels, unscaled) of
+  //! the source pixels used to calculate a destination pixel.
+  //!
+  //! The area affected by the filter is the filtered area extended by these
+  //! extents. Color filters and generators don't have extents.
+  FOG_INLINE void getExtents(PointF& extents) const
+  {
+    fog_api.febase_getExtents(this, &extents);
+  }
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 #include <Fog/G2d/Acc/AccC.h>
 #include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Imaging/ImageBits.h>
+#include <Fog/G2d/Imaging/ImageBufferPool.h>
 #include <Fog/G2d/Imaging/ImageCodec.h>
 #include <Fog/G2d/Imaging/ImageCodecProvider.h>
 #include <Fog/G2d/Imaging/ImageConverter.h>
@@ -77,11 +78,15 @@ static err_t FOG_CDECL Image_Buffer_create(ImageData** pd, const SizeI* size, ui
   if (stride == 0)
     return ERR_RT_INVALID_ARGUMENT;
 
-  if ((uint)size->h > (SIZE_MAX - sizeof(ImageData) - 16) / stride)
+  // The pixel data follows ImageData, both are allocated by ImageBufferPool,
+  // which returns buffers aligned to IMAGE_BUFFER_POOL_ALIGNMENT.
+  size_t dHeader = (sizeof(ImageData) + IMAGE_BUFFER_POOL_ALIGNMENT - 1) & ~(size_t)(IMAGE_BUFFER_POOL_ALIGNMENT - 1);
+
+  if ((uint)size->h > (SIZE_MAX - dHeader) / stride)
     return ERR_RT_OUT_OF_MEMORY;
 
-  size_t dSize = sizeof(ImageData) + 16 + (size_t)stride * (uint)size->h;
-  ImageData* d = static_cast<ImageData*>(MemMgr::alloc(dSize));
+  size_t dSize = dHeader + (size_t)stride * (uint)size->h;
+  ImageData* d = static_cast<ImageData*>(ImageBufferPool::alloc(dSize));
 
   if (FOG_IS_NULL(d))
     return ERR_RT_OUT_OF_MEMORY;
@@ -100,7 +105,7 @@ static err_t FOG_CDECL Image_Buffer_create(ImageData** pd, const SizeI* size, ui
   FOG_PADDING_ZERO_64(d->padding);
 
   d->stride = stride;
-  d->data = (uint8_t*)( ((size_t)d + sizeof(ImageData) + 15) & ~(size_t)15 );
+  d->data = reinterpret_cast<uint8_t*>(d) + dHeader;
   d->first = d->data;
   d->palette.init();
 
@@ -111,7 +116,12 @@ static err_t FOG_CDECL Image_Buffer_create(ImageData** pd, const SizeI* size, ui
 static void FOG_CDECL Image_Buffer_destroy(ImageData* d)
 {
   d->palette.destroy();
-  MemMgr::free(d);
+
+  // Adopted images don't own the pixel data, only ImageData is allocated.
+  if (d->adopted)
+    MemMgr::free(d);
+  else
+    ImageBufferPool::release(d);
 }
 
 static void* FOG_CDECL Image_Buffer_getHandle(const ImageData* d)
@@ -737,6 +747,7 @@ static err_t FOG_CDECL Image_convertTo8BitDepth(Image* self)
     params.bCount = 6;
     params.transposeTable = NULL;
     params.transposeTableLength = 0;
+    params.ditherType = DITHER_TYPE_PATTERN;
 
     ImageConverter converter;
     FOG_RETURN_ON_ERROR(converter.createDithered8(params,
@@ -716,7 +716,36 @@ struct FOG_NO_EXPORT Image
 #endif // FOG_OS_WINDOWS
 
   // --------------------------------------------------------------------------
-  // [Windows Support]
+  // [Posix Support]
+  // --------------------------------------------------------------------------
+
+#if defined(FOG_OS_POSIX)
+  //! @brief Export the shared memory of @c IMAGE_TYPE_SHARED image.
+  //!
+  //! The file descriptor stored to @a info is a duplicate owned by the caller,
+  //! it should be closed after it was passed to the other process. Use
+  //! @c IMAGE_SHARED_SEAL flag to seal the size of the memory.
+  //!
+  //! @note This function is for POSIX-only.
+  FOG_INLINE err_t exportShared(ImageSharedInfo& info, uint32_t flags = IMAGE_SHARED_NO_FLAGS) const
+  {
+    return fog_api.image_exportShared(this, &info, flags);
+  }
+
+  //! @brief Map the shared memory described by @a info as @c IMAGE_TYPE_SHARED
+  //! image.
+  //!
+  //! The file descriptor is duplicated, the caller keeps its ownership.
+  //!
+  //! @note This function is for POSIX-only.
+  FOG_INLINE err_t importShared(const ImageSharedInfo& info)
+  {
+    return fog_api.image_importShared(this, &info);
+  }
+#endif // FOG_OS_POSIX
+
+  // --------------------------------------------------------------------------
+  // [Mac Support]
   // --------------------------------------------------------------------------
 
 #if defined(FOG_OS_MAC)
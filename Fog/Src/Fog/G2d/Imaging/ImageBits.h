@@ -136,6 +136,88 @@ struct FOG_NO_EXPORT ImageBits
   uint8_t* _data;
 };
 
+// ============================================================================
+// [Fog::ImageSharedInfo]
+// ============================================================================
+
+//! @brief Shared image descriptor.
+//!
+//! Describes the shared memory of @c IMAGE_TYPE_SHARED image - file descriptor
+//! and the image layout. It's filled by @c Image::exportShared() and passed
+//! (together with the file descriptor) to another process, which can map the
+//! image by @c Image::importShared().
+struct FOG_NO_EXPORT ImageSharedInfo
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE ImageSharedInfo() :
+    _size(0, 0),
+    _format(IMAGE_FORMAT_NULL),
+    _fd(-1),
+    _stride(0)
+  {
+  }
+
+  FOG_INLINE ImageSharedInfo(const SizeI& size, uint32_t format, ssize_t stride, int fd) :
+    _size(size),
+    _format(format),
+    _fd(fd),
+    _stride(stride)
+  {
+  }
+
+  explicit FOG_INLINE ImageSharedInfo(_Uninitialized) {}
+
+  // --------------------------------------------------------------------------
+  // [Consistency]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE bool isValid() const
+  {
+    return _size.isValid() &&
+           _fd >= 0 &&
+           _stride > 0 &&
+           _format != IMAGE_FORMAT_NULL &&
+           _format < IMAGE_FORMAT_COUNT;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const SizeI& getSize() const { return _size; }
+  FOG_INLINE uint32_t getFormat() const { return _format; }
+  FOG_INLINE int getFd() const { return _fd; }
+  FOG_INLINE ssize_t getStride() const { return _stride; }
+
+  // --------------------------------------------------------------------------
+  // [Reset]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void reset()
+  {
+    _size.reset();
+    _format = IMAGE_FORMAT_NULL;
+    _fd = -1;
+    _stride = 0;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Image size.
+  SizeI _size;
+  //! @brief Image format.
+  uint32_t _format;
+  //! @brief File descriptor of the shared memory.
+  int _fd;
+  //! @brief Image stride (bytes per line), always positive.
+  ssize_t _stride;
+};
+
 //! @}
 
 } // Fog namespace
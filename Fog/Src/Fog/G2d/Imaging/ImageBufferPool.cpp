@@ -0,0 +1,619 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Threading/Atomic.h>
+#include <Fog/Core/Threading/Lock.h>
+#include <Fog/Core/Threading/ThreadLocal.h>
+#include <Fog/G2d/Imaging/ImageBufferPool.h>
+
+#if defined(FOG_OS_POSIX)
+# include <sys/mman.h>
+#endif // FOG_OS_POSIX
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::ImageBufferPool - Constants]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Size of the smallest size-class (log2).
+#define IMAGE_BUFFER_POOL_MIN_SHIFT 12
+
+//! @internal
+//!
+//! @brief Size-class index used by buffers which are not pooled.
+#define IMAGE_BUFFER_POOL_CLASS_NONE 0xFFFFFFFFU
+
+//! @internal
+//!
+//! @brief Size of the smallest buffer which is backed by huge pages.
+#define IMAGE_BUFFER_POOL_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+// ============================================================================
+// [Fog::ImageBufferPool - Block]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Header stored before each buffer returned by the pool.
+struct FOG_NO_EXPORT ImageBufferBlock
+{
+  //! @brief Link used by size-class lists and thread caches.
+  ImageBufferBlock* next;
+  //! @brief Pointer returned by the system allocator.
+  void* raw;
+  //! @brief Size of the buffer (size-class size).
+  size_t size;
+  //! @brief Size-class index, or @c IMAGE_BUFFER_POOL_CLASS_NONE.
+  uint32_t sizeClass;
+  //! @brief Whether the block was allocated by mmap() (huge pages).
+  uint32_t mapped;
+};
+
+static FOG_INLINE ImageBufferBlock* ImageBufferPool_getBlock(void* p)
+{
+  return reinterpret_cast<ImageBufferBlock*>(
+    reinterpret_cast<uint8_t*>(p) - sizeof(ImageBufferBlock));
+}
+
+static FOG_INLINE void* ImageBufferPool_getData(ImageBufferBlock* block)
+{
+  return reinterpret_cast<uint8_t*>(block) + sizeof(ImageBufferBlock);
+}
+
+// ============================================================================
+// [Fog::ImageBufferPool - ThreadCache]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Per-thread cache of released buffers.
+struct FOG_NO_EXPORT ImageBufferThreadCache
+{
+  ImageBufferBlock* first;
+  size_t bytes;
+};
+
+// ============================================================================
+// [Fog::ImageBufferPool - Global]
+// ============================================================================
+
+static Static<Lock> ImageBufferPool_lock;
+static Static<ThreadLocal> ImageBufferPool_threadCache;
+
+static ImageBufferBlock* ImageBufferPool_classes[IMAGE_BUFFER_POOL_CLASS_COUNT];
+
+static size_t ImageBufferPool_budget;
+static uint32_t ImageBufferPool_flags;
+
+static Atomic<size_t> ImageBufferPool_usedBytes;
+static Atomic<size_t> ImageBufferPool_cachedBytes;
+
+static Atomic<size_t> ImageBufferPool_allocCount;
+static Atomic<size_t> ImageBufferPool_releaseCount;
+static Atomic<size_t> ImageBufferPool_threadHitCount;
+static Atomic<size_t> ImageBufferPool_globalHitCount;
+static Atomic<size_t> ImageBufferPool_missCount;
+static Atomic<size_t> ImageBufferPool_evictCount;
+
+// ============================================================================
+// [Fog::ImageBufferPool - Size Classes]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Get size-class of @a size and round @a size up to the class size.
+//!
+//! There are four classes per each power of two, so the memory wasted by the
+//! rounding is at most 25%. The first class covers all buffers up to 4kB.
+static uint32_t ImageBufferPool_getSizeClass(size_t* size)
+{
+  size_t s = *size;
+
+  if (s <= ((size_t)1 << IMAGE_BUFFER_POOL_MIN_SHIFT))
+  {
+    *size = (size_t)1 << IMAGE_BUFFER_POOL_MIN_SHIFT;
+    return 0;
+  }
+
+  uint32_t k = IMAGE_BUFFER_POOL_MIN_SHIFT;
+  while (k < sizeof(size_t) * 8 - 1 && ((s - 1) >> (k + 1)) != 0)
+    k++;
+
+  uint32_t sizeClass = 1 + (k - IMAGE_BUFFER_POOL_MIN_SHIFT) * 4 + (uint32_t)(((s - 1) >> (k - 2)) & 3);
+  if (sizeClass >= IMAGE_BUFFER_POOL_CLASS_COUNT)
+    return IMAGE_BUFFER_POOL_CLASS_NONE;
+
+  size_t step = (size_t)1 << (k - 2);
+  *size = (s + step - 1) & ~(step - 1);
+  return sizeClass;
+}
+
+// ============================================================================
+// [Fog::ImageBufferPool - System Alloc / Free]
+// ============================================================================
+
+static ImageBufferBlock* ImageBufferPool_sysAlloc(size_t size, uint32_t sizeClass)
+{
+  // Protect against overflow, the header and alignment needs extra space.
+  if (size > SIZE_MAX - 2 * IMAGE_BUFFER_POOL_ALIGNMENT)
+    return NULL;
+
+  size_t rawSize = size + 2 * IMAGE_BUFFER_POOL_ALIGNMENT;
+  uint8_t* raw = NULL;
+  uint32_t mapped = 0;
+
+#if defined(FOG_OS_POSIX) && defined(MADV_HUGEPAGE)
+  if ((ImageBufferPool_flags & IMAGE_BUFFER_POOL_HUGE_PAGES) != 0 &&
+      size >= IMAGE_BUFFER_POOL_HUGE_PAGE_SIZE)
+  {
+    void* p = ::mmap(NULL, rawSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (p != MAP_FAILED)
+    {
+      // Failure of madvise() is not fatal, the buffer is just backed by the
+      // normal pages.
+      ::madvise(p, rawSize, MADV_HUGEPAGE);
+
+      raw = reinterpret_cast<uint8_t*>(p);
+      mapped = 1;
+    }
+  }
+#endif // FOG_OS_POSIX && MADV_HUGEPAGE
+
+  if (raw == NULL)
+  {
+    raw = reinterpret_cast<uint8_t*>(MemMgr::alloc(rawSize));
+    if (FOG_IS_NULL(raw))
+      return NULL;
+  }
+
+  uint8_t* data = reinterpret_cast<uint8_t*>(
+    ((size_t)raw + sizeof(ImageBufferBlock) + IMAGE_BUFFER_POOL_ALIGNMENT - 1) &
+    ~(size_t)(IMAGE_BUFFER_POOL_ALIGNMENT - 1));
+
+  ImageBufferBlock* block = ImageBufferPool_getBlock(data);
+  block->next = NULL;
+  block->raw = raw;
+  block->size = size;
+  block->sizeClass = sizeClass;
+  block->mapped = mapped;
+  return block;
+}
+
+static void ImageBufferPool_sysFree(ImageBufferBlock* block)
+{
+#if defined(FOG_OS_POSIX)
+  if (block->mapped)
+  {
+    ::munmap(block->raw, block->size + 2 * IMAGE_BUFFER_POOL_ALIGNMENT);
+    return;
+  }
+#endif // FOG_OS_POSIX
+
+  MemMgr::free(block->raw);
+}
+
+// ============================================================================
+// [Fog::ImageBufferPool - Global Lists]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Free cached blocks until the pool holds at most @a keepBytes.
+//!
+//! Largest blocks are freed first. Called with the pool lock held, returns a
+//! list of blocks which should be freed after the lock is released.
+static ImageBufferBlock* ImageBufferPool_evictLocked(size_t keepBytes)
+{
+  ImageBufferBlock* evicted = NULL;
+  uint32_t i = IMAGE_BUFFER_POOL_CLASS_COUNT;
+
+  while (i > 0 && ImageBufferPool_cachedBytes.get() > keepBytes)
+  {
+    ImageBufferBlock* block = ImageBufferPool_classes[--i];
+
+    while (block != NULL && ImageBufferPool_cachedBytes.get() > keepBytes)
+    {
+      ImageBufferBlock* next = block->next;
+
+      ImageBufferPool_cachedBytes.sub(block->size);
+      block->next = evicted;
+      evicted = block;
+
+      block = next;
+    }
+
+    ImageBufferPool_classes[i] = block;
+  }
+
+  return evicted;
+}
+
+static void ImageBufferPool_freeList(ImageBufferBlock* block)
+{
+  while (block != NULL)
+  {
+    ImageBufferBlock* next = block->next;
+
+    ImageBufferPool_evictCount.inc();
+    ImageBufferPool_sysFree(block);
+
+    block = next;
+  }
+}
+
+//! @internal
+//!
+//! @brief Return a list of blocks to the global size-class lists.
+static void ImageBufferPool_returnList(ImageBufferBlock* block)
+{
+  ImageBufferBlock* evicted;
+
+  {
+    AutoLock locked(ImageBufferPool_lock);
+
+    while (block != NULL)
+    {
+      ImageBufferBlock* next = block->next;
+
+      block->next = ImageBufferPool_classes[block->sizeClass];
+      ImageBufferPool_classes[block->sizeClass] = block;
+
+      block = next;
+    }
+
+    evicted = ImageBufferPool_evictLocked(ImageBufferPool_budget);
+  }
+
+  ImageBufferPool_freeList(evicted);
+}
+
+// ============================================================================
+// [Fog::ImageBufferPool - ThreadCache]
+// ============================================================================
+
+static void FOG_CDECL ImageBufferPool_threadCacheDestructor(void* value)
+{
+  ImageBufferThreadCache* cache = reinterpret_cast<ImageBufferThreadCache*>(value);
+  if (cache == NULL)
+    return;
+
+  ImageBufferPool_returnList(cache->first);
+  MemMgr::free(cache);
+}
+
+static ImageBufferThreadCache* ImageBufferPool_getThreadCache(bool create)
+{
+  if ((ImageBufferPool_flags & IMAGE_BUFFER_POOL_NO_THREAD_CACHE) != 0)
+    return NULL;
+
+  ImageBufferThreadCache* cache = reinterpret_cast<ImageBufferThreadCache*>(
+    ImageBufferPool_threadCache->get());
+
+  if (cache == NULL && create)
+  {
+    cache = reinterpret_cast<ImageBufferThreadCache*>(
+      MemMgr::alloc(sizeof(ImageBufferThreadCache)));
+
+    if (FOG_IS_NULL(cache))
+      return NULL;
+
+    cache->first = NULL;
+    cache->bytes = 0;
+
+    if (ImageBufferPool_threadCache->set(cache) != ERR_OK)
+    {
+      MemMgr::free(cache);
+      return NULL;
+    }
+  }
+
+  return cache;
+}
+
+// ============================================================================
+// [Fog::ImageBufferPool - Alloc / Release]
+// ============================================================================
+
+static void* FOG_CDECL ImageBufferPool_alloc(size_t size)
+{
+  uint32_t sizeClass = ImageBufferPool_getSizeClass(&size);
+  ImageBufferBlock* block = NULL;
+
+  ImageBufferPool_allocCount.inc();
+
+  if (sizeClass != IMAGE_BUFFER_POOL_CLASS_NONE)
+  {
+    // Try the thread cache first, it's accessed without locking. The cache
+    // is small so the linear search is fine.
+    ImageBufferThreadCache* cache = ImageBufferPool_getThreadCache(false);
+
+    if (cache != NULL)
+    {
+      ImageBufferBlock** pPrev = &cache->first;
+      ImageBufferBlock* cur = cache->first;
+
+      while (cur != NULL)
+      {
+        if (cur->sizeClass == sizeClass)
+        {
+          *pPrev = cur->next;
+          cache->bytes -= cur->size;
+
+          block = cur;
+          ImageBufferPool_threadHitCount.inc();
+          break;
+        }
+
+        pPrev = &cur->next;
+        cur = cur->next;
+      }
+    }
+
+    // The size-class lists are modified by other threads, so they are only
+    // read under the lock.
+    if (block == NULL)
+    {
+      AutoLock locked(ImageBufferPool_lock);
+
+      block = ImageBufferPool_classes[sizeClass];
+      if (block != NULL)
+      {
+        ImageBufferPool_classes[sizeClass] = block->next;
+        ImageBufferPool_globalHitCount.inc();
+      }
+    }
+
+    if (block != NULL)
+      ImageBufferPool_cachedBytes.sub(block->size);
+  }
+
+  if (block == NULL)
+  {
+    block = ImageBufferPool_sysAlloc(size, sizeClass);
+    if (FOG_IS_NULL(block))
+      return NULL;
+
+    ImageBufferPool_missCount.inc();
+  }
+
+  block->next = NULL;
+  ImageBufferPool_usedBytes.add(block->size);
+
+  return ImageBufferPool_getData(block);
+}
+
+static void FOG_CDECL ImageBufferPool_release(void* p)
+{
+  if (p == NULL)
+    return;
+
+  ImageBufferBlock* block = ImageBufferPool_getBlock(p);
+  size_t size = block->size;
+
+  ImageBufferPool_releaseCount.inc();
+  ImageBufferPool_usedBytes.sub(size);
+
+  if (block->sizeClass == IMAGE_BUFFER_POOL_CLASS_NONE || size > ImageBufferPool_budget)
+  {
+    ImageBufferPool_evictCount.inc();
+    ImageBufferPool_sysFree(block);
+    return;
+  }
+
+  ImageBufferPool_cachedBytes.add(size);
+
+  ImageBufferThreadCache* cache = ImageBufferPool_getThreadCache(true);
+  if (cache != NULL && size <= IMAGE_BUFFER_POOL_THREAD_BUDGET)
+  {
+    block->next = cache->first;
+    cache->first = block;
+    cache->bytes += size;
+
+    if (cache->bytes <= IMAGE_BUFFER_POOL_THREAD_BUDGET)
+      return;
+
+    // Thread cache is full, move all but the most recently released block to
+    // the global lists.
+    ImageBufferBlock* rest = block->next;
+
+    block->next = NULL;
+    cache->bytes = size;
+
+    ImageBufferPool_returnList(rest);
+    return;
+  }
+
+  ImageBufferPool_returnList(block);
+}
+
+// ============================================================================
+// [Fog::ImageBufferPool - Trim]
+// ============================================================================
+
+static void FOG_CDECL ImageBufferPool_trim(size_t keepBytes)
+{
+  // Flush the cache of the calling thread, caches of other threads can't be
+  // accessed safely.
+  ImageBufferThreadCache* cache = ImageBufferPool_getThreadCache(false);
+  ImageBufferBlock* evicted;
+
+  {
+    AutoLock locked(ImageBufferPool_lock);
+
+    if (cache != NULL)
+    {
+      ImageBufferBlock* block = cache->first;
+
+      while (block != NULL)
+      {
+        ImageBufferBlock* next = block->next;
+
+        block->next = ImageBufferPool_classes[block->sizeClass];
+        ImageBufferPool_classes[block->sizeClass] = block;
+
+        block = next;
+      }
+
+      cache->first = NULL;
+      cache->bytes = 0;
+    }
+
+    evicted = ImageBufferPool_evictLocked(keepBytes);
+  }
+
+  ImageBufferPool_freeList(evicted);
+}
+
+static void FOG_CDECL ImageBufferPool_cleanupFunc(void* closure, uint32_t reason)
+{
+  FOG_UNUSED(closure);
+  FOG_UNUSED(reason);
+
+  ImageBufferPool_trim(0);
+}
+
+// ============================================================================
+// [Fog::ImageBufferPool - Accessors]
+// ============================================================================
+
+static size_t FOG_CDECL ImageBufferPool_getBudget(void)
+{
+  return ImageBufferPool_budget;
+}
+
+static void FOG_CDECL ImageBufferPool_setBudget(size_t budget)
+{
+  ImageBufferBlock* evicted;
+
+  {
+    AutoLock locked(ImageBufferPool_lock);
+
+    ImageBufferPool_budget = budget;
+    evicted = ImageBufferPool_evictLocked(budget);
+  }
+
+  ImageBufferPool_freeList(evicted);
+}
+
+static uint32_t FOG_CDECL ImageBufferPool_getFlags(void)
+{
+  return ImageBufferPool_flags;
+}
+
+static void FOG_CDECL ImageBufferPool_setFlags(uint32_t flags)
+{
+  // Disabling the thread cache of the calling thread moves its buffers to
+  // the global lists.
+  if ((flags & IMAGE_BUFFER_POOL_NO_THREAD_CACHE) != 0)
+  {
+    ImageBufferThreadCache* cache = ImageBufferPool_getThreadCache(false);
+
+    if (cache != NULL)
+    {
+      ImageBufferBlock* first = cache->first;
+
+      cache->first = NULL;
+      cache->bytes = 0;
+
+      ImageBufferPool_returnList(first);
+    }
+  }
+
+  ImageBufferPool_flags = flags;
+}
+
+// ============================================================================
+// [Fog::ImageBufferPool - Statistics]
+// ============================================================================
+
+static void FOG_CDECL ImageBufferPool_getStats(ImageBufferPoolStats* stats)
+{
+  stats->allocCount = ImageBufferPool_allocCount.get();
+  stats->releaseCount = ImageBufferPool_releaseCount.get();
+
+  stats->threadHitCount = ImageBufferPool_threadHitCount.get();
+  stats->globalHitCount = ImageBufferPool_globalHitCount.get();
+  stats->missCount = ImageBufferPool_missCount.get();
+  stats->evictCount = ImageBufferPool_evictCount.get();
+
+  stats->usedBytes = ImageBufferPool_usedBytes.get();
+  stats->cachedBytes = ImageBufferPool_cachedBytes.get();
+  stats->budget = ImageBufferPool_budget;
+}
+
+static void FOG_CDECL ImageBufferPool_resetStats(void)
+{
+  ImageBufferPool_allocCount.set(0);
+  ImageBufferPool_releaseCount.set(0);
+
+  ImageBufferPool_threadHitCount.set(0);
+  ImageBufferPool_globalHitCount.set(0);
+  ImageBufferPool_missCount.set(0);
+  ImageBufferPool_evictCount.set(0);
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void ImageBufferPool_init(void)
+{
+  fog_api.imagebufferpool_alloc = ImageBufferPool_alloc;
+  fog_api.imagebufferpool_release = ImageBufferPool_release;
+  fog_api.imagebufferpool_trim = ImageBufferPool_trim;
+
+  fog_api.imagebufferpool_getBudget = ImageBufferPool_getBudget;
+  fog_api.imagebufferpool_setBudget = ImageBufferPool_setBudget;
+
+  fog_api.imagebufferpool_getFlags = ImageBufferPool_getFlags;
+  fog_api.imagebufferpool_setFlags = ImageBufferPool_setFlags;
+
+  fog_api.imagebufferpool_getStats = ImageBufferPool_getStats;
+  fog_api.imagebufferpool_resetStats = ImageBufferPool_resetStats;
+
+  ImageBufferPool_lock.init();
+  ImageBufferPool_threadCache.init();
+
+  // Fall back to the global lists only if TLS is not available.
+  ImageBufferPool_flags = IMAGE_BUFFER_POOL_NO_FLAGS;
+  if (ImageBufferPool_threadCache->create(ImageBufferPool_threadCacheDestructor) != ERR_OK)
+    ImageBufferPool_flags |= IMAGE_BUFFER_POOL_NO_THREAD_CACHE;
+
+  ImageBufferPool_budget = IMAGE_BUFFER_POOL_DEFAULT_BUDGET;
+  ImageBufferPool_usedBytes.init(0);
+  ImageBufferPool_cachedBytes.init(0);
+
+  ImageBufferPool_allocCount.init(0);
+  ImageBufferPool_releaseCount.init(0);
+  ImageBufferPool_threadHitCount.init(0);
+  ImageBufferPool_globalHitCount.init(0);
+  ImageBufferPool_missCount.init(0);
+  ImageBufferPool_evictCount.init(0);
+
+  MemMgr::registerCleanupFunc(ImageBufferPool_cleanupFunc, NULL);
+}
+
+FOG_NO_EXPORT void ImageBufferPool_fini(void)
+{
+  MemMgr::unregisterCleanupFunc(ImageBufferPool_cleanupFunc, NULL);
+
+  // Images which are still alive release their buffers later, so the lock
+  // and the thread-local slot are not destroyed here.
+  ImageBufferPool_trim(0);
+}
+
+} // Fog namespace
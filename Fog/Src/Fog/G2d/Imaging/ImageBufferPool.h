@@ -0,0 +1,133 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_IMAGING_IMAGEBUFFERPOOL_H
+#define _FOG_G2D_IMAGING_IMAGEBUFFERPOOL_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Imaging
+//! @{
+
+// ============================================================================
+// [Fog::ImageBufferPoolStats]
+// ============================================================================
+
+//! @brief Image buffer pool statistics.
+struct FOG_NO_EXPORT ImageBufferPoolStats
+{
+  //! @brief Count of buffers requested by @c ImageBufferPool::alloc().
+  uint64_t allocCount;
+  //! @brief Count of buffers returned by @c ImageBufferPool::release().
+  uint64_t releaseCount;
+
+  //! @brief Count of buffers recycled from a thread cache.
+  uint64_t threadHitCount;
+  //! @brief Count of buffers recycled from the global size-class lists.
+  uint64_t globalHitCount;
+  //! @brief Count of buffers allocated from the system.
+  uint64_t missCount;
+  //! @brief Count of buffers freed because the budget was exceeded or
+  //! because of trim.
+  uint64_t evictCount;
+
+  //! @brief Bytes held by buffers currently in use.
+  size_t usedBytes;
+  //! @brief Bytes held by unused (cached) buffers.
+  size_t cachedBytes;
+  //! @brief Byte budget of cached buffers.
+  size_t budget;
+};
+
+// ============================================================================
+// [Fog::ImageBufferPool]
+// ============================================================================
+
+//! @brief Pool of aligned pixel buffers used by @c Image.
+//!
+//! Buffers are rounded to size classes (four classes per power of two) and
+//! released buffers are kept in per-class lists so creating and destroying
+//! images of the same size doesn't go to the system allocator. The byte
+//! budget limits the memory held by unused buffers. Each thread has also a
+//! small cache, which is accessed without locking.
+//!
+//! All buffers are aligned to @c IMAGE_BUFFER_POOL_ALIGNMENT bytes.
+struct FOG_NO_EXPORT ImageBufferPool
+{
+  // --------------------------------------------------------------------------
+  // [Alloc / Release]
+  // --------------------------------------------------------------------------
+
+  static FOG_INLINE void* alloc(size_t size)
+  {
+    return fog_api.imagebufferpool_alloc(size);
+  }
+
+  static FOG_INLINE void release(void* p)
+  {
+    fog_api.imagebufferpool_release(p);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Trim]
+  // --------------------------------------------------------------------------
+
+  //! @brief Free unused buffers until the pool holds at most @a keepBytes.
+  //!
+  //! Buffers cached by other threads are not affected.
+  static FOG_INLINE void trim(size_t keepBytes = 0)
+  {
+    fog_api.imagebufferpool_trim(keepBytes);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  static FOG_INLINE size_t getBudget()
+  {
+    return fog_api.imagebufferpool_getBudget();
+  }
+
+  static FOG_INLINE void setBudget(size_t budget)
+  {
+    fog_api.imagebufferpool_setBudget(budget);
+  }
+
+  static FOG_INLINE uint32_t getFlags()
+  {
+    return fog_api.imagebufferpool_getFlags();
+  }
+
+  static FOG_INLINE void setFlags(uint32_t flags)
+  {
+    fog_api.imagebufferpool_setFlags(flags);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Statistics]
+  // --------------------------------------------------------------------------
+
+  static FOG_INLINE void getStats(ImageBufferPoolStats& stats)
+  {
+    fog_api.imagebufferpool_getStats(&stats);
+  }
+
+  static FOG_INLINE void resetStats()
+  {
+    fog_api.imagebufferpool_resetStats();
+  }
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_IMAGING_IMAGEBUFFERPOOL_H
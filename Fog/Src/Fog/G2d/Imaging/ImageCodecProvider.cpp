@@ -289,8 +289,13 @@ err_t ImageCodecProvider::createDecoderForFile(const StringW& fileName, ImageDec
   StringW extension;
 
   err_t err = stream.openMMap(fileName, false);
-  // MMap failed? Try to open the file using standard stream.
-  if (FOG_IS_ERROR(err)) err = stream.openFile(fileName, STREAM_OPEN_READ);
+  // MMap failed? Try to open the file using standard stream. Decoders read
+  // small chunks, so buffer it to not call read() for each of them.
+  if (FOG_IS_ERROR(err))
+  {
+    err = stream.openFile(fileName, STREAM_OPEN_READ);
+    if (err == ERR_OK) err = stream.openBuffered(stream);
+  }
 
   // If err is not ERR_OK then file can't be open.
   if (FOG_IS_ERROR(err)) goto _End;
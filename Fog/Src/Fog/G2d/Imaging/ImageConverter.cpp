@@ -10,10 +10,22 @@
 
 // [Dependencies]
 #include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Kernel/EventLoop.h>
+#include <Fog/Core/Kernel/Task.h>
+#include <Fog/Core/Math/Math.h>
 #include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Memory/MemOps.h>
+#include <Fog/Core/Threading/Atomic.h>
+#include <Fog/Core/Threading/Thread.h>
+#include <Fog/Core/Threading/ThreadEvent.h>
+#include <Fog/Core/Threading/ThreadPool.h>
+#include <Fog/Core/Tools/Cpu.h>
+#include <Fog/Core/Tools/Swap.h>
+#include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Imaging/ImageConverter.h>
 #include <Fog/G2d/Painting/RasterApi_p.h>
 #include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Tools/DitherTable_p.h>
 
 namespace Fog {
 
@@ -24,6 +36,74 @@ namespace Fog {
 static Static<ImageConverterData> ImageConverter_dNull;
 static Static<ImageConverter> ImageConverter_oNull;
 
+//! @internal
+//!
+//! @brief Minimum count of pixels to convert the image by more threads.
+static const uint32_t ImageConverter_mtMinPixels = 512 * 512;
+
+//! @internal
+//!
+//! @brief Minimum count of rows per band when converting by more threads.
+static const int ImageConverter_mtMinRows = 32;
+
+//! @internal
+//!
+//! @brief Maximum count of threads used by @c ImageConverter::convertImage().
+static const uint32_t ImageConverter_mtMaxThreads = 16;
+
+// ============================================================================
+// [Fog::ImageConverterDither8Data]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief The private data of the converter created by @c createDithered8().
+//!
+//! The pointer to this structure is stored in @c ImageConverterData::buffer.
+struct FOG_NO_EXPORT ImageConverterDither8Data
+{
+  //! @brief Converter used to fetch the source pixels as XRGB32 (unused if
+  //! @c fetchDirect is true).
+  Static<ImageConverter> fetcher;
+
+  //! @brief Dither type, see @c DITHER_TYPE.
+  uint32_t ditherType;
+  //! @brief Whether the source is PRGB32 or XRGB32, which is read directly.
+  uint32_t fetchDirect;
+
+  //! @brief Multiplier of the R, G and B levels to get the palette index.
+  uint32_t mul[3];
+
+  //! @brief Ordered dither tables, the low byte is the level multiplied by
+  //! @c mul, the high byte is a threshold compared with @c DitherTable::matrix.
+  uint16_t pattern[3][256];
+
+  //! @brief Error-diffusion tables, the nearest level of a component.
+  uint8_t nearest[3][256];
+  //! @brief Error-diffusion tables, the component value of a level.
+  uint8_t value[3][256];
+
+  //! @brief Palette index transpose table (identity if not specified).
+  uint8_t transpose[256];
+};
+
+static FOG_INLINE ImageConverterDither8Data* ImageConverter_getDither8(const ImageConverterData* d)
+{
+  return *reinterpret_cast<ImageConverterDither8Data* const*>(d->buffer);
+}
+
+static void ImageConverter_destroyDither8(ImageConverterData* d)
+{
+  if (!d->isDithered8)
+    return;
+
+  ImageConverterDither8Data* d8 = ImageConverter_getDither8(d);
+  d8->fetcher.destroy();
+  MemMgr::free(d8);
+
+  d->isDithered8 = 0;
+}
+
 // ============================================================================
 // [Fog::ImageConverter - Construction / Destruction]
 // ============================================================================
@@ -112,6 +192,7 @@ static err_t FOG_CDECL ImageConverter_create(ImageConverter* self,
       d->srcPalette->_d = NULL;
     }
 
+    ImageConverter_destroyDither8(d);
     d->reference.init(1);
   }
 
@@ -204,14 +285,159 @@ _Fail:
   return err;
 }
 
+static void FOG_FASTCALL ImageConverter_dither8Pattern(
+  uint8_t* dst, const uint8_t* src, int w, const ImageConverterClosure* closure);
+static void FOG_FASTCALL ImageConverter_dither8Diffuse(
+  uint8_t* dst, const uint8_t* src, int w, const ImageConverterClosure* closure);
+
 static err_t FOG_CDECL ImageConverter_createDithered8(ImageConverter* self,
   const ImageDither8Params* dstParams,
   const ImageFormatDescription* srcFormatDescription,
   const ImagePalette* dstPalette,
   const ImagePalette* srcPalette)
 {
-  // TODO: Not implemented.
-  return ERR_RT_NOT_IMPLEMENTED;
+  const ImageFormatDescription* sf = srcFormatDescription;
+
+  ImageConverterData* d = NULL;
+  ImageConverterDither8Data* d8 = NULL;
+  err_t err = ERR_OK;
+
+  uint32_t count[3];
+  uint32_t total;
+  uint32_t i, k;
+
+  count[0] = dstParams->rCount;
+  count[1] = dstParams->gCount;
+  count[2] = dstParams->bCount;
+
+  if (count[0] < 2 || count[1] < 2 || count[2] < 2 ||
+      count[0] > 256 || count[1] > 256 || count[2] > 256)
+  {
+    err = ERR_RT_INVALID_ARGUMENT;
+    goto _Fail;
+  }
+
+  total = count[0] * count[1] * count[2];
+  if (total > 256)
+  {
+    err = ERR_RT_INVALID_ARGUMENT;
+    goto _Fail;
+  }
+
+  if (dstParams->transposeTable != NULL && dstParams->transposeTableLength < total)
+  {
+    err = ERR_RT_INVALID_ARGUMENT;
+    goto _Fail;
+  }
+
+  if (dstParams->ditherType != DITHER_TYPE_PATTERN &&
+      dstParams->ditherType != DITHER_TYPE_ERROR_DIFFUSION)
+  {
+    err = ERR_RT_INVALID_ARGUMENT;
+    goto _Fail;
+  }
+
+  if (!sf->isValid() || (sf->isIndexed() && srcPalette == NULL))
+  {
+    err = ERR_RT_INVALID_ARGUMENT;
+    goto _Fail;
+  }
+
+  d = fog_api.imageconverter_dCreate();
+  if (FOG_IS_NULL(d))
+  {
+    err = ERR_RT_OUT_OF_MEMORY;
+    goto _Fail;
+  }
+
+  d8 = reinterpret_cast<ImageConverterDither8Data*>(MemMgr::alloc(sizeof(ImageConverterDither8Data)));
+  if (FOG_IS_NULL(d8))
+  {
+    err = ERR_RT_OUT_OF_MEMORY;
+    goto _Fail;
+  }
+
+  d8->fetcher.init();
+  *reinterpret_cast<ImageConverterDither8Data**>(d->buffer) = d8;
+  d->isDithered8 = 1;
+
+  d->dstFormatDescription = ImageFormatDescription::getByFormat(IMAGE_FORMAT_I8);
+  d->srcFormatDescription = *sf;
+
+  d->isDithered = 1;
+  d->isCopy = 0;
+  d->isBSwap = 0;
+
+  if (dstPalette != NULL)
+    d->dstPalette.init(*dstPalette);
+  else if (dstParams->transposeTable == NULL)
+    d->dstPalette.init(ImagePalette::fromColorCube(count[0], count[1], count[2]));
+
+  if (srcPalette != NULL)
+    d->srcPalette.init(*srcPalette);
+
+  // --------------------------------------------------------------------------
+  // [Fetcher]
+  // --------------------------------------------------------------------------
+
+  d8->ditherType = dstParams->ditherType;
+  d8->fetchDirect = (sf->getFormat() == IMAGE_FORMAT_PRGB32 || sf->getFormat() == IMAGE_FORMAT_XRGB32);
+
+  if (!d8->fetchDirect)
+  {
+    err = d8->fetcher->create(ImageFormatDescription::getByFormat(IMAGE_FORMAT_XRGB32), *sf, false, NULL, srcPalette);
+    if (FOG_IS_ERROR(err))
+      goto _Fail;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Tables]
+  // --------------------------------------------------------------------------
+
+  d8->mul[0] = count[1] * count[2];
+  d8->mul[1] = count[2];
+  d8->mul[2] = 1;
+
+  for (k = 0; k < 3; k++)
+  {
+    uint32_t n = count[k] - 1;
+    uint32_t inc = 0xFF000000U / n;
+
+    for (i = 0; i < 256; i++)
+    {
+      uint32_t s = i * n;
+      uint32_t level = s / 255;
+      uint32_t threshold = ((s % 255) * DitherTable::DIV) / 255;
+
+      d8->pattern[k][i] = (uint16_t)((level * d8->mul[k]) | (threshold << 8));
+      d8->nearest[k][i] = (uint8_t)((s + 127) / 255);
+    }
+
+    // The same values as generated by ImagePalette::fromColorCube().
+    for (i = 0; i <= n; i++)
+      d8->value[k][i] = (uint8_t)((i * inc) >> 24);
+  }
+
+  for (i = 0; i < 256; i++)
+  {
+    d8->transpose[i] = (dstParams->transposeTable != NULL && i < total)
+      ? dstParams->transposeTable[i]
+      : (uint8_t)i;
+  }
+
+  d->blitFn = (d8->ditherType == DITHER_TYPE_PATTERN)
+    ? ImageConverter_dither8Pattern
+    : ImageConverter_dither8Diffuse;
+
+  atomicPtrXchg(&self->_d, d)->release();
+  return ERR_OK;
+
+_Fail:
+  if (d != NULL)
+    d->release();
+
+  atomicPtrXchg(&self->_d, ImageConverter_dNull->addRef())->release();
+  return err;
 }
 
 // ============================================================================
@@ -248,6 +474,11 @@ static void FOG_CDECL ImageConverter_blitLine(const ImageConverter* self,
   d->blitFn(reinterpret_cast<uint8_t*>(dst), reinterpret_cast<const uint8_t*>(src), w, &closure);
 }
 
+static void ImageConverter_dither8DiffuseRect(const ImageConverterData* d,
+  uint8_t* dst, size_t dstStride,
+  const uint8_t* src, size_t srcStride,
+  int w, int h);
+
 static void FOG_CDECL ImageConverter_blitRect(const ImageConverter* self,
   void* dst, size_t dstStride,
   const void* src, size_t srcStride,
@@ -257,6 +488,16 @@ static void FOG_CDECL ImageConverter_blitRect(const ImageConverter* self,
   if (d == &ImageConverter_dNull)
     return;
 
+  uint8_t* dPtr = reinterpret_cast<uint8_t*>(dst);
+  const uint8_t* sPtr = reinterpret_cast<const uint8_t*>(src);
+
+  // The error-diffusion needs the error of the previous row.
+  if (d->isDithered8 && ImageConverter_getDither8(d)->ditherType == DITHER_TYPE_ERROR_DIFFUSION)
+  {
+    ImageConverter_dither8DiffuseRect(d, dPtr, dstStride, sPtr, srcStride, w, h);
+    return;
+  }
+
   ImageConverterClosure closure;
   if (ditherOrigin == NULL)
     closure.ditherOrigin.reset();
@@ -267,14 +508,12 @@ static void FOG_CDECL ImageConverter_blitRect(const ImageConverter* self,
   closure.palette = d->srcPalette->_d;
   closure.colorKey = 0xFFFFFFFF; // TODO: ColorKey should be part if image converter.
 
-  uint8_t* dPtr = reinterpret_cast<uint8_t*>(dst);
-  const uint8_t* sPtr = reinterpret_cast<const uint8_t*>(src);
-
   ImageConverterBlitLineFunc blitLine = d->blitFn;
+  int yOrigin = closure.ditherOrigin.y;
 
   for (int y = 0; y < h; y++)
   {
-    closure.ditherOrigin.y = y;
+    closure.ditherOrigin.y = yOrigin + y;
     blitLine(dPtr, sPtr, w, &closure);
 
     dPtr += dstStride;
@@ -282,6 +521,320 @@ static void FOG_CDECL ImageConverter_blitRect(const ImageConverter* self,
   }
 }
 
+// ============================================================================
+// [Fog::ImageConverter - Dither8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Fetch up to 256 pixels from @a src as XRGB32.
+static FOG_INLINE const uint32_t* ImageConverter_dither8Fetch(const ImageConverterDither8Data* d8,
+  uint32_t* buffer, const uint8_t* src, int w, const ImageConverterClosure* fetchClosure)
+{
+  if (d8->fetchDirect)
+    return reinterpret_cast<const uint32_t*>(src);
+
+  d8->fetcher->getBlitFn()(reinterpret_cast<uint8_t*>(buffer), src, w, fetchClosure);
+  return buffer;
+}
+
+static void FOG_FASTCALL ImageConverter_dither8Pattern(
+  uint8_t* dst, const uint8_t* src, int w, const ImageConverterClosure* closure)
+{
+  const ImageConverterData* d = reinterpret_cast<const ImageConverterData*>(closure->data);
+  const ImageConverterDither8Data* d8 = ImageConverter_getDither8(d);
+
+  const uint8_t* matrix = DitherTable::matrix[closure->ditherOrigin.y & DitherTable::MASK];
+  uint32_t x = (uint32_t)closure->ditherOrigin.x;
+
+  uint32_t srcBpp = d->srcFormatDescription.getBytesPerPixel();
+  uint32_t buffer[256];
+
+  ImageConverterClosure fetchClosure;
+  if (!d8->fetchDirect)
+    d8->fetcher->setupClosure(&fetchClosure);
+
+  while (w > 0)
+  {
+    int n = Math::min<int>(w, 256);
+    const uint32_t* pix = ImageConverter_dither8Fetch(d8, buffer, src, n, &fetchClosure);
+
+    for (int i = 0; i < n; i++, x++)
+    {
+      uint32_t p0 = pix[i];
+      uint32_t t0 = matrix[x & DitherTable::MASK];
+
+      uint32_t r0 = d8->pattern[0][(p0 >> 16) & 0xFF];
+      uint32_t g0 = d8->pattern[1][(p0 >>  8) & 0xFF];
+      uint32_t b0 = d8->pattern[2][(p0      ) & 0xFF];
+
+      uint32_t index = (r0 & 0xFF) + (g0 & 0xFF) + (b0 & 0xFF);
+
+      if ((r0 >> 8) > t0) index += d8->mul[0];
+      if ((g0 >> 8) > t0) index += d8->mul[1];
+      if ((b0 >> 8) > t0) index += d8->mul[2];
+
+      dst[i] = d8->transpose[index];
+    }
+
+    dst += n;
+    src += (uint)n * srcBpp;
+    w -= n;
+  }
+}
+
+//! @internal
+//!
+//! @brief Convert one row using the Floyd-Steinberg error diffusion.
+//!
+//! The @a errCur and @a errNext arrays contain (w + 2) * 3 items, the error
+//! is multiplied by 16. If @a errNext is NULL the error is propagated only
+//! to the next pixel in the row.
+static void ImageConverter_dither8DiffuseRow(const ImageConverterData* d,
+  uint8_t* dst, const uint8_t* src, int w, int* errCur, int* errNext)
+{
+  const ImageConverterDither8Data* d8 = ImageConverter_getDither8(d);
+
+  uint32_t srcBpp = d->srcFormatDescription.getBytesPerPixel();
+  uint32_t buffer[256];
+
+  ImageConverterClosure fetchClosure;
+  if (!d8->fetchDirect)
+    d8->fetcher->setupClosure(&fetchClosure);
+
+  int carry[3] = { 0, 0, 0 };
+  int x = 0;
+
+  while (w > 0)
+  {
+    int n = Math::min<int>(w, 256);
+    const uint32_t* pix = ImageConverter_dither8Fetch(d8, buffer, src, n, &fetchClosure);
+
+    for (int i = 0; i < n; i++, x++)
+    {
+      uint32_t p0 = pix[i];
+      uint32_t index = 0;
+
+      for (uint k = 0; k < 3; k++)
+      {
+        int c0 = (int)((p0 >> (16 - k * 8)) & 0xFF);
+
+        if (errNext != NULL)
+          c0 += (errCur[(x + 1) * 3 + k] + 8) >> 4;
+        else
+          c0 += carry[k];
+
+        c0 = Math::boundToByte(c0);
+
+        uint32_t level = d8->nearest[k][c0];
+        int e0 = c0 - (int)d8->value[k][level];
+
+        index += level * d8->mul[k];
+
+        if (errNext != NULL)
+        {
+          errCur [(x + 2) * 3 + k] += e0 * 7;
+          errNext[(x    ) * 3 + k] += e0 * 3;
+          errNext[(x + 1) * 3 + k] += e0 * 5;
+          errNext[(x + 2) * 3 + k] += e0;
+        }
+        else
+        {
+          carry[k] = e0;
+        }
+      }
+
+      dst[i] = d8->transpose[index];
+    }
+
+    dst += n;
+    src += (uint)n * srcBpp;
+    w -= n;
+  }
+}
+
+static void FOG_FASTCALL ImageConverter_dither8Diffuse(
+  uint8_t* dst, const uint8_t* src, int w, const ImageConverterClosure* closure)
+{
+  const ImageConverterData* d = reinterpret_cast<const ImageConverterData*>(closure->data);
+  ImageConverter_dither8DiffuseRow(d, dst, src, w, NULL, NULL);
+}
+
+static void ImageConverter_dither8DiffuseRect(const ImageConverterData* d,
+  uint8_t* dst, size_t dstStride,
+  const uint8_t* src, size_t srcStride,
+  int w, int h)
+{
+  if (w <= 0 || h <= 0)
+    return;
+
+  size_t rowSize = (size_t)((uint)w + 2) * 3;
+  int* err = reinterpret_cast<int*>(MemMgr::calloc(rowSize * 2 * sizeof(int)));
+
+  int* errCur = err;
+  int* errNext = err != NULL ? err + rowSize : NULL;
+
+  // Without the error buffer the error is propagated only in the row.
+  for (int y = 0; y < h; y++)
+  {
+    ImageConverter_dither8DiffuseRow(d, dst, src, w, errCur, errNext);
+
+    if (err != NULL)
+    {
+      swap(errCur, errNext);
+      MemOps::zero(errNext, rowSize * sizeof(int));
+    }
+
+    dst += dstStride;
+    src += srcStride;
+  }
+
+  if (err != NULL)
+    MemMgr::free(err);
+}
+
+// ============================================================================
+// [Fog::ImageConverter - Convert]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Task which converts a band of rows, used by @c ImageConverter_blitRectMT().
+struct FOG_NO_EXPORT ImageConverterBandTask : public Task
+{
+  virtual void run()
+  {
+    fog_api.imageconverter_blitRect(converter, dst, dstStride, src, srcStride, w, h, &ditherOrigin);
+
+    if (pending->deref())
+      done->signal();
+  }
+
+  const ImageConverter* converter;
+
+  uint8_t* dst;
+  size_t dstStride;
+  const uint8_t* src;
+  size_t srcStride;
+
+  int w;
+  int h;
+  PointI ditherOrigin;
+
+  Atomic<size_t>* pending;
+  ThreadEvent* done;
+};
+
+//! @internal
+//!
+//! @brief Convert the rectangle, splitting rows across the threads of the
+//! default @c ThreadPool if the rectangle is large enough.
+static void ImageConverter_blitRectMT(const ImageConverter* self,
+  uint8_t* dst, size_t dstStride,
+  const uint8_t* src, size_t srcStride,
+  int w, int h)
+{
+  const ImageConverterData* d = self->_d;
+  uint32_t numThreads = 1;
+
+  if ((uint64_t)(uint)w * (uint)h >= ImageConverter_mtMinPixels &&
+      !(d->isDithered8 && ImageConverter_getDither8(d)->ditherType == DITHER_TYPE_ERROR_DIFFUSION))
+  {
+    numThreads = Math::min<uint32_t>(Cpu::get()->getNumberOfProcessors(), ImageConverter_mtMaxThreads);
+    numThreads = Math::min<uint32_t>(numThreads, (uint32_t)(h / ImageConverter_mtMinRows));
+  }
+
+  Thread* threads[ImageConverter_mtMaxThreads];
+  uint32_t numWorkers = numThreads - 1;
+
+  if (numThreads <= 1 || FOG_IS_ERROR(ThreadPool::get()->getThreads(threads, numWorkers)))
+  {
+    fog_api.imageconverter_blitRect(self, dst, dstStride, src, srcStride, w, h, NULL);
+    return;
+  }
+
+  Atomic<size_t> pending;
+  pending.init(numWorkers);
+
+  ThreadEvent done(false, false);
+
+  // The calling thread converts the first band.
+  int bandHeight = (h + (int)numThreads - 1) / (int)numThreads;
+  int y = bandHeight;
+
+  for (uint32_t i = 0; i < numWorkers; i++, y += bandHeight)
+  {
+    ImageConverterBandTask* task = fog_new ImageConverterBandTask();
+    int bh = Math::max<int>(Math::min<int>(bandHeight, h - y), 0);
+
+    if (FOG_IS_NULL(task))
+    {
+      fog_api.imageconverter_blitRect(self,
+        dst + (ssize_t)y * (ssize_t)dstStride, dstStride,
+        src + (ssize_t)y * (ssize_t)srcStride, srcStride, w, bh, NULL);
+
+      if (pending.deref())
+        done.signal();
+      continue;
+    }
+
+    task->converter = self;
+    task->dst = dst + (ssize_t)y * (ssize_t)dstStride;
+    task->dstStride = dstStride;
+    task->src = src + (ssize_t)y * (ssize_t)srcStride;
+    task->srcStride = srcStride;
+    task->w = w;
+    task->h = bh;
+    task->ditherOrigin.set(0, y);
+    task->pending = &pending;
+    task->done = &done;
+
+    if (FOG_IS_ERROR(threads[i]->getEventLoop().postTask(task)))
+    {
+      task->run();
+      fog_delete(task);
+    }
+  }
+
+  fog_api.imageconverter_blitRect(self, dst, dstStride, src, srcStride, w, Math::min<int>(bandHeight, h), NULL);
+
+  done.wait();
+  ThreadPool::get()->releaseThreads(threads, numWorkers);
+}
+
+static err_t FOG_CDECL ImageConverter_convertImage(const ImageConverter* self, Image* dst, const Image* src)
+{
+  const ImageConverterData* d = self->_d;
+  if (d == &ImageConverter_dNull)
+    return ERR_RT_INVALID_STATE;
+
+  uint32_t dstFormat = d->dstFormatDescription.getFormat();
+  if (dstFormat >= IMAGE_FORMAT_COUNT || src->getFormat() != d->srcFormatDescription.getFormat())
+    return ERR_RT_INVALID_ARGUMENT;
+
+  if (src->isEmpty())
+  {
+    dst->reset();
+    return ERR_OK;
+  }
+
+  // Keep the source data alive, dst and src can be the same instance.
+  Image source(*src);
+  SizeI size = source.getSize();
+
+  FOG_RETURN_ON_ERROR(dst->create(size, dstFormat));
+
+  if (dstFormat == IMAGE_FORMAT_I8 && d->dstPalette->_d != NULL)
+    FOG_RETURN_ON_ERROR(dst->setPalette(d->dstPalette()));
+
+  ImageConverter_blitRectMT(self,
+    dst->getFirstX(), (size_t)dst->getStride(),
+    source.getFirst(), (size_t)source.getStride(), size.w, size.h);
+
+  dst->_modified();
+  return ERR_OK;
+}
+
 // ============================================================================
 // [Fog::ImageConverter - ImageConverterData]
 // ============================================================================
@@ -295,6 +848,7 @@ static ImageConverterData* FOG_CDECL ImageConverter_dCreate(void)
 
   d->reference.init(1);
   d->blitFn = NULL;
+  d->isDithered8 = 0;
 
   d->dstPalette->_d = NULL;
   d->srcPalette->_d = NULL;
@@ -310,6 +864,7 @@ static void FOG_CDECL ImageConverter_dFree(ImageConverterData* d)
   if (d->srcPalette->_d)
     d->srcPalette.destroy();
 
+  ImageConverter_destroyDither8(d);
   MemMgr::free(d);
 }
 
@@ -334,6 +889,7 @@ FOG_NO_EXPORT void ImageConverter_init(void)
 
   fog_api.imageconverter_blitLine = ImageConverter_blitLine;
   fog_api.imageconverter_blitRect = ImageConverter_blitRect;
+  fog_api.imageconverter_convertImage = ImageConverter_convertImage;
 
   fog_api.imageconverter_dCreate = ImageConverter_dCreate;
   fog_api.imageconverter_dFree = ImageConverter_dFree;
@@ -346,6 +902,7 @@ FOG_NO_EXPORT void ImageConverter_init(void)
 
   d->reference.init(1);
   d->blitFn = NULL;
+  d->isDithered8 = 0;
   d->dstFormatDescription.reset();
   d->srcFormatDescription.reset();
   d->dstPalette->_d = NULL;
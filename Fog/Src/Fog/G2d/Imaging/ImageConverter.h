@@ -77,6 +77,14 @@ struct FOG_NO_EXPORT ImageDither8Params
   uint32_t transposeTableLength;
   //! @brief Table used to transpose pixel into the target value (can be NULL).
   const uint8_t* transposeTable;
+
+  //! @brief Dither type, see @c DITHER_TYPE.
+  //!
+  //! @c DITHER_TYPE_PATTERN uses an ordered dither matrix, each pixel is
+  //! converted independently. @c DITHER_TYPE_ERROR_DIFFUSION uses the
+  //! Floyd-Steinberg algorithm, the error is propagated to the next row only
+  //! by @c ImageConverter::blitRect() and @c ImageConverter::convertImage().
+  uint32_t ditherType;
 };
 
 // ============================================================================
@@ -128,6 +136,9 @@ struct FOG_NO_EXPORT ImageConverterData
   uint32_t isCopy : 8;
   //! @brief Reserved for future use.
   uint32_t isBSwap : 8;
+  //! @brief Whether the converter was created by @c ImageConverter::createDithered8(),
+  //! the first pointer in @c buffer is the private dither data.
+  uint32_t isDithered8 : 8;
 
   //! @brief The additional read-only data which may be used by an external
   //! converter or JIT-Compiled code.
@@ -286,6 +297,24 @@ struct FOG_NO_EXPORT ImageConverter
     return fog_api.imageconverter_blitRect(this, dst, dstStride, src, srcStride, w, h, &ditherOrigin);
   }
 
+  // --------------------------------------------------------------------------
+  // [Convert - Image]
+  // --------------------------------------------------------------------------
+
+  //! @brief Convert the whole @a src image into @a dst.
+  //!
+  //! The destination image is created using the destination format of the
+  //! converter (it must be one of @c IMAGE_FORMAT) and the size of @a src,
+  //! the format of @a src must match the source format of the converter.
+  //!
+  //! Large images are split into bands of rows, which are converted by the
+  //! threads of the default @c ThreadPool. Error-diffusion is always done by
+  //! the calling thread.
+  FOG_INLINE err_t convertImage(Image& dst, const Image& src) const
+  {
+    return fog_api.imageconverter_convertImage(this, &dst, &src);
+  }
+
   // --------------------------------------------------------------------------
   // [Accessors]
   // --------------------------------------------------------------------------
@@ -6,8 +6,10 @@
 // [Dependencies]
 #include <Fog/Core/Global/Global.h>
 #include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Math/Math.h>
 #include <Fog/Core/Memory/MemMgr.h>
 #include <Fog/Core/Memory/MemOps.h>
+#include <Fog/G2d/Geometry/Point.h>
 #include <Fog/G2d/Imaging/ImageFilter.h>
 #include <Fog/G2d/Imaging/Filters/FeBase.h>
 #include <Fog/G2d/Imaging/Filters/FeBlur.h>
@@ -285,6 +287,52 @@ static void FOG_CDECL ImageFilter_dFree(ImageFilterData* d)
 
 #undef FOG_FE_FREE
 
+// ============================================================================
+// [Fog::FeBase - Extents]
+// ============================================================================
+
+static void FOG_CDECL FeBase_getExtents(const FeBase* self, PointF* extents)
+{
+  switch (self->getFeType())
+  {
+    case FE_TYPE_BLUR:
+    {
+      const FeBlur* fe = static_cast<const FeBlur*>(self);
+      extents->set(Math::abs(fe->getHorizontalRadius()),
+                   Math::abs(fe->getVerticalRadius()));
+      break;
+    }
+
+    case FE_TYPE_CONVOLVE_MATRIX:
+    {
+      const FeConvolveMatrix* fe = static_cast<const FeConvolveMatrix*>(self);
+      extents->set(float(fe->getMatrix().getWidth() / 2),
+                   float(fe->getMatrix().getHeight() / 2));
+      break;
+    }
+
+    case FE_TYPE_CONVOLVE_SEPARABLE:
+    {
+      const FeConvolveSeparable* fe = static_cast<const FeConvolveSeparable*>(self);
+      extents->set(float(fe->getHorzVector().getLength() / 2),
+                   float(fe->getVertVector().getLength() / 2));
+      break;
+    }
+
+    case FE_TYPE_MORPHOLOGY:
+    {
+      const FeMorphology* fe = static_cast<const FeMorphology*>(self);
+      extents->set(Math::abs(fe->getHorizontalRadius()),
+                   Math::abs(fe->getVerticalRadius()));
+      break;
+    }
+
+    default:
+      extents->reset();
+      break;
+  }
+}
+
 // ============================================================================
 // [Init / Fini]
 // ============================================================================
@@ -310,6 +358,8 @@ FOG_NO_EXPORT void ImageFilter_init(void)
   fog_api.imagefilter_dCreate = ImageFilter_dCreate;
   fog_api.imagefilter_dFree = ImageFilter_dFree;
 
+  fog_api.febase_getExtents = FeBase_getExtents;
+
   // --------------------------------------------------------------------------
   // [Data]
   // --------------------------------------------------------------------------
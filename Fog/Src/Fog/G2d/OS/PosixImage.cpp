@@ -0,0 +1,340 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/OS/OSUtil.h>
+#include <Fog/Core/Threading/Atomic.h>
+#include <Fog/Core/Tools/Logger.h>
+#include <Fog/G2d/Imaging/Image.h>
+#include <Fog/G2d/Imaging/ImageBits.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(FOG_OS_LINUX)
+# include <sys/syscall.h>
+#endif // FOG_OS_LINUX
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::SharedImageData]
+// ============================================================================
+
+struct FOG_NO_EXPORT SharedImageData : public ImageData
+{
+  //! @brief File descriptor of the shared memory.
+  int fd;
+  //! @brief Size of the mapping.
+  size_t mapSize;
+};
+
+// ============================================================================
+// [Fog::Image - Shared - Helpers]
+// ============================================================================
+
+static Atomic<uint32_t> Image_Shared_counter;
+
+//! @internal
+//!
+//! @brief Create anonymous shared memory of @a size bytes.
+//!
+//! The memfd_create() syscall is preferred, because the memory can be sealed.
+//! The shm_open() is used as a fallback, the name is unlinked immediately so
+//! the memory is released when the last descriptor is closed.
+static err_t Image_Shared_createFd(int* dst, size_t size)
+{
+  int fd = -1;
+
+#if defined(FOG_OS_LINUX) && defined(SYS_memfd_create)
+  // MFD_CLOEXEC == 0x0001, MFD_ALLOW_SEALING == 0x0002.
+  fd = (int)::syscall(SYS_memfd_create, "fog-image", 0x0001U | 0x0002U);
+#endif // FOG_OS_LINUX && SYS_memfd_create
+
+  if (fd == -1)
+  {
+    char name[64];
+
+    for (int attempt = 0; attempt < 16; attempt++)
+    {
+      ::snprintf(name, FOG_ARRAY_SIZE(name), "/fog-image-%d-%u",
+        (int)::getpid(), (uint)Image_Shared_counter.addXchg(1));
+
+      fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+      if (fd != -1)
+      {
+        ::shm_unlink(name);
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        break;
+      }
+
+      if (errno != EEXIST)
+        break;
+    }
+
+    if (fd == -1)
+      return OSUtil::getErrFromLibCErrno();
+  }
+
+  if (::ftruncate(fd, (off_t)size) != 0)
+  {
+    err_t err = OSUtil::getErrFromLibCErrno();
+    ::close(fd);
+    return err;
+  }
+
+  *dst = fd;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::Image - Shared - VTable]
+// ============================================================================
+
+static err_t FOG_CDECL Image_Shared_create(ImageData** pd, const SizeI* size, uint32_t format);
+static void  FOG_CDECL Image_Shared_destroy(ImageData* d);
+static void* FOG_CDECL Image_Shared_getHandle(const ImageData* d);
+static err_t FOG_CDECL Image_Shared_updatePalette(ImageData* d, const Range* range);
+
+static const ImageVTable Image_Shared_vTable =
+{
+  Image_Shared_create,
+  Image_Shared_destroy,
+  Image_Shared_getHandle,
+  Image_Shared_updatePalette
+};
+
+//! @internal
+//!
+//! @brief Map @a fd and create @c SharedImageData, which takes its ownership.
+static err_t Image_Shared_createData(SharedImageData** pd,
+  const SizeI* size, uint32_t format, ssize_t stride, int fd, size_t mapSize)
+{
+  const ImageFormatDescription& desc = ImageFormatDescription::getByFormat(format);
+
+  void* bits = ::mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (bits == MAP_FAILED)
+  {
+    err_t err = OSUtil::getErrFromLibCErrno();
+    ::close(fd);
+    return err;
+  }
+
+  SharedImageData* d = reinterpret_cast<SharedImageData*>(MemMgr::alloc(sizeof(SharedImageData)));
+  if (FOG_IS_NULL(d))
+  {
+    ::munmap(bits, mapSize);
+    ::close(fd);
+    return ERR_RT_OUT_OF_MEMORY;
+  }
+
+  d->reference.init(1);
+  d->vType = VAR_TYPE_IMAGE | VAR_FLAG_NONE;
+  d->locked = 0;
+
+  d->vtable = &Image_Shared_vTable;
+  d->size = *size;
+  d->format = format;
+  d->type = IMAGE_TYPE_SHARED;
+  d->adopted = 0;
+  d->colorKey = IMAGE_COLOR_KEY_NONE;
+  d->bytesPerPixel = desc.getBytesPerPixel();
+  FOG_PADDING_ZERO_64(d->padding);
+
+  d->data = reinterpret_cast<uint8_t*>(bits);
+  d->first = d->data;
+  d->stride = stride;
+
+  d->palette.init();
+  d->fd = fd;
+  d->mapSize = mapSize;
+
+  *pd = d;
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL Image_Shared_create(ImageData** pd, const SizeI* size, uint32_t format)
+{
+  const ImageFormatDescription& desc = ImageFormatDescription::getByFormat(format);
+  ssize_t stride = Image::getStrideFromWidth(size->w, desc.getDepth());
+
+  if (stride == 0)
+    return ERR_RT_INVALID_ARGUMENT;
+
+  if ((uint)size->h > SIZE_MAX / (size_t)stride)
+    return ERR_RT_OUT_OF_MEMORY;
+
+  size_t mapSize = (size_t)stride * (uint)size->h;
+  int fd;
+
+  FOG_RETURN_ON_ERROR(Image_Shared_createFd(&fd, mapSize));
+
+  SharedImageData* d;
+  FOG_RETURN_ON_ERROR(Image_Shared_createData(&d, size, format, stride, fd, mapSize));
+
+  *pd = d;
+  return ERR_OK;
+}
+
+static void FOG_CDECL Image_Shared_destroy(ImageData* _d)
+{
+  SharedImageData* d = reinterpret_cast<SharedImageData*>(_d);
+
+  if (d->data != NULL)
+    ::munmap(d->data, d->mapSize);
+
+  if (d->fd != -1)
+    ::close(d->fd);
+
+  d->palette.destroy();
+  MemMgr::free(d);
+}
+
+static void* FOG_CDECL Image_Shared_getHandle(const ImageData* _d)
+{
+  const SharedImageData* d = reinterpret_cast<const SharedImageData*>(_d);
+  return (void*)(intptr_t)d->fd;
+}
+
+static err_t FOG_CDECL Image_Shared_updatePalette(ImageData* d, const Range* range)
+{
+  FOG_UNUSED(d);
+  FOG_UNUSED(range);
+
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::Image - ExportShared / ImportShared]
+// ============================================================================
+
+static err_t FOG_CDECL Image_exportShared(const Image* self, ImageSharedInfo* info, uint32_t flags)
+{
+  const SharedImageData* d = reinterpret_cast<const SharedImageData*>(self->_d);
+
+  if (d->type != IMAGE_TYPE_SHARED)
+  {
+    Logger::error("Fog::Image", "exportShared",
+      "Image is not a shared memory image.");
+    return ERR_IMAGE_INVALID_TYPE;
+  }
+
+  if (flags & IMAGE_SHARED_SEAL)
+  {
+#if defined(F_ADD_SEALS) && defined(F_SEAL_SHRINK) && defined(F_SEAL_GROW)
+    // F_SEAL_SEAL is not used, so the image can be exported and sealed again.
+    if (::fcntl(d->fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW) != 0)
+      return OSUtil::getErrFromLibCErrno();
+#else
+    return ERR_RT_NOT_IMPLEMENTED;
+#endif // F_ADD_SEALS
+  }
+
+  int fd = ::fcntl(d->fd, F_DUPFD_CLOEXEC, 0);
+  if (fd == -1)
+    return OSUtil::getErrFromLibCErrno();
+
+  info->_size = d->size;
+  info->_format = d->format;
+  info->_fd = fd;
+  info->_stride = d->stride;
+
+  return ERR_OK;
+}
+
+static err_t FOG_CDECL Image_importShared(Image* self, const ImageSharedInfo* info)
+{
+  if (!info->isValid())
+  {
+    self->reset();
+    return ERR_RT_INVALID_ARGUMENT;
+  }
+
+  const ImageFormatDescription& desc = ImageFormatDescription::getByFormat(info->_format);
+  ssize_t stride = info->_stride;
+
+  if ((uint)info->_size.w >= IMAGE_MAX_WIDTH || (uint)info->_size.h >= IMAGE_MAX_HEIGHT ||
+      stride < Image::getStrideFromWidth(info->_size.w, desc.getDepth()))
+  {
+    self->reset();
+    return ERR_IMAGE_INVALID_SIZE;
+  }
+
+  if ((uint)info->_size.h > SIZE_MAX / (size_t)stride)
+  {
+    self->reset();
+    return ERR_RT_OUT_OF_MEMORY;
+  }
+
+  size_t mapSize = (size_t)stride * (uint)info->_size.h;
+
+  // The shared memory must be large enough, otherwise accessing the mapping
+  // beyond its end would raise SIGBUS.
+  struct stat st;
+  if (::fstat(info->_fd, &st) != 0)
+  {
+    self->reset();
+    return OSUtil::getErrFromLibCErrno();
+  }
+
+  if ((uint64_t)st.st_size < (uint64_t)mapSize)
+  {
+    self->reset();
+    return ERR_IMAGE_INVALID_SIZE;
+  }
+
+  int fd = ::fcntl(info->_fd, F_DUPFD_CLOEXEC, 0);
+  if (fd == -1)
+  {
+    self->reset();
+    return OSUtil::getErrFromLibCErrno();
+  }
+
+  SharedImageData* d;
+  err_t err = Image_Shared_createData(&d, &info->_size, info->_format, stride, fd, mapSize);
+
+  if (FOG_IS_ERROR(err))
+  {
+    self->reset();
+    return err;
+  }
+
+  atomicPtrXchg(&self->_d, static_cast<ImageData*>(d))->release();
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void Image_init_posix(void)
+{
+  // --------------------------------------------------------------------------
+  // [VTable]
+  // --------------------------------------------------------------------------
+
+  fog_api.image_vTable[IMAGE_TYPE_SHARED] = &Image_Shared_vTable;
+  Image_Shared_counter.init(0);
+
+  // --------------------------------------------------------------------------
+  // [Funcs]
+  // --------------------------------------------------------------------------
+
+  fog_api.image_exportShared = Image_exportShared;
+  fog_api.image_importShared = Image_importShared;
+}
+
+} // Fog namespace
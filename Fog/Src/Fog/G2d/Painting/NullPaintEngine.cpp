@@ -443,6 +443,12 @@ static err_t FOG_CDECL MyPaintEngine_blitImageInD(Painter* self, const RectD* r,
   return ERR_RT_NOT_IMPLEMENTED;
 }
 
+static err_t FOG_CDECL MyPaintEngine_blitImages(Painter* self, const Image* src, const BlitItem* items, size_t count)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
 static err_t FOG_CDECL MyPaintEngine_blitMaskedImageAtI(Painter* self, const PointI* p, const Image* src, const Image* mask, const RectI* sFragment, const RectI* maskFragment)
 {
   MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
@@ -531,6 +537,46 @@ static err_t FOG_CDECL MyPaintEngine_filterStrokedShapeD(Painter* self, const Fe
   return ERR_RT_NOT_IMPLEMENTED;
 }
 
+// ============================================================================
+// [Fog::MyPaintEngine - Shadow]
+// ============================================================================
+
+static err_t FOG_CDECL MyPaintEngine_drawShapeWithShadowF(Painter* self, uint32_t shapeType, const void* shapeData, const PointF* offset, float blurRadius, const Color* color)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
+static err_t FOG_CDECL MyPaintEngine_drawShapeWithShadowD(Painter* self, uint32_t shapeType, const void* shapeData, const PointD* offset, double blurRadius, const Color* color)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
+static err_t FOG_CDECL MyPaintEngine_fillShapeWithShadowF(Painter* self, uint32_t shapeType, const void* shapeData, const PointF* offset, float blurRadius, const Color* color)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
+static err_t FOG_CDECL MyPaintEngine_fillShapeWithShadowD(Painter* self, uint32_t shapeType, const void* shapeData, const PointD* offset, double blurRadius, const Color* color)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
+static err_t FOG_CDECL MyPaintEngine_fillTextWithShadowF(Painter* self, const PointF* p, const StringW* text, const Font* font, const PointF* offset, float blurRadius, const Color* color)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
+static err_t FOG_CDECL MyPaintEngine_fillTextWithShadowD(Painter* self, const PointD* p, const StringW* text, const Font* font, const PointD* offset, double blurRadius, const Color* color)
+{
+  MyPaintEngine* engine = static_cast<MyPaintEngine*>(self->_engine);
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
 // ============================================================================
 // [Fog::MyPaintEngine - Clip]
 // ============================================================================
@@ -842,6 +888,8 @@ static void MyPaintEngine_init()
   v->blitImageInF = MyPaintEngine_blitImageInF;
   v->blitImageInD = MyPaintEngine_blitImageInD;
 
+  v->blitImages = MyPaintEngine_blitImages;
+
   v->blitMaskedImageAtI = MyPaintEngine_blitMaskedImageAtI;
   v->blitMaskedImageAtF = MyPaintEngine_blitMaskedImageAtF;
   v->blitMaskedImageAtD = MyPaintEngine_blitMaskedImageAtD;
@@ -866,6 +914,19 @@ static void MyPaintEngine_init()
   v->filterStrokedShapeF = MyPaintEngine_filterStrokedShapeF;
   v->filterStrokedShapeD = MyPaintEngine_filterStrokedShapeD;
 
+  // --------------------------------------------------------------------------
+  // [Shadow]
+  // --------------------------------------------------------------------------
+
+  v->drawShapeWithShadowF = MyPaintEngine_drawShapeWithShadowF;
+  v->drawShapeWithShadowD = MyPaintEngine_drawShapeWithShadowD;
+
+  v->fillShapeWithShadowF = MyPaintEngine_fillShapeWithShadowF;
+  v->fillShapeWithShadowD = MyPaintEngine_fillShapeWithShadowD;
+
+  v->fillTextWithShadowF = MyPaintEngine_fillTextWithShadowF;
+  v->fillTextWithShadowD = MyPaintEngine_fillTextWithShadowD;
+
   // --------------------------------------------------------------------------
   // [Clip]
   // --------------------------------------------------------------------------
@@ -1174,6 +1235,11 @@ static err_t FOG_CDECL NullPaintEngine_blitImage(Painter* self, const Any* p, co
   return ERR_RT_INVALID_STATE;
 }
 
+static err_t FOG_CDECL NullPaintEngine_blitImages(Painter* self, const Image* src, const BlitItem* items, size_t count)
+{
+  return ERR_RT_INVALID_STATE;
+}
+
 static err_t FOG_CDECL NullPaintEngine_blitMaskedImage(Painter* self, const Any* p, const Image* src, const Image* mask, const Any* sFragment, const Any* mFragment)
 {
   return ERR_RT_INVALID_STATE;
@@ -1198,6 +1264,30 @@ static err_t FOG_CDECL NullPaintEngine_filterShape(Painter* self, const FeBase*
   return ERR_RT_INVALID_STATE;
 }
 
+// ============================================================================
+// [Fog::NullPaintEngine - Shadow]
+// ============================================================================
+
+static err_t FOG_CDECL NullPaintEngine_shadowShapeF(Painter* self, uint32_t shapeType, const void* shapeData, const PointF* offset, float blurRadius, const Color* color)
+{
+  return ERR_RT_INVALID_STATE;
+}
+
+static err_t FOG_CDECL NullPaintEngine_shadowShapeD(Painter* self, uint32_t shapeType, const void* shapeData, const PointD* offset, double blurRadius, const Color* color)
+{
+  return ERR_RT_INVALID_STATE;
+}
+
+static err_t FOG_CDECL NullPaintEngine_shadowTextAtF(Painter* self, const PointF* p, const StringW* text, const Font* font, const PointF* offset, float blurRadius, const Color* color)
+{
+  return ERR_RT_INVALID_STATE;
+}
+
+static err_t FOG_CDECL NullPaintEngine_shadowTextAtD(Painter* self, const PointD* p, const StringW* text, const Font* font, const PointD* offset, double blurRadius, const Color* color)
+{
+  return ERR_RT_INVALID_STATE;
+}
+
 // ============================================================================
 // [Fog::NullPaintEngine - Clip]
 // ============================================================================
@@ -1421,6 +1511,8 @@ FOG_NO_EXPORT void NullPaintEngine_init()
   v->blitImageInF = (PaintEngineVTable::BlitImageInF)NullPaintEngine_blitImage;
   v->blitImageInD = (PaintEngineVTable::BlitImageInD)NullPaintEngine_blitImage;
 
+  v->blitImages = NullPaintEngine_blitImages;
+
   v->blitMaskedImageAtI = (PaintEngineVTable::BlitMaskedImageAtI)NullPaintEngine_blitMaskedImage;
   v->blitMaskedImageAtF = (PaintEngineVTable::BlitMaskedImageAtF)NullPaintEngine_blitMaskedImage;
   v->blitMaskedImageAtD = (PaintEngineVTable::BlitMaskedImageAtD)NullPaintEngine_blitMaskedImage;
@@ -1445,6 +1537,19 @@ FOG_NO_EXPORT void NullPaintEngine_init()
   v->filterStrokedShapeF = (PaintEngineVTable::FilterStrokedShapeF)NullPaintEngine_filterShape;
   v->filterStrokedShapeD = (PaintEngineVTable::FilterStrokedShapeD)NullPaintEngine_filterShape;
 
+  // --------------------------------------------------------------------------
+  // [Shadow]
+  // --------------------------------------------------------------------------
+
+  v->drawShapeWithShadowF = NullPaintEngine_shadowShapeF;
+  v->drawShapeWithShadowD = NullPaintEngine_shadowShapeD;
+
+  v->fillShapeWithShadowF = NullPaintEngine_shadowShapeF;
+  v->fillShapeWithShadowD = NullPaintEngine_shadowShapeD;
+
+  v->fillTextWithShadowF = NullPaintEngine_shadowTextAtF;
+  v->fillTextWithShadowD = NullPaintEngine_shadowTextAtD;
+
   // --------------------------------------------------------------------------
   // [Clip]
   // --------------------------------------------------------------------------
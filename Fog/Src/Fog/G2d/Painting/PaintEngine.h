@@ -14,6 +14,7 @@
 #include <Fog/G2d/Geometry/PathStroker.h>
 #include <Fog/G2d/Geometry/Transform.h>
 #include <Fog/G2d/Imaging/Image.h>
+#include <Fog/G2d/Painting/PaintParams.h>
 #include <Fog/G2d/Source/Color.h>
 #include <Fog/G2d/Source/Pattern.h>
 #include <Fog/G2d/Text/Font.h>
@@ -256,6 +257,8 @@ struct FOG_NO_EXPORT PaintEngineVTable
   typedef err_t (FOG_CDECL *BlitImageInF)(Painter* self, const RectF* r, const Image* src, const RectI* sFragment);
   typedef err_t (FOG_CDECL *BlitImageInD)(Painter* self, const RectD* r, const Image* src, const RectI* sFragment);
 
+  typedef err_t (FOG_CDECL *BlitImages)(Painter* self, const Image* src, const BlitItem* items, size_t count);
+
   typedef err_t (FOG_CDECL *BlitMaskedImageAtI)(Painter* self, const PointI* p, const Image* src, const Image* mask, const RectI* sFragment, const RectI* mFragment);
   typedef err_t (FOG_CDECL *BlitMaskedImageAtF)(Painter* self, const PointF* p, const Image* src, const Image* mask, const RectI* sFragment, const RectI* mFragment);
   typedef err_t (FOG_CDECL *BlitMaskedImageAtD)(Painter* self, const PointD* p, const Image* src, const Image* mask, const RectI* sFragment, const RectI* mFragment);
@@ -276,6 +279,8 @@ struct FOG_NO_EXPORT PaintEngineVTable
   BlitImageInF blitImageInF;
   BlitImageInD blitImageInD;
 
+  BlitImages blitImages;
+
   BlitMaskedImageAtI blitMaskedImageAtI;
   BlitMaskedImageAtF blitMaskedImageAtF;
   BlitMaskedImageAtD blitMaskedImageAtD;
@@ -316,6 +321,29 @@ struct FOG_NO_EXPORT PaintEngineVTable
   FilterShapeF filterStrokedShapeF;
   FilterShapeD filterStrokedShapeD;
 
+  // --------------------------------------------------------------------------
+  // [Types - Shadow]
+  // --------------------------------------------------------------------------
+
+  typedef err_t (FOG_CDECL *ShadowShapeF)(Painter* self, uint32_t shapeType, const void* shapeData, const PointF* offset, float blurRadius, const Color* color);
+  typedef err_t (FOG_CDECL *ShadowShapeD)(Painter* self, uint32_t shapeType, const void* shapeData, const PointD* offset, double blurRadius, const Color* color);
+
+  typedef err_t (FOG_CDECL *ShadowTextAtF)(Painter* self, const PointF* p, const StringW* text, const Font* font, const PointF* offset, float blurRadius, const Color* color);
+  typedef err_t (FOG_CDECL *ShadowTextAtD)(Painter* self, const PointD* p, const StringW* text, const Font* font, const PointD* offset, double blurRadius, const Color* color);
+
+  // --------------------------------------------------------------------------
+  // [Funcs - Shadow]
+  // --------------------------------------------------------------------------
+
+  ShadowShapeF drawShapeWithShadowF;
+  ShadowShapeD drawShapeWithShadowD;
+
+  ShadowShapeF fillShapeWithShadowF;
+  ShadowShapeD fillShapeWithShadowD;
+
+  ShadowTextAtF fillTextWithShadowF;
+  ShadowTextAtD fillTextWithShadowD;
+
   // --------------------------------------------------------------------------
   // [Types - Clip]
   // --------------------------------------------------------------------------
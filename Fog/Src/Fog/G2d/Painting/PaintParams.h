@@ -10,6 +10,9 @@
 // [Dependencies]
 #include <Fog/Core/Global/Global.h>
 #include <Fog/G2d/Geometry/PathStroker.h>
+#include <Fog/G2d/Geometry/Point.h>
+#include <Fog/G2d/Geometry/Rect.h>
+#include <Fog/G2d/Geometry/Transform.h>
 #include <Fog/G2d/Source/Color.h>
 #include <Fog/G2d/Source/Pattern.h>
 
@@ -38,6 +41,7 @@ union FOG_NO_EXPORT PaintHints
     outlinedText = 0;
     geometricPrecision = GEOMETRIC_PRECISION_NORMAL;
     fillRule = FILL_RULE_DEFAULT;
+    colorSpace = COLOR_SPACE_DEFAULT;
     reserved = 0;
   }
 
@@ -55,7 +59,8 @@ union FOG_NO_EXPORT PaintHints
     uint32_t fastLine : 1;
     uint32_t geometricPrecision : 1;
     uint32_t fillRule : 1;
-    uint32_t reserved : 8;
+    uint32_t colorSpace : 1;
+    uint32_t reserved : 7;
   };
 
   uint32_t packed;
@@ -116,6 +121,9 @@ struct FOG_NO_EXPORT PaintParamsF
   FOG_INLINE uint32_t getFillRule() const { return _hints.fillRule; }
   FOG_INLINE void setFillRule(uint32_t fillRule) { _hints.fillRule = fillRule; }
 
+  FOG_INLINE uint32_t getColorSpace() const { return _hints.colorSpace; }
+  FOG_INLINE void setColorSpace(uint32_t colorSpace) { _hints.colorSpace = colorSpace; }
+
   // --------------------------------------------------------------------------
   // [Accessors - StrokeParams]
   // --------------------------------------------------------------------------
@@ -227,6 +235,9 @@ struct FOG_NO_EXPORT PaintParamsD
   FOG_INLINE uint32_t getFillRule() const { return _hints.fillRule; }
   FOG_INLINE void setFillRule(uint32_t fillRule) { _hints.fillRule = fillRule; }
 
+  FOG_INLINE uint32_t getColorSpace() const { return _hints.colorSpace; }
+  FOG_INLINE void setColorSpace(uint32_t colorSpace) { _hints.colorSpace = colorSpace; }
+
   // --------------------------------------------------------------------------
   // [Accessors - StrokeParams]
   // --------------------------------------------------------------------------
@@ -284,6 +295,99 @@ struct FOG_NO_EXPORT PaintParamsD
   PaintHints _hints;
 };
 
+// ============================================================================
+// [Fog::BlitItem]
+// ============================================================================
+
+//! @brief Image fragment blitted by @c Painter::blitImages().
+//!
+//! The fragment of the atlas image is blitted to the destination point, or
+//! scaled into the destination rectangle if @c BLIT_ITEM_SCALED flag is set.
+//! The opacity is multiplied by the painter opacity and the optional transform
+//! is applied before the painter transform, like @c Painter::transform() called
+//! between @c Painter::save() and @c Painter::restore().
+struct FOG_NO_EXPORT BlitItem
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE BlitItem() :
+    _fragment(0, 0, 0, 0),
+    _dst(0.0, 0.0, 0.0, 0.0),
+    _transform(NULL),
+    _opacity(1.0f),
+    _flags(BLIT_ITEM_NO_FLAGS)
+  {
+  }
+
+  FOG_INLINE BlitItem(const PointD& pt, const RectI& fragment, float opacity = 1.0f, const TransformD* tr = NULL) :
+    _fragment(fragment),
+    _dst(pt.x, pt.y, 0.0, 0.0),
+    _transform(tr),
+    _opacity(opacity),
+    _flags(BLIT_ITEM_NO_FLAGS)
+  {
+  }
+
+  FOG_INLINE BlitItem(const RectD& rect, const RectI& fragment, float opacity = 1.0f, const TransformD* tr = NULL) :
+    _fragment(fragment),
+    _dst(rect),
+    _transform(tr),
+    _opacity(opacity),
+    _flags(BLIT_ITEM_SCALED)
+  {
+  }
+
+  explicit FOG_INLINE BlitItem(_Uninitialized) {}
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE const RectI& getFragment() const { return _fragment; }
+  FOG_INLINE void setFragment(const RectI& fragment) { _fragment = fragment; }
+
+  FOG_INLINE const RectD& getDst() const { return _dst; }
+  FOG_INLINE PointD getDstPoint() const { return PointD(_dst.x, _dst.y); }
+
+  FOG_INLINE void setDstPoint(const PointD& pt)
+  {
+    _dst.setRect(pt.x, pt.y, 0.0, 0.0);
+    _flags &= ~BLIT_ITEM_SCALED;
+  }
+
+  FOG_INLINE void setDstRect(const RectD& rect)
+  {
+    _dst = rect;
+    _flags |= BLIT_ITEM_SCALED;
+  }
+
+  FOG_INLINE const TransformD* getTransform() const { return _transform; }
+  FOG_INLINE void setTransform(const TransformD* tr) { _transform = tr; }
+
+  FOG_INLINE float getOpacity() const { return _opacity; }
+  FOG_INLINE void setOpacity(float opacity) { _opacity = opacity; }
+
+  FOG_INLINE uint32_t getFlags() const { return _flags; }
+  FOG_INLINE bool isScaled() const { return (_flags & BLIT_ITEM_SCALED) != 0; }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Fragment of the atlas image.
+  RectI _fragment;
+  //! @brief Destination point (x, y) or rectangle (if @c BLIT_ITEM_SCALED).
+  RectD _dst;
+  //! @brief Optional transform (not owned, can be shared by more items).
+  const TransformD* _transform;
+  //! @brief Opacity (0.0 to 1.0).
+  float _opacity;
+  //! @brief Flags, see @c BLIT_ITEM_FLAGS.
+  uint32_t _flags;
+};
+
 //! @}
 
 } // Fog namespace
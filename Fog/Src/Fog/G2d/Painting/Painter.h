@@ -437,6 +437,28 @@ struct FOG_NO_EXPORT Painter
     return _vtable->resetParameter(this, PAINTER_PARAMETER_GRADIENT_QUALITY_I);
   }
 
+  // --------------------------------------------------------------------------
+  // [Parameters - Paint Hints - Color Space]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the color space used by compositing (see @c COLOR_SPACE).
+  FOG_INLINE err_t getColorSpace(uint32_t& val) const
+  {
+    return _vtable->getParameter(this, PAINTER_PARAMETER_COLOR_SPACE_I, &val);
+  }
+
+  //! @brief Set the color space used by compositing (see @c COLOR_SPACE).
+  FOG_INLINE err_t setColorSpace(uint32_t val)
+  {
+    return _vtable->setParameter(this, PAINTER_PARAMETER_COLOR_SPACE_I, &val);
+  }
+
+  //! @brief Reset the color space used by compositing.
+  FOG_INLINE err_t resetColorSpace()
+  {
+    return _vtable->resetParameter(this, PAINTER_PARAMETER_COLOR_SPACE_I);
+  }
+
   // --------------------------------------------------------------------------
   // [Parameters - Paint Hints - Outlined Text Hint]
   // --------------------------------------------------------------------------
@@ -1322,6 +1344,12 @@ struct FOG_NO_EXPORT Painter
   FOG_INLINE err_t blitImage(const RectF& r, const Image& src, const RectI& sFragment) { return _vtable->blitImageInF(this, &r, &src, &sFragment); }
   FOG_INLINE err_t blitImage(const RectD& r, const Image& src, const RectI& sFragment) { return _vtable->blitImageInD(this, &r, &src, &sFragment); }
 
+  //! @brief Blit @a count fragments of the @a atlas image described by @a items.
+  //!
+  //! The result is the same as calling @c blitImage() for each item, but the
+  //! clipping and the source setup are done once for the whole batch.
+  FOG_INLINE err_t blitImages(const Image& atlas, const BlitItem* items, size_t count) { return _vtable->blitImages(this, &atlas, items, count); }
+
   FOG_INLINE err_t blitMaskedImage(const PointI& p, const Image& src, const Image& mask) { return _vtable->blitMaskedImageAtI(this, &p, &src, &mask, NULL, NULL); }
   FOG_INLINE err_t blitMaskedImage(const PointF& p, const Image& src, const Image& mask) { return _vtable->blitMaskedImageAtF(this, &p, &src, &mask, NULL, NULL); }
   FOG_INLINE err_t blitMaskedImage(const PointD& p, const Image& src, const Image& mask) { return _vtable->blitMaskedImageAtD(this, &p, &src, &mask, NULL, NULL); }
@@ -1377,6 +1405,30 @@ struct FOG_NO_EXPORT Painter
   FOG_INLINE err_t filterStrokedPath(const ImageFilter& filter, const PathF& p) { return _vtable->filterStrokedShapeF(this, filter.getFeData(), SHAPE_TYPE_PATH, &p); }
   FOG_INLINE err_t filterStrokedPath(const ImageFilter& filter, const PathD& p) { return _vtable->filterStrokedShapeD(this, filter.getFeData(), SHAPE_TYPE_PATH, &p); }
 
+  // --------------------------------------------------------------------------
+  // [Shadow]
+  // --------------------------------------------------------------------------
+
+  // Paint a drop-shadow (or an outer glow if offset is zero) of the shape and
+  // then the shape itself. The shadow offset and blur radius are in device
+  // pixels and are not affected by the transform, the shadow is painted using
+  // the solid color and the current compositing operator and opacity.
+
+  FOG_INLINE err_t drawShapeWithShadow(const ShapeF& shape, const PointF& offset, float blurRadius, const Color& color) { return _vtable->drawShapeWithShadowF(this, shape.getType(), shape.getData(), &offset, blurRadius, &color); }
+  FOG_INLINE err_t drawShapeWithShadow(const ShapeD& shape, const PointD& offset, double blurRadius, const Color& color) { return _vtable->drawShapeWithShadowD(this, shape.getType(), shape.getData(), &offset, blurRadius, &color); }
+
+  FOG_INLINE err_t drawPathWithShadow(const PathF& p, const PointF& offset, float blurRadius, const Color& color) { return _vtable->drawShapeWithShadowF(this, SHAPE_TYPE_PATH, &p, &offset, blurRadius, &color); }
+  FOG_INLINE err_t drawPathWithShadow(const PathD& p, const PointD& offset, double blurRadius, const Color& color) { return _vtable->drawShapeWithShadowD(this, SHAPE_TYPE_PATH, &p, &offset, blurRadius, &color); }
+
+  FOG_INLINE err_t fillShapeWithShadow(const ShapeF& shape, const PointF& offset, float blurRadius, const Color& color) { return _vtable->fillShapeWithShadowF(this, shape.getType(), shape.getData(), &offset, blurRadius, &color); }
+  FOG_INLINE err_t fillShapeWithShadow(const ShapeD& shape, const PointD& offset, double blurRadius, const Color& color) { return _vtable->fillShapeWithShadowD(this, shape.getType(), shape.getData(), &offset, blurRadius, &color); }
+
+  FOG_INLINE err_t fillPathWithShadow(const PathF& p, const PointF& offset, float blurRadius, const Color& color) { return _vtable->fillShapeWithShadowF(this, SHAPE_TYPE_PATH, &p, &offset, blurRadius, &color); }
+  FOG_INLINE err_t fillPathWithShadow(const PathD& p, const PointD& offset, double blurRadius, const Color& color) { return _vtable->fillShapeWithShadowD(this, SHAPE_TYPE_PATH, &p, &offset, blurRadius, &color); }
+
+  FOG_INLINE err_t fillTextWithShadow(const PointF& p, const StringW& text, const Font& font, const PointF& offset, float blurRadius, const Color& color) { return _vtable->fillTextWithShadowF(this, &p, &text, &font, &offset, blurRadius, &color); }
+  FOG_INLINE err_t fillTextWithShadow(const PointD& p, const StringW& text, const Font& font, const PointD& offset, double blurRadius, const Color& color) { return _vtable->fillTextWithShadowD(this, &p, &text, &font, &offset, blurRadius, &color); }
+
   // --------------------------------------------------------------------------
   // [Clip]
   // --------------------------------------------------------------------------
@@ -478,6 +478,24 @@ struct FOG_NO_EXPORT ApiRaster
     return &compositeCore[format][op];
   }
 
+  //! @brief Get compositing functions for a given color space.
+  //!
+  //! Only core operators have linear-light variants, the @c compositeLinear
+  //! table is initialized to sRGB functions for combinations which are not
+  //! supported.
+  FOG_INLINE const RasterCompositeCoreFuncs* getCompositeCore(uint32_t format, uint32_t op, uint32_t colorSpace) const
+  {
+    FOG_ASSERT(format < IMAGE_FORMAT_COUNT);
+    FOG_ASSERT(op >= RASTER_COMPOSITE_CORE_START &&
+               op <  RASTER_COMPOSITE_CORE_START + RASTER_COMPOSITE_CORE_COUNT);
+    FOG_ASSERT(colorSpace < COLOR_SPACE_COUNT);
+
+    if (colorSpace == COLOR_SPACE_LINEAR)
+      return &compositeLinear[format][op];
+    else
+      return &compositeCore[format][op];
+  }
+
   // --------------------------------------------------------------------------
   // [Accessors - Composite - Extended]
   // --------------------------------------------------------------------------
@@ -545,12 +563,50 @@ struct FOG_NO_EXPORT ApiRaster
     }
   }
 
+  // --------------------------------------------------------------------------
+  // [Accessors - Composite - Unified (Color Space)]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RasterCBlitLineFunc getCBlitLine(uint32_t dstFormat, uint32_t op, uint32_t isOpaque, uint32_t colorSpace)
+  {
+    if (RasterUtil::isCompositeCoreOp(op))
+      return getCompositeCore(dstFormat, op, colorSpace)->cblit_line[isOpaque];
+    else
+      return getCompositeExt(dstFormat, op)->cblit_line[isOpaque];
+  }
+
+  FOG_INLINE RasterCBlitSpanFunc getCBlitSpan(uint32_t dstFormat, uint32_t op, uint32_t isOpaque, uint32_t colorSpace)
+  {
+    if (RasterUtil::isCompositeCoreOp(op))
+      return getCompositeCore(dstFormat, op, colorSpace)->cblit_span[isOpaque];
+    else
+      return getCompositeExt(dstFormat, op)->cblit_span[isOpaque];
+  }
+
+  FOG_INLINE RasterVBlitLineFunc getVBlitLine(uint32_t dstFormat, uint32_t op, uint32_t srcFormat, uint32_t colorSpace)
+  {
+    if (RasterUtil::isCompositeCoreOp(op))
+      return getCompositeCore(dstFormat, op, colorSpace)->vblit_line[srcFormat];
+    else
+      return getVBlitLine(dstFormat, op, srcFormat);
+  }
+
+  FOG_INLINE RasterVBlitSpanFunc getVBlitSpan(uint32_t dstFormat, uint32_t op, uint32_t srcFormat, uint32_t colorSpace)
+  {
+    if (RasterUtil::isCompositeCoreOp(op))
+      return getCompositeCore(dstFormat, op, colorSpace)->vblit_span[srcFormat];
+    else
+      return getVBlitSpan(dstFormat, op, srcFormat);
+  }
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
 
   RasterConvertFuncs convert;
   RasterCompositeCoreFuncs compositeCore[IMAGE_FORMAT_COUNT][RASTER_COMPOSITE_CORE_COUNT];
+  //! @brief Linear-light compositing functions (@c COLOR_SPACE_LINEAR).
+  RasterCompositeCoreFuncs compositeLinear[IMAGE_FORMAT_COUNT][RASTER_COMPOSITE_CORE_COUNT];
   RasterCompositeExtFuncs compositeExt[IMAGE_FORMAT_COUNT][RASTER_COMPOSITE_EXT_COUNT];
 
   RasterSolidFuncs solid;
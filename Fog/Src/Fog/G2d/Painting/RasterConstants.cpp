@@ -9,6 +9,7 @@
 #endif // FOG_PRECOMP
 
 // [Dependencies]
+#include <Fog/Core/Math/Math.h>
 #include <Fog/G2d/Painting/RasterConstants_p.h>
 
 namespace Fog {
@@ -92,6 +93,44 @@ const uint8_t _raster_blur_stack_8_shr[256] =
   24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 32
 };
 
+// ============================================================================
+// [Fog::Raster - Data - Linear]
+// ============================================================================
+
+uint16_t _raster_linear_from_srgb8[256];
+uint8_t _raster_srgb8_from_linear[RASTER_LINEAR_LUT_SIZE];
+
+static FOG_INLINE double _raster_linearFromSRgb(double x)
+{
+  return x <= 0.04045 ? x / 12.92 : Math::pow((x + 0.055) / 1.055, 2.4);
+}
+
+static FOG_INLINE double _raster_sRgbFromLinear(double x)
+{
+  return x <= 0.0031308 ? x * 12.92 : 1.055 * Math::pow(x, 1.0 / 2.4) - 0.055;
+}
+
+void _raster_initLinearTables(void)
+{
+  uint i;
+
+  for (i = 0; i < 256; i++)
+  {
+    double x = _raster_linearFromSRgb(double(int(i)) / 255.0);
+    _raster_linear_from_srgb8[i] = (uint16_t)Math::iround(x * 65535.0);
+  }
+
+  // Each entry is sampled in the middle of its interval, this guarantees that
+  // the 'sRGB -> linear -> sRGB' conversion is lossless for all 8-bit values.
+  for (i = 0; i < RASTER_LINEAR_LUT_SIZE; i++)
+  {
+    double x = (double(int(i << RASTER_LINEAR_LUT_SHIFT)) + double(1 << RASTER_LINEAR_LUT_SHIFT) * 0.5) / 65535.0;
+    int v = Math::iround(_raster_sRgbFromLinear(x) * 255.0);
+
+    _raster_srgb8_from_linear[i] = (uint8_t)Math::bound<int>(v, 0, 255);
+  }
+}
+
 // ============================================================================
 // [Fog::Raster - Data - CompatibleFormat]
 // ============================================================================
@@ -50,6 +50,26 @@ enum RASTER_CORE
   RASTER_MAX_THREADS_SUGGESTED = 16
 };
 
+// ============================================================================
+// [Fog::RASTER_LINEAR]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Constants used by linear-light compositing (@c COLOR_SPACE_LINEAR).
+enum RASTER_LINEAR
+{
+  //! @brief Count of pixels converted to linear-light at once.
+  RASTER_LINEAR_CHUNK_SIZE = 128,
+
+  //! @brief Count of bits used to index the linear to sRGB table.
+  RASTER_LINEAR_LUT_BITS = 12,
+  //! @brief Shift needed to convert a 16-bit linear value to the LUT index.
+  RASTER_LINEAR_LUT_SHIFT = 16 - RASTER_LINEAR_LUT_BITS,
+  //! @brief Size of the linear to sRGB table.
+  RASTER_LINEAR_LUT_SIZE = 1 << RASTER_LINEAR_LUT_BITS
+};
+
 // ============================================================================
 // [RASTER_BSWAP]
 // ============================================================================
@@ -745,6 +765,40 @@ enum RASTER_SOURCE
   RASTER_SOURCE_GRADIENT = 4
 };
 
+// ============================================================================
+// [Fog::RASTER_GROUP_BUFFER]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Group buffer (layer) constants.
+enum RASTER_GROUP_BUFFER
+{
+  //! @brief Size of the group tile in pixels, only tiles touched by the group
+  //! commands are cleared and composited by @ref Painter::paintGroup().
+  RASTER_GROUP_TILE_SIZE = 64,
+
+  //! @brief Count of dirty boxes tracked per group (the nearest boxes are
+  //! merged when the count is exceeded).
+  RASTER_GROUP_DIRTY_COUNT = 8,
+
+  //! @brief Count of group buffers kept by the paint engine for reuse.
+  RASTER_GROUP_POOL_SIZE = 4
+};
+
+// ============================================================================
+// [Fog::RASTER_PATTERN_CACHE]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Pattern-context cache constants.
+enum RASTER_PATTERN_CACHE
+{
+  //! @brief Count of recently used pattern-contexts kept by the paint engine.
+  RASTER_PATTERN_CACHE_SIZE = 4
+};
+
 // ============================================================================
 // [Fog::RASTER_SPAN]
 // ============================================================================
@@ -896,6 +950,27 @@ extern FOG_NO_EXPORT const uint16_t _raster_blur_stack_8_mul[256];
 //! @internal
 extern FOG_NO_EXPORT const uint8_t _raster_blur_stack_8_shr[256];
 
+// ============================================================================
+// [Fog::Raster - Data - Linear]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief sRGB (8-bit) to linear-light (16-bit) table.
+extern FOG_NO_EXPORT uint16_t _raster_linear_from_srgb8[256];
+
+//! @internal
+//!
+//! @brief Linear-light (16-bit shifted by @c RASTER_LINEAR_LUT_SHIFT) to sRGB
+//! (8-bit) table.
+extern FOG_NO_EXPORT uint8_t _raster_srgb8_from_linear[RASTER_LINEAR_LUT_SIZE];
+
+//! @internal
+//!
+//! @brief Initialize @c _raster_linear_from_srgb8 and
+//! @c _raster_srgb8_from_linear tables.
+FOG_NO_EXPORT void _raster_initLinearTables(void);
+
 // ============================================================================
 // [Fog::Raster - Data - CompatibleFormat]
 // ============================================================================
@@ -26,6 +26,7 @@ FOG_NO_EXPORT void RasterOps_init_C(void);
 FOG_NO_EXPORT void RasterOps_init_skipped(void);
 
 FOG_CPU_DECLARE_INITIALIZER_SSE2( RasterOps_init_SSE2(void) )
+FOG_CPU_DECLARE_INITIALIZER_AVX2( RasterOps_init_AVX2(void) )
 
 // ============================================================================
 // [Fog::G2d - Initialization / Finalization]
@@ -33,6 +34,9 @@ FOG_CPU_DECLARE_INITIALIZER_SSE2( RasterOps_init_SSE2(void) )
 
 FOG_NO_EXPORT void RasterOps_init(void)
 {
+  // Tables used by linear-light compositing.
+  _raster_initLinearTables();
+
   // Install C optimized code (default).
   RasterOps_init_C();
 
@@ -41,6 +45,7 @@ FOG_NO_EXPORT void RasterOps_init(void)
   // --------------------------------------------------------------------------
 
   FOG_CPU_USE_INITIALIZER_SSE2( RasterOps_init_SSE2() )
+  FOG_CPU_USE_INITIALIZER_AVX2( RasterOps_init_AVX2() )
 
   // --------------------------------------------------------------------------
   // [Init-Skipped]
@@ -92,7 +97,7 @@ FOG_NO_EXPORT void RasterOps_init_skipped(void)
   // pointers are always marked as 'SKIP' in the code.
 
   ApiRaster& api = _api_raster;
-  uint i, j;
+  uint i, j, k;
 
   // --------------------------------------------------------------------------
   // [RasterOps - Convert - API]
@@ -310,6 +315,11 @@ FOG_NO_EXPORT void RasterOps_init_skipped(void)
   INIT_VBLIT_BY_EOP(RGB24 , XRGB32, DST_IN  , DST     );
   INIT_VBLIT_BY_EOP(RGB24 , RGB24 , DST_IN  , DST     );
 
+  // Replace 'A DstIn A' by 'A SrcIn A'.
+  INIT_CBLIT_BY_EOP(A8    , PRGB  , DST_IN  , SRC_IN  );
+  INIT_VBLIT_BY_EOP(A8    , PRGB32, DST_IN  , SRC_IN  );
+  INIT_VBLIT_BY_EOP(A8    , A8    , DST_IN  , SRC_IN  );
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - DstOut]
   // --------------------------------------------------------------------------
@@ -351,10 +361,10 @@ FOG_NO_EXPORT void RasterOps_init_skipped(void)
   INIT_VBLIT_BY_EOP(RGB24 , XRGB32, DST_ATOP, DST     );
   INIT_VBLIT_BY_EOP(RGB24 , RGB24 , DST_ATOP, DST     );
 
-  // Replace 'A DstOver A' by 'A Src A'.
-  INIT_CBLIT_BY_COP(A8    , PRGB  , DST_OVER, SRC     );
-  INIT_VBLIT_BY_COP(A8    , PRGB32, DST_OVER, SRC     );
-  INIT_VBLIT_BY_COP(A8    , A8    , DST_OVER, SRC     );
+  // Replace 'A DstAtop A' by 'A Src A'.
+  INIT_CBLIT_BY_COP(A8    , PRGB  , DST_ATOP, SRC     );
+  INIT_VBLIT_BY_COP(A8    , PRGB32, DST_ATOP, SRC     );
+  INIT_VBLIT_BY_COP(A8    , A8    , DST_ATOP, SRC     );
 
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - Xor]
@@ -379,6 +389,38 @@ FOG_NO_EXPORT void RasterOps_init_skipped(void)
   INIT_VBLIT_BY_EOP(RGB24 , XRGB32, XOR     , CLEAR   );
   INIT_VBLIT_BY_EOP(RGB24 , RGB24 , XOR     , CLEAR   );
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - A8]
+  // --------------------------------------------------------------------------
+
+  // The 'A' destination has no color, the XRGB source is handled as opaque
+  // PRGB source, the result is only affected by the alpha of the source.
+  for (i = RASTER_COMPOSITE_EXT_START; i < COMPOSITE_COUNT; i++)
+  {
+    RasterCompositeExtFuncs& fA8 = api.compositeExt[IMAGE_FORMAT_A8][i - RASTER_COMPOSITE_EXT_START];
+
+    fA8.cblit_line[RASTER_CBLIT_XRGB] = fA8.cblit_line[RASTER_CBLIT_PRGB];
+    fA8.cblit_span[RASTER_CBLIT_XRGB] = fA8.cblit_span[RASTER_CBLIT_PRGB];
+  }
+
+  // All blend modes produce 'Sa + Da - Sa.Da' alpha, replace
+  // 'A Blend A' by 'A SrcOver A'.
+  for (i = COMPOSITE_MINUS; i <= COMPOSITE_EXCLUSION; i++)
+  {
+    RasterCompositeExtFuncs& fA8 = api.compositeExt[IMAGE_FORMAT_A8][i - RASTER_COMPOSITE_EXT_START];
+    RasterCompositeCoreFuncs& fOver = api.compositeCore[IMAGE_FORMAT_A8][RASTER_COMPOSITE_CORE_SRC_OVER];
+
+    fA8.cblit_line[RASTER_CBLIT_PRGB] = fOver.cblit_line[RASTER_CBLIT_PRGB];
+    fA8.cblit_line[RASTER_CBLIT_XRGB] = fOver.cblit_line[RASTER_CBLIT_PRGB];
+    fA8.cblit_span[RASTER_CBLIT_PRGB] = fOver.cblit_span[RASTER_CBLIT_PRGB];
+    fA8.cblit_span[RASTER_CBLIT_XRGB] = fOver.cblit_span[RASTER_CBLIT_PRGB];
+
+    fA8.vblit_line[RASTER_VBLIT_A8_AND_PRGB32] = fOver.vblit_line[IMAGE_FORMAT_PRGB32];
+    fA8.vblit_line[RASTER_VBLIT_A8_AND_A8    ] = fOver.vblit_line[IMAGE_FORMAT_A8    ];
+    fA8.vblit_span[RASTER_VBLIT_A8_AND_PRGB32] = fOver.vblit_span[IMAGE_FORMAT_PRGB32];
+    fA8.vblit_span[RASTER_VBLIT_A8_AND_A8    ] = fOver.vblit_span[IMAGE_FORMAT_A8    ];
+  }
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - ColorDodge]
   // --------------------------------------------------------------------------
@@ -406,6 +448,34 @@ FOG_NO_EXPORT void RasterOps_init_skipped(void)
 
   // Replace 'PRGB Exclusion A8' by 'PRGB Difference A8'.
   INIT_VBLIT_BY_EOP(PRGB32, A8    , EXCLUSION, DIFFERENCE);
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Linear]
+  // --------------------------------------------------------------------------
+
+  // Formats and functions without linear-light variant composite in sRGB.
+  for (i = 0; i < IMAGE_FORMAT_COUNT; i++)
+  {
+    for (j = 0; j < RASTER_COMPOSITE_CORE_COUNT; j++)
+    {
+      RasterCompositeCoreFuncs& fCore = api.compositeCore[i][j];
+      RasterCompositeCoreFuncs& fLinear = api.compositeLinear[i][j];
+
+      for (k = 0; k < RASTER_CBLIT_COUNT; k++)
+      {
+        if (fLinear.cblit_rect[k] == NULL) fLinear.cblit_rect[k] = fCore.cblit_rect[k];
+        if (fLinear.cblit_line[k] == NULL) fLinear.cblit_line[k] = fCore.cblit_line[k];
+        if (fLinear.cblit_span[k] == NULL) fLinear.cblit_span[k] = fCore.cblit_span[k];
+      }
+
+      for (k = 0; k < IMAGE_FORMAT_COUNT; k++)
+      {
+        if (fLinear.vblit_rect[k] == NULL) fLinear.vblit_rect[k] = fCore.vblit_rect[k];
+        if (fLinear.vblit_line[k] == NULL) fLinear.vblit_line[k] = fCore.vblit_line[k];
+        if (fLinear.vblit_span[k] == NULL) fLinear.vblit_span[k] = fCore.vblit_span[k];
+      }
+    }
+  }
 }
 
 } // Fog namespace
@@ -0,0 +1,96 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+
+#include <Fog/G2d/Painting/RasterApi_p.h>
+#include <Fog/G2d/Painting/RasterConstants_p.h>
+#include <Fog/G2d/Painting/RasterInit_p.h>
+
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseConvert_p.h>
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void RasterOps_init_AVX2(void)
+{
+  ApiRaster& api = _api_raster;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - API]
+  // --------------------------------------------------------------------------
+
+  RasterConvertFuncs& convert = api.convert;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - BSwap]
+  // --------------------------------------------------------------------------
+
+  convert.bswap[RASTER_BSWAP_24] = (ImageConverterBlitLineFunc)RasterOps_AVX2::Convert::bswap_24;
+  convert.bswap[RASTER_BSWAP_32] = (ImageConverterBlitLineFunc)RasterOps_AVX2::Convert::bswap_32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - Premultiply / Demultiply]
+  // --------------------------------------------------------------------------
+
+  convert.prgb32_from_argb32 = (ImageConverterBlitLineFunc)RasterOps_AVX2::Convert::prgb32_from_argb32;
+  convert.argb32_from_prgb32 = (ImageConverterBlitLineFunc)RasterOps_AVX2::Convert::argb32_from_prgb32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Src - PRGB32]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_PRGB32][RASTER_COMPOSITE_CORE_SRC];
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_RGB24    ], RasterOps_AVX2::Convert::prgb32_from_rgb24);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_A8       ], RasterOps_AVX2::Convert::prgb32_from_a8);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB64   ], RasterOps_AVX2::Convert::prgb32_from_prgb64);
+  }
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Src - XRGB32]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_XRGB32][RASTER_COMPOSITE_CORE_SRC];
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_RGB24    ], RasterOps_AVX2::Convert::prgb32_from_rgb24);
+  }
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Src - RGB24]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_RGB24][RASTER_COMPOSITE_CORE_SRC];
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::Convert::rgb24_from_xrgb32);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_XRGB32   ], RasterOps_AVX2::Convert::rgb24_from_xrgb32);
+  }
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Src - PRGB64]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_PRGB64][RASTER_COMPOSITE_CORE_SRC];
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_AVX2::Convert::prgb64_from_prgb32);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_XRGB32   ], RasterOps_AVX2::Convert::prgb64_from_xrgb32);
+  }
+}
+
+} // Fog namespace
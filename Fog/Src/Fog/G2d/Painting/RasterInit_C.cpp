@@ -23,6 +23,7 @@
 #include <Fog/G2d/Painting/RasterOps_C/CompositeBase_p.h>
 #include <Fog/G2d/Painting/RasterOps_C/CompositeClear_p.h>
 #include <Fog/G2d/Painting/RasterOps_C/CompositeExt_p.h>
+#include <Fog/G2d/Painting/RasterOps_C/CompositeLinear_p.h>
 #include <Fog/G2d/Painting/RasterOps_C/CompositeNop_p.h>
 #include <Fog/G2d/Painting/RasterOps_C/CompositeSrc_p.h>
 #include <Fog/G2d/Painting/RasterOps_C/CompositeSrcOver_p.h>
@@ -396,6 +397,22 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
   }
 #endif // FOG_RASTER_INIT_C
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Src - PRGB64]
+  // --------------------------------------------------------------------------
+
+#if defined(FOG_RASTER_INIT_C)
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_PRGB64][RASTER_COMPOSITE_CORE_SRC];
+
+    // Painting to PRGB64 is not supported, only the conversions from the most
+    // common formats (used by ImageConverter) are provided.
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_C::Convert::prgb64_from_prgb32);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_XRGB32   ], RasterOps_C::Convert::prgb64_from_xrgb32);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB64   ], RasterOps_C::Convert::copy_64);
+  }
+#endif // FOG_RASTER_INIT_C
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - SrcOver - PRGB32]
   // --------------------------------------------------------------------------
@@ -464,6 +481,19 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
   }
 #endif // FOG_RASTER_INIT_C
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Linear]
+  // --------------------------------------------------------------------------
+
+  // Only PRGB32 and XRGB32 destinations have linear-light compositing, other
+  // formats are filled from compositeCore by RasterOps_init_skipped().
+#if defined(FOG_RASTER_INIT_C)
+  RasterOps_C::CompositeLinear_init<RasterOps_C::LinearBlend, IMAGE_FORMAT_PRGB32, RASTER_COMPOSITE_CORE_SRC     >(api.compositeLinear[IMAGE_FORMAT_PRGB32][RASTER_COMPOSITE_CORE_SRC     ]);
+  RasterOps_C::CompositeLinear_init<RasterOps_C::LinearBlend, IMAGE_FORMAT_PRGB32, RASTER_COMPOSITE_CORE_SRC_OVER>(api.compositeLinear[IMAGE_FORMAT_PRGB32][RASTER_COMPOSITE_CORE_SRC_OVER]);
+  RasterOps_C::CompositeLinear_init<RasterOps_C::LinearBlend, IMAGE_FORMAT_XRGB32, RASTER_COMPOSITE_CORE_SRC     >(api.compositeLinear[IMAGE_FORMAT_XRGB32][RASTER_COMPOSITE_CORE_SRC     ]);
+  RasterOps_C::CompositeLinear_init<RasterOps_C::LinearBlend, IMAGE_FORMAT_XRGB32, RASTER_COMPOSITE_CORE_SRC_OVER>(api.compositeLinear[IMAGE_FORMAT_XRGB32][RASTER_COMPOSITE_CORE_SRC_OVER]);
+#endif // FOG_RASTER_INIT_C
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - SrcOver - RGB24]
   // --------------------------------------------------------------------------
@@ -502,7 +532,35 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
   // [RasterOps - Composite - SrcOver - A8]
   // --------------------------------------------------------------------------
 
-  // TODO: Image compositing.
+#if defined(FOG_RASTER_INIT_C)
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_A8][RASTER_COMPOSITE_CORE_SRC_OVER];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB     ], RasterOps_C::CompositeSrcOver::a8_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB     ], RasterOps_C::CompositeSrcOver::a8_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_C::CompositeSrcOver::a8_vblit_prgb32_line);
+    FOG_RASTER_SKIP(vblit_line[IMAGE_FORMAT_XRGB32   ]);
+    FOG_RASTER_SKIP(vblit_line[IMAGE_FORMAT_RGB24    ]);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_A8       ], RasterOps_C::CompositeSrcOver::a8_vblit_a8_line);
+  //FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_I8       ], RasterOps_C::CompositeSrcOver::a8_vblit_i8_line);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB64   ], RasterOps_C::CompositeSrcOver::a8_vblit_prgb64_line);
+    FOG_RASTER_SKIP(vblit_line[IMAGE_FORMAT_RGB48    ]);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_A16      ], RasterOps_C::CompositeSrcOver::a8_vblit_a16_line);
+
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_PRGB32   ], RasterOps_C::CompositeSrcOver::a8_vblit_prgb32_span);
+    FOG_RASTER_SKIP(vblit_span[IMAGE_FORMAT_XRGB32   ]);
+    FOG_RASTER_SKIP(vblit_span[IMAGE_FORMAT_RGB24    ]);
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_A8       ], RasterOps_C::CompositeSrcOver::a8_vblit_a8_span);
+  //FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_I8       ], RasterOps_C::CompositeSrcOver::a8_vblit_i8_span);
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_PRGB64   ], RasterOps_C::CompositeSrcOver::a8_vblit_prgb64_span);
+    FOG_RASTER_SKIP(vblit_span[IMAGE_FORMAT_RGB48    ]);
+    FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_A16      ], RasterOps_C::CompositeSrcOver::a8_vblit_a16_span);
+  }
+#endif // FOG_RASTER_INIT_C
 
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - Clear - PRGB32]
@@ -646,6 +704,26 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
     FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_XRGB32_AND_RGB24 ]);
   }
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - SrcIn - A8]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeExtFuncs& funcs = api.compositeExt[IMAGE_FORMAT_A8][RASTER_COMPOSITE_EXT_SRC_IN];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositeSrcIn::a8_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositeSrcIn::a8_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositeSrcIn::a8_vblit_prgb32_line);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositeSrcIn::a8_vblit_a8_line);
+
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositeSrcIn::a8_vblit_prgb32_span);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositeSrcIn::a8_vblit_a8_span);
+  }
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - SrcOut - PRGB32]
   // --------------------------------------------------------------------------
@@ -692,6 +770,26 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
     FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_XRGB32_AND_RGB24 ]);
   }
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - SrcOut - A8]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeExtFuncs& funcs = api.compositeExt[IMAGE_FORMAT_A8][RASTER_COMPOSITE_EXT_SRC_OUT];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositeSrcOut::a8_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositeSrcOut::a8_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositeSrcOut::a8_vblit_prgb32_line);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositeSrcOut::a8_vblit_a8_line);
+
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositeSrcOut::a8_vblit_prgb32_span);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositeSrcOut::a8_vblit_a8_span);
+  }
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - SrcAtop - PRGB32]
   // --------------------------------------------------------------------------
@@ -876,6 +974,26 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
     FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_XRGB32_AND_RGB24 ]);
   }
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - DstOut - A8]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeExtFuncs& funcs = api.compositeExt[IMAGE_FORMAT_A8][RASTER_COMPOSITE_EXT_DST_OUT];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositeDstOut::a8_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositeDstOut::a8_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositeDstOut::a8_vblit_prgb32_line);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositeDstOut::a8_vblit_a8_line);
+
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositeDstOut::a8_vblit_prgb32_span);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositeDstOut::a8_vblit_a8_span);
+  }
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - DstAtop - PRGB32]
   // --------------------------------------------------------------------------
@@ -968,6 +1086,26 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
     FOG_RASTER_SKIP(vblit_span[RASTER_VBLIT_XRGB32_AND_RGB24 ]);
   }
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Xor - A8]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeExtFuncs& funcs = api.compositeExt[IMAGE_FORMAT_A8][RASTER_COMPOSITE_EXT_XOR];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositeXor::a8_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositeXor::a8_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositeXor::a8_vblit_prgb32_line);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositeXor::a8_vblit_a8_line);
+
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositeXor::a8_vblit_prgb32_span);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositeXor::a8_vblit_a8_span);
+  }
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - Plus - PRGB32]
   // --------------------------------------------------------------------------
@@ -1014,6 +1152,26 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
     FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_XRGB32_AND_RGB24 ], RasterOps_C::CompositePlus::xrgb32_vblit_rgb24_span);
   }
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Plus - A8]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeExtFuncs& funcs = api.compositeExt[IMAGE_FORMAT_A8][RASTER_COMPOSITE_EXT_PLUS];
+
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositePlus::a8_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB             ], RasterOps_C::CompositePlus::a8_cblit_prgb32_span);
+    FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB             ]);
+
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositePlus::a8_vblit_prgb32_line);
+    FOG_RASTER_INIT(vblit_line[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositePlus::a8_vblit_a8_line);
+
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_PRGB32    ], RasterOps_C::CompositePlus::a8_vblit_prgb32_span);
+    FOG_RASTER_INIT(vblit_span[RASTER_VBLIT_A8_AND_A8        ], RasterOps_C::CompositePlus::a8_vblit_a8_span);
+  }
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - Minus - PRGB32]
   // --------------------------------------------------------------------------
@@ -1876,7 +2034,53 @@ FOG_NO_EXPORT void RasterOps_init_C(void)
   // [RasterOps - Pattern - Texture - Projection]
   // --------------------------------------------------------------------------
 
-  // TODO: Texture-Projection fetcher.
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_pad<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_nearest_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_nearest [IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_nearest_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_RGB24 ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_RGB24 >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_A8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_A8    >;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_I8    ][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_C::PTextureAccessor_PRGB32_From_I8    >;
 
 #endif // FOG_RASTER_INIT_C
 
@@ -23,6 +23,7 @@
 #include <Fog/G2d/Painting/RasterOps_SSE2/CompositeBase_p.h>
 #include <Fog/G2d/Painting/RasterOps_SSE2/CompositeClear_p.h>
 #include <Fog/G2d/Painting/RasterOps_SSE2/CompositeExt_p.h>
+#include <Fog/G2d/Painting/RasterOps_SSE2/CompositeLinear_p.h>
 #include <Fog/G2d/Painting/RasterOps_SSE2/CompositeSrc_p.h>
 #include <Fog/G2d/Painting/RasterOps_SSE2/CompositeSrcOver_p.h>
 
@@ -72,6 +73,19 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
   */
   convert.fill[RASTER_FILL_8] = (ImageConverterBlitLineFunc)RasterOps_SSE2::Convert::fill_8;
   convert.fill[RASTER_FILL_16] = (ImageConverterBlitLineFunc)RasterOps_SSE2::Convert::fill_16;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - BSwap]
+  // --------------------------------------------------------------------------
+
+  convert.bswap[RASTER_BSWAP_32] = (ImageConverterBlitLineFunc)RasterOps_SSE2::Convert::bswap_32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Convert - Premultiply / Demultiply]
+  // --------------------------------------------------------------------------
+
+  convert.prgb32_from_argb32 = (ImageConverterBlitLineFunc)RasterOps_SSE2::Convert::prgb32_from_argb32;
+  convert.argb32_from_prgb32 = (ImageConverterBlitLineFunc)RasterOps_SSE2::Convert::argb32_from_prgb32;
   /*
   // --------------------------------------------------------------------------
   // [RasterOps - Convert - BSwap]
@@ -235,6 +249,9 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
 
     FOG_RASTER_INIT(cblit_span[RASTER_CBLIT_PRGB     ], RasterOps_SSE2::CompositeSrc::prgb32_cblit_prgb32_span);
     FOG_RASTER_SKIP(cblit_span[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_A8       ], RasterOps_SSE2::Convert::prgb32_from_a8);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB64   ], RasterOps_SSE2::Convert::prgb32_from_prgb64);
 /*
     FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_SSE2::Convert::copy_32);
     FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_XRGB32   ], RasterOps_SSE2::CompositeSrc::prgb32_vblit_xrgb32_line);
@@ -289,6 +306,17 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
 */
   }
 
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Src - PRGB64]
+  // --------------------------------------------------------------------------
+
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_PRGB64][RASTER_COMPOSITE_CORE_SRC];
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_SSE2::Convert::prgb64_from_prgb32);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_XRGB32   ], RasterOps_SSE2::Convert::prgb64_from_xrgb32);
+  }
+
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - Src - RGB24]
   // --------------------------------------------------------------------------
@@ -422,6 +450,15 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
     FOG_RASTER_INIT(vblit_span[IMAGE_FORMAT_A16      ], RasterOps_SSE2::CompositeSrcOver::prgb32_vblit_a16_span);
 */
   }
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Composite - Linear]
+  // --------------------------------------------------------------------------
+
+  RasterOps_C::CompositeLinear_init<RasterOps_SSE2::LinearBlend, IMAGE_FORMAT_PRGB32, RASTER_COMPOSITE_CORE_SRC     >(api.compositeLinear[IMAGE_FORMAT_PRGB32][RASTER_COMPOSITE_CORE_SRC     ]);
+  RasterOps_C::CompositeLinear_init<RasterOps_SSE2::LinearBlend, IMAGE_FORMAT_PRGB32, RASTER_COMPOSITE_CORE_SRC_OVER>(api.compositeLinear[IMAGE_FORMAT_PRGB32][RASTER_COMPOSITE_CORE_SRC_OVER]);
+  RasterOps_C::CompositeLinear_init<RasterOps_SSE2::LinearBlend, IMAGE_FORMAT_XRGB32, RASTER_COMPOSITE_CORE_SRC     >(api.compositeLinear[IMAGE_FORMAT_XRGB32][RASTER_COMPOSITE_CORE_SRC     ]);
+  RasterOps_C::CompositeLinear_init<RasterOps_SSE2::LinearBlend, IMAGE_FORMAT_XRGB32, RASTER_COMPOSITE_CORE_SRC_OVER>(api.compositeLinear[IMAGE_FORMAT_XRGB32][RASTER_COMPOSITE_CORE_SRC_OVER]);
 /*
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - SrcOver - RGB24]
@@ -459,7 +496,19 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
   // [RasterOps - Composite - SrcOver - A8]
   // --------------------------------------------------------------------------
 
-  // TODO: Image compositing.
+  {
+    RasterCompositeCoreFuncs& funcs = api.compositeCore[IMAGE_FORMAT_A8][RASTER_COMPOSITE_CORE_SRC_OVER];
+
+    // Only the line functions are accelerated, spans are handled by the C
+    // implementation.
+    FOG_RASTER_INIT(cblit_line[RASTER_CBLIT_PRGB     ], RasterOps_SSE2::CompositeSrcOver::a8_cblit_prgb32_line);
+    FOG_RASTER_SKIP(cblit_line[RASTER_CBLIT_XRGB     ]);
+
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_PRGB32   ], RasterOps_SSE2::CompositeSrcOver::a8_vblit_prgb32_line);
+    FOG_RASTER_SKIP(vblit_line[IMAGE_FORMAT_XRGB32   ]);
+    FOG_RASTER_SKIP(vblit_line[IMAGE_FORMAT_RGB24    ]);
+    FOG_RASTER_INIT(vblit_line[IMAGE_FORMAT_A8       ], RasterOps_SSE2::CompositeSrcOver::a8_vblit_a8_line);
+  }
   /*
   // --------------------------------------------------------------------------
   // [RasterOps - Composite - Clear - PRGB32]
@@ -1546,6 +1595,28 @@ FOG_NO_EXPORT void RasterOps_init_SSE2(void)
 
   gradient.interpolate[IMAGE_FORMAT_PRGB32] = RasterOps_SSE2::PGradientBase::interpolate_prgb32;
   gradient.interpolate[IMAGE_FORMAT_XRGB32] = RasterOps_SSE2::PGradientBase::interpolate_prgb32;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Texture - API]
+  // --------------------------------------------------------------------------
+
+  RasterTextureFuncs& texture = api.texture;
+
+  // --------------------------------------------------------------------------
+  // [RasterOps - Pattern - Texture - Projection]
+  // --------------------------------------------------------------------------
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_PAD    ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_pad<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REPEAT ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_repeat<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_REFLECT] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_reflect<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
+
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_PRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_PRGB32>;
+  texture.prgb32.fetch_proj_bilinear[IMAGE_FORMAT_XRGB32][TEXTURE_TILE_CLAMP  ] = RasterOps_C::PTextureProjection::fetch_proj_bilinear_clamp<RasterOps_SSE2::PTextureAccessor_PRGB32_From_XRGB32>;
 }
 
 } // Fog namespace
@@ -0,0 +1,386 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASECONVERT_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASECONVERT_P_H
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/BaseConvert_p.h>
+#include <Fog/G2d/Painting/RasterOps_C/CompositeSrc_p.h>
+
+// [Dependencies - RasterOps_AVX2]
+#include <Fog/G2d/Painting/RasterOps_AVX2/BaseDefs_p.h>
+
+namespace Fog {
+namespace RasterOps_AVX2 {
+
+// ============================================================================
+// [Fog::RasterOps_AVX2 - Convert]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief AVX2 converters.
+//!
+//! Each function converts 8 or 16 pixels per iteration and passes the tail to
+//! the C implementation. The results are the same as the results of the SSE2
+//! converters.
+struct FOG_NO_EXPORT Convert
+{
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  //! @brief Load 8 packed 24-bit pixels, 4 pixels in each 128-bit lane.
+  //!
+  //! Reads 28 bytes from @a src, the caller must guarantee at least 10 pixels.
+  static FOG_INLINE __m256i load8x24(const uint8_t* src)
+  {
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12));
+
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+  }
+
+  //! @brief Store 8 packed 24-bit pixels, 12 bytes in each 128-bit lane.
+  //!
+  //! Writes exactly 24 bytes to @a dst.
+  static FOG_INLINE void store8x24(uint8_t* dst, __m256i x)
+  {
+    x = _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(x));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 16), _mm256_extracti128_si256(x, 1));
+  }
+
+  // ==========================================================================
+  // [BSwap - 24]
+  // ==========================================================================
+
+  static void FOG_FASTCALL bswap_24(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    __m256i mask = FOG_YMM_SHUFFLE_MASK(
+      2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 0x80, 0x80, 0x80, 0x80);
+
+    while (w >= 10)
+    {
+      __m256i ymm0 = load8x24(src);
+
+      ymm0 = _mm256_shuffle_epi8(ymm0, mask);
+      store8x24(dst, ymm0);
+
+      dst += 24;
+      src += 24;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::Convert::bswap_24(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [BSwap - 32]
+  // ==========================================================================
+
+  static void FOG_FASTCALL bswap_32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    __m256i mask = FOG_YMM_SHUFFLE_MASK(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+    while (w >= 8)
+    {
+      __m256i ymm0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+
+      ymm0 = _mm256_shuffle_epi8(ymm0, mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), ymm0);
+
+      dst += 32;
+      src += 32;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::Convert::bswap_32(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [Convert - Premultiply / Demultiply]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_from_argb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    __m256i zero = _mm256_setzero_si256();
+    __m256i a255 = _mm256_set1_epi64x((int64_t)FOG_UINT64_C(0x00FF000000000000));
+    __m256i c0080 = _mm256_set1_epi16(0x0080);
+
+    while (w >= 8)
+    {
+      __m256i ymm0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+      __m256i ymm1 = _mm256_unpackhi_epi8(ymm0, zero);
+      __m256i alpha0, alpha1;
+
+      ymm0 = _mm256_unpacklo_epi8(ymm0, zero);
+
+      // Broadcast alpha into all components, alpha itself is multiplied by 255.
+      alpha0 = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(ymm0, 0xFF), 0xFF);
+      alpha1 = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(ymm1, 0xFF), 0xFF);
+      alpha0 = _mm256_or_si256(alpha0, a255);
+      alpha1 = _mm256_or_si256(alpha1, a255);
+
+      ymm0 = _mm256_mullo_epi16(ymm0, alpha0);
+      ymm1 = _mm256_mullo_epi16(ymm1, alpha1);
+
+      // (t + (t >> 8) + 0x80) >> 8, rounded the same way as the C tail
+      // (Acc::p32PRGB32FromARGB32()).
+      ymm0 = _mm256_add_epi16(ymm0, _mm256_add_epi16(_mm256_srli_epi16(ymm0, 8), c0080));
+      ymm1 = _mm256_add_epi16(ymm1, _mm256_add_epi16(_mm256_srli_epi16(ymm1, 8), c0080));
+      ymm0 = _mm256_srli_epi16(ymm0, 8);
+      ymm1 = _mm256_srli_epi16(ymm1, 8);
+
+      ymm0 = _mm256_packus_epi16(ymm0, ymm1);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), ymm0);
+
+      dst += 32;
+      src += 32;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::Convert::prgb32_from_argb32(dst, src, w, closure);
+  }
+
+  static void FOG_FASTCALL argb32_from_prgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    const int* rcpTable = reinterpret_cast<const int*>(Acc::_u8_divide_table_d);
+
+    __m256i cFF = _mm256_set1_epi32(0x000000FF);
+    __m256i cFF00 = _mm256_set1_epi32(0x0000FF00);
+    __m256i cFF0000 = _mm256_set1_epi32(0x00FF0000);
+    __m256i cFF000000 = _mm256_set1_epi32((int)0xFF000000U);
+
+    while (w >= 8)
+    {
+      __m256i pix = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+      __m256i rcp = _mm256_i32gather_epi32(rcpTable, _mm256_srli_epi32(pix, 24), 4);
+
+      // The same as Acc::p32ARGB32FromPRGB32(), but 8 pixels at a time.
+      __m256i r = _mm256_mullo_epi32(_mm256_and_si256(_mm256_srli_epi32(pix, 16), cFF), rcp);
+      __m256i g = _mm256_mullo_epi32(_mm256_and_si256(_mm256_srli_epi32(pix,  8), cFF), rcp);
+      __m256i b = _mm256_mullo_epi32(_mm256_and_si256(pix, cFF), rcp);
+
+      r = _mm256_and_si256(r, cFF0000);
+      g = _mm256_and_si256(_mm256_srli_epi32(g, 8), cFF00);
+      b = _mm256_srli_epi32(b, 16);
+
+      pix = _mm256_and_si256(pix, cFF000000);
+      pix = _mm256_or_si256(_mm256_or_si256(pix, r), _mm256_or_si256(g, b));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), pix);
+
+      dst += 32;
+      src += 32;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::Convert::argb32_from_prgb32(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [Convert - PRGB32 <- RGB24]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_from_rgb24(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    __m256i mask = FOG_YMM_SHUFFLE_MASK(
+      0, 1, 2, 0x80, 3, 4, 5, 0x80, 6, 7, 8, 0x80, 9, 10, 11, 0x80);
+    __m256i alpha = _mm256_set1_epi32((int)0xFF000000U);
+
+    while (w >= 10)
+    {
+      __m256i ymm0 = load8x24(src);
+
+      ymm0 = _mm256_shuffle_epi8(ymm0, mask);
+      ymm0 = _mm256_or_si256(ymm0, alpha);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), ymm0);
+
+      dst += 32;
+      src += 24;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::CompositeSrc::prgb32_vblit_rgb24_line(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [Convert - RGB24 <- XRGB32]
+  // ==========================================================================
+
+  static void FOG_FASTCALL rgb24_from_xrgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    __m256i mask = FOG_YMM_SHUFFLE_MASK(
+      0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, 0x80, 0x80, 0x80, 0x80);
+
+    while (w >= 8)
+    {
+      __m256i ymm0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+
+      ymm0 = _mm256_shuffle_epi8(ymm0, mask);
+      store8x24(dst, ymm0);
+
+      dst += 24;
+      src += 32;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::CompositeSrc::rgb24_vblit_xrgb32_line(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [Convert - PRGB32 <- A8]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_from_a8(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    __m256i mask0 = _mm256_setr_epi8(
+       0,  0,  0,  0,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3,
+       4,  4,  4,  4,  5,  5,  5,  5,  6,  6,  6,  6,  7,  7,  7,  7);
+    __m256i mask1 = _mm256_setr_epi8(
+       8,  8,  8,  8,  9,  9,  9,  9, 10, 10, 10, 10, 11, 11, 11, 11,
+      12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15);
+
+    while (w >= 16)
+    {
+      __m256i ymm0 = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+      __m256i ymm1 = _mm256_shuffle_epi8(ymm0, mask1);
+
+      ymm0 = _mm256_shuffle_epi8(ymm0, mask0);
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst +  0), ymm0);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), ymm1);
+
+      dst += 64;
+      src += 16;
+      w -= 16;
+    }
+
+    if (w)
+      RasterOps_C::CompositeSrc::prgb32_vblit_a8_line(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [Convert - PRGB32 <-> PRGB64]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_from_prgb64(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 8)
+    {
+      __m256i ymm0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src +  0));
+      __m256i ymm1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 32));
+
+      // Take the high byte of each 16-bit component, packus works in lanes so
+      // the quad-words have to be reordered.
+      ymm0 = _mm256_packus_epi16(_mm256_srli_epi16(ymm0, 8), _mm256_srli_epi16(ymm1, 8));
+      ymm0 = _mm256_permute4x64_epi64(ymm0, _MM_SHUFFLE(3, 1, 2, 0));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), ymm0);
+
+      dst += 32;
+      src += 64;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::CompositeSrc::prgb32_vblit_prgb64_line(dst, src, w, closure);
+  }
+
+  static void FOG_FASTCALL prgb64_from_prgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 8)
+    {
+      __m256i ymm0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+      __m256i ymm1;
+
+      // Unpacking the byte with itself is the same as multiplying by 0x0101.
+      ymm0 = _mm256_permute4x64_epi64(ymm0, _MM_SHUFFLE(3, 1, 2, 0));
+      ymm1 = _mm256_unpackhi_epi8(ymm0, ymm0);
+      ymm0 = _mm256_unpacklo_epi8(ymm0, ymm0);
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst +  0), ymm0);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), ymm1);
+
+      dst += 64;
+      src += 32;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::Convert::prgb64_from_prgb32(dst, src, w, closure);
+  }
+
+  static void FOG_FASTCALL prgb64_from_xrgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    __m256i alpha = _mm256_set1_epi32((int)0xFF000000U);
+
+    while (w >= 8)
+    {
+      __m256i ymm0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+      __m256i ymm1;
+
+      ymm0 = _mm256_or_si256(ymm0, alpha);
+      ymm0 = _mm256_permute4x64_epi64(ymm0, _MM_SHUFFLE(3, 1, 2, 0));
+      ymm1 = _mm256_unpackhi_epi8(ymm0, ymm0);
+      ymm0 = _mm256_unpacklo_epi8(ymm0, ymm0);
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst +  0), ymm0);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), ymm1);
+
+      dst += 64;
+      src += 32;
+      w -= 8;
+    }
+
+    if (w)
+      RasterOps_C::Convert::prgb64_from_xrgb32(dst, src, w, closure);
+  }
+};
+
+} // RasterOps_AVX2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASECONVERT_P_H
@@ -0,0 +1,36 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEDEFS_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEDEFS_P_H
+
+// [Dependencies]
+#include <Fog/Core/C++/IntrinAvx2.h>
+
+// [Dependencies - RasterOps_C]
+#include <Fog/G2d/Painting/RasterOps_C/BaseDefs_p.h>
+
+// ============================================================================
+// [FOG_YMM_SHUFFLE_MASK]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Create a pshufb mask which is the same in both 128-bit lanes.
+#define FOG_YMM_SHUFFLE_MASK(_B0_, _B1_, _B2_, _B3_, _B4_, _B5_, _B6_, _B7_, \
+                             _B8_, _B9_, _BA_, _BB_, _BC_, _BD_, _BE_, _BF_) \
+  _mm256_setr_epi8( \
+    (char)(_B0_), (char)(_B1_), (char)(_B2_), (char)(_B3_), \
+    (char)(_B4_), (char)(_B5_), (char)(_B6_), (char)(_B7_), \
+    (char)(_B8_), (char)(_B9_), (char)(_BA_), (char)(_BB_), \
+    (char)(_BC_), (char)(_BD_), (char)(_BE_), (char)(_BF_), \
+    (char)(_B0_), (char)(_B1_), (char)(_B2_), (char)(_B3_), \
+    (char)(_B4_), (char)(_B5_), (char)(_B6_), (char)(_B7_), \
+    (char)(_B8_), (char)(_B9_), (char)(_BA_), (char)(_BB_), \
+    (char)(_BC_), (char)(_BD_), (char)(_BE_), (char)(_BF_))
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_AVX2_BASEDEFS_P_H
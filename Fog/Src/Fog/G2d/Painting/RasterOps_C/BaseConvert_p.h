@@ -1127,6 +1127,43 @@ struct FOG_NO_EXPORT Convert
     } while (--w);
   }
 
+  // ==========================================================================
+  // [Convert - PRGB64 <- PRGB32/XRGB32]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb64_from_prgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    do {
+      uint32_t c0;
+      __p64 c1;
+
+      Acc::p32Load4a(c0, src);
+      Acc::p64PRGB64FromPRGB32(c1, c0);
+      Acc::p64Store8a(dst, c1);
+
+      dst += 8;
+      src += 4;
+    } while (--w);
+  }
+
+  static void FOG_FASTCALL prgb64_from_xrgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    do {
+      uint32_t c0;
+      __p64 c1;
+
+      Acc::p32Load4a(c0, src);
+      Acc::p64PRGB64FromPRGB32(c1, c0);
+      Acc::p64FillPWW3(c1, c1);
+      Acc::p64Store8a(dst, c1);
+
+      dst += 8;
+      src += 4;
+    } while (--w);
+  }
+
   // ==========================================================================
   // [Convert - ARGB32 <- Custom]
   // ==========================================================================
@@ -99,6 +99,389 @@ struct FOG_NO_EXPORT CompositeBase
   };
 };
 
+// ============================================================================
+// [Fog::RasterOps_C - CompositeA8]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Template used to composite into the A8 destination.
+//!
+//! Only the alpha channel is stored by the A8 format, so every operator can
+//! be expressed by a scalar function 'CompositeOp::a8_op_a8(dst, Da, Sa)'.
+//! Coverage (mask) is applied by interpolating between the original and the
+//! composited value, which is valid for both, bound and unbound operators.
+template<typename CompositeOp>
+struct CompositeA8
+{
+  // ==========================================================================
+  // [Func - Helpers]
+  // ==========================================================================
+
+  static FOG_INLINE void a8_op_a8_msk(
+    uint32_t& dst0p, const uint32_t& src0p, const uint32_t& msk0p, const uint32_t& minv0p)
+  {
+    uint32_t res0p;
+    CompositeOp::a8_op_a8(res0p, dst0p, src0p);
+
+    dst0p = (res0p * msk0p + dst0p * minv0p) >> 8;
+  }
+
+  // ==========================================================================
+  // [A8 - CBlit - PRGB32 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_cblit_prgb32_line(
+    uint8_t* dst, const RasterSolid* src, int w, const RasterClosure* closure)
+  {
+    uint32_t sra0p = src->prgb32.a;
+
+    FOG_BLIT_LOOP_8x1_INIT()
+
+    FOG_BLIT_LOOP_8x1_BEGIN(C_Opaque)
+      uint32_t dst0p;
+
+      Acc::p32Load1b(dst0p, dst);
+      CompositeOp::a8_op_a8(dst0p, dst0p, sra0p);
+      Acc::p32Store1b(dst, dst0p);
+
+      dst += 1;
+    FOG_BLIT_LOOP_8x1_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [A8 - CBlit - PRGB32 - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_cblit_prgb32_span(
+    uint8_t* dst, const RasterSolid* src, const RasterSpan* span, const RasterClosure* closure)
+  {
+    uint32_t sra0p = src->prgb32.a;
+
+    FOG_CBLIT_SPAN8_BEGIN(1)
+
+    // ------------------------------------------------------------------------
+    // [C-Opaque]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_C_OPAQUE()
+    {
+      FOG_BLIT_LOOP_8x1_INIT()
+
+      FOG_BLIT_LOOP_8x1_BEGIN(C_Opaque)
+        uint32_t dst0p;
+
+        Acc::p32Load1b(dst0p, dst);
+        CompositeOp::a8_op_a8(dst0p, dst0p, sra0p);
+        Acc::p32Store1b(dst, dst0p);
+
+        dst += 1;
+      FOG_BLIT_LOOP_8x1_END(C_Opaque)
+    }
+
+    // ------------------------------------------------------------------------
+    // [C-Mask]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_C_MASK()
+    {
+      uint32_t msk0p;
+      uint32_t minv0p;
+
+      Acc::p32Copy(msk0p, msk0);
+      Acc::p32Negate256SBW(minv0p, msk0p);
+
+      FOG_BLIT_LOOP_8x1_INIT()
+
+      FOG_BLIT_LOOP_8x1_BEGIN(C_Mask)
+        uint32_t dst0p;
+
+        Acc::p32Load1b(dst0p, dst);
+        a8_op_a8_msk(dst0p, sra0p, msk0p, minv0p);
+        Acc::p32Store1b(dst, dst0p);
+
+        dst += 1;
+      FOG_BLIT_LOOP_8x1_END(C_Mask)
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8/ARGB32-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_OR_ARGB32_GLYPH()
+    {
+      FOG_BLIT_LOOP_8x1_INIT()
+
+      FOG_BLIT_LOOP_8x1_BEGIN(A8_Glyph)
+        uint32_t dst0p;
+        uint32_t msk0p;
+        uint32_t minv0p;
+
+        Acc::p32Load1b(msk0p, msk);
+        if (msk0p == 0x00) goto _A8_Glyph_Skip;
+
+        Acc::p32Load1b(dst0p, dst);
+        Acc::p32Cvt256SBWFrom255SBW(msk0p, msk0p);
+        Acc::p32Negate256SBW(minv0p, msk0p);
+
+        a8_op_a8_msk(dst0p, sra0p, msk0p, minv0p);
+        Acc::p32Store1b(dst, dst0p);
+
+_A8_Glyph_Skip:
+        dst += 1;
+        msk += MskSize;
+      FOG_BLIT_LOOP_8x1_END(A8_Glyph)
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Extra]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_A8_EXTRA()
+    {
+      FOG_BLIT_LOOP_8x1_INIT()
+
+      FOG_BLIT_LOOP_8x1_BEGIN(A8_Extra)
+        uint32_t dst0p;
+        uint32_t msk0p;
+        uint32_t minv0p;
+
+        Acc::p32Load2a(msk0p, msk);
+        Acc::p32Load1b(dst0p, dst);
+        Acc::p32Negate256SBW(minv0p, msk0p);
+
+        a8_op_a8_msk(dst0p, sra0p, msk0p, minv0p);
+        Acc::p32Store1b(dst, dst0p);
+
+        dst += 1;
+        msk += 2;
+      FOG_BLIT_LOOP_8x1_END(A8_Extra)
+    }
+
+    FOG_CBLIT_SPAN8_END()
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - Any - Line]
+  // ==========================================================================
+
+  template<uint SrcSize, uint SrcA>
+  static FOG_INLINE void _a8_vblit_any_line(
+    uint8_t* dst, const uint8_t* src, int w)
+  {
+    FOG_BLIT_LOOP_8x1_INIT()
+    src += SrcA;
+
+    FOG_BLIT_LOOP_8x1_BEGIN(C_Opaque)
+      uint32_t dst0p;
+      uint32_t src0p;
+
+      Acc::p32Load1b(dst0p, dst);
+      Acc::p32Load1b(src0p, src);
+
+      CompositeOp::a8_op_a8(dst0p, dst0p, src0p);
+      Acc::p32Store1b(dst, dst0p);
+
+      dst += 1;
+      src += SrcSize;
+    FOG_BLIT_LOOP_8x1_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - Any - Span]
+  // ==========================================================================
+
+  template<uint SrcSize, uint SrcA>
+  static FOG_INLINE void _a8_vblit_any_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    FOG_VBLIT_SPAN8_BEGIN(1)
+
+    // ------------------------------------------------------------------------
+    // [C-Opaque]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_C_OPAQUE()
+    {
+      _a8_vblit_any_line<SrcSize, SrcA>(dst, src, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [C-Mask]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_C_MASK()
+    {
+      uint32_t msk0p;
+      uint32_t minv0p;
+
+      Acc::p32Copy(msk0p, msk0);
+      Acc::p32Negate256SBW(minv0p, msk0p);
+
+      FOG_BLIT_LOOP_8x1_INIT()
+      src += SrcA;
+
+      FOG_BLIT_LOOP_8x1_BEGIN(C_Mask)
+        uint32_t dst0p;
+        uint32_t src0p;
+
+        Acc::p32Load1b(dst0p, dst);
+        Acc::p32Load1b(src0p, src);
+
+        a8_op_a8_msk(dst0p, src0p, msk0p, minv0p);
+        Acc::p32Store1b(dst, dst0p);
+
+        dst += 1;
+        src += SrcSize;
+      FOG_BLIT_LOOP_8x1_END(C_Mask)
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8/ARGB32-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_OR_ARGB32_GLYPH()
+    {
+      FOG_BLIT_LOOP_8x1_INIT()
+      src += SrcA;
+
+      FOG_BLIT_LOOP_8x1_BEGIN(A8_Glyph)
+        uint32_t dst0p;
+        uint32_t src0p;
+        uint32_t msk0p;
+        uint32_t minv0p;
+
+        Acc::p32Load1b(msk0p, msk);
+        if (msk0p == 0x00) goto _A8_Glyph_Skip;
+
+        Acc::p32Load1b(dst0p, dst);
+        Acc::p32Load1b(src0p, src);
+        Acc::p32Cvt256SBWFrom255SBW(msk0p, msk0p);
+        Acc::p32Negate256SBW(minv0p, msk0p);
+
+        a8_op_a8_msk(dst0p, src0p, msk0p, minv0p);
+        Acc::p32Store1b(dst, dst0p);
+
+_A8_Glyph_Skip:
+        dst += 1;
+        src += SrcSize;
+        msk += MskSize;
+      FOG_BLIT_LOOP_8x1_END(A8_Glyph)
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Extra]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_EXTRA()
+    {
+      FOG_BLIT_LOOP_8x1_INIT()
+      src += SrcA;
+
+      FOG_BLIT_LOOP_8x1_BEGIN(A8_Extra)
+        uint32_t dst0p;
+        uint32_t src0p;
+        uint32_t msk0p;
+        uint32_t minv0p;
+
+        Acc::p32Load2a(msk0p, msk);
+        Acc::p32Load1b(dst0p, dst);
+        Acc::p32Load1b(src0p, src);
+        Acc::p32Negate256SBW(minv0p, msk0p);
+
+        a8_op_a8_msk(dst0p, src0p, msk0p, minv0p);
+        Acc::p32Store1b(dst, dst0p);
+
+        dst += 1;
+        src += SrcSize;
+        msk += 2;
+      FOG_BLIT_LOOP_8x1_END(A8_Extra)
+    }
+
+    FOG_VBLIT_SPAN8_END()
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - PRGB32 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_prgb32_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    _a8_vblit_any_line<4, PIXEL_ARGB32_POS_A>(dst, src, w);
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - PRGB32 - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_prgb32_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _a8_vblit_any_span<4, PIXEL_ARGB32_POS_A>(dst, span, closure);
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - A8 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_a8_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    _a8_vblit_any_line<1, 0>(dst, src, w);
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - A8 - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_a8_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _a8_vblit_any_span<1, 0>(dst, span, closure);
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - PRGB64 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_prgb64_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    _a8_vblit_any_line<8, PIXEL_ARGB64_BYTE_A_HI>(dst, src, w);
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - PRGB64 - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_prgb64_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _a8_vblit_any_span<8, PIXEL_ARGB64_BYTE_A_HI>(dst, span, closure);
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - A16 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_a16_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    _a8_vblit_any_line<2, PIXEL_A16_BYTE_HI>(dst, src, w);
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - A16 - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_a16_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    _a8_vblit_any_span<2, PIXEL_A16_BYTE_HI>(dst, span, closure);
+  }
+};
+
 } // RasterOps_C namespace
 } // Fog namespace
 
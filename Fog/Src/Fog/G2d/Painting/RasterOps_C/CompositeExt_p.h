@@ -3428,8 +3428,19 @@ struct CompositeExtPrgbVsA
 //! @internal
 struct FOG_NO_EXPORT CompositeSrcIn : public CompositeExtSrcInSrcOut<
   CompositeSrcIn, RASTER_COMBINE_OP_SRC_IN, RASTER_PRGB_PREPARE_NONE,
-  false>
+  false>,
+  public CompositeA8<CompositeSrcIn>
 {
+  // ==========================================================================
+  // [Func - PixelA8 - Op - PixelA8]
+  // ==========================================================================
+
+  // Da' = Sa.Da.
+  static FOG_INLINE void a8_op_a8(
+    uint32_t& dst0p, const uint32_t& a0p, const uint32_t& b0p)
+  {
+    Acc::p32MulDiv255SBW(dst0p, a0p, b0p);
+  }
 };
 
 // ============================================================================
@@ -3439,8 +3450,21 @@ struct FOG_NO_EXPORT CompositeSrcIn : public CompositeExtSrcInSrcOut<
 //! @internal
 struct FOG_NO_EXPORT CompositeSrcOut : public CompositeExtSrcInSrcOut<
   CompositeSrcOut, RASTER_COMBINE_OP_SRC_OUT, RASTER_PRGB_PREPARE_NONE,
-  true>
+  true>,
+  public CompositeA8<CompositeSrcOut>
 {
+  // ==========================================================================
+  // [Func - PixelA8 - Op - PixelA8]
+  // ==========================================================================
+
+  // Da' = Sa.(1 - Da).
+  static FOG_INLINE void a8_op_a8(
+    uint32_t& dst0p, const uint32_t& a0p, const uint32_t& b0p)
+  {
+    uint32_t ainv0p;
+    Acc::p32Negate255SBW(ainv0p, a0p);
+    Acc::p32MulDiv255SBW(dst0p, ainv0p, b0p);
+  }
 };
 
 // ============================================================================
@@ -3818,7 +3842,8 @@ struct FOG_NO_EXPORT CompositeDstIn : public CompositeExtPrgbVsA<
 
 //! @internal
 struct FOG_NO_EXPORT CompositeDstOut : public CompositeExtPrgbVsA<
-  CompositeDstOut, RASTER_COMBINE_OP_DST_OUT, RASTER_PRGB_PREPARE_NONE>
+  CompositeDstOut, RASTER_COMBINE_OP_DST_OUT, RASTER_PRGB_PREPARE_NONE>,
+  public CompositeA8<CompositeDstOut>
 {
   // ==========================================================================
   // [Func - Pixel32 - Op - PixelA8]
@@ -4024,7 +4049,8 @@ struct FOG_NO_EXPORT CompositeDstAtop : public CompositeExtPrgbVsPrgb<
 
 //! @internal
 struct FOG_NO_EXPORT CompositeXor : public CompositeExtPrgbVsPrgb<
-  CompositeXor, RASTER_COMBINE_OP_XOR, RASTER_PRGB_PREPARE_NONE>
+  CompositeXor, RASTER_COMBINE_OP_XOR, RASTER_PRGB_PREPARE_NONE>,
+  public CompositeA8<CompositeXor>
 {
   // ==========================================================================
   // [Func - Pixel32 - Op - Pixel32]
@@ -4192,7 +4218,8 @@ struct FOG_NO_EXPORT CompositeXor : public CompositeExtPrgbVsPrgb<
 
 //! @internal
 struct FOG_NO_EXPORT CompositePlus : public CompositeExtPrgbVsPrgb<
-  CompositePlus, RASTER_COMBINE_OP_PLUS, RASTER_PRGB_PREPARE_FRGB>
+  CompositePlus, RASTER_COMBINE_OP_PLUS, RASTER_PRGB_PREPARE_FRGB>,
+  public CompositeA8<CompositePlus>
 {
   // ==========================================================================
   // [Func - Pixel32 - Op - Pixel32]
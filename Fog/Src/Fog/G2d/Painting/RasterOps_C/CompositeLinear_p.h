@@ -0,0 +1,589 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_C_COMPOSITELINEAR_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_C_COMPOSITELINEAR_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Painting/RasterOps_C/CompositeBase_p.h>
+
+namespace Fog {
+namespace RasterOps_C {
+
+// ============================================================================
+// [Fog::RasterOps_C - Linear - Introduction]
+// ============================================================================
+
+// Linear-light compositing converts the destination (and the source) to the
+// linear-light 16-bit premultiplied representation using lookup tables, blends
+// in that space and converts the result back to sRGB. The pixels are processed
+// in chunks of RASTER_LINEAR_CHUNK_SIZE pixels stored on the stack.
+//
+// The linear pixel is stored as four 16-bit components in the same order as
+// the bytes of ARGB32 pixel in memory, so the PIXEL_ARGB32_POS_A constant can
+// be used to get its alpha component. The mask is stored in the same format,
+// each component is in range [0, 256].
+//
+// Pixels where all mask components are zero are never written back, so the
+// destination is left untouched even if the 'sRGB -> linear -> sRGB' round
+// trip of a semi-transparent pixel is not lossless.
+
+// ============================================================================
+// [Fog::RasterOps_C - LinearMask]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Type of the mask converted by @c LinearMask::fill().
+enum LINEAR_MASK_TYPE
+{
+  LINEAR_MASK_CONST = 0,
+  LINEAR_MASK_A8_GLYPH = 1,
+  LINEAR_MASK_A8_EXTRA = 2,
+  LINEAR_MASK_ARGB32_GLYPH = 3
+};
+
+//! @internal
+struct FOG_NO_EXPORT LinearMask
+{
+  static FOG_INLINE uint32_t getBpp(uint32_t type)
+  {
+    static const uint8_t bpp[] = { 0, 1, 2, 4 };
+    return bpp[type];
+  }
+
+  static FOG_INLINE void fill(uint16_t* m, const uint8_t* msk, uint32_t msk0, uint32_t type, int w)
+  {
+    int i;
+
+    switch (type)
+    {
+      case LINEAR_MASK_CONST:
+        for (i = 0; i < w; i++, m += 4)
+        {
+          m[0] = m[1] = m[2] = m[3] = (uint16_t)msk0;
+        }
+        break;
+
+      case LINEAR_MASK_A8_GLYPH:
+        for (i = 0; i < w; i++, m += 4, msk += 1)
+        {
+          uint32_t m0 = msk[0];
+          m0 += m0 >> 7;
+          m[0] = m[1] = m[2] = m[3] = (uint16_t)m0;
+        }
+        break;
+
+      case LINEAR_MASK_A8_EXTRA:
+        for (i = 0; i < w; i++, m += 4, msk += 2)
+        {
+          uint32_t m0 = reinterpret_cast<const uint16_t*>(msk)[0];
+          m[0] = m[1] = m[2] = m[3] = (uint16_t)m0;
+        }
+        break;
+
+      case LINEAR_MASK_ARGB32_GLYPH:
+        for (i = 0; i < w; i++, m += 4, msk += 4)
+        {
+          m[0] = (uint16_t)(msk[0] + (msk[0] >> 7));
+          m[1] = (uint16_t)(msk[1] + (msk[1] >> 7));
+          m[2] = (uint16_t)(msk[2] + (msk[2] >> 7));
+          m[3] = (uint16_t)(msk[3] + (msk[3] >> 7));
+        }
+        break;
+
+      default:
+        FOG_ASSERT_NOT_REACHED();
+    }
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_C - LinearConvert]
+// ============================================================================
+
+//! @internal
+struct FOG_NO_EXPORT LinearConvert
+{
+  //! @brief Convert premultiplied sRGB pixel to the linear-light pixel.
+  static FOG_INLINE void fromPRGB32(uint16_t* lin, uint32_t pix)
+  {
+    uint32_t a = pix >> 24;
+
+    if (a == 0xFF)
+    {
+      lin[PIXEL_ARGB32_POS_R] = _raster_linear_from_srgb8[(pix >> 16) & 0xFF];
+      lin[PIXEL_ARGB32_POS_G] = _raster_linear_from_srgb8[(pix >>  8) & 0xFF];
+      lin[PIXEL_ARGB32_POS_B] = _raster_linear_from_srgb8[(pix      ) & 0xFF];
+      lin[PIXEL_ARGB32_POS_A] = 0xFFFF;
+    }
+    else if (a == 0x00)
+    {
+      lin[0] = lin[1] = lin[2] = lin[3] = 0;
+    }
+    else
+    {
+      uint32_t recip = Acc::_u8_divide_table_d[a];
+      uint32_t a16 = a * 257;
+
+      uint32_t r = _raster_linear_from_srgb8[(((pix >> 16) & 0xFF) * recip) >> 16];
+      uint32_t g = _raster_linear_from_srgb8[(((pix >>  8) & 0xFF) * recip) >> 16];
+      uint32_t b = _raster_linear_from_srgb8[(((pix      ) & 0xFF) * recip) >> 16];
+
+      lin[PIXEL_ARGB32_POS_R] = (uint16_t)((r * a16 + 0x8000) >> 16);
+      lin[PIXEL_ARGB32_POS_G] = (uint16_t)((g * a16 + 0x8000) >> 16);
+      lin[PIXEL_ARGB32_POS_B] = (uint16_t)((b * a16 + 0x8000) >> 16);
+      lin[PIXEL_ARGB32_POS_A] = (uint16_t)a16;
+    }
+  }
+
+  static FOG_INLINE void fromXRGB32(uint16_t* lin, uint32_t pix)
+  {
+    lin[PIXEL_ARGB32_POS_R] = _raster_linear_from_srgb8[(pix >> 16) & 0xFF];
+    lin[PIXEL_ARGB32_POS_G] = _raster_linear_from_srgb8[(pix >>  8) & 0xFF];
+    lin[PIXEL_ARGB32_POS_B] = _raster_linear_from_srgb8[(pix      ) & 0xFF];
+    lin[PIXEL_ARGB32_POS_A] = 0xFFFF;
+  }
+
+  //! @brief Convert the linear-light pixel back to premultiplied sRGB.
+  static FOG_INLINE uint32_t toPRGB32(const uint16_t* lin)
+  {
+    uint32_t a16 = lin[PIXEL_ARGB32_POS_A];
+    uint32_t r = lin[PIXEL_ARGB32_POS_R];
+    uint32_t g = lin[PIXEL_ARGB32_POS_G];
+    uint32_t b = lin[PIXEL_ARGB32_POS_B];
+
+    if (a16 == 0xFFFF)
+    {
+      return 0xFF000000 |
+        ((uint32_t)_raster_srgb8_from_linear[r >> RASTER_LINEAR_LUT_SHIFT] << 16) |
+        ((uint32_t)_raster_srgb8_from_linear[g >> RASTER_LINEAR_LUT_SHIFT] <<  8) |
+        ((uint32_t)_raster_srgb8_from_linear[b >> RASTER_LINEAR_LUT_SHIFT]      ) ;
+    }
+
+    uint32_t a = (a16 * 255 + 0x8000) >> 16;
+    if (a == 0)
+      return 0;
+
+    // Demultiply in 16.16 fixed point, the color can't be greater than alpha,
+    // but the rounding errors of the blender might cause a small overflow.
+    uint32_t recip = 0xFFFF0000U / a16;
+
+    r = Math::min<uint32_t>((r * recip) >> 16, 0xFFFF);
+    g = Math::min<uint32_t>((g * recip) >> 16, 0xFFFF);
+    b = Math::min<uint32_t>((b * recip) >> 16, 0xFFFF);
+
+    r = _raster_srgb8_from_linear[r >> RASTER_LINEAR_LUT_SHIFT] * a;
+    g = _raster_srgb8_from_linear[g >> RASTER_LINEAR_LUT_SHIFT] * a;
+    b = _raster_srgb8_from_linear[b >> RASTER_LINEAR_LUT_SHIFT] * a;
+
+    r = (r + 0x80 + ((r + 0x80) >> 8)) >> 8;
+    g = (g + 0x80 + ((g + 0x80) >> 8)) >> 8;
+    b = (b + 0x80 + ((b + 0x80) >> 8)) >> 8;
+
+    return (a << 24) | (r << 16) | (g << 8) | b;
+  }
+
+  static FOG_INLINE void fromPRGB32_line(uint16_t* lin, const uint8_t* src, int w)
+  {
+    for (int i = 0; i < w; i++, lin += 4, src += 4)
+      fromPRGB32(lin, reinterpret_cast<const uint32_t*>(src)[0]);
+  }
+
+  static FOG_INLINE void fromXRGB32_line(uint16_t* lin, const uint8_t* src, int w)
+  {
+    for (int i = 0; i < w; i++, lin += 4, src += 4)
+      fromXRGB32(lin, reinterpret_cast<const uint32_t*>(src)[0]);
+  }
+
+  //! @brief Store linear-light pixels into @a dst, skipping pixels where the
+  //! mask is fully transparent.
+  static FOG_INLINE void toPRGB32_line(uint8_t* dst, const uint16_t* lin, const uint16_t* msk, int w, uint32_t fillMask)
+  {
+    for (int i = 0; i < w; i++, dst += 4, lin += 4, msk += 4)
+    {
+      if ((msk[0] | msk[1] | msk[2] | msk[3]) == 0)
+        continue;
+      reinterpret_cast<uint32_t*>(dst)[0] = toPRGB32(lin) | fillMask;
+    }
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_C - LinearBlend]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Portable linear-light blender.
+//!
+//! The SSE2 blender (see @c RasterOps_SSE2::LinearBlend) must produce exactly
+//! the same result.
+struct FOG_NO_EXPORT LinearBlend
+{
+  // Dca' = Sca.m + Dca.(1 - m)
+  static FOG_INLINE void src(uint16_t* dst, const uint16_t* src, size_t srcInc, const uint16_t* msk, int w)
+  {
+    for (int i = 0; i < w; i++, dst += 4, src += srcInc, msk += 4)
+    {
+      for (int c = 0; c < 4; c++)
+      {
+        uint32_t m = msk[c];
+        dst[c] = (uint16_t)(((src[c] * m) >> 8) + ((dst[c] * (0x100 - m)) >> 8));
+      }
+    }
+  }
+
+  // Dca' = Sca.m + Dca.(1 - Sa.m)
+  static FOG_INLINE void srcOver(uint16_t* dst, const uint16_t* src, size_t srcInc, const uint16_t* msk, int w)
+  {
+    for (int i = 0; i < w; i++, dst += 4, src += srcInc, msk += 4)
+    {
+      uint32_t sa = src[PIXEL_ARGB32_POS_A];
+
+      for (int c = 0; c < 4; c++)
+      {
+        uint32_t m = msk[c];
+        uint32_t d = dst[c];
+        uint32_t inv = 0xFFFF - ((sa * m) >> 8);
+
+        dst[c] = (uint16_t)(((d * inv + d) >> 16) + ((src[c] * m) >> 8));
+      }
+    }
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_C - CompositeLinear]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Linear-light compositing of SRC and SRC_OVER operators into PRGB32
+//! and XRGB32 destinations.
+//!
+//! Full coverage cases which give the same result in sRGB and linear-light
+//! (SRC operator, SRC_OVER operator using opaque source) are delegated to the
+//! sRGB compositing functions.
+template<typename Blend, uint32_t DstFormat, uint32_t Op>
+struct CompositeLinear
+{
+  static FOG_INLINE const RasterCompositeCoreFuncs* getSRGB()
+  {
+    return &_api_raster.compositeCore[DstFormat][RASTER_COMPOSITE_CORE_SRC];
+  }
+
+  static FOG_INLINE uint32_t getFillMask()
+  {
+    return DstFormat == IMAGE_FORMAT_XRGB32 ? 0xFF000000 : 0x00000000;
+  }
+
+  // ==========================================================================
+  // [Chunk]
+  // ==========================================================================
+
+  static FOG_INLINE void _blend_chunk(uint8_t* dst, const uint16_t* srcLin, size_t srcInc, const uint16_t* mskLin, int w)
+  {
+    FOG_ALIGNED_VAR(uint16_t, dstLin[RASTER_LINEAR_CHUNK_SIZE * 4], 16);
+
+    if (DstFormat == IMAGE_FORMAT_XRGB32)
+      LinearConvert::fromXRGB32_line(dstLin, dst, w);
+    else
+      LinearConvert::fromPRGB32_line(dstLin, dst, w);
+
+    if (Op == RASTER_COMPOSITE_CORE_SRC)
+      Blend::src(dstLin, srcLin, srcInc, mskLin, w);
+    else
+      Blend::srcOver(dstLin, srcLin, srcInc, mskLin, w);
+
+    LinearConvert::toPRGB32_line(dst, dstLin, mskLin, w, getFillMask());
+  }
+
+  static FOG_INLINE void _cblit(uint8_t* dst, const uint16_t* srcLin, const uint8_t* msk, uint32_t msk0, uint32_t mskType, int w)
+  {
+    FOG_ALIGNED_VAR(uint16_t, mskLin[RASTER_LINEAR_CHUNK_SIZE * 4], 16);
+    uint32_t mskBpp = LinearMask::getBpp(mskType);
+
+    while (w > 0)
+    {
+      int n = Math::min<int>(w, RASTER_LINEAR_CHUNK_SIZE);
+
+      LinearMask::fill(mskLin, msk, msk0, mskType, n);
+      _blend_chunk(dst, srcLin, 0, mskLin, n);
+
+      dst += (size_t)(uint)n * 4;
+      msk += (size_t)(uint)n * mskBpp;
+      w -= n;
+    }
+  }
+
+  // ==========================================================================
+  // [CBlit - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL cblit_line(
+    uint8_t* dst, const RasterSolid* src, int w, const RasterClosure* closure)
+  {
+    uint32_t pix = src->prgb32.u32;
+
+    if (Op == RASTER_COMPOSITE_CORE_SRC || (pix >> 24) == 0xFF)
+    {
+      getSRGB()->cblit_line[RASTER_CBLIT_PRGB](dst, src, w, closure);
+      return;
+    }
+
+    if (pix == 0)
+      return;
+
+    FOG_ALIGNED_VAR(uint16_t, srcLin[4], 16);
+    LinearConvert::fromPRGB32(srcLin, pix);
+
+    _cblit(dst, srcLin, NULL, 0x100, LINEAR_MASK_CONST, w);
+  }
+
+  // ==========================================================================
+  // [CBlit - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL cblit_span(
+    uint8_t* dst, const RasterSolid* src, const RasterSpan* span, const RasterClosure* closure)
+  {
+    uint32_t pix = src->prgb32.u32;
+
+    if (Op == RASTER_COMPOSITE_CORE_SRC_OVER && pix == 0)
+      return;
+
+    FOG_ALIGNED_VAR(uint16_t, srcLin[4], 16);
+    LinearConvert::fromPRGB32(srcLin, pix);
+
+    bool isOpaque = Op == RASTER_COMPOSITE_CORE_SRC || (pix >> 24) == 0xFF;
+
+    FOG_CBLIT_SPAN8_BEGIN(4)
+
+    // ------------------------------------------------------------------------
+    // [C-Opaque]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_C_OPAQUE()
+    {
+      if (isOpaque)
+        getSRGB()->cblit_line[RASTER_CBLIT_PRGB](dst, src, w, closure);
+      else
+        _cblit(dst, srcLin, NULL, msk0, LINEAR_MASK_CONST, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [C-Mask]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_C_MASK()
+    {
+      _cblit(dst, srcLin, NULL, msk0, LINEAR_MASK_CONST, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_A8_GLYPH()
+    {
+      _cblit(dst, srcLin, msk, 0, LINEAR_MASK_A8_GLYPH, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Extra]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_A8_EXTRA()
+    {
+      _cblit(dst, srcLin, msk, 0, LINEAR_MASK_A8_EXTRA, w);
+    }
+
+    // ------------------------------------------------------------------------
+    // [ARGB32-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_CBLIT_SPAN8_ARGB32_GLYPH()
+    {
+      _cblit(dst, srcLin, msk, 0, LINEAR_MASK_ARGB32_GLYPH, w);
+    }
+
+    FOG_CBLIT_SPAN8_END()
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_C - CompositeLinearVBlit]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Linear-light variant blit.
+//!
+//! Sources other than PRGB32 and XRGB32 are converted to PRGB32 first using
+//! the sRGB 'Src' compositing function (it handles also I8 palette).
+template<typename Blend, uint32_t DstFormat, uint32_t Op, uint32_t SrcFormat, uint32_t SrcBpp>
+struct CompositeLinearVBlit : public CompositeLinear<Blend, DstFormat, Op>
+{
+  typedef CompositeLinear<Blend, DstFormat, Op> Base;
+
+  static FOG_INLINE bool isSrcOpaque()
+  {
+    return SrcFormat == IMAGE_FORMAT_XRGB32 ||
+           SrcFormat == IMAGE_FORMAT_RGB24  ||
+           SrcFormat == IMAGE_FORMAT_RGB48  ;
+  }
+
+  static FOG_INLINE void _vblit(uint8_t* dst, const uint8_t* src, const uint8_t* msk, uint32_t msk0, uint32_t mskType, int w, const RasterClosure* closure)
+  {
+    FOG_ALIGNED_VAR(uint16_t, srcLin[RASTER_LINEAR_CHUNK_SIZE * 4], 16);
+    FOG_ALIGNED_VAR(uint16_t, mskLin[RASTER_LINEAR_CHUNK_SIZE * 4], 16);
+    FOG_ALIGNED_VAR(uint32_t, srcTmp[RASTER_LINEAR_CHUNK_SIZE], 16);
+
+    uint32_t mskBpp = LinearMask::getBpp(mskType);
+
+    while (w > 0)
+    {
+      int n = Math::min<int>(w, RASTER_LINEAR_CHUNK_SIZE);
+
+      if (SrcFormat == IMAGE_FORMAT_PRGB32)
+      {
+        LinearConvert::fromPRGB32_line(srcLin, src, n);
+      }
+      else if (SrcFormat == IMAGE_FORMAT_XRGB32)
+      {
+        LinearConvert::fromXRGB32_line(srcLin, src, n);
+      }
+      else
+      {
+        _api_raster.compositeCore[IMAGE_FORMAT_PRGB32][RASTER_COMPOSITE_CORE_SRC].vblit_line[SrcFormat](
+          reinterpret_cast<uint8_t*>(srcTmp), src, n, closure);
+        LinearConvert::fromPRGB32_line(srcLin, reinterpret_cast<uint8_t*>(srcTmp), n);
+      }
+
+      LinearMask::fill(mskLin, msk, msk0, mskType, n);
+      Base::_blend_chunk(dst, srcLin, 4, mskLin, n);
+
+      dst += (size_t)(uint)n * 4;
+      src += (size_t)(uint)n * SrcBpp;
+      msk += (size_t)(uint)n * mskBpp;
+      w -= n;
+    }
+  }
+
+  // ==========================================================================
+  // [VBlit - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL vblit_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    if (Op == RASTER_COMPOSITE_CORE_SRC || isSrcOpaque())
+    {
+      Base::getSRGB()->vblit_line[SrcFormat](dst, src, w, closure);
+      return;
+    }
+
+    _vblit(dst, src, NULL, 0x100, LINEAR_MASK_CONST, w, closure);
+  }
+
+  // ==========================================================================
+  // [VBlit - Span]
+  // ==========================================================================
+
+  static void FOG_FASTCALL vblit_span(
+    uint8_t* dst, const RasterSpan* span, const RasterClosure* closure)
+  {
+    FOG_VBLIT_SPAN8_BEGIN(4)
+
+    // ------------------------------------------------------------------------
+    // [C-Opaque]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_C_OPAQUE()
+    {
+      vblit_line(dst, src, w, closure);
+    }
+
+    // ------------------------------------------------------------------------
+    // [C-Mask]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_C_MASK()
+    {
+      _vblit(dst, src, NULL, msk0, LINEAR_MASK_CONST, w, closure);
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_GLYPH()
+    {
+      _vblit(dst, src, msk, 0, LINEAR_MASK_A8_GLYPH, w, closure);
+    }
+
+    // ------------------------------------------------------------------------
+    // [A8-Extra]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_A8_EXTRA()
+    {
+      _vblit(dst, src, msk, 0, LINEAR_MASK_A8_EXTRA, w, closure);
+    }
+
+    // ------------------------------------------------------------------------
+    // [ARGB32-Glyph]
+    // ------------------------------------------------------------------------
+
+    FOG_VBLIT_SPAN8_ARGB32_GLYPH()
+    {
+      _vblit(dst, src, msk, 0, LINEAR_MASK_ARGB32_GLYPH, w, closure);
+    }
+
+    FOG_VBLIT_SPAN8_END()
+  }
+};
+
+// ============================================================================
+// [Fog::RasterOps_C - CompositeLinear - Init]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Fill the linear-light compositing functions, used by both C and
+//! SSE2 initializers (they differ only in @a Blend).
+template<typename Blend, uint32_t DstFormat, uint32_t Op>
+static void CompositeLinear_init(RasterCompositeCoreFuncs& funcs)
+{
+  typedef CompositeLinear<Blend, DstFormat, Op> Solid;
+
+  funcs.cblit_line[RASTER_CBLIT_PRGB] = Solid::cblit_line;
+  funcs.cblit_line[RASTER_CBLIT_XRGB] = Solid::cblit_line;
+  funcs.cblit_span[RASTER_CBLIT_PRGB] = Solid::cblit_span;
+  funcs.cblit_span[RASTER_CBLIT_XRGB] = Solid::cblit_span;
+
+#define FOG_LINEAR_INIT_VBLIT(_Format_, _Bpp_) \
+  funcs.vblit_line[_Format_] = CompositeLinearVBlit<Blend, DstFormat, Op, _Format_, _Bpp_>::vblit_line; \
+  funcs.vblit_span[_Format_] = CompositeLinearVBlit<Blend, DstFormat, Op, _Format_, _Bpp_>::vblit_span
+
+  FOG_LINEAR_INIT_VBLIT(IMAGE_FORMAT_PRGB32, 4);
+  FOG_LINEAR_INIT_VBLIT(IMAGE_FORMAT_XRGB32, 4);
+  FOG_LINEAR_INIT_VBLIT(IMAGE_FORMAT_RGB24 , 3);
+  FOG_LINEAR_INIT_VBLIT(IMAGE_FORMAT_A8    , 1);
+  FOG_LINEAR_INIT_VBLIT(IMAGE_FORMAT_I8    , 1);
+  FOG_LINEAR_INIT_VBLIT(IMAGE_FORMAT_PRGB64, 8);
+  FOG_LINEAR_INIT_VBLIT(IMAGE_FORMAT_RGB48 , 6);
+  FOG_LINEAR_INIT_VBLIT(IMAGE_FORMAT_A16   , 2);
+
+#undef FOG_LINEAR_INIT_VBLIT
+}
+
+} // RasterOps_C namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_C_COMPOSITELINEAR_P_H
@@ -4702,7 +4702,7 @@ _ARGB32_Glyph_Skip:
 
     Acc::p32ExtendPBBFromSBB(sro0p, sra0p);
 
-    FOG_CBLIT_SPAN8_BEGIN(4)
+    FOG_CBLIT_SPAN8_BEGIN(1)
 
     // ------------------------------------------------------------------------
     // [C-Opaque]
@@ -4756,8 +4756,8 @@ _ARGB32_Glyph_Skip:
       FOG_BLIT_LOOP_8x8_MAIN_BEGIN(C_Mask)
         uint32_t dst0p, dst1p;
 
-        Acc::p32Load4a(dst0p, dst);
-        Acc::p32Load4a(dst1p, dst);
+        Acc::p32Load4a(dst0p, dst + 0);
+        Acc::p32Load4a(dst1p, dst + 4);
 
         Acc::p32MulDiv256PBB_SBW(dst0p, dst0p, msk0p);
         Acc::p32MulDiv256PBB_SBW(dst1p, dst1p, msk0p);
@@ -4781,6 +4781,7 @@ _ARGB32_Glyph_Skip:
 
       FOG_BLIT_LOOP_8x1_BEGIN(A8_Glyph)
         uint32_t dst0p;
+        uint32_t src0p;
         uint32_t msk0p;
 
         Acc::p32Load1b(msk0p, msk);
@@ -4788,10 +4789,10 @@ _ARGB32_Glyph_Skip:
 
         Acc::p32Load1b(dst0p, dst);
         Acc::p32Cvt256SBWFrom255SBW(msk0p, msk0p);
-        Acc::p32MulDiv256SBW(dst0p, dst0p, msk0p);
+        Acc::p32MulDiv256SBW(src0p, sra0p, msk0p);
         Acc::p32Negate256SBW(msk0p, msk0p);
-        Acc::p32MulDiv256SBW(msk0p, msk0p, sra0p);
-        Acc::p32Add(dst0p, dst0p, msk0p);
+        Acc::p32MulDiv256SBW(dst0p, dst0p, msk0p);
+        Acc::p32Add(dst0p, dst0p, src0p);
         Acc::p32Store1b(dst, dst0p);
 
 _A8_Glyph_Skip:
@@ -4810,15 +4811,16 @@ _A8_Glyph_Skip:
 
       FOG_BLIT_LOOP_8x1_BEGIN(A8_Extra)
         uint32_t dst0p;
+        uint32_t src0p;
         uint32_t msk0p;
 
         Acc::p32Load2a(msk0p, msk);
         Acc::p32Load1b(dst0p, dst);
 
-        Acc::p32MulDiv256SBW(dst0p, dst0p, msk0p);
+        Acc::p32MulDiv256SBW(src0p, sra0p, msk0p);
         Acc::p32Negate256SBW(msk0p, msk0p);
-        Acc::p32MulDiv256SBW(msk0p, msk0p, sra0p);
-        Acc::p32Add(dst0p, dst0p, msk0p);
+        Acc::p32MulDiv256SBW(dst0p, dst0p, msk0p);
+        Acc::p32Add(dst0p, dst0p, src0p);
         Acc::p32Store1b(dst, dst0p);
 
         dst += 1;
@@ -4971,8 +4973,8 @@ _A8_Glyph_Skip:
         Acc::p32MulDiv256PBW_2x_Pack_2031(src0p_20, src0p_20, msk0p, src0p_31, msk0p);
         Acc::p32MulDiv256PBW_2x_Pack_2031(src0p_64, src0p_64, msk0p, src0p_75, msk0p);
 
-        Acc::p32Load4a(src0p_31, src + 0);
-        Acc::p32Load4a(src0p_75, src + 4);
+        Acc::p32Load4a(src0p_31, dst + 0);
+        Acc::p32Load4a(src0p_75, dst + 4);
 
         Acc::p32MulDiv256PBB_SBW(src0p_31, src0p_31, minv0p);
         Acc::p32MulDiv256PBB_SBW(src0p_75, src0p_75, minv0p);
@@ -5001,10 +5003,9 @@ _A8_Glyph_Skip:
         Acc::p32Load1b(msk0p, msk);
         if (msk0p == 0x00) goto _A8_Glyph_Skip;
 
-        Acc::p32Load1b(src0p, src);
         Acc::p32Cvt256SBWFrom255SBW(msk0p, msk0p);
 
-        src0p = uint32_t(src[0]) * msk0p;
+        src0p = uint32_t(src[SrcA]) * msk0p;
         Acc::p32Negate256SBW(msk0p, msk0p);
 
         src0p += uint32_t(dst[0]) * msk0p;
@@ -5031,10 +5032,9 @@ _A8_Glyph_Skip:
         uint32_t src0p;
         uint32_t msk0p;
 
-        Acc::p32Load1b(src0p, src);
-        Acc::p32Load1b(msk0p, msk);
+        Acc::p32Load2a(msk0p, msk);
 
-        src0p = uint32_t(src[0]) * msk0p;
+        src0p = uint32_t(src[SrcA]) * msk0p;
         Acc::p32Negate256SBW(msk0p, msk0p);
 
         src0p += uint32_t(dst[0]) * msk0p;
@@ -5083,8 +5083,8 @@ _A8_Glyph_Skip:
       FOG_BLIT_LOOP_8x8_SMALL_END(C_Opaque)
 
       FOG_BLIT_LOOP_8x8_MAIN_BEGIN(C_Opaque)
-        Acc::p32Store1b(dst + 0, src0p);
-        Acc::p32Store1b(dst + 4, src0p);
+        Acc::p32Store4a(dst + 0, src0p);
+        Acc::p32Store4a(dst + 4, src0p);
 
         dst += 8;
       FOG_BLIT_LOOP_8x8_MAIN_END(C_Opaque)
@@ -5114,8 +5114,9 @@ _A8_Glyph_Skip:
         Acc::p32Load4a(dst1p, dst + 4);
 
         Acc::p32Negate255PBB_2x(dst0p, dst0p, dst1p, dst1p);
-        Acc::p32MulDiv256PBW_2x(dst0p, dst0p, msk0p, dst1p, dst1p, msk0p);
-        
+        Acc::p32MulDiv256PBB_SBW(dst0p, dst0p, msk0p);
+        Acc::p32MulDiv256PBB_SBW(dst1p, dst1p, msk0p);
+
         reinterpret_cast<uint32_t*>(dst + 0)[0] += dst0p;
         reinterpret_cast<uint32_t*>(dst + 4)[0] += dst1p;
 
@@ -207,22 +207,32 @@ struct FOG_NO_EXPORT PGradientBase
         }
         else
         {
-          // Try to create the color-stop cache.
-          cache = ColorStopCache::create32(srcFormat, get_optimal_cache_length(stops));
-          if (FOG_IS_NULL(cache)) return ERR_RT_OUT_OF_MEMORY;
+          uint32_t cacheLength = get_optimal_cache_length(stops);
 
-          cache->reference.init(2);
+          // Try to get the color-stop cache from the global cache, it's shared
+          // by all lists containing the same stops.
+          cache = ColorStopCache::getShared(stops->getList(), stops->getLength(), srcFormat, cacheLength);
 
-          _api_raster.gradient.interpolate[srcFormat](
-            reinterpret_cast<uint8_t*>(cache->getData()), cache->getLength(), stops->getList(), stops->getLength());
+          if (cache == NULL)
+          {
+            // Try to create the color-stop cache.
+            cache = ColorStopCache::create32(srcFormat, cacheLength);
+            if (FOG_IS_NULL(cache)) return ERR_RT_OUT_OF_MEMORY;
+
+            _api_raster.gradient.interpolate[srcFormat](
+              reinterpret_cast<uint8_t*>(cache->getData()), cache->getLength(), stops->getList(), stops->getLength());
 
-          // Assign also the end point.
-          uint32_t* table = reinterpret_cast<uint32_t*>(cache->getData());
-          table[cache->getLength()] = table[cache->getLength() - 1];
+            // Assign also the end point.
+            uint32_t* table = reinterpret_cast<uint32_t*>(cache->getData());
+            table[cache->getLength()] = table[cache->getLength() - 1];
+
+            cache = ColorStopCache::putShared(stops->getList(), stops->getLength(), cache);
+          }
 
           // Try to add it back to the ColorStopList instance. If we failed then
           // some other thread was faster than us, in this case it's needed to
-          // decrease the reference count of the instance we created.
+          // decrease the reference count we added.
+          cache->reference.inc();
           if (!AtomicCore<ColorStopCache*>::cmpXchg(&stops->_d->stopCachePrgb32, (ColorStopCache*)NULL, cache))
             cache->reference.dec();
         }
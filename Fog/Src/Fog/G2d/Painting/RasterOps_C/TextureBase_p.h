@@ -343,9 +343,63 @@ _Has16BPC:
     // ------------------------------------------------------------------------
 
     {
-      // TODO: Not implemented.
-      ctx->_fetch = NULL;
-      return ERR_RT_NOT_IMPLEMENTED;
+      // The fetcher steps in the homogeneous space, the offset is added to
+      // 'tx', 'ty' and 'tz' by prepare(). Input values are centered to
+      // (0.5, 0.5).
+      ctx->_d.texture.proj.tx = 0.5 * (inv._00 + inv._10) + inv._20;
+      ctx->_d.texture.proj.ty = 0.5 * (inv._01 + inv._11) + inv._21;
+      ctx->_d.texture.proj.tz = 0.5 * (inv._02 + inv._12) + inv._22;
+
+      ctx->_d.texture.proj.xx = inv._00;
+      ctx->_d.texture.proj.xy = inv._01;
+      ctx->_d.texture.proj.xz = inv._02;
+
+      ctx->_d.texture.proj.yx = inv._10;
+      ctx->_d.texture.proj.yy = inv._11;
+      ctx->_d.texture.proj.yz = inv._12;
+
+      // Translate the center of pixel back if the filter is not NEAREST. The
+      // coordinates are divided by 'z' later so the translation has to be
+      // scaled by 'z' as well.
+      if (imageQuality != IMAGE_QUALITY_NEAREST)
+      {
+        ctx->_d.texture.proj.tx -= 0.5 * ctx->_d.texture.proj.tz;
+        ctx->_d.texture.proj.ty -= 0.5 * ctx->_d.texture.proj.tz;
+
+        ctx->_d.texture.proj.xx -= 0.5 * ctx->_d.texture.proj.xz;
+        ctx->_d.texture.proj.xy -= 0.5 * ctx->_d.texture.proj.xz;
+
+        ctx->_d.texture.proj.yx -= 0.5 * ctx->_d.texture.proj.yz;
+        ctx->_d.texture.proj.yy -= 0.5 * ctx->_d.texture.proj.yz;
+      }
+
+      ctx->_d.texture.proj.mx = (double)ctx->_d.texture.base.w;
+      ctx->_d.texture.proj.my = (double)ctx->_d.texture.base.h;
+
+      if (tileMode == TEXTURE_TILE_REFLECT)
+      {
+        ctx->_d.texture.proj.mx *= 2.0;
+        ctx->_d.texture.proj.my *= 2.0;
+      }
+
+      ctx->_d.texture.proj.mx16x16 = Math::fixed16x16FromFloat(ctx->_d.texture.proj.mx);
+      ctx->_d.texture.proj.my16x16 = Math::fixed16x16FromFloat(ctx->_d.texture.proj.my);
+
+      // The 16.16 fixed point is limited to coordinates in (-16384, 16384),
+      // see PTextureProjection::getFixedLimit().
+      ctx->_d.texture.proj.safeFixedPoint =
+        ctx->_d.texture.proj.mx < 16384.0 &&
+        ctx->_d.texture.proj.my < 16384.0;
+
+      // Setup functions.
+      ctx->_prepare = prepare_proj;
+      ctx->_skip = skip_proj;
+
+      if (imageQuality == IMAGE_QUALITY_NEAREST)
+        ctx->_fetch = fetchFuncs->fetch_proj_nearest[srcFormat][tileMode];
+      else
+        ctx->_fetch = fetchFuncs->fetch_proj_bilinear[srcFormat][tileMode];
+      return ERR_OK;
     }
   }
 
@@ -436,6 +490,26 @@ _Has16BPC:
     fetcher->_d.texture.affine.dy = Math::repeat(d * ctx->_d.texture.affine.yy, ctx->_d.texture.affine.my);
   }
 
+  static void FOG_FASTCALL prepare_proj(
+    const RasterPattern* ctx, RasterPatternFetcher* fetcher, int _y, int _delta, uint32_t mode)
+  {
+    double y = (double)_y;
+    double d = (double)_delta;
+
+    fetcher->_ctx = ctx;
+    fetcher->_fetch = ctx->_fetch;
+    fetcher->_skip = ctx->_skip;
+    fetcher->_mode = mode;
+
+    fetcher->_d.texture.proj.px = y * ctx->_d.texture.proj.yx + ctx->_d.texture.proj.tx;
+    fetcher->_d.texture.proj.py = y * ctx->_d.texture.proj.yy + ctx->_d.texture.proj.ty;
+    fetcher->_d.texture.proj.pz = y * ctx->_d.texture.proj.yz + ctx->_d.texture.proj.tz;
+
+    fetcher->_d.texture.proj.dx = d * ctx->_d.texture.proj.yx;
+    fetcher->_d.texture.proj.dy = d * ctx->_d.texture.proj.yy;
+    fetcher->_d.texture.proj.dz = d * ctx->_d.texture.proj.yz;
+  }
+
   // ==========================================================================
   // [Skip]
   // ==========================================================================
@@ -481,6 +555,16 @@ _Has16BPC:
       fetcher->_d.texture.affine.py + fetcher->_d.texture.affine.dy * s,
       fetcher->_ctx->_d.texture.affine.my);
   }
+
+  static void FOG_FASTCALL skip_proj(
+    RasterPatternFetcher* fetcher, int step)
+  {
+    double s = (double)step;
+
+    fetcher->_d.texture.proj.px += fetcher->_d.texture.proj.dx * s;
+    fetcher->_d.texture.proj.py += fetcher->_d.texture.proj.dy * s;
+    fetcher->_d.texture.proj.pz += fetcher->_d.texture.proj.dz * s;
+  }
 };
 
 // ============================================================================
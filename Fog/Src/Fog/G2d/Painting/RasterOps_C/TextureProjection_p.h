@@ -13,6 +13,467 @@
 namespace Fog {
 namespace RasterOps_C {
 
+// ============================================================================
+// [Fog::RasterOps_C - PTextureProjection]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Texture fetcher used by projection (perspective) transform.
+//!
+//! The exact texture coordinate of each pixel is given by a division of two
+//! linear functions (x/z, y/z). To avoid a division per pixel the span is
+//! subdivided into blocks of @c SUBDIVISION_STEP pixels, the exact position
+//! is calculated only at the block boundaries and the position is linearly
+//! interpolated (in 16.16 fixed point) inside of the block.
+//!
+//! If the fixed point can't be used (the coordinates are out of range or the
+//! block crosses the horizon) the exact position is calculated per pixel.
+struct FOG_NO_EXPORT PTextureProjection
+{
+  // --------------------------------------------------------------------------
+  // [Constants]
+  // --------------------------------------------------------------------------
+
+  enum { SUBDIVISION_STEP = 16 };
+
+  //! @brief Maximum coordinate which can be stepped by 16.16 fixed point.
+  static FOG_INLINE double getFixedLimit() { return 16384.0; }
+
+  // --------------------------------------------------------------------------
+  // [Helpers]
+  // --------------------------------------------------------------------------
+
+  static FOG_INLINE double _recip(double z)
+  {
+    if (Math::isFuzzyZero(z)) z = MATH_EPSILON_D;
+    return 1.0 / z;
+  }
+
+  //! @brief Convert the exact texture coordinate @a u into the integer and
+  //! 8-bit fractional part, used by the per-pixel (non-fixed) path.
+  template<uint32_t TileMode>
+  static FOG_INLINE void _split(int& c0, uint32_t& wc, double u, int size, double m)
+  {
+    if (TileMode == TEXTURE_TILE_REPEAT || TileMode == TEXTURE_TILE_REFLECT)
+    {
+      u = Math::repeat(u, m);
+    }
+    else
+    {
+      // Everything outside of [-1, size] is padded (or clamped) the same way.
+      u = Math::bound<double>(u, -2.0, (double)size + 1.0);
+    }
+
+    c0 = Math::ifloor(u);
+    wc = (uint32_t)Math::ifloor((u - (double)c0) * 256.0) & 0xFF;
+
+    if (TileMode == TEXTURE_TILE_REPEAT || TileMode == TEXTURE_TILE_REFLECT)
+    {
+      // Math::repeat() can return exactly 'm' due to the rounding.
+      if (c0 >= (int)m) c0 = 0;
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // [Sample - Nearest]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor, uint32_t TileMode>
+  static FOG_INLINE void _sample_nearest(
+    Accessor& accessor, typename Accessor::Pixel& dst,
+    const RasterPattern* ctx, int x0, int y0, const typename Accessor::Pixel& clamp)
+  {
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    switch (TileMode)
+    {
+      case TEXTURE_TILE_PAD:
+        x0 = Math::bound<int>(x0, 0, tw - 1);
+        y0 = Math::bound<int>(y0, 0, th - 1);
+        break;
+
+      case TEXTURE_TILE_REPEAT:
+        FOG_ASSERT((uint)x0 < (uint)tw && (uint)y0 < (uint)th);
+        break;
+
+      case TEXTURE_TILE_REFLECT:
+        if (x0 >= tw) x0 = tw * 2 - 1 - x0;
+        if (y0 >= th) y0 = th * 2 - 1 - y0;
+        break;
+
+      case TEXTURE_TILE_CLAMP:
+        if (((uint)x0 >= (uint)tw) | ((uint)y0 >= (uint)th))
+        {
+          dst = clamp;
+          return;
+        }
+        break;
+    }
+
+    accessor.fetchNorm(dst, ctx->_d.texture.base.pixels +
+      (ssize_t)y0 * ctx->_d.texture.base.stride + (uint)x0 * Accessor::SRC_BPP);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Sample - Bilinear]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor, uint32_t TileMode>
+  static FOG_INLINE void _sample_bilinear(
+    Accessor& accessor, typename Accessor::Pixel& dst,
+    const RasterPattern* ctx, int x0, int y0, uint32_t wx, uint32_t wy, const typename Accessor::Pixel& clamp)
+  {
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    const uint8_t* srcPixels = ctx->_d.texture.base.pixels;
+    ssize_t srcStride = ctx->_d.texture.base.stride;
+
+    int x1 = x0 + 1;
+    int y1 = y0 + 1;
+
+    uint32_t w00 = ((0x100 - wx) * (0x100 - wy)) >> 8;
+    uint32_t w01 = ((wx        ) * (0x100 - wy)) >> 8;
+    uint32_t w10 = ((0x100 - wx) * (wy        )) >> 8;
+    uint32_t w11 = ((wx        ) * (wy        )) >> 8;
+
+    typename Accessor::Pixel pix_x0y0;
+    typename Accessor::Pixel pix_x1y0;
+    typename Accessor::Pixel pix_x0y1;
+    typename Accessor::Pixel pix_x1y1;
+
+    switch (TileMode)
+    {
+      case TEXTURE_TILE_PAD:
+        if (FOG_UNLIKELY(((uint)x0 >= (uint)(tw - 1)) | ((uint)y0 >= (uint)(th - 1))))
+        {
+          x0 = Math::bound<int>(x0, 0, tw - 1);
+          x1 = Math::bound<int>(x1, 0, tw - 1);
+          y0 = Math::bound<int>(y0, 0, th - 1);
+          y1 = Math::bound<int>(y1, 0, th - 1);
+        }
+        break;
+
+      case TEXTURE_TILE_REPEAT:
+        if (x1 == tw) x1 = 0;
+        if (y1 == th) y1 = 0;
+        break;
+
+      case TEXTURE_TILE_REFLECT:
+        if (x1 == tw * 2) x1 = 0;
+        if (y1 == th * 2) y1 = 0;
+
+        if (x0 >= tw) x0 = tw * 2 - 1 - x0;
+        if (x1 >= tw) x1 = tw * 2 - 1 - x1;
+        if (y0 >= th) y0 = th * 2 - 1 - y0;
+        if (y1 >= th) y1 = th * 2 - 1 - y1;
+        break;
+
+      case TEXTURE_TILE_CLAMP:
+        if (FOG_UNLIKELY(((uint)x0 >= (uint)(tw - 1)) | ((uint)y0 >= (uint)(th - 1))))
+        {
+          bool x0Valid = (uint)x0 < (uint)tw;
+          bool x1Valid = (uint)x1 < (uint)tw;
+          bool y0Valid = (uint)y0 < (uint)th;
+          bool y1Valid = (uint)y1 < (uint)th;
+
+          const uint8_t* srcLine0 = srcPixels + (ssize_t)y0 * srcStride;
+          const uint8_t* srcLine1 = srcPixels + (ssize_t)y1 * srcStride;
+
+          if (x0Valid & y0Valid) accessor.fetchNorm(pix_x0y0, srcLine0 + (uint)x0 * Accessor::SRC_BPP); else pix_x0y0 = clamp;
+          if (x1Valid & y0Valid) accessor.fetchNorm(pix_x1y0, srcLine0 + (uint)x1 * Accessor::SRC_BPP); else pix_x1y0 = clamp;
+          if (x0Valid & y1Valid) accessor.fetchNorm(pix_x0y1, srcLine1 + (uint)x0 * Accessor::SRC_BPP); else pix_x0y1 = clamp;
+          if (x1Valid & y1Valid) accessor.fetchNorm(pix_x1y1, srcLine1 + (uint)x1 * Accessor::SRC_BPP); else pix_x1y1 = clamp;
+
+          accessor.interpolateNorm_4(dst,
+            pix_x0y0, w00,
+            pix_x1y0, w01,
+            pix_x0y1, w10,
+            pix_x1y1, w11);
+          return;
+        }
+        break;
+    }
+
+    const uint8_t* srcLine0 = srcPixels + (ssize_t)y0 * srcStride;
+    const uint8_t* srcLine1 = srcPixels + (ssize_t)y1 * srcStride;
+
+    accessor.fetchRaw(pix_x0y0, srcLine0 + (uint)x0 * Accessor::SRC_BPP);
+    accessor.fetchRaw(pix_x1y0, srcLine0 + (uint)x1 * Accessor::SRC_BPP);
+    accessor.fetchRaw(pix_x0y1, srcLine1 + (uint)x0 * Accessor::SRC_BPP);
+    accessor.fetchRaw(pix_x1y1, srcLine1 + (uint)x1 * Accessor::SRC_BPP);
+
+    accessor.interpolateRaw_4(dst,
+      pix_x0y0, w00,
+      pix_x1y0, w01,
+      pix_x0y1, w10,
+      pix_x1y1, w11);
+    accessor.normalize(dst, dst);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor, uint32_t TileMode, int Bilinear>
+  static void FOG_FASTCALL _fetch_proj(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    const RasterPattern* ctx = fetcher->getContext();
+    Accessor accessor(ctx);
+
+    // ------------------------------------------------------------------------
+    // [Prepare]
+    // ------------------------------------------------------------------------
+
+    int tw = ctx->_d.texture.base.w;
+    int th = ctx->_d.texture.base.h;
+
+    double xx = ctx->_d.texture.proj.xx;
+    double xy = ctx->_d.texture.proj.xy;
+    double xz = ctx->_d.texture.proj.xz;
+
+    double mx = ctx->_d.texture.proj.mx;
+    double my = ctx->_d.texture.proj.my;
+
+    int mx16x16 = ctx->_d.texture.proj.mx16x16;
+    int my16x16 = ctx->_d.texture.proj.my16x16;
+
+    double offx = fetcher->_d.texture.proj.px;
+    double offy = fetcher->_d.texture.proj.py;
+    double offz = fetcher->_d.texture.proj.pz;
+
+    double fixedLimit = getFixedLimit();
+    bool safeFixedPoint = ctx->_d.texture.proj.safeFixedPoint != 0;
+
+    typename Accessor::Pixel clamp;
+    accessor.fetchSolid(clamp, ctx->_d.texture.base.clamp);
+
+    P_FETCH_SPAN8_INIT()
+
+    // ------------------------------------------------------------------------
+    // [Loop]
+    // ------------------------------------------------------------------------
+
+    P_FETCH_SPAN8_BEGIN()
+      P_FETCH_SPAN8_SET_CURRENT_AND_MERGE_NEIGHBORS(Accessor::DST_BPP)
+      double _x = (double)x;
+
+      // Homogeneous coordinates at the start of the current block.
+      double hx0 = offx + _x * xx;
+      double hy0 = offy + _x * xy;
+      double hz0 = offz + _x * xz;
+
+      double rz = _recip(hz0);
+      double u0 = hx0 * rz;
+      double v0 = hy0 * rz;
+
+      for (;;)
+      {
+        int i = Math::min<int>(w, SUBDIVISION_STEP);
+        double _i = (double)i;
+
+        // Homogeneous coordinates at the end of the current block.
+        double hx1 = hx0 + xx * _i;
+        double hy1 = hy0 + xy * _i;
+        double hz1 = hz0 + xz * _i;
+
+        rz = _recip(hz1);
+        double u1 = hx1 * rz;
+        double v1 = hy1 * rz;
+
+        w -= i;
+
+        // --------------------------------------------------------------------
+        // [Block - FixedPoint]
+        // --------------------------------------------------------------------
+
+        bool useFixed = safeFixedPoint && (hz0 * hz1 > 0.0);
+
+        if (TileMode == TEXTURE_TILE_PAD || TileMode == TEXTURE_TILE_CLAMP)
+        {
+          useFixed &= (Math::abs(u0) < fixedLimit) & (Math::abs(u1) < fixedLimit) &
+                      (Math::abs(v0) < fixedLimit) & (Math::abs(v1) < fixedLimit);
+        }
+
+        if (useFixed)
+        {
+          double du = (u1 - u0) / _i;
+          double dv = (v1 - v0) / _i;
+
+          int px, py;
+          int dx, dy;
+
+          if (TileMode == TEXTURE_TILE_REPEAT || TileMode == TEXTURE_TILE_REFLECT)
+          {
+            // Both, the position and the step are in [0, m) so the position
+            // never overflows the tile twice.
+            px = Math::fixed16x16FromFloat(Math::repeat(u0, mx));
+            py = Math::fixed16x16FromFloat(Math::repeat(v0, my));
+            dx = Math::fixed16x16FromFloat(Math::repeat(du, mx));
+            dy = Math::fixed16x16FromFloat(Math::repeat(dv, my));
+
+            if (px >= mx16x16) px -= mx16x16;
+            if (py >= my16x16) py -= my16x16;
+            if (dx >= mx16x16) dx -= mx16x16;
+            if (dy >= my16x16) dy -= my16x16;
+          }
+          else
+          {
+            px = Math::fixed16x16FromFloat(u0);
+            py = Math::fixed16x16FromFloat(v0);
+            dx = Math::fixed16x16FromFloat(du);
+            dy = Math::fixed16x16FromFloat(dv);
+          }
+
+          do {
+            typename Accessor::Pixel pix;
+
+            if (Bilinear)
+              _sample_bilinear<Accessor, TileMode>(accessor, pix, ctx,
+                px >> 16, py >> 16, (uint)(px >> 8) & 0xFF, (uint)(py >> 8) & 0xFF, clamp);
+            else
+              _sample_nearest<Accessor, TileMode>(accessor, pix, ctx,
+                px >> 16, py >> 16, clamp);
+
+            accessor.store(dst, pix);
+            dst += Accessor::DST_BPP;
+
+            px += dx;
+            py += dy;
+
+            if (TileMode == TEXTURE_TILE_REPEAT || TileMode == TEXTURE_TILE_REFLECT)
+            {
+              if ((uint)px >= (uint)mx16x16) px -= mx16x16;
+              if ((uint)py >= (uint)my16x16) py -= my16x16;
+            }
+          } while (--i);
+        }
+
+        // --------------------------------------------------------------------
+        // [Block - Exact]
+        // --------------------------------------------------------------------
+
+        else
+        {
+          double hx = hx0;
+          double hy = hy0;
+          double hz = hz0;
+
+          do {
+            double r = _recip(hz);
+
+            int x0, y0;
+            uint32_t wx, wy;
+
+            _split<TileMode>(x0, wx, hx * r, tw, mx);
+            _split<TileMode>(y0, wy, hy * r, th, my);
+
+            typename Accessor::Pixel pix;
+
+            if (Bilinear)
+              _sample_bilinear<Accessor, TileMode>(accessor, pix, ctx, x0, y0, wx, wy, clamp);
+            else
+              _sample_nearest<Accessor, TileMode>(accessor, pix, ctx, x0, y0, clamp);
+
+            accessor.store(dst, pix);
+            dst += Accessor::DST_BPP;
+
+            hx += xx;
+            hy += xy;
+            hz += xz;
+          } while (--i);
+        }
+
+        if (w == 0) break;
+
+        hx0 = hx1;
+        hy0 = hy1;
+        hz0 = hz1;
+
+        u0 = u1;
+        v0 = v1;
+      }
+
+      P_FETCH_SPAN8_NEXT()
+    P_FETCH_SPAN8_END()
+
+    // ------------------------------------------------------------------------
+    // [Advance]
+    // ------------------------------------------------------------------------
+
+    fetcher->_d.texture.proj.px += fetcher->_d.texture.proj.dx;
+    fetcher->_d.texture.proj.py += fetcher->_d.texture.proj.dy;
+    fetcher->_d.texture.proj.pz += fetcher->_d.texture.proj.dz;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Nearest)]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_proj<Accessor, TEXTURE_TILE_PAD, 0>(fetcher, span, buffer);
+  }
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_proj<Accessor, TEXTURE_TILE_REPEAT, 0>(fetcher, span, buffer);
+  }
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_proj<Accessor, TEXTURE_TILE_REFLECT, 0>(fetcher, span, buffer);
+  }
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_nearest_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_proj<Accessor, TEXTURE_TILE_CLAMP, 0>(fetcher, span, buffer);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Fetch - Projection (Bilinear)]
+  // --------------------------------------------------------------------------
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_pad(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_proj<Accessor, TEXTURE_TILE_PAD, 1>(fetcher, span, buffer);
+  }
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_repeat(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_proj<Accessor, TEXTURE_TILE_REPEAT, 1>(fetcher, span, buffer);
+  }
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_reflect(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_proj<Accessor, TEXTURE_TILE_REFLECT, 1>(fetcher, span, buffer);
+  }
+
+  template<typename Accessor>
+  static void FOG_FASTCALL fetch_proj_bilinear_clamp(
+    RasterPatternFetcher* fetcher, RasterSpan* span, uint8_t* buffer)
+  {
+    _fetch_proj<Accessor, TEXTURE_TILE_CLAMP, 1>(fetcher, span, buffer);
+  }
+};
+
 } // RasterOps_C namespace
 } // Fog namespace
 
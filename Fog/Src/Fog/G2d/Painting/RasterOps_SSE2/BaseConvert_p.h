@@ -9,6 +9,7 @@
 
 // [Dependencies - RasterOps_C]
 #include <Fog/G2d/Painting/RasterOps_C/BaseConvert_p.h>
+#include <Fog/G2d/Painting/RasterOps_C/CompositeSrc_p.h>
 
 // [Dependencies - RasterOps_SSE2]
 #include <Fog/G2d/Painting/RasterOps_SSE2/BaseDefs_p.h>
@@ -122,6 +123,277 @@ struct FOG_NO_EXPORT Convert
       Acc::m128iStore16u(dst + (uint)w * 2 - 16, xmm0);
     }
   }
+
+  // ==========================================================================
+  // [BSwap - 32]
+  // ==========================================================================
+
+  static void FOG_FASTCALL bswap_32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 4)
+    {
+      __m128i xmm0;
+      __m128i xmm1;
+
+      Acc::m128iLoad16u(xmm0, src);
+
+      // Swap bytes in words and then words in dwords.
+      Acc::m128iLShiftPU16<8>(xmm1, xmm0);
+      Acc::m128iRShiftPU16<8>(xmm0, xmm0);
+      Acc::m128iOr(xmm0, xmm0, xmm1);
+
+      Acc::m128iShufflePI16Lo<1, 0, 3, 2>(xmm0, xmm0);
+      Acc::m128iShufflePI16Hi<1, 0, 3, 2>(xmm0, xmm0);
+      Acc::m128iStore16u(dst, xmm0);
+
+      dst += 16;
+      src += 16;
+      w -= 4;
+    }
+
+    if (w)
+      RasterOps_C::Convert::bswap_32(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [Convert - Premultiply / Demultiply]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_from_argb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 4)
+    {
+      __m128i xmm0, xmm1;
+      __m128i tmp0, tmp1;
+
+      Acc::m128iLoad16u(xmm0, src);
+      Acc::m128iUnpackPI16FromPI8Hi(xmm1, xmm0);
+      Acc::m128iUnpackPI16FromPI8Lo(xmm0, xmm0);
+
+      // Broadcast alpha into all components, alpha itself is multiplied by 255.
+      Acc::m128iShufflePI16<3, 3, 3, 3>(tmp0, xmm0);
+      Acc::m128iShufflePI16<3, 3, 3, 3>(tmp1, xmm1);
+      Acc::m128iOr(xmm0, xmm0, FOG_XMM_GET_CONST_PI(00FF000000000000_00FF000000000000));
+      Acc::m128iOr(xmm1, xmm1, FOG_XMM_GET_CONST_PI(00FF000000000000_00FF000000000000));
+      Acc::m128iMulLoPI16(xmm0, xmm0, tmp0);
+      Acc::m128iMulLoPI16(xmm1, xmm1, tmp1);
+
+      // (t + (t >> 8) + 0x80) >> 8, rounded the same way as the C tail
+      // (Acc::p32PRGB32FromARGB32()), Acc::m128iMulDiv255PI16() differs.
+      Acc::m128iRShiftPU16<8>(tmp0, xmm0);
+      Acc::m128iRShiftPU16<8>(tmp1, xmm1);
+      Acc::m128iAddPI16(xmm0, xmm0, tmp0);
+      Acc::m128iAddPI16(xmm1, xmm1, tmp1);
+      Acc::m128iAddPI16(xmm0, xmm0, FOG_XMM_GET_CONST_PI(0080008000800080_0080008000800080));
+      Acc::m128iAddPI16(xmm1, xmm1, FOG_XMM_GET_CONST_PI(0080008000800080_0080008000800080));
+      Acc::m128iRShiftPU16<8>(xmm0, xmm0);
+      Acc::m128iRShiftPU16<8>(xmm1, xmm1);
+
+      Acc::m128iPackPU8FromPU16(xmm0, xmm0, xmm1);
+      Acc::m128iStore16u(dst, xmm0);
+
+      dst += 16;
+      src += 16;
+      w -= 4;
+    }
+
+    if (w)
+      RasterOps_C::Convert::prgb32_from_argb32(dst, src, w, closure);
+  }
+
+  static void FOG_FASTCALL argb32_from_prgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 4)
+    {
+      __m128i xmm0, xmm1;
+      __m128i rcp0, rcp1;
+      __m128i rcpLo0, rcpLo1;
+      __m128i rcpHi0, rcpHi1;
+      __m128i alpha;
+
+      // There is no gather in SSE2, the 24-bit reciprocals are loaded one by
+      // one and then split into 16-bit halves, because SSE2 can't multiply
+      // 32-bit integers. The result is the same as Acc::p32ARGB32FromPRGB32():
+      //
+      //   (c * rcp) >> 16 == c * rcpHi + ((c * rcpLo) >> 16).
+      rcp0 = _mm_set_epi32(
+        (int)Acc::_u8_divide_table_d[src[PIXEL_ARGB32_POS_A + 12]],
+        (int)Acc::_u8_divide_table_d[src[PIXEL_ARGB32_POS_A +  8]],
+        (int)Acc::_u8_divide_table_d[src[PIXEL_ARGB32_POS_A +  4]],
+        (int)Acc::_u8_divide_table_d[src[PIXEL_ARGB32_POS_A +  0]]);
+
+      Acc::m128iUnpackPI64FromPI32Hi(rcp1, rcp0, rcp0);
+      Acc::m128iUnpackPI64FromPI32Lo(rcp0, rcp0, rcp0);
+
+      Acc::m128iShufflePI16Lo<0, 0, 0, 0>(rcpLo0, rcp0);
+      Acc::m128iShufflePI16Lo<0, 0, 0, 0>(rcpLo1, rcp1);
+      Acc::m128iShufflePI16Hi<0, 0, 0, 0>(rcpLo0, rcpLo0);
+      Acc::m128iShufflePI16Hi<0, 0, 0, 0>(rcpLo1, rcpLo1);
+
+      Acc::m128iShufflePI16Lo<1, 1, 1, 1>(rcpHi0, rcp0);
+      Acc::m128iShufflePI16Lo<1, 1, 1, 1>(rcpHi1, rcp1);
+      Acc::m128iShufflePI16Hi<1, 1, 1, 1>(rcpHi0, rcpHi0);
+      Acc::m128iShufflePI16Hi<1, 1, 1, 1>(rcpHi1, rcpHi1);
+
+      Acc::m128iLoad16u(xmm0, src);
+      Acc::m128iAnd(alpha, xmm0, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+
+      Acc::m128iUnpackPI16FromPI8Hi(xmm1, xmm0);
+      Acc::m128iUnpackPI16FromPI8Lo(xmm0, xmm0);
+
+      Acc::m128iMulLoPI16(rcpHi0, rcpHi0, xmm0);
+      Acc::m128iMulLoPI16(rcpHi1, rcpHi1, xmm1);
+      Acc::m128iMulHiPU16(xmm0, xmm0, rcpLo0);
+      Acc::m128iMulHiPU16(xmm1, xmm1, rcpLo1);
+
+      Acc::m128iAddPI16(xmm0, xmm0, rcpHi0);
+      Acc::m128iAddPI16(xmm1, xmm1, rcpHi1);
+      Acc::m128iAnd(xmm0, xmm0, FOG_XMM_GET_CONST_PI(00FF00FF00FF00FF_00FF00FF00FF00FF));
+      Acc::m128iAnd(xmm1, xmm1, FOG_XMM_GET_CONST_PI(00FF00FF00FF00FF_00FF00FF00FF00FF));
+
+      Acc::m128iPackPU8FromPU16(xmm0, xmm0, xmm1);
+      Acc::m128iAnd(xmm0, xmm0, FOG_XMM_GET_CONST_PI(00FFFFFF00FFFFFF_00FFFFFF00FFFFFF));
+      Acc::m128iOr(xmm0, xmm0, alpha);
+      Acc::m128iStore16u(dst, xmm0);
+
+      dst += 16;
+      src += 16;
+      w -= 4;
+    }
+
+    if (w)
+      RasterOps_C::Convert::argb32_from_prgb32(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [Convert - PRGB32 <- A8]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_from_a8(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 16)
+    {
+      __m128i xmm0, xmm1, xmm2, xmm3;
+
+      Acc::m128iLoad16u(xmm0, src);
+      Acc::m128iUnpackPI16FromPI8Hi(xmm2, xmm0, xmm0);
+      Acc::m128iUnpackPI16FromPI8Lo(xmm0, xmm0, xmm0);
+
+      Acc::m128iUnpackPI32FromPI16Hi(xmm1, xmm0, xmm0);
+      Acc::m128iUnpackPI32FromPI16Lo(xmm0, xmm0, xmm0);
+      Acc::m128iUnpackPI32FromPI16Hi(xmm3, xmm2, xmm2);
+      Acc::m128iUnpackPI32FromPI16Lo(xmm2, xmm2, xmm2);
+
+      Acc::m128iStore16u(dst +  0, xmm0);
+      Acc::m128iStore16u(dst + 16, xmm1);
+      Acc::m128iStore16u(dst + 32, xmm2);
+      Acc::m128iStore16u(dst + 48, xmm3);
+
+      dst += 64;
+      src += 16;
+      w -= 16;
+    }
+
+    if (w)
+      RasterOps_C::CompositeSrc::prgb32_vblit_a8_line(dst, src, w, closure);
+  }
+
+  // ==========================================================================
+  // [Convert - PRGB32 <-> PRGB64]
+  // ==========================================================================
+
+  static void FOG_FASTCALL prgb32_from_prgb64(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 4)
+    {
+      __m128i xmm0, xmm1;
+
+      Acc::m128iLoad16u(xmm0, src +  0);
+      Acc::m128iLoad16u(xmm1, src + 16);
+
+      // Take the high byte of each 16-bit component.
+      Acc::m128iRShiftPU16<8>(xmm0, xmm0);
+      Acc::m128iRShiftPU16<8>(xmm1, xmm1);
+
+      Acc::m128iPackPU8FromPU16(xmm0, xmm0, xmm1);
+      Acc::m128iStore16u(dst, xmm0);
+
+      dst += 16;
+      src += 32;
+      w -= 4;
+    }
+
+    if (w)
+      RasterOps_C::CompositeSrc::prgb32_vblit_prgb64_line(dst, src, w, closure);
+  }
+
+  static void FOG_FASTCALL prgb64_from_prgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 4)
+    {
+      __m128i xmm0, xmm1;
+
+      // Unpacking the byte with itself is the same as multiplying by 0x0101.
+      Acc::m128iLoad16u(xmm0, src);
+      Acc::m128iUnpackPI16FromPI8Hi(xmm1, xmm0, xmm0);
+      Acc::m128iUnpackPI16FromPI8Lo(xmm0, xmm0, xmm0);
+
+      Acc::m128iStore16u(dst +  0, xmm0);
+      Acc::m128iStore16u(dst + 16, xmm1);
+
+      dst += 32;
+      src += 16;
+      w -= 4;
+    }
+
+    if (w)
+      RasterOps_C::Convert::prgb64_from_prgb32(dst, src, w, closure);
+  }
+
+  static void FOG_FASTCALL prgb64_from_xrgb32(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_ASSUME(w > 0);
+
+    while (w >= 4)
+    {
+      __m128i xmm0, xmm1;
+
+      Acc::m128iLoad16u(xmm0, src);
+      Acc::m128iOr(xmm0, xmm0, FOG_XMM_GET_CONST_PI(FF000000FF000000_FF000000FF000000));
+
+      Acc::m128iUnpackPI16FromPI8Hi(xmm1, xmm0, xmm0);
+      Acc::m128iUnpackPI16FromPI8Lo(xmm0, xmm0, xmm0);
+
+      Acc::m128iStore16u(dst +  0, xmm0);
+      Acc::m128iStore16u(dst + 16, xmm1);
+
+      dst += 32;
+      src += 16;
+      w -= 4;
+    }
+
+    if (w)
+      RasterOps_C::Convert::prgb64_from_xrgb32(dst, src, w, closure);
+  }
 };
 
 } // RasterOps_SSE2 namespace
@@ -0,0 +1,178 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_COMPOSITELINEAR_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_SSE2_COMPOSITELINEAR_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Painting/RasterOps_C/CompositeLinear_p.h>
+#include <Fog/G2d/Painting/RasterOps_SSE2/CompositeBase_p.h>
+
+namespace Fog {
+namespace RasterOps_SSE2 {
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - LinearBlend]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief SSE2 linear-light blender, two pixels per iteration.
+//!
+//! The result is identical to @c RasterOps_C::LinearBlend, the conversion
+//! between sRGB and linear-light is shared (it's LUT based).
+struct FOG_NO_EXPORT LinearBlend
+{
+  // ==========================================================================
+  // [Helpers]
+  // ==========================================================================
+
+  // (x * m) >> 8, the result must fit into 16 bits (m <= 0x100).
+  static FOG_INLINE void _mulDiv256(__m128i& dst0, const __m128i& x0, const __m128i& m0)
+  {
+    __m128i t0;
+
+    Acc::m128iMulHiPU16(t0, x0, m0);
+    Acc::m128iMulLoPI16(dst0, x0, m0);
+
+    Acc::m128iLShiftPU16<8>(t0, t0);
+    Acc::m128iRShiftPU16<8>(dst0, dst0);
+    Acc::m128iOr(dst0, dst0, t0);
+  }
+
+  static FOG_INLINE void _expandAlpha(__m128i& dst0, const __m128i& x0)
+  {
+    Acc::m128iShufflePI16Lo<3, 3, 3, 3>(dst0, x0);
+    Acc::m128iShufflePI16Hi<3, 3, 3, 3>(dst0, dst0);
+  }
+
+  // Dca' = Sca.m + Dca.(1 - m)
+  static FOG_INLINE void _src(__m128i& d0, const __m128i& s0, const __m128i& m0)
+  {
+    __m128i t0, i0;
+
+    Acc::m128iSubPI16(i0, FOG_XMM_GET_CONST_PI(0100010001000100_0100010001000100), m0);
+    _mulDiv256(t0, s0, m0);
+    _mulDiv256(d0, d0, i0);
+    Acc::m128iAddPI16(d0, d0, t0);
+  }
+
+  // Dca' = Sca.m + Dca.(1 - Sa.m)
+  static FOG_INLINE void _srcOver(__m128i& d0, const __m128i& s0, const __m128i& sa0, const __m128i& m0)
+  {
+    __m128i t0, t1, t2;
+
+    // inv = 0xFFFF - ((Sa * m) >> 8).
+    _mulDiv256(t2, sa0, m0);
+    Acc::m128iXor(t2, t2, FOG_XMM_GET_CONST_PI(FFFFFFFFFFFFFFFF_FFFFFFFFFFFFFFFF));
+
+    // (D * inv + D) >> 16, the carry of the low word addition is detected by
+    // comparing the wrapping and the saturating sum.
+    Acc::m128iMulHiPU16(t0, d0, t2);
+    Acc::m128iMulLoPI16(t1, d0, t2);
+
+    Acc::m128iAddPI16(t2, t1, d0);
+    Acc::m128iAddusPU16(t1, t1, d0);
+    Acc::m128iCmpEqPI16(t1, t1, t2);
+
+    Acc::m128iSubPI16(t0, t0, FOG_XMM_GET_CONST_PI(FFFFFFFFFFFFFFFF_FFFFFFFFFFFFFFFF));
+    Acc::m128iAddPI16(t0, t0, t1);
+
+    _mulDiv256(t1, s0, m0);
+    Acc::m128iAddPI16(d0, t0, t1);
+  }
+
+  // ==========================================================================
+  // [Src]
+  // ==========================================================================
+
+  static FOG_INLINE void src(uint16_t* dst, const uint16_t* src, size_t srcInc, const uint16_t* msk, int w)
+  {
+    __m128i d0, s0, m0;
+
+    if (srcInc == 0)
+    {
+      Acc::m128iLoad8(s0, src);
+      Acc::m128iUnpackSI128FromPI64Lo(s0, s0, s0);
+    }
+
+    for (; w >= 2; w -= 2, dst += 8, src += srcInc * 2, msk += 8)
+    {
+      if (srcInc != 0)
+        Acc::m128iLoad16u(s0, src);
+
+      Acc::m128iLoad16a(d0, dst);
+      Acc::m128iLoad16a(m0, msk);
+
+      _src(d0, s0, m0);
+      Acc::m128iStore16a(dst, d0);
+    }
+
+    if (w)
+    {
+      if (srcInc != 0)
+        Acc::m128iLoad8(s0, src);
+
+      Acc::m128iLoad8(d0, dst);
+      Acc::m128iLoad8(m0, msk);
+
+      _src(d0, s0, m0);
+      Acc::m128iStore8(dst, d0);
+    }
+  }
+
+  // ==========================================================================
+  // [SrcOver]
+  // ==========================================================================
+
+  static FOG_INLINE void srcOver(uint16_t* dst, const uint16_t* src, size_t srcInc, const uint16_t* msk, int w)
+  {
+    __m128i d0, s0, sa0, m0;
+
+    if (srcInc == 0)
+    {
+      Acc::m128iLoad8(s0, src);
+      Acc::m128iUnpackSI128FromPI64Lo(s0, s0, s0);
+      _expandAlpha(sa0, s0);
+    }
+
+    for (; w >= 2; w -= 2, dst += 8, src += srcInc * 2, msk += 8)
+    {
+      if (srcInc != 0)
+      {
+        Acc::m128iLoad16u(s0, src);
+        _expandAlpha(sa0, s0);
+      }
+
+      Acc::m128iLoad16a(d0, dst);
+      Acc::m128iLoad16a(m0, msk);
+
+      _srcOver(d0, s0, sa0, m0);
+      Acc::m128iStore16a(dst, d0);
+    }
+
+    if (w)
+    {
+      if (srcInc != 0)
+      {
+        Acc::m128iLoad8(s0, src);
+        _expandAlpha(sa0, s0);
+      }
+
+      Acc::m128iLoad8(d0, dst);
+      Acc::m128iLoad8(m0, msk);
+
+      _srcOver(d0, s0, sa0, m0);
+      Acc::m128iStore8(dst, d0);
+    }
+  }
+};
+
+} // RasterOps_SSE2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_SSE2_COMPOSITELINEAR_P_H
@@ -1214,6 +1214,162 @@ struct FOG_NO_EXPORT CompositeSrcOver
 
     FOG_VBLIT_SPAN8_END()
   }
+
+  // ==========================================================================
+  // [A8 - CBlit - PRGB32 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_cblit_prgb32_line(
+    uint8_t* dst, const RasterSolid* src, int w, const RasterClosure* closure)
+  {
+    uint32_t sra0p = src->prgb32.a;
+    uint32_t sinv0p = 255 - sra0p;
+
+    __m128i sra0xmm;
+    __m128i sinv0xmm;
+
+    Acc::m128iCvtSI128FromSI(sra0xmm, (int)sra0p);
+    Acc::m128iCvtSI128FromSI(sinv0xmm, (int)sinv0p);
+    Acc::m128iExtendPI8FromSI8(sra0xmm, sra0xmm);
+    Acc::m128iExpandPI16FromSI16(sinv0xmm, sinv0xmm);
+
+    FOG_BLIT_LOOP_8x16_INIT()
+
+    FOG_BLIT_LOOP_8x16_SMALL_BEGIN(C_Opaque)
+      uint32_t dst0p;
+
+      Acc::p32Load1b(dst0p, dst);
+      Acc::p32MulDiv255SBW(dst0p, dst0p, sinv0p);
+      Acc::p32Add(dst0p, dst0p, sra0p);
+      Acc::p32Store1b(dst, dst0p);
+
+      dst += 1;
+    FOG_BLIT_LOOP_8x16_SMALL_END(C_Opaque)
+
+    FOG_BLIT_LOOP_8x16_MAIN_BEGIN(C_Opaque)
+      __m128i dst0xmm, dst1xmm;
+
+      Acc::m128iLoad16a(dst0xmm, dst);
+      Acc::m128iUnpackPI16FromPI8Hi(dst1xmm, dst0xmm);
+      Acc::m128iUnpackPI16FromPI8Lo(dst0xmm, dst0xmm);
+
+      Acc::m128iMulDiv255PI16_2x(dst0xmm, dst0xmm, sinv0xmm, dst1xmm, dst1xmm, sinv0xmm);
+      Acc::m128iPackPU8FromPU16(dst0xmm, dst0xmm, dst1xmm);
+      Acc::m128iAddPI8(dst0xmm, dst0xmm, sra0xmm);
+      Acc::m128iStore16a(dst, dst0xmm);
+
+      dst += 16;
+    FOG_BLIT_LOOP_8x16_MAIN_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - PRGB32 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_prgb32_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_BLIT_LOOP_8x16_INIT()
+
+    FOG_BLIT_LOOP_8x16_SMALL_BEGIN(C_Opaque)
+      uint32_t dst0p;
+      uint32_t src0p;
+      uint32_t inv0p;
+
+      Acc::p32Load1b(dst0p, dst);
+      Acc::p32Load1b(src0p, src + PIXEL_ARGB32_POS_A);
+      Acc::p32Negate255SBW(inv0p, src0p);
+      Acc::p32MulDiv255SBW(dst0p, dst0p, inv0p);
+      Acc::p32Add(dst0p, dst0p, src0p);
+      Acc::p32Store1b(dst, dst0p);
+
+      dst += 1;
+      src += 4;
+    FOG_BLIT_LOOP_8x16_SMALL_END(C_Opaque)
+
+    FOG_BLIT_LOOP_8x16_MAIN_BEGIN(C_Opaque)
+      __m128i dst0xmm, dst1xmm;
+      __m128i src0xmm, src1xmm;
+      __m128i src2xmm, src3xmm;
+
+      Acc::m128iLoad16u(src0xmm, src +  0);
+      Acc::m128iLoad16u(src1xmm, src + 16);
+      Acc::m128iLoad16u(src2xmm, src + 32);
+      Acc::m128iLoad16u(src3xmm, src + 48);
+      Acc::m128iLoad16a(dst0xmm, dst);
+
+      // Extract the alpha of 16 pixels into two PI16 vectors.
+      Acc::m128iRShiftPU32<24>(src0xmm, src0xmm);
+      Acc::m128iRShiftPU32<24>(src1xmm, src1xmm);
+      Acc::m128iRShiftPU32<24>(src2xmm, src2xmm);
+      Acc::m128iRShiftPU32<24>(src3xmm, src3xmm);
+      Acc::m128iPackPI16FromPI32(src0xmm, src0xmm, src1xmm);
+      Acc::m128iPackPI16FromPI32(src1xmm, src2xmm, src3xmm);
+
+      Acc::m128iUnpackPI16FromPI8Hi(dst1xmm, dst0xmm);
+      Acc::m128iUnpackPI16FromPI8Lo(dst0xmm, dst0xmm);
+
+      Acc::m128iNegate255PI16_2x(src2xmm, src0xmm, src3xmm, src1xmm);
+      Acc::m128iMulDiv255PI16_2x(dst0xmm, dst0xmm, src2xmm, dst1xmm, dst1xmm, src3xmm);
+      Acc::m128iAddPI16_2x(dst0xmm, dst0xmm, src0xmm, dst1xmm, dst1xmm, src1xmm);
+      Acc::m128iPackPU8FromPU16(dst0xmm, dst0xmm, dst1xmm);
+      Acc::m128iStore16a(dst, dst0xmm);
+
+      dst += 16;
+      src += 64;
+    FOG_BLIT_LOOP_8x16_MAIN_END(C_Opaque)
+  }
+
+  // ==========================================================================
+  // [A8 - VBlit - A8 - Line]
+  // ==========================================================================
+
+  static void FOG_FASTCALL a8_vblit_a8_line(
+    uint8_t* dst, const uint8_t* src, int w, const RasterClosure* closure)
+  {
+    FOG_BLIT_LOOP_8x16_INIT()
+
+    FOG_BLIT_LOOP_8x16_SMALL_BEGIN(C_Opaque)
+      uint32_t dst0p;
+      uint32_t src0p;
+      uint32_t inv0p;
+
+      Acc::p32Load1b(dst0p, dst);
+      Acc::p32Load1b(src0p, src);
+      Acc::p32Negate255SBW(inv0p, src0p);
+      Acc::p32MulDiv255SBW(dst0p, dst0p, inv0p);
+      Acc::p32Add(dst0p, dst0p, src0p);
+      Acc::p32Store1b(dst, dst0p);
+
+      dst += 1;
+      src += 1;
+    FOG_BLIT_LOOP_8x16_SMALL_END(C_Opaque)
+
+    FOG_BLIT_LOOP_8x16_MAIN_BEGIN(C_Opaque)
+      __m128i dst0xmm, dst1xmm;
+      __m128i src0xmm;
+      __m128i inv0xmm, inv1xmm;
+
+      Acc::m128iLoad16u(src0xmm, src);
+      Acc::m128iLoad16a(dst0xmm, dst);
+
+      Acc::m128iUnpackPI16FromPI8Hi(inv1xmm, src0xmm);
+      Acc::m128iUnpackPI16FromPI8Lo(inv0xmm, src0xmm);
+      Acc::m128iUnpackPI16FromPI8Hi(dst1xmm, dst0xmm);
+      Acc::m128iUnpackPI16FromPI8Lo(dst0xmm, dst0xmm);
+
+      Acc::m128iNegate255PI16_2x(inv0xmm, inv0xmm, inv1xmm, inv1xmm);
+      Acc::m128iMulDiv255PI16_2x(dst0xmm, dst0xmm, inv0xmm, dst1xmm, dst1xmm, inv1xmm);
+      Acc::m128iPackPU8FromPU16(dst0xmm, dst0xmm, dst1xmm);
+
+      // Sa + Da.(1 - Sa) never overflows, a byte-add is enough.
+      Acc::m128iAddPI8(dst0xmm, dst0xmm, src0xmm);
+      Acc::m128iStore16a(dst, dst0xmm);
+
+      dst += 16;
+      src += 16;
+    FOG_BLIT_LOOP_8x16_MAIN_END(C_Opaque)
+  }
 };
 
 } // RasterOps_SSE2 namespace
@@ -0,0 +1,109 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREPROJECTION_P_H
+#define _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREPROJECTION_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Painting/RasterOps_C/TextureProjection_p.h>
+#include <Fog/G2d/Painting/RasterOps_SSE2/BaseDefs_p.h>
+
+namespace Fog {
+namespace RasterOps_SSE2 {
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureProjection - Helpers]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Bilinear interpolation of four PRGB32 pixels using SSE2.
+//!
+//! The result is identical to @c P_INTERPOLATE_C_32_4, the sum of weights
+//! must be less or equal to 256.
+static FOG_INLINE void p_interpolate_prgb32_4(
+  uint32_t& dst,
+  const uint32_t& c0, uint w0, const uint32_t& c1, uint w1,
+  const uint32_t& c2, uint w2, const uint32_t& c3, uint w3)
+{
+  __m128i pix0xmm, pix1xmm, tmp0xmm, tmp1xmm;
+  __m128i wgt0xmm, wgt1xmm;
+
+  // [c0 | c1] and [c2 | c3] unpacked to 16-bit.
+  Acc::m128iCvtSI128FromSI(pix0xmm, (int)c0);
+  Acc::m128iCvtSI128FromSI(tmp0xmm, (int)c1);
+  Acc::m128iCvtSI128FromSI(pix1xmm, (int)c2);
+  Acc::m128iCvtSI128FromSI(tmp1xmm, (int)c3);
+
+  Acc::m128iUnpackPI64FromPI32Lo(pix0xmm, pix0xmm, tmp0xmm);
+  Acc::m128iUnpackPI64FromPI32Lo(pix1xmm, pix1xmm, tmp1xmm);
+
+  Acc::m128iUnpackPI16FromPI8Lo(pix0xmm, pix0xmm);
+  Acc::m128iUnpackPI16FromPI8Lo(pix1xmm, pix1xmm);
+
+  // [w0 w0 w0 w0 | w1 w1 w1 w1] and [w2 w2 w2 w2 | w3 w3 w3 w3].
+  Acc::m128iCvtSI128FromSI(wgt0xmm, (int)(w0 | (w1 << 16)));
+  Acc::m128iCvtSI128FromSI(wgt1xmm, (int)(w2 | (w3 << 16)));
+
+  Acc::m128iUnpackPI32FromPI16Lo(wgt0xmm, wgt0xmm, wgt0xmm);
+  Acc::m128iUnpackPI32FromPI16Lo(wgt1xmm, wgt1xmm, wgt1xmm);
+
+  Acc::m128iShufflePI32<1, 1, 0, 0>(wgt0xmm, wgt0xmm);
+  Acc::m128iShufflePI32<1, 1, 0, 0>(wgt1xmm, wgt1xmm);
+
+  Acc::m128iMulLoPI16(pix0xmm, pix0xmm, wgt0xmm);
+  Acc::m128iMulLoPI16(pix1xmm, pix1xmm, wgt1xmm);
+
+  // Horizontal sum of both halves.
+  Acc::m128iAddPI16(pix0xmm, pix0xmm, pix1xmm);
+  Acc::m128iRShiftSU128<64>(pix1xmm, pix0xmm);
+  Acc::m128iAddPI16(pix0xmm, pix0xmm, pix1xmm);
+
+  Acc::m128iRShiftPU16<8>(pix0xmm, pix0xmm);
+  Acc::m128iPackPU8FromPU16(pix0xmm, pix0xmm);
+
+  int result;
+  Acc::m128iCvtSIFromSI128(result, pix0xmm);
+  dst = (uint32_t)result;
+}
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureAccessor - PRGB32 <- PRGB32]
+// ============================================================================
+
+struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_PRGB32 : public RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32
+{
+  FOG_INLINE PTextureAccessor_PRGB32_From_PRGB32(const RasterPattern* ctx) :
+    RasterOps_C::PTextureAccessor_PRGB32_From_PRGB32(ctx) {}
+
+  FOG_INLINE void interpolateRaw_4(Pixel& dst, const Pixel& c0, uint w0, const Pixel& c1, uint w1, const Pixel& c2, uint w2, const Pixel& c3, uint w3)
+  { p_interpolate_prgb32_4(dst, c0, w0, c1, w1, c2, w2, c3, w3); }
+
+  FOG_INLINE void interpolateNorm_4(Pixel& dst, const Pixel& c0, uint w0, const Pixel& c1, uint w1, const Pixel& c2, uint w2, const Pixel& c3, uint w3)
+  { p_interpolate_prgb32_4(dst, c0, w0, c1, w1, c2, w2, c3, w3); }
+};
+
+// ============================================================================
+// [Fog::RasterOps_SSE2 - PTextureAccessor - PRGB32 <- XRGB32]
+// ============================================================================
+
+struct FOG_NO_EXPORT PTextureAccessor_PRGB32_From_XRGB32 : public RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32
+{
+  FOG_INLINE PTextureAccessor_PRGB32_From_XRGB32(const RasterPattern* ctx) :
+    RasterOps_C::PTextureAccessor_PRGB32_From_XRGB32(ctx) {}
+
+  FOG_INLINE void interpolateRaw_4(Pixel& dst, const Pixel& c0, uint w0, const Pixel& c1, uint w1, const Pixel& c2, uint w2, const Pixel& c3, uint w3)
+  { p_interpolate_prgb32_4(dst, c0, w0, c1, w1, c2, w2, c3, w3); }
+
+  FOG_INLINE void interpolateNorm_4(Pixel& dst, const Pixel& c0, uint w0, const Pixel& c1, uint w1, const Pixel& c2, uint w2, const Pixel& c3, uint w3)
+  { p_interpolate_prgb32_4(dst, c0, w0, c1, w1, c2, w2, c3, w3); }
+};
+
+} // RasterOps_SSE2 namespace
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_PAINTING_RASTEROPS_SSE2_TEXTUREPROJECTION_P_H
@@ -11,6 +11,7 @@
 // [Dependencies]
 #include <Fog/Core/Acc/AccC.h>
 #include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemBufferTmp_p.h>
 #include <Fog/Core/Memory/MemMgr.h>
 #include <Fog/Core/Memory/MemOps.h>
 #include <Fog/Core/Threading/Atomic.h>
@@ -28,6 +29,7 @@
 #include <Fog/G2d/Imaging/ImageBits.h>
 #include <Fog/G2d/Imaging/ImageFormatDescription.h>
 #include <Fog/G2d/Imaging/Filters/FeBase.h>
+#include <Fog/G2d/Imaging/Filters/FeBlur.h>
 #include <Fog/G2d/Painting/Painter.h>
 #include <Fog/G2d/Painting/RasterApi_p.h>
 #include <Fog/G2d/Painting/RasterConstants_p.h>
@@ -134,6 +136,18 @@ static const uint32_t RasterPaintEngine_clipAllFlags[CLIP_OP_COUNT] =
     } \
   FOG_MACRO_END
 
+// Called by 'filterStroked' functions, the source is not used, but the stroke
+// parameters must be correct.
+#define _FOG_RASTER_ENTER_FILTER_STROKE_FUNC() \
+  FOG_MACRO_BEGIN \
+    if (FOG_UNLIKELY((engine->masterFlags & (RASTER_NO_PAINT_BASE_FLAGS     | \
+                                             RASTER_NO_PAINT_STROKE         | \
+                                             RASTER_NO_PAINT_FATAL          )) != 0)) \
+    { \
+      return ERR_OK; \
+    } \
+  FOG_MACRO_END
+
 #define _PARAM_C(_Type_) (*static_cast<const _Type_*>(value))
 #define _PARAM_M(_Type_) (*static_cast<_Type_*>(value))
 
@@ -178,6 +192,7 @@ static err_t FOG_CDECL RasterPaintEngine_setMetaParams(Painter* self, const Regi
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
   engine->discardStates(NULL);
+  engine->discardPatternCache();
   // TODO: Discard also groups.
 
   BoxI screen(0, 0, engine->ctx.target.size.w, engine->ctx.target.size.h);
@@ -198,6 +213,7 @@ static err_t FOG_CDECL RasterPaintEngine_resetMetaParams(Painter* self)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
   engine->discardStates(NULL);
+  engine->discardPatternCache();
   // TODO: Discard also groups.
 
   BoxI screen(0, 0, engine->ctx.target.size.w, engine->ctx.target.size.h);
@@ -627,6 +643,16 @@ static err_t FOG_CDECL RasterPaintEngine_getParameter(const Painter* self, uint3
       return ERR_OK;
     }
 
+    // ------------------------------------------------------------------------
+    // [Color Space]
+    // ------------------------------------------------------------------------
+
+    case PAINTER_PARAMETER_COLOR_SPACE_I:
+    {
+      _PARAM_M(uint32_t) = engine->ctx.paintHints.colorSpace;
+      return ERR_OK;
+    }
+
     default:
     {
       return ERR_RT_INVALID_ARGUMENT;
@@ -1475,6 +1501,27 @@ _GlobalOpacityF:
       return ERR_OK;
     }
 
+    // ------------------------------------------------------------------------
+    // [Color Space]
+    // ------------------------------------------------------------------------
+
+    case PAINTER_PARAMETER_COLOR_SPACE_I:
+    {
+      uint32_t v = _PARAM_C(uint32_t);
+
+      if (v == engine->ctx.paintHints.colorSpace)
+        return ERR_OK;
+
+      if (v >= COLOR_SPACE_COUNT)
+        return ERR_RT_INVALID_ARGUMENT;
+
+      // The color space selects compositing functions, it must be propagated
+      // to the group and multi-threaded paint workers.
+      engine->ctx.paintHints.colorSpace = v;
+      engine->masterFlags |= RASTER_PENDING_PAINT_HINTS;
+      return ERR_OK;
+    }
+
     default:
     {
       return ERR_RT_INVALID_ARGUMENT;
@@ -1812,6 +1859,20 @@ static err_t FOG_CDECL RasterPaintEngine_resetParameter(Painter* self, uint32_t
       return ERR_OK;
     }
 
+    // ------------------------------------------------------------------------
+    // [Color Space]
+    // ------------------------------------------------------------------------
+
+    case PAINTER_PARAMETER_COLOR_SPACE_I:
+    {
+      if (engine->ctx.paintHints.colorSpace == COLOR_SPACE_DEFAULT)
+        return ERR_OK;
+
+      engine->ctx.paintHints.colorSpace = COLOR_SPACE_DEFAULT;
+      engine->masterFlags |= RASTER_PENDING_PAINT_HINTS;
+      return ERR_OK;
+    }
+
     default:
     {
       return ERR_RT_INVALID_ARGUMENT;
@@ -2543,8 +2604,7 @@ static err_t FOG_CDECL RasterPaintEngine_mapPointF(const Painter* self, uint32_t
       return ERR_OK;
 
     case PAINTER_MAP_DEVICE_TO_USER:
-      // TODO: Not optimal, should we cache the inverted matrix?
-      engine->userTransformD.inverted().mapPoint(pd);
+      engine->getUserTransformInv().mapPoint(pd);
       *pt = pd;
       return ERR_OK;
 
@@ -2564,8 +2624,7 @@ static err_t FOG_CDECL RasterPaintEngine_mapPointD(const Painter* self, uint32_t
       return ERR_OK;
 
     case PAINTER_MAP_DEVICE_TO_USER:
-      // TODO: Not optimal, should we cache the inverted matrix?
-      engine->userTransformD.inverted().mapPoint(*pt);
+      engine->getUserTransformInv().mapPoint(*pt);
       return ERR_OK;
 
     default:
@@ -3253,8 +3312,25 @@ static err_t FOG_CDECL RasterPaintEngine_fillRegion(Painter* self, const Region*
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
   _FOG_RASTER_ENTER_FILL_FUNC();
 
-  // TODO: Not optimal.
+  if (r->isInfinite())
+    return engine->doCmd->fillAll(engine);
 
+  // Translated region is filled directly by the band structure, the clipping
+  // is done here so fillNormalizedRegion() gets only visible boxes.
+  if (engine->integralTransformType == RASTER_INTEGRAL_TRANSFORM_SIMPLE)
+  {
+    Region* region = engine->getTemporaryRegion();
+    PointI translation(engine->integralTransform._tx, engine->integralTransform._ty);
+
+    FOG_RETURN_ON_ERROR(Region::translateAndClip(*region, *r, translation, engine->ctx.clipBoxI));
+    if (engine->ctx.clipType == RASTER_CLIP_REGION)
+      FOG_RETURN_ON_ERROR(region->intersect(engine->ctx.clipRegion));
+
+    return engine->doCmd->fillNormalizedRegion(engine, region);
+  }
+
+  // Scaled or swapped region, or region transformed by a non-integral matrix
+  // is converted to path.
   if (!engine->ctx.paintHints.geometricPrecision)
   {
     PathF* path = &engine->ctx.tmpPathF[0];
@@ -3718,6 +3794,183 @@ static err_t FOG_CDECL RasterPaintEngine_blitImageInD(Painter* self, const RectD
     return engine->doCmd->blitImageD(engine, &box, src, &sRect, &tr, engine->ctx.paintHints.imageQuality);
 }
 
+// ============================================================================
+// [Fog::RasterPaintEngine - Blit - Images]
+// ============================================================================
+
+static err_t FOG_CDECL RasterPaintEngine_blitImages(Painter* self, const Image* src, const BlitItem* items, size_t count)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+
+  if (src->isEmpty() || count == 0)
+    return ERR_OK;
+
+  _FOG_RASTER_ENTER_BLIT_FUNC();
+
+  if (count > SIZE_MAX / sizeof(RasterBlitItemA))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  MemBufferTmp<sizeof(RasterBlitItemA) * 128> normalizedBuffer;
+  RasterBlitItemA* normalized = reinterpret_cast<RasterBlitItemA*>(
+    normalizedBuffer.alloc(count * sizeof(RasterBlitItemA)));
+
+  if (FOG_IS_NULL(normalized))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  int atlasW = src->getWidth();
+  int atlasH = src->getHeight();
+
+  // Items which are aligned to the pixel grid (the transform is integral and
+  // the fragment is not scaled) are clipped and translated to device units
+  // here and passed to blitNormalizedImagesA() at once. Other items are blitted
+  // by blitImageAtD() or blitImageInD(), the opacity and the user transform of
+  // the painter are changed for them and restored when the batch is done.
+  bool isAligned = engine->integralTransformType == RASTER_INTEGRAL_TRANSFORM_SIMPLE;
+
+  float baseOpacityF = engine->opacityF;
+  float curOpacityF = baseOpacityF;
+  float fullOpacityF = engine->ctx.fullOpacity.f;
+
+  TransformD userTransform(engine->userTransformD);
+  bool userTransformChanged = false;
+
+  size_t normalizedCount = 0;
+  err_t err = ERR_OK;
+
+  for (size_t i = 0; i < count; i++)
+  {
+    const BlitItem& item = items[i];
+    const RectI& fragment = item._fragment;
+
+    if (fragment.w <= 0 || fragment.h <= 0 ||
+        (uint)fragment.x >= (uint)atlasW || (uint)fragment.w > (uint)(atlasW - fragment.x) ||
+        (uint)fragment.y >= (uint)atlasH || (uint)fragment.h > (uint)(atlasH - fragment.y))
+    {
+      err = ERR_RT_INVALID_ARGUMENT;
+      break;
+    }
+
+    float opacityF = baseOpacityF * Math::bound<float>(item._opacity, 0.0f, 1.0f);
+    if (opacityF <= 0.0f)
+      continue;
+
+    const TransformD* tr = item._transform;
+
+    if (isAligned && (tr == NULL || tr->getType() <= TRANSFORM_TYPE_TRANSLATION) &&
+        (!item.isScaled() || (item._dst.w == double(fragment.w) && item._dst.h == double(fragment.h))))
+    {
+      double x = item._dst.x;
+      double y = item._dst.y;
+
+      if (tr != NULL)
+      {
+        x += tr->_20;
+        y += tr->_21;
+      }
+
+      int dX = Math::iround(x);
+      int dY = Math::iround(y);
+
+      if (double(dX) == x && double(dY) == y)
+      {
+        int sX = fragment.x;
+        int sY = fragment.y;
+        int sW = fragment.w;
+        int sH = fragment.h;
+        int t;
+
+        dX += engine->integralTransform._tx;
+        dY += engine->integralTransform._ty;
+
+        if ((uint)(t = dX - engine->ctx.clipBoxI.x0) >= (uint)engine->ctx.clipBoxI.getWidth())
+        {
+          dX = engine->ctx.clipBoxI.x0; sX -= t;
+          if (t >= 0 || (sW += t) <= 0) continue;
+        }
+
+        if ((uint)(t = dY - engine->ctx.clipBoxI.y0) >= (uint)engine->ctx.clipBoxI.getHeight())
+        {
+          dY = engine->ctx.clipBoxI.y0; sY -= t;
+          if (t >= 0 || (sH += t) <= 0) continue;
+        }
+
+        if ((t = engine->ctx.clipBoxI.x1 - dX) < sW) sW = t;
+        if ((t = engine->ctx.clipBoxI.y1 - dY) < sH) sH = t;
+
+        uint32_t opacity = (uint32_t)Math::iround(opacityF * fullOpacityF);
+        if (opacity == 0)
+          continue;
+
+        RasterBlitItemA& n = normalized[normalizedCount++];
+        n.pt.set(dX, dY);
+        n.fragment.setRect(sX, sY, sW, sH);
+        n.opacity = opacity;
+        continue;
+      }
+    }
+
+    // The item is not aligned. Flush all normalized items to keep the order.
+    if (normalizedCount != 0)
+    {
+      err = engine->doCmd->blitNormalizedImagesA(engine, src, normalized, normalizedCount);
+      normalizedCount = 0;
+
+      if (FOG_IS_ERROR(err))
+        break;
+    }
+
+    if (opacityF != curOpacityF)
+    {
+      err = engine->vtable->setParameter(self, PAINTER_PARAMETER_OPACITY_F, &opacityF);
+      if (FOG_IS_ERROR(err))
+        break;
+      curOpacityF = opacityF;
+    }
+
+    if (tr != NULL)
+    {
+      TransformD itemTransform(*tr);
+      itemTransform.transform(userTransform, MATRIX_ORDER_APPEND);
+
+      err = engine->vtable->setTransformD(self, &itemTransform);
+      if (FOG_IS_ERROR(err))
+        break;
+      userTransformChanged = true;
+    }
+    else if (userTransformChanged)
+    {
+      err = engine->vtable->setTransformD(self, &userTransform);
+      if (FOG_IS_ERROR(err))
+        break;
+      userTransformChanged = false;
+    }
+
+    if (item.isScaled())
+    {
+      err = engine->vtable->blitImageInD(self, &item._dst, src, &fragment);
+    }
+    else
+    {
+      PointD pt(item._dst.x, item._dst.y);
+      err = engine->vtable->blitImageAtD(self, &pt, src, &fragment);
+    }
+
+    if (FOG_IS_ERROR(err))
+      break;
+  }
+
+  if (normalizedCount != 0 && err == ERR_OK)
+    err = engine->doCmd->blitNormalizedImagesA(engine, src, normalized, normalizedCount);
+
+  if (curOpacityF != baseOpacityF)
+    engine->vtable->setParameter(self, PAINTER_PARAMETER_OPACITY_F, &baseOpacityF);
+
+  if (userTransformChanged)
+    engine->vtable->setTransformD(self, &userTransform);
+
+  return err;
+}
+
 // ============================================================================
 // [Fog::RasterPaintEngine - Blit - MaskedImageAt]
 // ============================================================================
@@ -4054,6 +4307,85 @@ _Default:
   }
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - Filter - Stroke - Mask]
+// ============================================================================
+
+// Get the filter extents in device pixels, the extents are scaled the same way
+// as the filter parameters are scaled by the filter context.
+static void FOG_FASTCALL RasterPaintEngine_getFilterExtents(
+  RasterPaintEngine* engine, const FeBase* feBase, PointI& extents)
+{
+  PointF fe(UNINITIALIZED);
+  feBase->getExtents(fe);
+
+  const ImageFilterScaleD& scale = engine->ctx.filterScale;
+  double ex = Math::abs(double(fe.x) * scale.getPoint().x);
+  double ey = Math::abs(double(fe.y) * scale.getPoint().y);
+
+  if (scale.isSwapped())
+    swap(ex, ey);
+
+  // The extents larger than the target are useless, they are clipped anyway.
+  extents.set(Math::iceil(Math::min<double>(ex, double(engine->ctx.target.size.w))),
+              Math::iceil(Math::min<double>(ey, double(engine->ctx.target.size.h))));
+}
+
+// Filter the area around the stroke. The output of a filter which has extents
+// (blur, morphology) spreads outside of the stroke (glow, blurred outline), so
+// the stroke coverage is extended by the filter extents:
+//
+//   1. The stroke is rasterized into a temporary A8 mask, which covers only
+//      the bounding box of the stroke extended by the extents and clipped by
+//      the clip-box.
+//   2. The outline of the stroke is stroked again by a round pen of the
+//      extents radius (the larger one of both), the coverage is added to the
+//      mask.
+//   3. The box is filtered and composited through the mask. The pixels which
+//      are farther from the stroke than the extents (for example the interior
+//      of a stroked rectangle) are not changed.
+static err_t FOG_FASTCALL RasterPaintEngine_filterStrokedMask(
+  RasterPaintEngine* engine, const FeBase* feBase, const PathD* stroke, const PointI& extents)
+{
+  if (stroke->isEmpty())
+    return ERR_OK;
+
+  BoxD strokeBox(UNINITIALIZED);
+  FOG_RETURN_ON_ERROR(stroke->getBoundingBox(strokeBox));
+
+  BoxI box(Math::ifloor(strokeBox.x0) - extents.x,
+           Math::ifloor(strokeBox.y0) - extents.y,
+           Math::iceil (strokeBox.x1) + extents.x,
+           Math::iceil (strokeBox.y1) + extents.y);
+
+  if (!BoxI::intersect(box, box, engine->ctx.clipBoxI))
+    return ERR_OK;
+
+  Image mask;
+  FOG_RETURN_ON_ERROR(mask.create(SizeI(box.getWidth(), box.getHeight()), IMAGE_FORMAT_A8));
+  FOG_RETURN_ON_ERROR(mask.clear(Argb32(0x00000000)));
+
+  {
+    Painter maskPainter(mask);
+
+    // The opacity is applied to the mask. The source operator is used so the
+    // overlapping stroke and its extension don't accumulate the opacity.
+    maskPainter.setCompositingOperator(COMPOSITE_SRC);
+    maskPainter.setOpacity(engine->opacityF);
+    maskPainter.setSource(Argb32(0xFFFFFFFF));
+    maskPainter.translate(PointD(-double(box.x0), -double(box.y0)));
+    maskPainter.fillPath(*stroke);
+
+    maskPainter.setLineWidth(double(Math::max(extents.x, extents.y)) * 2.0);
+    maskPainter.setLineJoin(LINE_JOIN_ROUND);
+    maskPainter.setLineCaps(LINE_CAP_ROUND);
+    maskPainter.drawPath(*stroke);
+    maskPainter.end();
+  }
+
+  return engine->doCmd->filterNormalizedBoxMask(engine, feBase, &box, &mask);
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - Filter - Stroke - RawPath]
 // ============================================================================
@@ -4087,7 +4419,16 @@ static err_t FOG_FASTCALL RasterPaintEngine_filterStrokedRawPathF(
   tmp.clear();
   FOG_RETURN_ON_ERROR(stroker.strokePath(tmp, *path));
 
-  return engine->doCmd->filterNormalizedPathF(engine, feBase, &tmp, &engine->dummyPointF, FILL_RULE_NON_ZERO);
+  PointI extents(UNINITIALIZED);
+  RasterPaintEngine_getFilterExtents(engine, feBase, extents);
+
+  if (extents.x == 0 && extents.y == 0)
+    return engine->doCmd->filterNormalizedPathF(engine, feBase, &tmp, &engine->dummyPointF, FILL_RULE_NON_ZERO);
+
+  PathD& strokeD = engine->ctx.tmpPathD[0];
+  FOG_RETURN_ON_ERROR(strokeD.setPath(tmp));
+
+  return RasterPaintEngine_filterStrokedMask(engine, feBase, &strokeD, extents);
 }
 
 static err_t FOG_FASTCALL RasterPaintEngine_filterStrokedRawPathD(
@@ -4106,57 +4447,431 @@ static err_t FOG_FASTCALL RasterPaintEngine_filterStrokedRawPathD(
   tmp.clear();
   FOG_RETURN_ON_ERROR(stroker.strokePath(tmp, *path));
 
-  return engine->doCmd->filterNormalizedPathD(engine, feBase, &tmp, &engine->dummyPointD, FILL_RULE_NON_ZERO);
+  PointI extents(UNINITIALIZED);
+  RasterPaintEngine_getFilterExtents(engine, feBase, extents);
+
+  if (extents.x == 0 && extents.y == 0)
+    return engine->doCmd->filterNormalizedPathD(engine, feBase, &tmp, &engine->dummyPointD, FILL_RULE_NON_ZERO);
+
+  return RasterPaintEngine_filterStrokedMask(engine, feBase, &tmp, extents);
 }
 
 // ============================================================================
 // [Fog::RasterPaintDoRender - Filter - Stroke - Shape]
 // ============================================================================
 
+// The stroke is converted to a path by PathStroker. If the filter has no
+// extents (color filters) the stroke is passed to the same filterNormalizedPath
+// command as used by filterShape() and the filter is applied only to the area
+// covered by the stroke. Otherwise the coverage of the stroke is extended by
+// the filter extents, see RasterPaintEngine_filterStrokedMask().
+
 static err_t FOG_CDECL RasterPaintEngine_filterStrokedShapeF(Painter* self, const FeBase* feBase, uint32_t shapeType, const void* shapeData)
 {
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_FILTER_STROKE_FUNC();
+
+  if (feBase->getFeType() == FE_TYPE_NONE)
+    return ERR_OK;
+
+  switch (shapeType)
+  {
+    case SHAPE_TYPE_NONE:
+    {
+      return ERR_GEOMETRY_NONE;
+    }
+
+    case SHAPE_TYPE_PATH:
+    {
+      const PathF* path = reinterpret_cast<const PathF*>(shapeData);
+      return RasterPaintEngine_filterStrokedRawPathF(engine, feBase, path);
+    }
+
+    default:
+    {
+      PathF* path = &engine->ctx.tmpPathF[2];
+      path->clear();
+      path->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL);
+      return RasterPaintEngine_filterStrokedRawPathF(engine, feBase, path);
+    }
+  }
 }
 
 static err_t FOG_CDECL RasterPaintEngine_filterStrokedShapeD(Painter* self, const FeBase* feBase, uint32_t shapeType, const void* shapeData)
 {
-  // TODO:
-  return ERR_RT_NOT_IMPLEMENTED;
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_FILTER_STROKE_FUNC();
+
+  if (feBase->getFeType() == FE_TYPE_NONE)
+    return ERR_OK;
+
+  switch (shapeType)
+  {
+    case SHAPE_TYPE_NONE:
+    {
+      return ERR_GEOMETRY_NONE;
+    }
+
+    case SHAPE_TYPE_PATH:
+    {
+      const PathD* path = reinterpret_cast<const PathD*>(shapeData);
+      return RasterPaintEngine_filterStrokedRawPathD(engine, feBase, path);
+    }
+
+    default:
+    {
+      PathD* path = &engine->ctx.tmpPathD[2];
+      path->clear();
+      path->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL);
+      return RasterPaintEngine_filterStrokedRawPathD(engine, feBase, path);
+    }
+  }
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+// ============================================================================
+// [Fog::RasterPaintEngine - Shadow]
+// ============================================================================
+
+// The shadow is rendered in device coordinates (the offset and the blur radius
+// are not transformed) using these steps:
+//
+//   1. The coverage of the shape translated by the shadow offset is rasterized
+//      into a temporary A8 buffer. The buffer covers only the bounding box of
+//      the shadow extended by the blur radius and clipped by the clip-box
+//      (which is extended by the blur radius too, the pixels around the clip
+//      contribute to the blurred edge).
+//   2. The A8 buffer is blurred in-place by the stack-blur filter, processing
+//      one byte per pixel instead of four.
+//   3. The visible part of the blurred coverage is multiplied by the shadow
+//      color into a PRGB32 buffer.
+//   4. The PRGB32 buffer is composited by blitNormalizedImageA(), respecting
+//      the clip, the compositing operator and the opacity.
+//
+// The shape itself is painted after the shadow using the current source.
+
+static err_t FOG_FASTCALL RasterPaintEngine_paintShadow(
+  RasterPaintEngine* engine, PathD* path, uint32_t fillRule,
+  const PointD* offset, double blurRadius, const Color* color)
+{
+  uint32_t argb32 = color->getArgb32().u32;
+  if ((argb32 >> 24) == 0)
+    return ERR_OK;
+
+  uint32_t prgb32;
+  Acc::p32PRGB32FromARGB32(prgb32, argb32);
+
+  double radius = Math::bound<double>(blurRadius, 0.0, double(FE_BLUR_LIMIT_RADIUS));
+  int kernelRadius = Math::iround(radius);
+  int extent = kernelRadius + 1;
+
+  if (path->isEmpty())
+    return ERR_OK;
+
+  BoxD shadowBoxD(UNINITIALIZED);
+  FOG_RETURN_ON_ERROR(path->getBoundingBox(shadowBoxD));
+  shadowBoxD.translate(*offset);
+
+  const BoxI& clipBox = engine->ctx.clipBoxI;
+
+  BoxI shadowBox(Math::max(Math::ifloor(shadowBoxD.x0), clipBox.x0 - kernelRadius) - extent,
+                 Math::max(Math::ifloor(shadowBoxD.y0), clipBox.y0 - kernelRadius) - extent,
+                 Math::min(Math::iceil (shadowBoxD.x1), clipBox.x1 + kernelRadius) + extent,
+                 Math::min(Math::iceil (shadowBoxD.y1), clipBox.y1 + kernelRadius) + extent);
+
+  BoxI visibleBox(UNINITIALIZED);
+  if (!BoxI::intersect(visibleBox, shadowBox, clipBox))
+    return ERR_OK;
+
+  int maskW = shadowBox.getWidth();
+  int maskH = shadowBox.getHeight();
+
+  int visibleW = visibleBox.getWidth();
+  int visibleH = visibleBox.getHeight();
+
+  // --------------------------------------------------------------------------
+  // [Coverage]
+  // --------------------------------------------------------------------------
+
+  Image mask;
+  FOG_RETURN_ON_ERROR(mask.create(SizeI(maskW, maskH), IMAGE_FORMAT_A8));
+  FOG_RETURN_ON_ERROR(mask.clear(Argb32(0x00000000)));
+
+  FOG_RETURN_ON_ERROR(path->translate(PointD(offset->x - double(shadowBox.x0),
+                                             offset->y - double(shadowBox.y0))));
+
+  {
+    Painter maskPainter(mask);
+
+    maskPainter.setFillRule(fillRule);
+    maskPainter.setSource(Argb32(0xFFFFFFFF));
+    maskPainter.fillPath(*path);
+    maskPainter.end();
+  }
+
+  // --------------------------------------------------------------------------
+  // [Blur]
+  // --------------------------------------------------------------------------
+
+  if (kernelRadius > 0)
+  {
+    FeBlur feBlur(FE_BLUR_TYPE_STACK, float(radius));
+
+    RasterFilter filter;
+    FOG_RETURN_ON_ERROR(_api_raster.filter.create[FE_TYPE_BLUR](&filter,
+      &feBlur, NULL, &engine->ctx.buffer, IMAGE_FORMAT_A8, IMAGE_FORMAT_A8));
+
+    RasterFilterImage filterImage;
+    filterImage.size.set(maskW, maskH);
+    filterImage.stride = mask.getStride();
+    filterImage.data = mask.getFirstX();
+
+    PointI dPos(0, 0);
+    RectI sRect(0, 0, maskW, maskH);
+    MemBuffer intermediateBuffer;
+
+    err_t err = filter.doRect(&filter, &filterImage, &dPos, &filterImage, &sRect, &intermediateBuffer);
+    filter.destroy(&filter);
+
+    FOG_RETURN_ON_ERROR(err);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Colorize]
+  // --------------------------------------------------------------------------
+
+  Image shadow;
+  FOG_RETURN_ON_ERROR(shadow.create(SizeI(visibleW, visibleH), IMAGE_FORMAT_PRGB32));
+
+  uint32_t c0_20, c0_31;
+  Acc::p32UnpackPBWFromPBB_2031(c0_20, c0_31, prgb32);
+
+  ssize_t maskStride = mask.getStride();
+  ssize_t shadowStride = shadow.getStride();
+
+  const uint8_t* maskPixels = mask.getFirst() +
+    (visibleBox.y0 - shadowBox.y0) * maskStride + (visibleBox.x0 - shadowBox.x0);
+  uint8_t* shadowPixels = shadow.getFirstX();
+
+  for (int y = 0; y < visibleH; y++, maskPixels += maskStride, shadowPixels += shadowStride)
+  {
+    uint32_t* dst = reinterpret_cast<uint32_t*>(shadowPixels);
+
+    for (int x = 0; x < visibleW; x++)
+    {
+      uint32_t m = maskPixels[x];
+
+      if (m == 0x00)
+        dst[x] = 0x00000000;
+      else if (m == 0xFF)
+        dst[x] = prgb32;
+      else
+        Acc::p32MulDiv255PBW_SBW_2x_Pack_2031(dst[x], c0_20, m, c0_31, m);
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // [Composite]
+  // --------------------------------------------------------------------------
+
+  PointI dPos(visibleBox.x0, visibleBox.y0);
+  RectI sRect(0, 0, visibleW, visibleH);
+
+  return engine->doCmd->blitNormalizedImageA(engine, &dPos, &shadow, &sRect);
 }
 
+// Stroke the path to the device-space outline of the stroke.
+static err_t FOG_FASTCALL RasterPaintEngine_strokeShadowPathD(
+  RasterPaintEngine* engine, PathD* dst, const PathD* src)
+{
+  if (engine->strokerPrecision == RASTER_PRECISION_F)
+  {
+    engine->strokerPrecision = RASTER_PRECISION_BOTH;
+    engine->stroker.d->_params() = engine->stroker.f->_params();
+    engine->stroker.d->_isDirty = true;
+  }
 
+  dst->clear();
+  return engine->stroker.d->strokePath(*dst, *src);
+}
 
+static err_t FOG_CDECL RasterPaintEngine_drawShapeWithShadowF(Painter* self, uint32_t shapeType, const void* shapeData, const PointF* offset, float blurRadius, const Color* color)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_STROKE_FUNC();
 
+  PathF* pathF = &engine->ctx.tmpPathF[1];
+  PathD* pathD = &engine->ctx.tmpPathD[1];
 
+  if (shapeType == SHAPE_TYPE_PATH)
+  {
+    FOG_RETURN_ON_ERROR(pathD->setPath(*reinterpret_cast<const PathF*>(shapeData)));
+  }
+  else
+  {
+    pathF->clear();
+    FOG_RETURN_ON_ERROR(pathF->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL));
+    FOG_RETURN_ON_ERROR(pathD->setPath(*pathF));
+  }
 
+  PathD* devicePath = &engine->ctx.tmpPathD[2];
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_strokeShadowPathD(engine, devicePath, pathD));
 
+  PointD offsetD(*offset);
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_paintShadow(engine, devicePath, FILL_RULE_NON_ZERO, &offsetD, double(blurRadius), color));
 
+  return self->_vtable->drawShapeF(self, shapeType, shapeData);
+}
 
+static err_t FOG_CDECL RasterPaintEngine_drawShapeWithShadowD(Painter* self, uint32_t shapeType, const void* shapeData, const PointD* offset, double blurRadius, const Color* color)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_STROKE_FUNC();
 
+  const PathD* pathD;
 
+  if (shapeType == SHAPE_TYPE_PATH)
+  {
+    pathD = reinterpret_cast<const PathD*>(shapeData);
+  }
+  else
+  {
+    PathD* tmp = &engine->ctx.tmpPathD[1];
+    tmp->clear();
+    FOG_RETURN_ON_ERROR(tmp->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL));
+    pathD = tmp;
+  }
 
+  PathD* devicePath = &engine->ctx.tmpPathD[2];
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_strokeShadowPathD(engine, devicePath, pathD));
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_paintShadow(engine, devicePath, FILL_RULE_NON_ZERO, offset, blurRadius, color));
 
+  return self->_vtable->drawShapeD(self, shapeType, shapeData);
+}
 
+static err_t FOG_CDECL RasterPaintEngine_fillShapeWithShadowF(Painter* self, uint32_t shapeType, const void* shapeData, const PointF* offset, float blurRadius, const Color* color)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_FILL_FUNC();
 
+  const PathF* pathF;
 
+  if (shapeType == SHAPE_TYPE_PATH)
+  {
+    pathF = reinterpret_cast<const PathF*>(shapeData);
+  }
+  else
+  {
+    PathF* tmp = &engine->ctx.tmpPathF[1];
+    tmp->clear();
+    FOG_RETURN_ON_ERROR(tmp->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL));
+    pathF = tmp;
+  }
 
+  PathD* devicePath = &engine->ctx.tmpPathD[2];
+  FOG_RETURN_ON_ERROR(engine->getFinalTransformD().mapPath(*devicePath, *pathF));
 
+  PointD offsetD(*offset);
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_paintShadow(engine, devicePath, engine->ctx.paintHints.fillRule, &offsetD, double(blurRadius), color));
 
+  return self->_vtable->fillShapeF(self, shapeType, shapeData);
+}
 
+static err_t FOG_CDECL RasterPaintEngine_fillShapeWithShadowD(Painter* self, uint32_t shapeType, const void* shapeData, const PointD* offset, double blurRadius, const Color* color)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_FILL_FUNC();
 
+  const PathD* pathD;
 
+  if (shapeType == SHAPE_TYPE_PATH)
+  {
+    pathD = reinterpret_cast<const PathD*>(shapeData);
+  }
+  else
+  {
+    PathD* tmp = &engine->ctx.tmpPathD[1];
+    tmp->clear();
+    FOG_RETURN_ON_ERROR(tmp->_shape(shapeType, shapeData, PATH_DIRECTION_CW, NULL));
+    pathD = tmp;
+  }
 
+  PathD* devicePath = &engine->ctx.tmpPathD[2];
+  FOG_RETURN_ON_ERROR(engine->getFinalTransformD().mapPath(*devicePath, *pathD));
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_paintShadow(engine, devicePath, engine->ctx.paintHints.fillRule, offset, blurRadius, color));
 
+  return self->_vtable->fillShapeD(self, shapeType, shapeData);
+}
 
+static err_t FOG_CDECL RasterPaintEngine_fillTextWithShadowF(Painter* self, const PointF* p, const StringW* text, const Font* font, const PointF* offset, float blurRadius, const Color* color)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_FILL_FUNC();
 
+  GlyphShaper shaper;
+  FOG_RETURN_ON_ERROR(shaper.addText(*font, *text));
 
+  PathF* pathF = &engine->ctx.tmpPathF[1];
+  FOG_RETURN_ON_ERROR(font->getOutlineFromGlyphRun(*pathF, CONTAINER_OP_REPLACE, *p, shaper._glyphRun));
 
+  PathD* devicePath = &engine->ctx.tmpPathD[2];
+  FOG_RETURN_ON_ERROR(engine->getFinalTransformD().mapPath(*devicePath, *pathF));
 
+  PointD offsetD(*offset);
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_paintShadow(engine, devicePath, FILL_RULE_NON_ZERO, &offsetD, double(blurRadius), color));
 
+  return self->_vtable->fillGlyphRunF(self, p, &shaper._glyphRun, font, NULL);
+}
 
+static err_t FOG_CDECL RasterPaintEngine_fillTextWithShadowD(Painter* self, const PointD* p, const StringW* text, const Font* font, const PointD* offset, double blurRadius, const Color* color)
+{
+  RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
+  _FOG_RASTER_ENTER_FILL_FUNC();
 
+  GlyphShaper shaper;
+  FOG_RETURN_ON_ERROR(shaper.addText(*font, *text));
 
+  PathD* pathD = &engine->ctx.tmpPathD[1];
+  FOG_RETURN_ON_ERROR(font->getOutlineFromGlyphRun(*pathD, CONTAINER_OP_REPLACE, *p, shaper._glyphRun));
+
+  PathD* devicePath = &engine->ctx.tmpPathD[2];
+  FOG_RETURN_ON_ERROR(engine->getFinalTransformD().mapPath(*devicePath, *pathD));
+  FOG_RETURN_ON_ERROR(RasterPaintEngine_paintShadow(engine, devicePath, FILL_RULE_NON_ZERO, offset, blurRadius, color));
+
+  return self->_vtable->fillGlyphRunD(self, p, &shaper._glyphRun, font, NULL);
+}
 
 // ============================================================================
 // [Fog::RasterPaintEngine - ClipAll]
@@ -5197,6 +5912,150 @@ static err_t FOG_CDECL RasterPaintEngine_beginGroup(Painter* self, uint32_t flag
   return ERR_OK;
 }
 
+// Acquire a PRGB32 buffer of at least the given size, the smallest pooled
+// buffer which is large enough is preferred to creating a new one.
+static err_t FOG_FASTCALL RasterPaintEngine_acquireGroupBuffer(
+  RasterPaintEngine* engine, Image& dst, const SizeI& size)
+{
+  uint i, bestIndex = RASTER_GROUP_POOL_SIZE;
+  uint64_t bestArea = UINT64_MAX;
+
+  for (i = 0; i < RASTER_GROUP_POOL_SIZE; i++)
+  {
+    const Image& image = engine->groupPool[i];
+    if (image.isEmpty() || image.getWidth() < size.w || image.getHeight() < size.h)
+      continue;
+
+    uint64_t area = uint64_t(uint(image.getWidth())) * uint(image.getHeight());
+    if (area < bestArea)
+    {
+      bestIndex = i;
+      bestArea = area;
+    }
+  }
+
+  if (bestIndex != RASTER_GROUP_POOL_SIZE)
+  {
+    dst = engine->groupPool[bestIndex];
+    engine->groupPool[bestIndex].reset();
+    return ERR_OK;
+  }
+
+  return dst.create(size, IMAGE_FORMAT_PRGB32);
+}
+
+// Return the buffer to the pool. The buffer can't be reused if it's still
+// referenced (by a blit command recorded in the parent group), in such case
+// it's simply released. Otherwise an empty slot or the slot holding the
+// smallest buffer is used.
+static void FOG_FASTCALL RasterPaintEngine_releaseGroupBuffer(
+  RasterPaintEngine* engine, Image& image)
+{
+  if (!image.isDetached())
+  {
+    image.reset();
+    return;
+  }
+
+  uint i, smallestIndex = 0;
+  uint64_t area = uint64_t(uint(image.getWidth())) * uint(image.getHeight());
+  uint64_t smallestArea = UINT64_MAX;
+
+  for (i = 0; i < RASTER_GROUP_POOL_SIZE; i++)
+  {
+    const Image& pooled = engine->groupPool[i];
+
+    if (pooled.isEmpty())
+    {
+      smallestIndex = i;
+      smallestArea = 0;
+      break;
+    }
+
+    uint64_t pooledArea = uint64_t(uint(pooled.getWidth())) * uint(pooled.getHeight());
+    if (pooledArea < smallestArea)
+    {
+      smallestIndex = i;
+      smallestArea = pooledArea;
+    }
+  }
+
+  if (smallestArea < area)
+    engine->groupPool[smallestIndex] = image;
+  image.reset();
+}
+
+// Get boxes covering the tiles touched by the dirty boxes of the group. The
+// tiles are RASTER_GROUP_TILE_SIZE pixels large and aligned to the group
+// bounding box, the horizontally adjacent tiles are joined and the boxes are
+// clipped to the group bounding box. Returns zero if out of memory.
+static size_t FOG_FASTCALL RasterPaintEngine_getGroupTileBoxes(
+  const RasterPaintGroup* g, MemBuffer& buffer, BoxI** dst)
+{
+  const BoxI& bbox = g->boundingBox;
+
+  int tilesX = (bbox.getWidth()  + RASTER_GROUP_TILE_SIZE - 1) / RASTER_GROUP_TILE_SIZE;
+  int tilesY = (bbox.getHeight() + RASTER_GROUP_TILE_SIZE - 1) / RASTER_GROUP_TILE_SIZE;
+
+  size_t tilesSize = size_t(tilesX) * size_t(tilesY);
+  size_t boxesSize = size_t((tilesX + 1) / 2) * size_t(tilesY) * sizeof(BoxI);
+
+  uint8_t* tiles = reinterpret_cast<uint8_t*>(buffer.alloc(boxesSize + tilesSize));
+  if (FOG_IS_NULL(tiles))
+    return 0;
+
+  BoxI* boxes = reinterpret_cast<BoxI*>(tiles);
+  tiles += boxesSize;
+
+  MemOps::zero(tiles, tilesSize);
+
+  int x, y;
+
+  for (uint32_t i = 0; i < g->dirtyCount; i++)
+  {
+    const BoxI& dirty = g->dirtyBox[i];
+
+    int tx0 = (dirty.x0 - bbox.x0) / RASTER_GROUP_TILE_SIZE;
+    int ty0 = (dirty.y0 - bbox.y0) / RASTER_GROUP_TILE_SIZE;
+    int tx1 = (dirty.x1 - bbox.x0 + RASTER_GROUP_TILE_SIZE - 1) / RASTER_GROUP_TILE_SIZE;
+    int ty1 = (dirty.y1 - bbox.y0 + RASTER_GROUP_TILE_SIZE - 1) / RASTER_GROUP_TILE_SIZE;
+
+    for (y = ty0; y < ty1; y++)
+      MemOps::set(tiles + y * tilesX + tx0, 1, size_t(tx1 - tx0));
+  }
+
+  size_t count = 0;
+
+  for (y = 0; y < tilesY; y++)
+  {
+    const uint8_t* row = tiles + y * tilesX;
+
+    int by0 = bbox.y0 + y * RASTER_GROUP_TILE_SIZE;
+    int by1 = Math::min(by0 + RASTER_GROUP_TILE_SIZE, bbox.y1);
+
+    x = 0;
+    for (;;)
+    {
+      while (x < tilesX && row[x] == 0)
+        x++;
+
+      if (x == tilesX)
+        break;
+
+      int start = x;
+      while (x < tilesX && row[x] != 0)
+        x++;
+
+      boxes[count++].setBox(
+        bbox.x0 + start * RASTER_GROUP_TILE_SIZE, by0,
+        Math::min(bbox.x0 + x * RASTER_GROUP_TILE_SIZE, bbox.x1), by1);
+    }
+  }
+
+  *dst = boxes;
+  return count;
+}
+
 static err_t FOG_CDECL RasterPaintEngine_paintGroup(Painter* self)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
@@ -5214,6 +6073,11 @@ static err_t FOG_CDECL RasterPaintEngine_paintGroup(Painter* self)
   Static<Image> image;
   BoxI targetBBox = g->boundingBox;
 
+  // Only the tiles touched by the group commands are cleared and composited.
+  MemBufferTmp<1024> tileBuffer;
+  BoxI* tileBoxes = NULL;
+  size_t tileCount = 0;
+
   image->_d = NULL;
   engine->curGroup = g->top;
 
@@ -5223,8 +6087,19 @@ static err_t FOG_CDECL RasterPaintEngine_paintGroup(Painter* self)
     SizeI targetSize(targetBBox.getWidth(), targetBBox.getHeight());
 
     image.init();
-    if (image->create(targetSize, IMAGE_FORMAT_PRGB32) != ERR_OK)
+    if (RasterPaintEngine_acquireGroupBuffer(engine, image, targetSize) != ERR_OK)
+    {
+      image.destroy();
+      image->_d = NULL;
       goto _DiscardCommands;
+    }
+
+    tileCount = RasterPaintEngine_getGroupTileBoxes(g, tileBuffer, &tileBoxes);
+    if (tileCount == 0)
+    {
+      tileBoxes = &targetBBox;
+      tileCount = 1;
+    }
 
     // We don't change target size.
     engine->ctx.target.stride = image->getStride();
@@ -5246,7 +6121,8 @@ static err_t FOG_CDECL RasterPaintEngine_paintGroup(Painter* self)
     engine->ctx.solid.prgb32.u32 = 0x00000000;
     engine->ctx.pc = (RasterPattern*)(size_t)0x1;
 
-    engine->doCmd->fillNormalizedBoxI(engine, &targetBBox);
+    for (size_t i = 0; i < tileCount; i++)
+      engine->doCmd->fillNormalizedBoxI(engine, &tileBoxes[i]);
 
     engine->ctx.paintHints.packed = oldPaintHints;
     engine->ctx.solid.prgb32.u32 = oldPrgb32;
@@ -5290,12 +6166,19 @@ _DiscardCommands:
   engine->cmdAllocator.revert(g->cmdRecord);
   engine->groupAllocator.revert(g->groupRecord);
 
-  // Destroy image buffer, if created.
+  // Composite the touched tiles and return the buffer to the pool.
   if (image->_d != NULL)
   {
-    PointI dPos(targetBBox.x0, targetBBox.y0);
-    RectI sRect(0, 0, image->getWidth(), image->getHeight());
-    engine->doCmd->blitNormalizedImageA(engine, &dPos, &image, &sRect);
+    for (size_t i = 0; i < tileCount; i++)
+    {
+      const BoxI& box = tileBoxes[i];
+
+      PointI dPos(box.x0, box.y0);
+      RectI sRect(box.x0 - targetBBox.x0, box.y0 - targetBBox.y0, box.getWidth(), box.getHeight());
+      engine->doCmd->blitNormalizedImageA(engine, &dPos, &image, &sRect);
+    }
+
+    RasterPaintEngine_releaseGroupBuffer(engine, image);
     image.destroy();
   }
 
@@ -5310,6 +6193,10 @@ static err_t FOG_CDECL RasterPaintEngine_flush(Painter* self, uint32_t flags)
 {
   RasterPaintEngine* engine = static_cast<RasterPaintEngine*>(self->_engine);
 
+  // Release the images referenced by the cached pattern-contexts, the caller
+  // may want to modify them without creating a deep copy.
+  engine->discardPatternCache();
+
   // TODO: MT version.
   return ERR_OK;
 }
@@ -5355,6 +6242,9 @@ RasterPaintEngine::RasterPaintEngine() :
   source.color.initCustom1(Argb32(0xFF000000));
   opacityF = 1.0f;
 
+  for (uint i = 0; i < RASTER_PATTERN_CACHE_SIZE; i++)
+    pcCache[i].pc = NULL;
+
   stroker.f.init();
   stroker.f->_isClippingEnabled = true;
   stroker.d.init();
@@ -5377,6 +6267,7 @@ RasterPaintEngine::~RasterPaintEngine()
   discardStates(NULL);
   // TODO: Discard also groups.
   discardSource();
+  discardPatternCache();
 
   stroker.f.destroy();
   stroker.d.destroy();
@@ -5823,6 +6714,7 @@ void RasterPaintEngine::setupOps()
   ctx.paintHints.fastLine = 0;
   ctx.paintHints.geometricPrecision = GEOMETRIC_PRECISION_NORMAL;
   ctx.paintHints.fillRule = FILL_RULE_DEFAULT;
+  ctx.paintHints.colorSpace = COLOR_SPACE_DEFAULT;
 
   ctx.rasterHints.packed = 0;
   ctx.rasterHints.opacity = ctx.fullOpacity.u;
@@ -5875,8 +6767,19 @@ err_t RasterPaintEngine::createPatternContext()
 
   err_t err = ERR_RT_NOT_IMPLEMENTED;
 
-  // First try to reuse context from context-pool.
-  RasterPattern* pc = reinterpret_cast<RasterPattern*>(pcPool);
+  // The same source might have been used recently (alternating sources or
+  // save/restore), reuse the pattern-context if it matches.
+  RasterPattern* pc = findCachedPatternContext();
+
+  if (pc != NULL)
+  {
+    pc->_reference.inc();
+    ctx.pc = pc;
+    return ERR_OK;
+  }
+
+  // Then try to reuse context from context-pool.
+  pc = reinterpret_cast<RasterPattern*>(pcPool);
 
   if (FOG_IS_NULL(pc))
   {
@@ -5935,10 +6838,140 @@ err_t RasterPaintEngine::createPatternContext()
     pcPool = reinterpret_cast<RasterAbstractLinkedList*>(pc);
     ctx.pc = NULL;
   }
+  else
+  {
+    addCachedPatternContext(pc);
+  }
 
   return err;
 }
 
+static FOG_INLINE uint32_t RasterPaintEngine_getPatternQuality(const RasterPaintEngine* engine)
+{
+  return engine->sourceType == RASTER_SOURCE_TEXTURE
+    ? engine->ctx.paintHints.imageQuality
+    : engine->ctx.paintHints.gradientQuality;
+}
+
+RasterPattern* RasterPaintEngine::findCachedPatternContext()
+{
+  uint32_t quality = RasterPaintEngine_getPatternQuality(this);
+  uint i;
+
+  for (i = 0; i < RASTER_PATTERN_CACHE_SIZE; i++)
+  {
+    RasterPatternCacheEntry& entry = pcCache[i];
+
+    if (entry.pc == NULL)
+      return NULL;
+
+    if (entry.sourceType != sourceType ||
+        entry.format     != ctx.target.format ||
+        entry.quality    != quality ||
+        entry.clipBox    != metaClipBoxI ||
+        entry.transform() != source.adjusted())
+    {
+      continue;
+    }
+
+    if (sourceType == RASTER_SOURCE_TEXTURE)
+    {
+      // Images are compared by identity, not by content.
+      const Texture& a = entry.texture();
+      const Texture& b = source.texture();
+
+      if (a._image._d != b._image._d ||
+          a._fragment != b._fragment ||
+          a._tileType != b._tileType ||
+          a._clampColor != b._clampColor)
+      {
+        continue;
+      }
+    }
+    else
+    {
+      if (!entry.gradient->eq(source.gradient()))
+        continue;
+    }
+
+    // Move the entry to the front (LRU).
+    if (i != 0)
+    {
+      RasterPatternCacheEntry tmp;
+      MemOps::copy_t<RasterPatternCacheEntry>(&tmp, &entry);
+      MemOps::move(&pcCache[1], &pcCache[0], i * sizeof(RasterPatternCacheEntry));
+      MemOps::copy_t<RasterPatternCacheEntry>(&pcCache[0], &tmp);
+    }
+
+    return pcCache[0].pc;
+  }
+
+  return NULL;
+}
+
+void RasterPaintEngine::addCachedPatternContext(RasterPattern* pc)
+{
+  // Image data which can change without being detached (adopted pixels or
+  // locked by another paint engine) can't be cached.
+  if (sourceType == RASTER_SOURCE_TEXTURE)
+  {
+    const ImageData* d = source.texture->_image._d;
+    if (d->adopted || d->locked)
+      return;
+  }
+
+  // Discard the least recently used entry if the cache is full.
+  RasterPatternCacheEntry& last = pcCache[RASTER_PATTERN_CACHE_SIZE - 1];
+  if (last.pc != NULL)
+  {
+    if (last.pc->_reference.deref())
+      destroyPatternContext(last.pc);
+
+    if (last.sourceType == RASTER_SOURCE_TEXTURE)
+      last.texture.destroy();
+    else
+      last.gradient.destroy();
+    last.transform.destroy();
+  }
+
+  MemOps::move(&pcCache[1], &pcCache[0], (RASTER_PATTERN_CACHE_SIZE - 1) * sizeof(RasterPatternCacheEntry));
+  RasterPatternCacheEntry& entry = pcCache[0];
+
+  pc->_reference.inc();
+  entry.pc = pc;
+  entry.sourceType = sourceType;
+  entry.format = ctx.target.format;
+  entry.quality = RasterPaintEngine_getPatternQuality(this);
+  entry.clipBox = metaClipBoxI;
+
+  if (sourceType == RASTER_SOURCE_TEXTURE)
+    entry.texture.initCustom1(source.texture());
+  else
+    entry.gradient.initCustom1(source.gradient());
+  entry.transform.initCustom1(source.adjusted());
+}
+
+void RasterPaintEngine::discardPatternCache()
+{
+  for (uint i = 0; i < RASTER_PATTERN_CACHE_SIZE; i++)
+  {
+    RasterPatternCacheEntry& entry = pcCache[i];
+    if (entry.pc == NULL)
+      break;
+
+    if (entry.pc->_reference.deref())
+      destroyPatternContext(entry.pc);
+
+    if (entry.sourceType == RASTER_SOURCE_TEXTURE)
+      entry.texture.destroy();
+    else
+      entry.gradient.destroy();
+    entry.transform.destroy();
+
+    entry.pc = NULL;
+  }
+}
+
 // ============================================================================
 // [Fog::RasterPaintEngine - Changed - Meta-Params]
 // ============================================================================
@@ -6414,6 +7447,8 @@ static void RasterPaintEngine_init_vtable_t()
   v->blitImageInF = RasterPaintEngine_blitImageInF;
   v->blitImageInD = RasterPaintEngine_blitImageInD;
 
+  v->blitImages = RasterPaintEngine_blitImages;
+
   v->blitMaskedImageAtI = RasterPaintEngine_blitMaskedImageAtI;
   v->blitMaskedImageAtF = RasterPaintEngine_blitMaskedImageAtF;
   v->blitMaskedImageAtD = RasterPaintEngine_blitMaskedImageAtD;
@@ -6438,6 +7473,19 @@ static void RasterPaintEngine_init_vtable_t()
   v->filterStrokedShapeF = RasterPaintEngine_filterStrokedShapeF;
   v->filterStrokedShapeD = RasterPaintEngine_filterStrokedShapeD;
 
+  // --------------------------------------------------------------------------
+  // [Shadow]
+  // --------------------------------------------------------------------------
+
+  v->drawShapeWithShadowF = RasterPaintEngine_drawShapeWithShadowF;
+  v->drawShapeWithShadowD = RasterPaintEngine_drawShapeWithShadowD;
+
+  v->fillShapeWithShadowF = RasterPaintEngine_fillShapeWithShadowF;
+  v->fillShapeWithShadowD = RasterPaintEngine_fillShapeWithShadowD;
+
+  v->fillTextWithShadowF = RasterPaintEngine_fillTextWithShadowF;
+  v->fillTextWithShadowD = RasterPaintEngine_fillTextWithShadowD;
+
   // --------------------------------------------------------------------------
   // [Clip]
   // --------------------------------------------------------------------------
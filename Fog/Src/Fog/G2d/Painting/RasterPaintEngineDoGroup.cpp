@@ -43,6 +43,70 @@ namespace Fog {
 
 FOG_NO_EXPORT RasterPaintDoCmd RasterPaintDoGroup_vtable[RASTER_MODE_COUNT];
 
+// ============================================================================
+// [Fog::RasterPaintDoGroup - Dirty]
+// ============================================================================
+
+// Merge the box into the group bounding box and into the dirty boxes used to
+// find the group tiles which must be cleared and composited. The box is first
+// clipped to the meta clip-box, the commands can't paint outside of it.
+static void FOG_FASTCALL RasterPaintDoGroup_mergeBox(
+  RasterPaintEngine* engine, int x0, int y0, int x1, int y1)
+{
+  const BoxI& clipBox = engine->metaClipBoxI;
+
+  if (x0 < clipBox.x0) x0 = clipBox.x0;
+  if (y0 < clipBox.y0) y0 = clipBox.y0;
+  if (x1 > clipBox.x1) x1 = clipBox.x1;
+  if (y1 > clipBox.y1) y1 = clipBox.y1;
+
+  if (x0 >= x1 || y0 >= y1)
+    return;
+
+  RasterPaintGroup* g = engine->curGroup;
+  g->mergeBoundingBox(x0, y0, x1, y1);
+
+  uint32_t i, count = g->dirtyCount;
+  for (i = 0; i < count; i++)
+  {
+    const BoxI& dirty = g->dirtyBox[i];
+    if (dirty.x0 <= x0 && dirty.y0 <= y0 && dirty.x1 >= x1 && dirty.y1 >= y1)
+      return;
+  }
+
+  if (count < RASTER_GROUP_DIRTY_COUNT)
+  {
+    g->dirtyBox[count].setBox(x0, y0, x1, y1);
+    g->dirtyCount = count + 1;
+    return;
+  }
+
+  // All dirty boxes are used, merge the box into the one which grows least.
+  uint32_t bestIndex = 0;
+  uint64_t bestGrowth = UINT64_MAX;
+
+  for (i = 0; i < count; i++)
+  {
+    const BoxI& dirty = g->dirtyBox[i];
+
+    uint64_t area = uint64_t(uint(dirty.x1 - dirty.x0)) * uint(dirty.y1 - dirty.y0);
+    uint64_t merged = uint64_t(uint(Math::max(dirty.x1, x1) - Math::min(dirty.x0, x0))) *
+                               uint(Math::max(dirty.y1, y1) - Math::min(dirty.y0, y0));
+
+    if (merged - area < bestGrowth)
+    {
+      bestIndex = i;
+      bestGrowth = merged - area;
+    }
+  }
+
+  BoxI& dirty = g->dirtyBox[bestIndex];
+  if (dirty.x0 > x0) dirty.x0 = x0;
+  if (dirty.y0 > y0) dirty.y0 = y0;
+  if (dirty.x1 < x1) dirty.x1 = x1;
+  if (dirty.y1 < y1) dirty.y1 = y1;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoGroup - Pending]
 // ============================================================================
@@ -184,7 +248,11 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_fillAll(
     return ERR_RT_OUT_OF_MEMORY;
   cmd->init(engine, RASTER_PAINT_CMD_FILL_ALL);
 
-  engine->curGroup->mergeBoundingBox(engine->ctx.clipBoxI);
+  RasterPaintDoGroup_mergeBox(engine,
+    engine->ctx.clipBoxI.x0,
+    engine->ctx.clipBoxI.y0,
+    engine->ctx.clipBoxI.x1,
+    engine->ctx.clipBoxI.y1);
   return ERR_OK;
 }
 
@@ -203,7 +271,7 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedBoxI(
     return ERR_RT_OUT_OF_MEMORY;
   cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_I, *box);
 
-  engine->curGroup->mergeBoundingBox(*box);
+  RasterPaintDoGroup_mergeBox(engine, box->x0, box->y0, box->x1, box->y1);
   return ERR_OK;
 }
 
@@ -217,7 +285,7 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedBoxF(
     return ERR_RT_OUT_OF_MEMORY;
   cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_F, *box);
 
-  engine->curGroup->mergeBoundingBox(
+  RasterPaintDoGroup_mergeBox(engine,
     Math::ifloor(box->x0),
     Math::ifloor(box->y0),
     Math::iceil(box->x1),
@@ -235,7 +303,7 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedBoxD(
     return ERR_RT_OUT_OF_MEMORY;
   cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_BOX_D, *box);
 
-  engine->curGroup->mergeBoundingBox(
+  RasterPaintDoGroup_mergeBox(engine,
     Math::ifloor(box->x0),
     Math::ifloor(box->y0),
     Math::iceil(box->x1),
@@ -243,6 +311,24 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedBoxD(
   return ERR_OK;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoGroup - Fill - NormalizedRegion]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedRegion(
+  RasterPaintEngine* engine, const Region* region)
+{
+  // Regions are recorded as a sequence of boxes, the dirty area is merged
+  // per box so the group composites only the tiles the region touched.
+  const BoxI* data = region->getData();
+  size_t i, length = region->getLength();
+
+  for (i = 0; i < length; i++)
+    FOG_RETURN_ON_ERROR(RasterPaintDoGroup_fillNormalizedBoxI(engine, &data[i]));
+
+  return ERR_OK;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoGroup - Fill - NormalizedPath]
 // ============================================================================
@@ -261,7 +347,7 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedPathF(
   cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_F,
     *path, *pt, engine->ctx.paintHints.fillRule);
 
-  engine->curGroup->mergeBoundingBox(
+  RasterPaintDoGroup_mergeBox(engine,
     Math::ifloor(boundingBox.x0),
     Math::ifloor(boundingBox.y0),
     Math::iceil(boundingBox.x1),
@@ -283,7 +369,7 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_fillNormalizedPathD(
   cmd->init(engine, RASTER_PAINT_CMD_FILL_NORMALIZED_PATH_D,
     *path, *pt, engine->ctx.paintHints.fillRule);
 
-  engine->curGroup->mergeBoundingBox(
+  RasterPaintDoGroup_mergeBox(engine,
     Math::ifloor(boundingBox.x0),
     Math::ifloor(boundingBox.y0),
     Math::iceil(boundingBox.x1),
@@ -341,7 +427,7 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_blitNormalizedImageA(
       *pt, *srcImage, *srcFragment);
   }
 
-  engine->curGroup->mergeBoundingBox(
+  RasterPaintDoGroup_mergeBox(engine,
     pt->x,
     pt->y,
     pt->x + srcFragment->w,
@@ -349,6 +435,40 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_blitNormalizedImageA(
   return ERR_OK;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoGroup - Blit - NormalizedImagesA]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoGroup_blitNormalizedImagesA(
+  RasterPaintEngine* engine, const Image* srcImage, const RasterBlitItemA* items, size_t count)
+{
+  uint32_t opacity = engine->ctx.rasterHints.opacity;
+  err_t err = ERR_OK;
+
+  // Each item is serialized as blitNormalizedImageA command, the opacity
+  // command is serialized only when the opacity of the item changes.
+  for (size_t i = 0; i < count; i++)
+  {
+    if (engine->ctx.rasterHints.opacity != items[i].opacity)
+    {
+      engine->ctx.rasterHints.opacity = items[i].opacity;
+      engine->masterFlags |= RASTER_PENDING_OPACITY;
+    }
+
+    err = RasterPaintDoGroup_blitNormalizedImageA(engine, &items[i].pt, srcImage, &items[i].fragment);
+    if (FOG_IS_ERROR(err))
+      break;
+  }
+
+  if (engine->ctx.rasterHints.opacity != opacity)
+  {
+    engine->ctx.rasterHints.opacity = opacity;
+    engine->masterFlags |= RASTER_PENDING_OPACITY;
+  }
+
+  return err;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoGroup - Blit - NormalizedImage]
 // ============================================================================
@@ -367,7 +487,7 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_blitNormalizedImageI(
   cmd->init(engine, RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_I,
     *box, *srcImage, *srcFragment, *srcTransform, imageQuality);
 
-  engine->curGroup->mergeBoundingBox(*box);
+  RasterPaintDoGroup_mergeBox(engine, box->x0, box->y0, box->x1, box->y1);
   return ERR_OK;
 }
 
@@ -385,7 +505,7 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_blitNormalizedImageD(
   cmd->init(engine, RASTER_PAINT_CMD_BLIT_NORMALIZED_IMAGE_D,
     *box, *srcImage, *srcFragment, *srcTransform, imageQuality);
 
-  engine->curGroup->mergeBoundingBox(
+  RasterPaintDoGroup_mergeBox(engine,
     Math::ifloor(box->x0),
     Math::ifloor(box->y0),
     Math::iceil(box->x1),
@@ -436,6 +556,17 @@ static err_t FOG_FASTCALL RasterPaintDoGroup_filterNormalizedPathD(
   return ERR_RT_NOT_IMPLEMENTED;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoGroup - Filter - NormalizedBoxMask]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoGroup_filterNormalizedBoxMask(
+  RasterPaintEngine* engine, const FeBase* feBase, const BoxI* box, const Image* mask)
+{
+  // TODO: Raster paint-engine.
+  return ERR_RT_NOT_IMPLEMENTED;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoGroup - SwitchToMask / DiscardMask]
 // ============================================================================
@@ -522,6 +653,7 @@ void FOG_NO_EXPORT RasterPaintDoGroup_init(void)
   v->fillNormalizedBoxI = RasterPaintDoGroup_fillNormalizedBoxI;
   v->fillNormalizedBoxF = RasterPaintDoGroup_fillNormalizedBoxF;
   v->fillNormalizedBoxD = RasterPaintDoGroup_fillNormalizedBoxD;
+  v->fillNormalizedRegion = RasterPaintDoGroup_fillNormalizedRegion;
   v->fillNormalizedPathF = RasterPaintDoGroup_fillNormalizedPathF;
   v->fillNormalizedPathD = RasterPaintDoGroup_fillNormalizedPathD;
 
@@ -533,6 +665,7 @@ void FOG_NO_EXPORT RasterPaintDoGroup_init(void)
   v->blitNormalizedImageA = RasterPaintDoGroup_blitNormalizedImageA;
   v->blitNormalizedImageI = RasterPaintDoGroup_blitNormalizedImageI;
   v->blitNormalizedImageD = RasterPaintDoGroup_blitNormalizedImageD;
+  v->blitNormalizedImagesA = RasterPaintDoGroup_blitNormalizedImagesA;
 
   // --------------------------------------------------------------------------
   // [Filter]
@@ -543,6 +676,7 @@ void FOG_NO_EXPORT RasterPaintDoGroup_init(void)
   v->filterNormalizedBoxD = RasterPaintDoGroup_filterNormalizedBoxD;
   v->filterNormalizedPathF = RasterPaintDoGroup_filterNormalizedPathF;
   v->filterNormalizedPathD = RasterPaintDoGroup_filterNormalizedPathD;
+  v->filterNormalizedBoxMask = RasterPaintDoGroup_filterNormalizedBoxMask;
 
   // --------------------------------------------------------------------------
   // [Mask]
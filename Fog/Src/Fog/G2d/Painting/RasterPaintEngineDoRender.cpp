@@ -11,6 +11,7 @@
 // [Dependencies]
 #include <Fog/Core/Acc/AccC.h>
 #include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemBufferTmp_p.h>
 #include <Fog/Core/Memory/MemMgr.h>
 #include <Fog/Core/Memory/MemOps.h>
 #include <Fog/G2d/Geometry/PathClipper.h>
@@ -34,6 +35,7 @@
 #include <Fog/G2d/Painting/Rasterizer_p.h>
 #include <Fog/G2d/Source/Color.h>
 #include <Fog/G2d/Source/Pattern.h>
+#include <Fog/G2d/Tools/RegionUtil_p.h>
 
 namespace Fog {
 
@@ -237,6 +239,56 @@ static void FOG_INLINE RasterPaintDoRender_prepareRasterizer(RasterPaintEngine*
   }
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - ClipRegion]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Get whether the @a box is completely inside a single box of the
+//! clip-region.
+//!
+//! If it is, the clip-region has no effect and the box can be filled using
+//! the clip-box fast-path instead of the span-based rasterizer.
+static bool RasterPaintDoRender_isBoxInClipRegion(RasterPaintEngine* engine, const BoxI* box)
+{
+  const BoxI* data = engine->ctx.clipRegion.getData();
+  const BoxI* end = data + engine->ctx.clipRegion.getLength();
+
+  const BoxI* clip = data;
+  size_t length = engine->ctx.clipRegion.getLength();
+
+  // Find the first box where y1 is greater than box->y0 (bsearch), the boxes
+  // in region are sorted by bands so this is the first box of the band which
+  // can contain the given box.
+  while (length > 0)
+  {
+    size_t half = length >> 1;
+
+    if (clip[half].y1 <= box->y0)
+    {
+      clip += half + 1;
+      length -= half + 1;
+    }
+    else
+    {
+      length = half;
+    }
+  }
+
+  if (clip == end || clip->y0 > box->y0 || clip->y1 < box->y1)
+    return false;
+
+  int bandY0 = clip->y0;
+
+  do {
+    if (clip->x1 > box->x0)
+      return clip->x0 <= box->x0 && clip->x1 >= box->x1;
+  } while (++clip != end && clip->y0 == bandY0);
+
+  return false;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - FillRasterizedShape]
 // ============================================================================
@@ -263,7 +315,7 @@ _Solid:
     filler._process = (RasterFiller::ProcessFunc)RasterPaintFiller_process_solid;
     filler._skip = (RasterFiller::SkipFunc)RasterPaintFiller_skip_solid;
 
-    filler.c.blit = _api_raster.getCBlitSpan(dstFormat, compositingOperator, isSrcOpaque);
+    filler.c.blit = _api_raster.getCBlitSpan(dstFormat, compositingOperator, isSrcOpaque, engine->ctx.paintHints.colorSpace);
     filler.c.closure = &engine->ctx.closure;
     filler.c.solid = &engine->ctx.solid;
 
@@ -283,7 +335,7 @@ _Solid:
     filler._process = (RasterFiller::ProcessFunc)RasterPaintFiller_process_pattern;
     filler._skip = (RasterFiller::SkipFunc)RasterPaintFiller_skip_pattern;
 
-    filler.v.blit = _api_raster.getVBlitSpan(dstFormat, compositingOperator, srcFormat);
+    filler.v.blit = _api_raster.getVBlitSpan(dstFormat, compositingOperator, srcFormat, engine->ctx.paintHints.colorSpace);
     filler.v.closure = &engine->ctx.closure;
     filler.v.pc = engine->ctx.pc;
     filler.v.pb = &engine->ctx.buffer;
@@ -317,8 +369,11 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxI(
   {
     case IMAGE_PRECISION_BYTE:
     {
-      // Fast-path (clip-box and full-opacity).
-      if (engine->ctx.rasterHints.opacity == 0x100 && engine->ctx.clipType == RASTER_CLIP_BOX)
+      // Fast-path (clip-box and full-opacity). The clip-region is handled
+      // the same way if the box is completely inside a single band-run.
+      if (engine->ctx.rasterHints.opacity == 0x100 &&
+          (engine->ctx.clipType == RASTER_CLIP_BOX ||
+          (engine->ctx.clipType == RASTER_CLIP_REGION && RasterPaintDoRender_isBoxInClipRegion(engine, box))))
       {
         uint8_t* dstPixels = engine->ctx.target.pixels;
         ssize_t dstStride = engine->ctx.target.stride;
@@ -336,7 +391,7 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxI(
         {
 _Solid:
           bool isSrcOpaque = Acc::p32PRGB32IsAlphaFF(engine->ctx.solid.prgb32.u32);
-          RasterCBlitLineFunc blitLine = _api_raster.getCBlitLine(dstFormat, compositingOperator, isSrcOpaque);
+          RasterCBlitLineFunc blitLine = _api_raster.getCBlitLine(dstFormat, compositingOperator, isSrcOpaque, engine->ctx.paintHints.colorSpace);
 
           dstPixels += box->x0 * engine->ctx.target.bpp;
           do {
@@ -376,7 +431,7 @@ _Solid:
           {
             pc->prepare(&pf, y0, 1, RASTER_FETCH_REFERENCE);
 
-            RasterVBlitLineFunc blitLine = _api_raster.getVBlitLine(dstFormat, compositingOperator, srcFormat);
+            RasterVBlitLineFunc blitLine = _api_raster.getVBlitLine(dstFormat, compositingOperator, srcFormat, engine->ctx.paintHints.colorSpace);
             uint8_t* srcPixels = reinterpret_cast<uint8_t*>(engine->ctx.buffer.getMem());
 
             dstPixels += box->x0 * engine->ctx.target.bpp;
@@ -494,6 +549,112 @@ static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedBoxD(
   return ERR_RT_INVALID_STATE;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - FillNormalizedRegion]
+// ============================================================================
+
+static err_t FOG_FASTCALL RasterPaintDoRender_fillNormalizedRegion(
+  RasterPaintEngine* engine, const Region* region)
+{
+  // The region is already translated and clipped by the caller, it can't be
+  // infinite and all boxes are inside the clip-box and the clip-region.
+  const BoxI* data = region->getData();
+  size_t length = region->getLength();
+
+  if (length == 0)
+    return ERR_OK;
+
+  if (length == 1)
+    return engine->doCmd->fillNormalizedBoxI(engine, &data[0]);
+
+  const BoxI* end = data + length;
+
+  switch (engine->ctx.precision)
+  {
+    case IMAGE_PRECISION_BYTE:
+    {
+      uint32_t compositingOperator = engine->ctx.paintHints.compositingOperator;
+
+      // Fast-path (solid color and full-opacity). Spans are generated per
+      // scanline directly from the region bands, the adjacent boxes in the
+      // band are coalesced so each span is blitted by a single call.
+      if (engine->ctx.rasterHints.opacity == 0x100 &&
+          engine->ctx.clipType != RASTER_CLIP_MASK &&
+          (RasterUtil::isSolidContext(engine->ctx.pc) || compositingOperator == COMPOSITE_CLEAR))
+      {
+        uint8_t* dstPixels = engine->ctx.target.pixels;
+        ssize_t dstStride = engine->ctx.target.stride;
+        uint32_t dstFormat = engine->ctx.target.format;
+        uint32_t dstBpp = engine->ctx.target.bpp;
+
+        bool isSrcOpaque = Acc::p32PRGB32IsAlphaFF(engine->ctx.solid.prgb32.u32);
+        RasterCBlitLineFunc blitLine = _api_raster.getCBlitLine(dstFormat, compositingOperator, isSrcOpaque, engine->ctx.paintHints.colorSpace);
+
+        const BoxI* band = data;
+        do {
+          const BoxI* bandEnd = RegionUtil::getEndBand(band, end);
+
+          uint8_t* dstLine = dstPixels + band->y0 * dstStride;
+          int i = band->y1 - band->y0;
+
+          do {
+            const BoxI* cur = band;
+
+            do {
+              int x0 = cur->x0;
+              int x1 = cur->x1;
+
+              while (++cur != bandEnd && cur->x0 == x1)
+                x1 = cur->x1;
+
+              blitLine(dstLine + x0 * dstBpp, &engine->ctx.solid, x1 - x0, &engine->ctx.closure);
+            } while (cur != bandEnd);
+
+            dstLine += dstStride;
+          } while (--i);
+
+          band = bandEnd;
+        } while (band != end);
+
+        return ERR_OK;
+      }
+
+      // Pattern or opacity, fill each coalesced box using fillNormalizedBoxI,
+      // which contains the fast-path for patterns.
+      const BoxI* band = data;
+      do {
+        const BoxI* bandEnd = RegionUtil::getEndBand(band, end);
+        const BoxI* cur = band;
+
+        do {
+          BoxI box(cur->x0, cur->y0, cur->x1, cur->y1);
+
+          while (++cur != bandEnd && cur->x0 == box.x1)
+            box.x1 = cur->x1;
+
+          FOG_RETURN_ON_ERROR(engine->doCmd->fillNormalizedBoxI(engine, &box));
+        } while (cur != bandEnd);
+
+        band = bandEnd;
+      } while (band != end);
+
+      return ERR_OK;
+    }
+
+    case IMAGE_PRECISION_WORD:
+    {
+      // TODO: 16-bit image processing.
+      break;
+    }
+
+    default:
+      FOG_ASSERT_NOT_REACHED();
+  }
+
+  // Dead code to avoid warning.
+  return ERR_RT_INVALID_STATE;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - FillNormalizedPath]
 // ============================================================================
@@ -673,7 +834,7 @@ static err_t FOG_FASTCALL RasterPaintDoRender_blitNormalizedImageA(
           // of other values, then only few image formats can be mixed together.
           if (RasterUtil::isCompositeCoreOp(compositingOperator))
           {
-            blitLine = _api_raster.getCompositeCore(format, compositingOperator)->vblit_line[srcFormat];
+            blitLine = _api_raster.getCompositeCore(format, compositingOperator, engine->ctx.paintHints.colorSpace)->vblit_line[srcFormat];
 
 _BlitImageA8_Opaque:
             do {
@@ -725,7 +886,7 @@ _BlitImageA8_Opaque:
           // of other values, then only few image formats can be mixed together.
           if (RasterUtil::isCompositeCoreOp(compositingOperator))
           {
-            blitSpan = _api_raster.getCompositeCore(format, compositingOperator)->vblit_span[srcFormat];
+            blitSpan = _api_raster.getCompositeCore(format, compositingOperator, engine->ctx.paintHints.colorSpace)->vblit_span[srcFormat];
 
 _BlitImageA8_Alpha:
             do {
@@ -808,6 +969,290 @@ _BlitImageA8_Alpha:
   return ERR_RT_INVALID_STATE;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - BlitNormalizedImagesA]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Blit functions and pointers shared by all items of one batch.
+struct FOG_NO_EXPORT RasterBlitBatchA
+{
+  uint8_t* pixels;
+  ssize_t stride;
+  uint32_t bpp;
+
+  const uint8_t* srcPixels;
+  ssize_t srcStride;
+  uint32_t srcBpp;
+
+  uint32_t fullOpacity;
+
+  RasterVBlitLineFunc blitLine;
+  RasterVBlitSpanFunc blitSpan;
+
+  //! @brief Conversion to the format supported by @c blitLine and @c blitSpan,
+  //! NULL if the source format is supported directly.
+  RasterVBlitLineFunc cvtLine;
+  uint8_t* tmpPixels;
+
+  const RasterClosure* closure;
+};
+
+//! @internal
+//!
+//! @brief Items are bucketed to bands of 32 scanlines, see
+//! @c RasterPaintDoRender_blitNormalizedImagesA().
+enum { RASTER_BLIT_BAND_SHIFT = 5 };
+
+static FOG_INLINE void RasterPaintDoRender_blitItemRowsA(
+  const RasterBlitBatchA& batch, const RasterBlitItemA* item, int y0, int y1)
+{
+  int y = Math::max<int>(y0, item->pt.y);
+  int i = Math::min<int>(y1, item->pt.y + item->fragment.h) - y;
+
+  if (i <= 0)
+    return;
+
+  int w = item->fragment.w;
+
+  uint8_t* pixels = batch.pixels + (ssize_t)y * batch.stride;
+  const uint8_t* srcPixels = batch.srcPixels +
+    (ssize_t)(item->fragment.y + y - item->pt.y) * batch.srcStride +
+    (ssize_t)item->fragment.x * batch.srcBpp;
+
+  if (item->opacity == batch.fullOpacity)
+  {
+    pixels += (ssize_t)item->pt.x * batch.bpp;
+
+    if (batch.cvtLine == NULL)
+    {
+      do {
+        batch.blitLine(pixels, srcPixels, w, batch.closure);
+
+        pixels += batch.stride;
+        srcPixels += batch.srcStride;
+      } while (--i);
+    }
+    else
+    {
+      do {
+        batch.cvtLine(batch.tmpPixels, srcPixels, w, batch.closure);
+        batch.blitLine(pixels, batch.tmpPixels, w, batch.closure);
+
+        pixels += batch.stride;
+        srcPixels += batch.srcStride;
+      } while (--i);
+    }
+  }
+  else
+  {
+    RasterSpan8 span[1];
+    span[0].setPositionAndType(item->pt.x, item->pt.x + w, RASTER_SPAN_C);
+    span[0].setConstMask(item->opacity);
+    span[0].setNext(NULL);
+
+    if (batch.cvtLine == NULL)
+    {
+      do {
+        // SrcPixels won't be changed, it's just needed to remove the const modifier.
+        span[0].setData(const_cast<uint8_t*>(srcPixels));
+        batch.blitSpan(pixels, span, batch.closure);
+
+        pixels += batch.stride;
+        srcPixels += batch.srcStride;
+      } while (--i);
+    }
+    else
+    {
+      span[0].setData(batch.tmpPixels);
+
+      do {
+        batch.cvtLine(batch.tmpPixels, srcPixels, w, batch.closure);
+        batch.blitSpan(pixels, span, batch.closure);
+
+        pixels += batch.stride;
+        srcPixels += batch.srcStride;
+      } while (--i);
+    }
+  }
+}
+
+//! @internal
+//!
+//! @brief Blit aligned and clipped fragments of one image.
+//!
+//! The blit functions are resolved once per batch. Large batches are bucketed
+//! into horizontal bands, each band is then composited by all items it
+//! intersects (in their original order) so the destination scanlines stay in
+//! cache. Items in different bands don't overlap, so the result is the same
+//! as blitting the items one by one.
+static err_t FOG_FASTCALL RasterPaintDoRender_blitNormalizedImagesA(
+  RasterPaintEngine* engine, const Image* srcImage, const RasterBlitItemA* items, size_t count)
+{
+  size_t i;
+
+  // Generic path (clip-region or 16-bit context), each item is blitted by
+  // blitNormalizedImageA() using its own opacity.
+  if (engine->ctx.precision != IMAGE_PRECISION_BYTE || engine->ctx.clipType != RASTER_CLIP_BOX)
+  {
+    uint32_t opacity = engine->ctx.rasterHints.opacity;
+    err_t err = ERR_OK;
+
+    for (i = 0; i < count; i++)
+    {
+      engine->ctx.rasterHints.opacity = items[i].opacity;
+
+      err = RasterPaintDoRender_blitNormalizedImageA(engine, &items[i].pt, srcImage, &items[i].fragment);
+      if (FOG_IS_ERROR(err))
+        break;
+    }
+
+    engine->ctx.rasterHints.opacity = opacity;
+    return err;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Clip == Box]
+  // --------------------------------------------------------------------------
+
+  const ImageData* srcD = srcImage->_d;
+  uint32_t format = engine->ctx.target.format;
+  uint32_t srcFormat = srcD->format;
+  uint32_t compositingOperator = engine->ctx.paintHints.compositingOperator;
+
+  RasterBlitBatchA batch;
+  batch.pixels = engine->ctx.target.pixels;
+  batch.stride = engine->ctx.target.stride;
+  batch.bpp = engine->ctx.target.bpp;
+
+  batch.srcPixels = srcD->first;
+  batch.srcStride = srcD->stride;
+  batch.srcBpp = srcD->bytesPerPixel;
+
+  batch.fullOpacity = engine->ctx.fullOpacity.u;
+  batch.cvtLine = NULL;
+  batch.tmpPixels = NULL;
+  batch.closure = &engine->ctx.closure;
+
+  // If compositing operator is SRC or SRC_OVER then any image format
+  // combination is supported. However, if compositing operator is one
+  // of other values, then only few image formats can be mixed together.
+  if (RasterUtil::isCompositeCoreOp(compositingOperator))
+  {
+    const RasterCompositeCoreFuncs* funcs = _api_raster.getCompositeCore(format, compositingOperator, engine->ctx.paintHints.colorSpace);
+
+    batch.blitLine = funcs->vblit_line[srcFormat];
+    batch.blitSpan = funcs->vblit_span[srcFormat];
+  }
+  else
+  {
+    uint32_t vBlitSrc = _raster_compatibleFormat[format][srcFormat].srcFormat;
+    uint32_t vBlitId = _raster_compatibleFormat[format][srcFormat].vblitId;
+
+    const RasterCompositeExtFuncs* funcs = _api_raster.getCompositeExt(format, compositingOperator);
+
+    batch.blitLine = funcs->vblit_line[vBlitId];
+    batch.blitSpan = funcs->vblit_span[vBlitId];
+
+    if (srcFormat != vBlitSrc)
+    {
+      batch.cvtLine = _api_raster.getCompositeCore(vBlitSrc, COMPOSITE_SRC)->vblit_line[srcFormat];
+      batch.tmpPixels = reinterpret_cast<uint8_t*>(engine->ctx.buffer.getMem());
+    }
+  }
+
+  engine->ctx.closure.palette = srcD->palette->_d;
+  engine->ctx.closure.colorKey = srcD->colorKey;
+
+  int clipY0 = engine->ctx.clipBoxI.y0;
+  int clipY1 = engine->ctx.clipBoxI.y1;
+
+  size_t bandCount = (size_t)((clipY1 - clipY0 - 1) >> RASTER_BLIT_BAND_SHIFT) + 1;
+  uint32_t* bandData = NULL;
+
+  MemBufferTmp<1024> bandBuffer;
+
+  // Bucket the items into bands, using counting-sort. Each band has a list of
+  // indexes to items which intersect it. Small batches, or batches which don't
+  // fit into 32-bit indexes, are blitted directly.
+  if (count >= 16 && bandCount > 1 && count <= (size_t)UINT32_MAX)
+  {
+    size_t indexCount = 0;
+
+    for (i = 0; i < count; i++)
+    {
+      int b0 = (items[i].pt.y - clipY0) >> RASTER_BLIT_BAND_SHIFT;
+      int b1 = (items[i].pt.y + items[i].fragment.h - 1 - clipY0) >> RASTER_BLIT_BAND_SHIFT;
+
+      indexCount += (size_t)(b1 - b0 + 1);
+    }
+
+    // bandData layout: [bandCount + 1] starts, [bandCount] cursors, indexes.
+    size_t bandDataSize = (bandCount * 2 + 1 + indexCount) * sizeof(uint32_t);
+    if (indexCount <= (size_t)UINT32_MAX && indexCount < (SIZE_MAX / sizeof(uint32_t)) - bandCount * 2 - 1)
+      bandData = reinterpret_cast<uint32_t*>(bandBuffer.alloc(bandDataSize));
+  }
+
+  if (bandData != NULL)
+  {
+    uint32_t* bandStart = bandData;
+    uint32_t* bandCursor = bandData + bandCount + 1;
+    uint32_t* bandIndex = bandCursor + bandCount;
+
+    size_t b;
+    MemOps::zero(bandStart, (bandCount + 1) * sizeof(uint32_t));
+
+    for (i = 0; i < count; i++)
+    {
+      int b0 = (items[i].pt.y - clipY0) >> RASTER_BLIT_BAND_SHIFT;
+      int b1 = (items[i].pt.y + items[i].fragment.h - 1 - clipY0) >> RASTER_BLIT_BAND_SHIFT;
+
+      do {
+        bandStart[b0 + 1]++;
+      } while (++b0 <= b1);
+    }
+
+    for (b = 0; b < bandCount; b++)
+    {
+      bandStart[b + 1] += bandStart[b];
+      bandCursor[b] = bandStart[b];
+    }
+
+    for (i = 0; i < count; i++)
+    {
+      int b0 = (items[i].pt.y - clipY0) >> RASTER_BLIT_BAND_SHIFT;
+      int b1 = (items[i].pt.y + items[i].fragment.h - 1 - clipY0) >> RASTER_BLIT_BAND_SHIFT;
+
+      do {
+        bandIndex[bandCursor[b0]++] = (uint32_t)i;
+      } while (++b0 <= b1);
+    }
+
+    for (b = 0; b < bandCount; b++)
+    {
+      int y0 = clipY0 + ((int)b << RASTER_BLIT_BAND_SHIFT);
+      int y1 = Math::min<int>(y0 + (1 << RASTER_BLIT_BAND_SHIFT), clipY1);
+
+      uint32_t index = bandStart[b];
+      uint32_t indexEnd = bandStart[b + 1];
+
+      for (; index < indexEnd; index++)
+        RasterPaintDoRender_blitItemRowsA(batch, &items[bandIndex[index]], y0, y1);
+    }
+  }
+  else
+  {
+    for (i = 0; i < count; i++)
+      RasterPaintDoRender_blitItemRowsA(batch, &items[i], clipY0, clipY1);
+  }
+
+  engine->ctx.closure.palette = NULL;
+  engine->ctx.closure.colorKey = 0xFFFFFFFF;
+
+  return ERR_OK;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - BlitNormalizedImage]
 // ============================================================================
@@ -1195,6 +1640,93 @@ static err_t FOG_FASTCALL RasterPaintDoRender_filterNormalizedPathD(
   return ERR_RT_INVALID_STATE;
 }
 
+// ============================================================================
+// [Fog::RasterPaintDoRender - FilterNormalizedBoxMask]
+// ============================================================================
+
+// Filter the box and composite the result through the A8 mask, which has the
+// size of the box. The pixels where the mask is zero are not changed, the
+// opacity must be already applied to the mask.
+static err_t FOG_FASTCALL RasterPaintDoRender_filterNormalizedBoxMask(
+  RasterPaintEngine* engine, const FeBase* feBase, const BoxI* box, const Image* mask)
+{
+  FOG_ASSERT(box->isValid());
+  FOG_ASSERT(engine->ctx.clipBoxI.subsumes(*box));
+
+  FOG_ASSERT(mask->getFormat() == IMAGE_FORMAT_A8);
+  FOG_ASSERT(mask->getWidth() == box->getWidth());
+  FOG_ASSERT(mask->getHeight() == box->getHeight());
+
+  if (engine->ctx.precision != IMAGE_PRECISION_BYTE)
+  {
+    // TODO: 16-bit image processing.
+    return ERR_RT_NOT_IMPLEMENTED;
+  }
+
+  // Destination and source formats are the same.
+  RasterFilter ctx;
+  FOG_RETURN_ON_ERROR(_api_raster.filter.create[feBase->getFeType()](&ctx,
+    feBase, &engine->ctx.filterScale,
+    &engine->ctx.buffer,
+    engine->ctx.target.format,
+    engine->ctx.target.format));
+
+  RasterFilterImage dImage;
+  RasterFilterImage sImage;
+
+  PointI dPos(0, 0);
+  RectI sRect(box->x0, box->y0, box->x1 - box->x0, box->y1 - box->y0);
+
+  // Render to the intermediate buffer (see the NULL assignment to the
+  // dImage.data), the filter reads the pixels around each destination pixel
+  // so the target can't be modified until the whole box is filtered.
+  dImage.size.set(sRect.w, sRect.h);
+  dImage.stride = 0;
+  dImage.data = NULL;
+
+  sImage.size = engine->ctx.target.size;
+  sImage.stride = engine->ctx.target.stride;
+  sImage.data = engine->ctx.target.pixels;
+
+  MemBuffer intermediateBuffer;
+  err_t err = ctx.doRect(&ctx, &dImage, &dPos, &sImage, &sRect, &intermediateBuffer);
+
+  if (err == ERR_OK)
+  {
+    int i = sRect.h;
+
+    RasterVBlitSpanFunc blitSpan;
+    blitSpan = _api_raster.getCompositeCore(engine->ctx.target.format, COMPOSITE_SRC)->vblit_span[engine->ctx.target.format];
+
+    ssize_t dstStride = engine->ctx.target.stride;
+    ssize_t srcStride = dImage.stride;
+    ssize_t mskStride = mask->getStride();
+
+    uint8_t* dstPixels = engine->ctx.target.pixels + box->y0 * dstStride;
+    uint8_t* srcPixels = dImage.data;
+    const uint8_t* mskPixels = mask->getFirst();
+
+    FOG_ASSERT(srcPixels != NULL);
+
+    RasterSpan8 span[1];
+    span[0].setPositionAndType(box->x0, box->x1, RASTER_SPAN_A8_GLYPH);
+    span[0].setNext(NULL);
+
+    do {
+      span[0].setA8Glyph(const_cast<uint8_t*>(mskPixels));
+      span[0].setData(srcPixels);
+      blitSpan(dstPixels, span, &engine->ctx.closure);
+
+      dstPixels += dstStride;
+      srcPixels += srcStride;
+      mskPixels += mskStride;
+    } while (--i);
+  }
+
+  ctx.destroy(&ctx);
+  return err;
+}
+
 // ============================================================================
 // [Fog::RasterPaintDoRender - SwitchToMask / DiscardMask]
 // ============================================================================
@@ -1281,6 +1813,7 @@ void FOG_NO_EXPORT RasterPaintDoRender_init(void)
   v->fillNormalizedBoxI = RasterPaintDoRender_fillNormalizedBoxI;
   v->fillNormalizedBoxF = RasterPaintDoRender_fillNormalizedBoxF;
   v->fillNormalizedBoxD = RasterPaintDoRender_fillNormalizedBoxD;
+  v->fillNormalizedRegion = RasterPaintDoRender_fillNormalizedRegion;
   v->fillNormalizedPathF = RasterPaintDoRender_fillNormalizedPathF;
   v->fillNormalizedPathD = RasterPaintDoRender_fillNormalizedPathD;
 
@@ -1292,6 +1825,7 @@ void FOG_NO_EXPORT RasterPaintDoRender_init(void)
   v->blitNormalizedImageA = RasterPaintDoRender_blitNormalizedImageA;
   v->blitNormalizedImageI = RasterPaintDoRender_blitNormalizedImageI;
   v->blitNormalizedImageD = RasterPaintDoRender_blitNormalizedImageD;
+  v->blitNormalizedImagesA = RasterPaintDoRender_blitNormalizedImagesA;
 
   // --------------------------------------------------------------------------
   // [Filter]
@@ -1302,6 +1836,7 @@ void FOG_NO_EXPORT RasterPaintDoRender_init(void)
   v->filterNormalizedBoxD = RasterPaintDoRender_filterNormalizedBoxD;
   v->filterNormalizedPathF = RasterPaintDoRender_filterNormalizedPathF;
   v->filterNormalizedPathD = RasterPaintDoRender_filterNormalizedPathD;
+  v->filterNormalizedBoxMask = RasterPaintDoRender_filterNormalizedBoxMask;
 
   // --------------------------------------------------------------------------
   // [Mask]
@@ -178,6 +178,10 @@ struct FOG_NO_EXPORT RasterPaintEngine : public PaintEngine
 
   err_t createPatternContext();
 
+  RasterPattern* findCachedPatternContext();
+  void addCachedPatternContext(RasterPattern* pc);
+  void discardPatternCache();
+
   FOG_INLINE void discardSource()
   {
     switch (sourceType)
@@ -213,6 +217,25 @@ _DiscardContinue:
     pcPool = reinterpret_cast<RasterAbstractLinkedList*>(pc);
   }
 
+  // --------------------------------------------------------------------------
+  // [Helpers - Transform]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get the inverted user transformation matrix.
+  //!
+  //! The inverted matrix is recomputed only if the user transform was changed
+  //! since the last call (compared by value, so save/restore is handled too).
+  FOG_INLINE const TransformD& getUserTransformInv()
+  {
+    if (userTransformInvSrcD != userTransformD)
+    {
+      userTransformInvSrcD = userTransformD;
+      userTransformInvD = userTransformD.inverted();
+    }
+
+    return userTransformInvD;
+  }
+
   // --------------------------------------------------------------------------
   // [Helpers - Region]
   // --------------------------------------------------------------------------
@@ -371,6 +394,11 @@ _DiscardContinue:
   //! @brief The user transformation matrix.
   TransformD userTransformD;
 
+  //! @brief Inverted user transformation matrix (cached).
+  TransformD userTransformInvD;
+  //! @brief User transformation matrix @c userTransformInvD was inverted from.
+  TransformD userTransformInvSrcD;
+
   // --------------------------------------------------------------------------
   // [Members - Source & Opacity]
   // --------------------------------------------------------------------------
@@ -413,6 +441,9 @@ _DiscardContinue:
   //! @brief Pattern-context pool.
   RasterAbstractLinkedList* pcPool;
 
+  //! @brief Recently used pattern-contexts, the most recent one is first.
+  RasterPatternCacheEntry pcCache[RASTER_PATTERN_CACHE_SIZE];
+
   // --------------------------------------------------------------------------
   // [Members - Dummy]
   // --------------------------------------------------------------------------
@@ -433,6 +464,9 @@ _DiscardContinue:
   //! @brief Current group.
   RasterPaintGroup* curGroup;
 
+  //! @brief Group buffers (PRGB32 images) kept for reuse by paintGroup().
+  Image groupPool[RASTER_GROUP_POOL_SIZE];
+
   // --------------------------------------------------------------------------
   // [Members - Commands]
   // --------------------------------------------------------------------------
@@ -131,6 +131,53 @@ struct FOG_NO_EXPORT RasterPaintSource
   Static<TransformD> adjusted;
 };
 
+// ============================================================================
+// [Fog::RasterPatternCacheEntry]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Entry of a recently used pattern-context cache.
+//!
+//! The entry holds one reference of the pattern-context and a copy of the
+//! source (texture or gradient) it was created from. The copy of the texture
+//! keeps the image data referenced, so the image can't be modified without
+//! being detached first (which changes the image data and causes cache miss).
+//!
+//! The cache is discarded by @c Painter::flush(), when the meta-params are
+//! changed or reset and when the engine is destroyed (@c Painter::end()), so
+//! the images are not kept alive after painting.
+struct FOG_NO_EXPORT RasterPatternCacheEntry
+{
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief The pattern-context, NULL if the entry is not used.
+  RasterPattern* pc;
+
+  //! @brief Source type, see @c RASTER_SOURCE.
+  uint32_t sourceType;
+  //! @brief Target format.
+  uint32_t format;
+  //! @brief Image or gradient quality.
+  uint32_t quality;
+
+  //! @brief Meta clip-box the pattern-context was created for.
+  BoxI clipBox;
+
+  union
+  {
+    //! @brief Texture.
+    Static<Texture> texture;
+    //! @brief Gradient.
+    Static<GradientD> gradient;
+  };
+
+  //! @brief Adjusted source transform.
+  Static<TransformD> transform;
+};
+
 // ============================================================================
 // [Fog::RasterPaintTarget]
 // ============================================================================
@@ -211,6 +258,7 @@ struct FOG_NO_EXPORT RasterPaintGroup
     numGroups = 0;
     opacityF = 1.0f;
     boundingBox.setBox(INT_MIN, INT_MIN, INT_MIN, INT_MIN);
+    dirtyCount = 0;
 
     groupRecord = NULL;
     cmdRecord = NULL;
@@ -275,6 +323,11 @@ struct FOG_NO_EXPORT RasterPaintGroup
 
   RasterPaintState* savedState;
 
+  //! @brief Count of dirty boxes.
+  uint32_t dirtyCount;
+  //! @brief Dirty boxes, their union is the group bounding box.
+  BoxI dirtyBox[RASTER_GROUP_DIRTY_COUNT];
+
   //! @brief Group record (recorded position in groupAllocator).
   MemZoneRecord* groupRecord;
   //! @brief Commands record (recorded position in cmdAllocator).
@@ -412,6 +465,23 @@ struct FOG_NO_EXPORT RasterPaintState
   Static<ImageFilterScaleD> filterScale;
 };
 
+// ============================================================================
+// [Fog::RasterBlitItemA]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Normalized (aligned and clipped) item of @c Painter::blitImages().
+struct FOG_NO_EXPORT RasterBlitItemA
+{
+  //! @brief Destination point (device coordinates).
+  PointI pt;
+  //! @brief Source fragment (already clipped).
+  RectI fragment;
+  //! @brief Opacity (0 to full opacity of the context).
+  uint32_t opacity;
+};
+
 // ============================================================================
 // [Fog::RasterPaintDoCmd]
 // ============================================================================
@@ -433,6 +503,7 @@ struct FOG_NO_EXPORT RasterPaintDoCmd
   err_t (FOG_FASTCALL *fillNormalizedBoxI)(RasterPaintEngine* engine, const BoxI* box);
   err_t (FOG_FASTCALL *fillNormalizedBoxF)(RasterPaintEngine* engine, const BoxF* box);
   err_t (FOG_FASTCALL *fillNormalizedBoxD)(RasterPaintEngine* engine, const BoxD* box);
+  err_t (FOG_FASTCALL *fillNormalizedRegion)(RasterPaintEngine* engine, const Region* region);
   err_t (FOG_FASTCALL *fillNormalizedPathF)(RasterPaintEngine* engine, const PathF* path, const PointF* pt, uint32_t fillRule);
   err_t (FOG_FASTCALL *fillNormalizedPathD)(RasterPaintEngine* engine, const PathD* path, const PointD* pt, uint32_t fillRule);
 
@@ -444,6 +515,7 @@ struct FOG_NO_EXPORT RasterPaintDoCmd
   err_t (FOG_FASTCALL *blitNormalizedImageA)(RasterPaintEngine* engine, const PointI* pt, const Image* srcImage, const RectI* srcFragment);
   err_t (FOG_FASTCALL *blitNormalizedImageI)(RasterPaintEngine* engine, const BoxI* box, const Image* srcImage, const RectI* srcFragment, const TransformD* srcTransform, uint32_t imageQuality);
   err_t (FOG_FASTCALL *blitNormalizedImageD)(RasterPaintEngine* engine, const BoxD* box, const Image* srcImage, const RectI* srcFragment, const TransformD* srcTransform, uint32_t imageQuality);
+  err_t (FOG_FASTCALL *blitNormalizedImagesA)(RasterPaintEngine* engine, const Image* srcImage, const RasterBlitItemA* items, size_t count);
 
   // --------------------------------------------------------------------------
   // [Funcs - Filter]
@@ -454,6 +526,7 @@ struct FOG_NO_EXPORT RasterPaintDoCmd
   err_t (FOG_FASTCALL *filterNormalizedBoxD)(RasterPaintEngine* engine, const FeBase* feBase, const BoxD* box);
   err_t (FOG_FASTCALL *filterNormalizedPathF)(RasterPaintEngine* engine, const FeBase* feBase, const PathF* path, const PointF* pt, uint32_t fillRule);
   err_t (FOG_FASTCALL *filterNormalizedPathD)(RasterPaintEngine* engine, const FeBase* feBase, const PathD* path, const PointD* pt, uint32_t fillRule);
+  err_t (FOG_FASTCALL *filterNormalizedBoxMask)(RasterPaintEngine* engine, const FeBase* feBase, const BoxI* box, const Image* mask);
 
   // --------------------------------------------------------------------------
   // [Funcs - Mask]
@@ -402,6 +402,21 @@ struct FOG_NO_EXPORT RasterPattern
     //int fyrewind;
   };
 
+  struct _TextureProjection
+  {
+    double tx, ty, tz;
+    double xx, xy, xz;
+    double yx, yy, yz;
+    double mx, my; // Max X/Y.
+
+    // Used by 16x16 fixed point.
+    int mx16x16, my16x16;
+
+    //! @brief Whether the 16.16 fixed point can be used to step within
+    //! subdivided spans (depends on the texture size and tiling).
+    int safeFixedPoint;
+  };
+
   struct _TexturePacked
   {
     _TextureBase base;
@@ -410,6 +425,7 @@ struct FOG_NO_EXPORT RasterPattern
     {
       _TextureSimple simple;
       _TextureAffine affine;
+      _TextureProjection proj;
     };
   };
 
@@ -618,6 +634,12 @@ struct FOG_NO_EXPORT RasterPatternFetcher
       double px, py;
       double dx, dy;
     } affine;
+
+    struct _Projection
+    {
+      double px, py, pz;
+      double dx, dy, dz;
+    } proj;
   };
 
   // --------------------------------------------------------------------------
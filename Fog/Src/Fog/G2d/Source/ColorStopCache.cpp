@@ -9,7 +9,397 @@
 #endif // FOG_PRECOMP
 
 // [Dependencies]
+#include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Memory/MemOps.h>
+#include <Fog/Core/Threading/Atomic.h>
+#include <Fog/Core/Threading/Lock.h>
+#include <Fog/Core/Tools/HashUtil.h>
+#include <Fog/G2d/Imaging/ImageFormatDescription.h>
 #include <Fog/G2d/Source/ColorStopCache.h>
 
 namespace Fog {
+
+// ============================================================================
+// [Fog::ColorStopCache - Entry]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Entry of the global color-stop cache.
+//!
+//! The entry keeps a copy of color stops, which is compared when the hash
+//! code, the format and the length of the color table match, and a reference
+//! to the color table.
+struct FOG_NO_EXPORT ColorStopCacheEntry
+{
+  //! @brief Next entry in the hash bucket.
+  ColorStopCacheEntry* hashNext;
+  //! @brief Previous (more recently used) entry in the LRU list.
+  ColorStopCacheEntry* lruPrev;
+  //! @brief Next (less recently used) entry in the LRU list.
+  ColorStopCacheEntry* lruNext;
+
+  //! @brief The color table.
+  ColorStopCache* cache;
+  //! @brief Bytes held by the entry, including the color table.
+  size_t memSize;
+
+  //! @brief Hash code of the key.
+  uint32_t hashCode;
+  //! @brief Count of color stops.
+  uint32_t stopCount;
+
+  //! @brief Color stops.
+  ColorStop stops[1];
+};
+
+// ============================================================================
+// [Fog::ColorStopCache - Global]
+// ============================================================================
+
+static Static<Lock> ColorStopCache_lock;
+
+static ColorStopCacheEntry* ColorStopCache_buckets[COLOR_STOP_CACHE_BUCKET_COUNT];
+static ColorStopCacheEntry* ColorStopCache_lruFirst;
+static ColorStopCacheEntry* ColorStopCache_lruLast;
+
+static size_t ColorStopCache_budget;
+static size_t ColorStopCache_entryCount;
+static size_t ColorStopCache_usedBytes;
+
+static Atomic<size_t> ColorStopCache_hitCount;
+static Atomic<size_t> ColorStopCache_missCount;
+static Atomic<size_t> ColorStopCache_evictCount;
+
+// ============================================================================
+// [Fog::ColorStopCache - Helpers]
+// ============================================================================
+
+static FOG_INLINE uint32_t ColorStopCache_hashKey(const ColorStop* stops, size_t length, uint32_t format, uint32_t cacheLength)
+{
+  uint32_t hashCode = HashUtil::hashBinary(stops, length * sizeof(ColorStop));
+  return hashCode * 31 + ((format << 24) ^ cacheLength);
+}
+
+static FOG_INLINE size_t ColorStopCache_getMemSize(const ColorStopCache* cache, size_t length)
+{
+  size_t bpp = ImageFormatDescription::getByFormat(cache->getFormat()).getBytesPerPixel();
+
+  return sizeof(ColorStopCacheEntry) - sizeof(ColorStop) + length * sizeof(ColorStop) +
+    sizeof(ColorStopCache) + (size_t)(cache->getLength() + 1) * bpp;
+}
+
+static FOG_INLINE void ColorStopCache_lruUnlink(ColorStopCacheEntry* entry)
+{
+  if (entry->lruPrev)
+    entry->lruPrev->lruNext = entry->lruNext;
+  else
+    ColorStopCache_lruFirst = entry->lruNext;
+
+  if (entry->lruNext)
+    entry->lruNext->lruPrev = entry->lruPrev;
+  else
+    ColorStopCache_lruLast = entry->lruPrev;
+}
+
+static FOG_INLINE void ColorStopCache_lruPrepend(ColorStopCacheEntry* entry)
+{
+  entry->lruPrev = NULL;
+  entry->lruNext = ColorStopCache_lruFirst;
+
+  if (ColorStopCache_lruFirst)
+    ColorStopCache_lruFirst->lruPrev = entry;
+  else
+    ColorStopCache_lruLast = entry;
+
+  ColorStopCache_lruFirst = entry;
+}
+
+//! @internal
+//!
+//! @brief Find an entry, the lock must be held.
+static ColorStopCacheEntry* ColorStopCache_findLocked(uint32_t hashCode,
+  const ColorStop* stops, size_t length, uint32_t format, uint32_t cacheLength)
+{
+  ColorStopCacheEntry* entry = ColorStopCache_buckets[hashCode % COLOR_STOP_CACHE_BUCKET_COUNT];
+
+  while (entry != NULL)
+  {
+    if (entry->hashCode == hashCode &&
+        entry->stopCount == length &&
+        entry->cache->getFormat() == format &&
+        entry->cache->getLength() == cacheLength &&
+        MemOps::eq(entry->stops, stops, length * sizeof(ColorStop)))
+    {
+      return entry;
+    }
+
+    entry = entry->hashNext;
+  }
+
+  return NULL;
+}
+
+//! @internal
+//!
+//! @brief Remove the least recently used entries until the cache holds at
+//! most @a keepBytes, the lock must be held.
+//!
+//! The removed entries are returned as a list linked by @c hashNext, the
+//! color tables are released by @c ColorStopCache_freeList() after the lock
+//! is released.
+static ColorStopCacheEntry* ColorStopCache_evictLocked(size_t keepBytes)
+{
+  ColorStopCacheEntry* evicted = NULL;
+
+  while (ColorStopCache_usedBytes > keepBytes)
+  {
+    ColorStopCacheEntry* entry = ColorStopCache_lruLast;
+    FOG_ASSERT(entry != NULL);
+
+    ColorStopCacheEntry** pPrev = &ColorStopCache_buckets[entry->hashCode % COLOR_STOP_CACHE_BUCKET_COUNT];
+    while (*pPrev != entry)
+      pPrev = &(*pPrev)->hashNext;
+    *pPrev = entry->hashNext;
+
+    ColorStopCache_lruUnlink(entry);
+    ColorStopCache_entryCount--;
+    ColorStopCache_usedBytes -= entry->memSize;
+
+    entry->hashNext = evicted;
+    evicted = entry;
+  }
+
+  return evicted;
+}
+
+static void ColorStopCache_freeList(ColorStopCacheEntry* entry)
+{
+  while (entry != NULL)
+  {
+    ColorStopCacheEntry* next = entry->hashNext;
+
+    entry->cache->release();
+    MemMgr::free(entry);
+
+    ColorStopCache_evictCount.inc();
+    entry = next;
+  }
+}
+
+// ============================================================================
+// [Fog::ColorStopCache - Shared]
+// ============================================================================
+
+static ColorStopCache* FOG_CDECL ColorStopCache_getShared(const ColorStop* stops, size_t length, uint32_t format, uint32_t cacheLength)
+{
+  if (ColorStopCache_budget == 0)
+    return NULL;
+
+  uint32_t hashCode = ColorStopCache_hashKey(stops, length, format, cacheLength);
+  ColorStopCache* cache = NULL;
+
+  {
+    AutoLock locked(ColorStopCache_lock);
+    ColorStopCacheEntry* entry = ColorStopCache_findLocked(hashCode, stops, length, format, cacheLength);
+
+    if (entry != NULL)
+    {
+      if (entry != ColorStopCache_lruFirst)
+      {
+        ColorStopCache_lruUnlink(entry);
+        ColorStopCache_lruPrepend(entry);
+      }
+
+      cache = entry->cache->addRef();
+    }
+  }
+
+  if (cache != NULL)
+    ColorStopCache_hitCount.inc();
+  else
+    ColorStopCache_missCount.inc();
+
+  return cache;
+}
+
+static ColorStopCache* FOG_CDECL ColorStopCache_putShared(const ColorStop* stops, size_t length, ColorStopCache* cache)
+{
+  size_t memSize = ColorStopCache_getMemSize(cache, length);
+
+  // Don't cache tables which would evict everything else.
+  if (memSize > ColorStopCache_budget / 2 || length > UINT32_MAX)
+    return cache;
+
+  uint32_t format = cache->getFormat();
+  uint32_t cacheLength = cache->getLength();
+  uint32_t hashCode = ColorStopCache_hashKey(stops, length, format, cacheLength);
+
+  ColorStopCacheEntry* entry = reinterpret_cast<ColorStopCacheEntry*>(
+    MemMgr::alloc(sizeof(ColorStopCacheEntry) - sizeof(ColorStop) + length * sizeof(ColorStop)));
+
+  if (FOG_IS_NULL(entry))
+    return cache;
+
+  entry->cache = cache;
+  entry->memSize = memSize;
+  entry->hashCode = hashCode;
+  entry->stopCount = (uint32_t)length;
+  MemOps::copy(entry->stops, stops, length * sizeof(ColorStop));
+
+  ColorStopCache* result;
+  ColorStopCacheEntry* evicted = NULL;
+
+  {
+    AutoLock locked(ColorStopCache_lock);
+    ColorStopCacheEntry* other = ColorStopCache_findLocked(hashCode, stops, length, format, cacheLength);
+
+    if (other != NULL)
+    {
+      // Another thread was faster, use its table.
+      result = other->cache->addRef();
+    }
+    else
+    {
+      ColorStopCacheEntry** pBucket = &ColorStopCache_buckets[hashCode % COLOR_STOP_CACHE_BUCKET_COUNT];
+
+      entry->hashNext = *pBucket;
+      *pBucket = entry;
+      ColorStopCache_lruPrepend(entry);
+
+      ColorStopCache_entryCount++;
+      ColorStopCache_usedBytes += memSize;
+
+      // The reference of the caller is now owned by the entry.
+      result = cache->addRef();
+      entry = NULL;
+
+      evicted = ColorStopCache_evictLocked(ColorStopCache_budget);
+    }
+  }
+
+  if (entry != NULL)
+  {
+    cache->release();
+    MemMgr::free(entry);
+  }
+
+  ColorStopCache_freeList(evicted);
+  return result;
+}
+
+// ============================================================================
+// [Fog::ColorStopCache - Trim]
+// ============================================================================
+
+static void FOG_CDECL ColorStopCache_trim(size_t keepBytes)
+{
+  ColorStopCacheEntry* evicted;
+
+  {
+    AutoLock locked(ColorStopCache_lock);
+    evicted = ColorStopCache_evictLocked(keepBytes);
+  }
+
+  ColorStopCache_freeList(evicted);
+}
+
+static void FOG_CDECL ColorStopCache_cleanupFunc(void* closure, uint32_t reason)
+{
+  FOG_UNUSED(closure);
+  FOG_UNUSED(reason);
+
+  ColorStopCache_trim(0);
+}
+
+// ============================================================================
+// [Fog::ColorStopCache - Accessors]
+// ============================================================================
+
+static size_t FOG_CDECL ColorStopCache_getBudget(void)
+{
+  return ColorStopCache_budget;
+}
+
+static void FOG_CDECL ColorStopCache_setBudget(size_t budget)
+{
+  ColorStopCacheEntry* evicted;
+
+  {
+    AutoLock locked(ColorStopCache_lock);
+
+    ColorStopCache_budget = budget;
+    evicted = ColorStopCache_evictLocked(budget);
+  }
+
+  ColorStopCache_freeList(evicted);
+}
+
+// ============================================================================
+// [Fog::ColorStopCache - Statistics]
+// ============================================================================
+
+static void FOG_CDECL ColorStopCache_getStats(ColorStopCacheStats* stats)
+{
+  stats->hitCount = ColorStopCache_hitCount.get();
+  stats->missCount = ColorStopCache_missCount.get();
+  stats->evictCount = ColorStopCache_evictCount.get();
+
+  AutoLock locked(ColorStopCache_lock);
+
+  stats->entryCount = ColorStopCache_entryCount;
+  stats->usedBytes = ColorStopCache_usedBytes;
+  stats->budget = ColorStopCache_budget;
+}
+
+static void FOG_CDECL ColorStopCache_resetStats(void)
+{
+  ColorStopCache_hitCount.set(0);
+  ColorStopCache_missCount.set(0);
+  ColorStopCache_evictCount.set(0);
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void ColorStopCache_init(void)
+{
+  fog_api.colorstopcache_getShared = ColorStopCache_getShared;
+  fog_api.colorstopcache_putShared = ColorStopCache_putShared;
+  fog_api.colorstopcache_trim = ColorStopCache_trim;
+
+  fog_api.colorstopcache_getBudget = ColorStopCache_getBudget;
+  fog_api.colorstopcache_setBudget = ColorStopCache_setBudget;
+
+  fog_api.colorstopcache_getStats = ColorStopCache_getStats;
+  fog_api.colorstopcache_resetStats = ColorStopCache_resetStats;
+
+  ColorStopCache_lock.init();
+
+  MemOps::zero(ColorStopCache_buckets, sizeof(ColorStopCache_buckets));
+  ColorStopCache_lruFirst = NULL;
+  ColorStopCache_lruLast = NULL;
+
+  ColorStopCache_budget = COLOR_STOP_CACHE_DEFAULT_BUDGET;
+  ColorStopCache_entryCount = 0;
+  ColorStopCache_usedBytes = 0;
+
+  ColorStopCache_hitCount.init(0);
+  ColorStopCache_missCount.init(0);
+  ColorStopCache_evictCount.init(0);
+
+  MemMgr::registerCleanupFunc(ColorStopCache_cleanupFunc, NULL);
+}
+
+FOG_NO_EXPORT void ColorStopCache_fini(void)
+{
+  MemMgr::unregisterCleanupFunc(ColorStopCache_cleanupFunc, NULL);
+
+  // Patterns which are still alive keep references to their color tables,
+  // only the references held by the cache are released here.
+  ColorStopCache_trim(0);
+}
+
 } // Fog namespace
@@ -19,10 +19,40 @@ namespace Fog {
 //! @addtogroup Fog_G2d_Source
 //! @{
 
+// ============================================================================
+// [Fog::ColorStopCacheStats]
+// ============================================================================
+
+//! @brief Global color-stop cache statistics.
+struct FOG_NO_EXPORT ColorStopCacheStats
+{
+  //! @brief Count of color tables found in the global cache.
+  uint64_t hitCount;
+  //! @brief Count of color tables not found in the global cache.
+  uint64_t missCount;
+  //! @brief Count of color tables removed because the budget was exceeded or
+  //! because of trim.
+  uint64_t evictCount;
+
+  //! @brief Count of color tables in the global cache.
+  size_t entryCount;
+  //! @brief Bytes held by the global cache.
+  size_t usedBytes;
+  //! @brief Byte budget of the global cache.
+  size_t budget;
+};
+
 // ============================================================================
 // [Fog::ColorStopCache]
 // ============================================================================
 
+//! @brief Color table (gradient LUT) generated from a list of color stops.
+//!
+//! The color table is cached by @c ColorStopList, which generated it, and
+//! also by a process-wide LRU cache keyed by the content of color stops, the
+//! format and the length of the table. Lists which contain the same stops
+//! (for example lists rebuilt by the SVG renderer each frame) share a single
+//! color table this way.
 struct FOG_NO_EXPORT ColorStopCache
 {
   // --------------------------------------------------------------------------
@@ -101,6 +131,59 @@ struct FOG_NO_EXPORT ColorStopCache
     MemMgr::free(cache);
   }
 
+  // --------------------------------------------------------------------------
+  // [Shared]
+  // --------------------------------------------------------------------------
+
+  //! @brief Get a color table matching @a stops, @a format and @a cacheLength
+  //! from the global cache.
+  //!
+  //! Returns a new reference (must be released by the caller) or @c NULL if
+  //! the table is not cached.
+  static FOG_INLINE ColorStopCache* getShared(const ColorStop* stops, size_t length, uint32_t format, uint32_t cacheLength)
+  {
+    return fog_api.colorstopcache_getShared(stops, length, format, cacheLength);
+  }
+
+  //! @brief Add the color table @a cache generated from @a stops to the global
+  //! cache.
+  //!
+  //! The reference of @a cache owned by the caller is consumed. The returned
+  //! table is a new reference, which is @a cache or the table added by another
+  //! thread in the meantime.
+  static FOG_INLINE ColorStopCache* putShared(const ColorStop* stops, size_t length, ColorStopCache* cache)
+  {
+    return fog_api.colorstopcache_putShared(stops, length, cache);
+  }
+
+  //! @brief Remove the least recently used color tables from the global cache
+  //! until it holds at most @a keepBytes.
+  static FOG_INLINE void trimShared(size_t keepBytes = 0)
+  {
+    fog_api.colorstopcache_trim(keepBytes);
+  }
+
+  static FOG_INLINE size_t getSharedBudget()
+  {
+    return fog_api.colorstopcache_getBudget();
+  }
+
+  //! @brief Set the byte budget of the global cache, zero disables it.
+  static FOG_INLINE void setSharedBudget(size_t budget)
+  {
+    fog_api.colorstopcache_setBudget(budget);
+  }
+
+  static FOG_INLINE void getSharedStats(ColorStopCacheStats& stats)
+  {
+    fog_api.colorstopcache_getStats(&stats);
+  }
+
+  static FOG_INLINE void resetSharedStats()
+  {
+    fog_api.colorstopcache_resetStats();
+  }
+
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
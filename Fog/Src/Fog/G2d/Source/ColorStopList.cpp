@@ -241,9 +241,10 @@ static void FOG_CDECL ColorStopList_clear(ColorStopList* self)
   {
     d->length = 0;
 
+    // The cache can be shared by other lists and patterns.
     ColorStopCache* cache = atomicPtrXchg(&d->stopCachePrgb32, (ColorStopCache*)NULL);
     if (cache)
-      ColorStopCache::destroy(cache);
+      cache->release();
   }
 }
 
@@ -355,14 +355,63 @@ err_t SvgHitTestContext::onShape(SvgElement* obj, const ShapeF& shape)
     _transformDirty = false;
   }
 
+  // The hit-index of a path is requested once per query. The first query of
+  // a path uses the direct hit-tests, the next ones build and use the index.
+  const PathF* path = NULL;
+  const PathHitIndexF* hitIndex = NULL;
+
+  if (shape.getType() == SHAPE_TYPE_PATH)
+  {
+    path = static_cast<const PathF*>(shape.getData());
+    hitIndex = path->getHitIndexLazy();
+  }
+
   if (_fillSource.isPaintable())
   {
-    if (shape.hitTest(_invPoint, _fillRule))
+    bool hit;
+
+    if (hitIndex != NULL)
+      hit = hitIndex->hitTest(_invPoint, _fillRule);
+    else if (path != NULL)
+      hit = path->hitTestDirect(_invPoint, _fillRule);
+    else
+      hit = shape.hitTest(_invPoint, _fillRule);
+
+    if (hit)
       return _result.append(obj);
   }
 
   if (_strokeSource.isPaintable())
   {
+    // Use the hit-index of the path to reject points far from the outline
+    // without stroking. Solid strokes having round joins and caps are decided
+    // by the distance only.
+    if (hitIndex != NULL)
+    {
+      float halfWidth = _strokeParams.getLineWidth() * 0.5f;
+      uint32_t lineJoin = _strokeParams.getLineJoin();
+
+      bool isRound = lineJoin == LINE_JOIN_ROUND &&
+                     _strokeParams.getStartCap() == LINE_CAP_ROUND &&
+                     _strokeParams.getEndCap() == LINE_CAP_ROUND &&
+                     _strokeParams.getDashList().isEmpty();
+
+      float extent = halfWidth;
+      if (!isRound)
+      {
+        float factor = float(MATH_SQRT_2);
+        if (lineJoin != LINE_JOIN_ROUND && lineJoin != LINE_JOIN_BEVEL)
+          factor = Math::max(factor, _strokeParams.getMiterLimit());
+        extent *= factor;
+      }
+
+      if (hitIndex->getDistance(_invPoint, extent) >= extent)
+        return ERR_OK;
+
+      if (isRound)
+        return _result.append(obj);
+    }
+
     PathStrokerF stroker(_strokeParams);
     _pathTmp.clear();
 
@@ -0,0 +1,1124 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Precompiled Headers]
+#if defined(FOG_PRECOMP)
+#include FOG_PRECOMP
+#endif // FOG_PRECOMP
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Global/Private.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemMgr.h>
+#include <Fog/Core/Memory/MemOps.h>
+#include <Fog/Core/Tools/Algorithm.h>
+#include <Fog/G2d/Tools/RTree.h>
+
+namespace Fog {
+
+// ============================================================================
+// [Fog::RTreeT - Helpers]
+// ============================================================================
+
+template<typename NumT>
+static FOG_INLINE bool RTreeT_isValidBox(const NumT_(Box)& box)
+{
+  // Also false if any coordinate is NaN.
+  return box.x0 <= box.x1 && box.y0 <= box.y1;
+}
+
+template<typename NumT>
+static FOG_INLINE bool RTreeT_isSameBox(const NumT_(Box)& a, const NumT_(Box)& b)
+{
+  return a.x0 == b.x0 && a.y0 == b.y0 && a.x1 == b.x1 && a.y1 == b.y1;
+}
+
+template<typename NumT>
+static FOG_INLINE bool RTreeT_subsumes(const NumT_(Box)& a, const NumT_(Box)& b)
+{
+  return a.x0 <= b.x0 && a.y0 <= b.y0 && a.x1 >= b.x1 && a.y1 >= b.y1;
+}
+
+template<typename NumT>
+static FOG_INLINE void RTreeT_unite(NumT_(Box)& dst, const NumT_(Box)& src)
+{
+  if (dst.x0 > src.x0) dst.x0 = src.x0;
+  if (dst.y0 > src.y0) dst.y0 = src.y0;
+  if (dst.x1 < src.x1) dst.x1 = src.x1;
+  if (dst.y1 < src.y1) dst.y1 = src.y1;
+}
+
+template<typename NumT>
+static FOG_INLINE NumT RTreeT_getArea(const NumT_(Box)& box)
+{
+  return (box.x1 - box.x0) * (box.y1 - box.y0);
+}
+
+template<typename NumT>
+static FOG_INLINE NumT RTreeT_getMargin(const NumT_(Box)& box)
+{
+  return (box.x1 - box.x0) + (box.y1 - box.y0);
+}
+
+template<typename NumT>
+static FOG_INLINE NumT RTreeT_getOverlap(const NumT_(Box)& a, const NumT_(Box)& b)
+{
+  NumT w = Math::min(a.x1, b.x1) - Math::max(a.x0, b.x0);
+  NumT h = Math::min(a.y1, b.y1) - Math::max(a.y0, b.y0);
+
+  if (w <= NumT(0) || h <= NumT(0))
+    return NumT(0);
+  return w * h;
+}
+
+//! @internal
+//!
+//! @brief Get the squared distance between the point and the box, zero if the
+//! box contains the point.
+template<typename NumT>
+static FOG_INLINE NumT RTreeT_getDistanceSquared(const NumT_(Box)& box, NumT px, NumT py)
+{
+  NumT dx = NumT(0);
+  NumT dy = NumT(0);
+
+  if (px < box.x0)
+    dx = box.x0 - px;
+  else if (px > box.x1)
+    dx = px - box.x1;
+
+  if (py < box.y0)
+    dy = box.y0 - py;
+  else if (py > box.y1)
+    dy = py - box.y1;
+
+  return dx * dx + dy * dy;
+}
+
+template<typename NumT>
+static FOG_INLINE void RTreeT_getNodeBox(const NumT_(RTreeNode)* node, NumT_(Box)& dst)
+{
+  uint32_t count = node->count;
+  FOG_ASSERT(count > 0);
+
+  dst = node->box[0];
+  for (uint32_t i = 1; i < count; i++)
+    RTreeT_unite<NumT>(dst, node->box[i]);
+}
+
+template<typename NumT>
+static FOG_INLINE uint32_t RTreeT_getChildIndex(const NumT_(RTreeNode)* parent, const NumT_(RTreeNode)* node)
+{
+  uint32_t i = 0;
+
+  while (parent->data[i] != node)
+  {
+    i++;
+    FOG_ASSERT(i < parent->count);
+  }
+
+  return i;
+}
+
+template<typename NumT>
+static FOG_INLINE NumT_(RTreeNode)* RTreeT_allocNode(NumT_(RTree)* self, uint32_t level)
+{
+  NumT_(RTreeNode)* node = reinterpret_cast<NumT_(RTreeNode)*>(
+    self->_nodePool.alloc(sizeof(NumT_(RTreeNode))));
+
+  if (FOG_IS_NULL(node))
+    return NULL;
+
+  node->parent = NULL;
+  node->level = level;
+  node->count = 0;
+  return node;
+}
+
+template<typename NumT>
+static FOG_INLINE void RTreeT_freeNode(NumT_(RTree)* self, NumT_(RTreeNode)* node)
+{
+  self->_nodePool.free(node);
+}
+
+template<typename NumT>
+static FOG_INLINE void RTreeT_append(NumT_(RTreeNode)* node, const NumT_(Box)& box, void* data)
+{
+  uint32_t i = node->count++;
+  FOG_ASSERT(i < RTREE_NODE_CAPACITY);
+
+  node->box[i] = box;
+  node->data[i] = data;
+
+  if (!node->isLeaf())
+    reinterpret_cast<NumT_(RTreeNode)*>(data)->parent = node;
+}
+
+template<typename NumT>
+static FOG_INLINE void RTreeT_removeAt(NumT_(RTreeNode)* node, uint32_t index)
+{
+  // The order of entries doesn't matter, move the last one to the hole.
+  uint32_t last = --node->count;
+
+  node->box[index] = node->box[last];
+  node->data[index] = node->data[last];
+}
+
+// ============================================================================
+// [Fog::RTreeT - Sort]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Sort of items by the center of their boxes (@c Axis is 0 for x and
+//! 1 for y), used by the bulk-loading.
+template<typename NumT, int Axis>
+struct RTreeT_SortItems
+{
+  FOG_INLINE int _compare(const void* _a, const void* _b) const
+  {
+    const NumT_(RTreeItem)* a = reinterpret_cast<const NumT_(RTreeItem)*>(_a);
+    const NumT_(RTreeItem)* b = reinterpret_cast<const NumT_(RTreeItem)*>(_b);
+
+    NumT ac = Axis == 0 ? a->box.x0 + a->box.x1 : a->box.y0 + a->box.y1;
+    NumT bc = Axis == 0 ? b->box.x0 + b->box.x1 : b->box.y0 + b->box.y1;
+
+    return (ac > bc) - (ac < bc);
+  }
+
+  FOG_INLINE void _swap(void* _a, void* _b)
+  {
+    NumT_(RTreeItem)* a = reinterpret_cast<NumT_(RTreeItem)*>(_a);
+    NumT_(RTreeItem)* b = reinterpret_cast<NumT_(RTreeItem)*>(_b);
+
+    NumT_(RTreeItem) t(*a);
+    *a = *b;
+    *b = t;
+  }
+
+  enum { _size = sizeof(NumT_(RTreeItem)) };
+};
+
+template<typename NumT, int Axis>
+static FOG_INLINE void RTreeT_sortItems(NumT_(RTreeItem)* items, size_t length)
+{
+  Algorithm::QSortImpl< RTreeT_SortItems<NumT, Axis> > context;
+  context._sort(reinterpret_cast<uint8_t*>(items), length);
+}
+
+// ============================================================================
+// [Fog::RTreeT - Construction / Destruction]
+// ============================================================================
+
+template<typename NumT>
+static void FOG_CDECL RTreeT_ctor(NumT_(RTree)* self)
+{
+  self->_root = NULL;
+  self->_length = 0;
+
+  fog_api.mempool_ctor(&self->_nodePool);
+}
+
+template<typename NumT>
+static void FOG_CDECL RTreeT_dtor(NumT_(RTree)* self)
+{
+  fog_api.mempool_dtor(&self->_nodePool);
+}
+
+// ============================================================================
+// [Fog::RTreeT - Accessors]
+// ============================================================================
+
+template<typename NumT>
+static err_t FOG_CDECL RTreeT_getBoundingBox(const NumT_(RTree)* self, NumT_(Box)* dst)
+{
+  if (self->_root == NULL || self->_root->count == 0)
+  {
+    dst->reset();
+    return ERR_GEOMETRY_NONE;
+  }
+
+  RTreeT_getNodeBox<NumT>(self->_root, *dst);
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RTreeT - Clear]
+// ============================================================================
+
+template<typename NumT>
+static void FOG_CDECL RTreeT_clear(NumT_(RTree)* self)
+{
+  self->_nodePool.reset();
+
+  self->_root = NULL;
+  self->_length = 0;
+}
+
+// ============================================================================
+// [Fog::RTreeT - Build]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Pack @a length items into nodes of @a level (sort-tile-recursive).
+//!
+//! The items are sorted by x and divided into vertical slices, each slice is
+//! sorted by y and divided into nodes. The entries are distributed evenly, so
+//! all nodes are filled almost fully. The items describing the created nodes
+//! are stored to the beginning of @a items and their count is returned (zero
+//! on failure).
+template<typename NumT>
+static size_t RTreeT_packLevel(NumT_(RTree)* self, NumT_(RTreeItem)* items, size_t length, uint32_t level)
+{
+  size_t nodeCount = (length + RTREE_NODE_CAPACITY - 1) / RTREE_NODE_CAPACITY;
+  size_t sliceCount = (size_t)Math::ceil(Math::sqrt(double(nodeCount)));
+  size_t sliceLength = (length + sliceCount - 1) / sliceCount;
+
+  RTreeT_sortItems<NumT, 0>(items, length);
+
+  size_t dstIndex = 0;
+  size_t sliceStart = 0;
+
+  while (sliceStart < length)
+  {
+    size_t sliceEnd = Math::min(sliceStart + sliceLength, length);
+    size_t sliceSize = sliceEnd - sliceStart;
+    size_t sliceNodes = (sliceSize + RTREE_NODE_CAPACITY - 1) / RTREE_NODE_CAPACITY;
+
+    RTreeT_sortItems<NumT, 1>(items + sliceStart, sliceSize);
+
+    for (size_t j = 0; j < sliceNodes; j++)
+    {
+      size_t i0 = sliceStart + (size_t)(uint64_t(sliceSize) * j / sliceNodes);
+      size_t i1 = sliceStart + (size_t)(uint64_t(sliceSize) * (j + 1) / sliceNodes);
+
+      NumT_(RTreeNode)* node = RTreeT_allocNode<NumT>(self, level);
+      if (FOG_IS_NULL(node))
+        return 0;
+
+      for (size_t i = i0; i < i1; i++)
+        RTreeT_append<NumT>(node, items[i].box, items[i].data);
+
+      // The node consumed at least one item, dstIndex never overtakes i0.
+      RTreeT_getNodeBox<NumT>(node, items[dstIndex].box);
+      items[dstIndex].data = node;
+      dstIndex++;
+    }
+
+    sliceStart = sliceEnd;
+  }
+
+  return dstIndex;
+}
+
+template<typename NumT>
+static err_t FOG_CDECL RTreeT_build(NumT_(RTree)* self, const NumT_(RTreeItem)* items, size_t length)
+{
+  RTreeT_clear<NumT>(self);
+
+  if (length == 0)
+    return ERR_OK;
+
+  size_t i;
+  for (i = 0; i < length; i++)
+  {
+    if (!RTreeT_isValidBox<NumT>(items[i].box))
+      return ERR_RT_INVALID_ARGUMENT;
+  }
+
+  NumT_(RTreeItem)* tmp = reinterpret_cast<NumT_(RTreeItem)*>(
+    MemMgr::alloc(length * sizeof(NumT_(RTreeItem))));
+
+  if (FOG_IS_NULL(tmp))
+    return ERR_RT_OUT_OF_MEMORY;
+
+  MemOps::copy(tmp, items, length * sizeof(NumT_(RTreeItem)));
+
+  uint32_t level = 0;
+  size_t count = length;
+
+  for (;;)
+  {
+    count = RTreeT_packLevel<NumT>(self, tmp, count, level);
+
+    if (count == 0)
+    {
+      MemMgr::free(tmp);
+      RTreeT_clear<NumT>(self);
+      return ERR_RT_OUT_OF_MEMORY;
+    }
+
+    if (count == 1)
+      break;
+
+    level++;
+  }
+
+  self->_root = reinterpret_cast<NumT_(RTreeNode)*>(tmp[0].data);
+  self->_length = length;
+
+  MemMgr::free(tmp);
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RTreeT - Insert]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Choose the child which needs the least enlargement to include the
+//! @a box, ties are resolved by the smaller area.
+template<typename NumT>
+static uint32_t RTreeT_chooseSubtree(const NumT_(RTreeNode)* node, const NumT_(Box)& box)
+{
+  uint32_t count = node->count;
+  uint32_t best = 0;
+
+  NumT bestEnlargement = Math::getPInfT<NumT>();
+  NumT bestArea = Math::getPInfT<NumT>();
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    const NumT_(Box)& b = node->box[i];
+
+    NumT area = RTreeT_getArea<NumT>(b);
+    NumT enlargement =
+      (Math::max(b.x1, box.x1) - Math::min(b.x0, box.x0)) *
+      (Math::max(b.y1, box.y1) - Math::min(b.y0, box.y0)) - area;
+
+    if (enlargement < bestEnlargement || (enlargement == bestEnlargement && area < bestArea))
+    {
+      best = i;
+      bestEnlargement = enlargement;
+      bestArea = area;
+    }
+  }
+
+  return best;
+}
+
+//! @internal
+//!
+//! @brief Split the full @a node and the extra entry into @a node and the
+//! empty @a sibling.
+//!
+//! The axis is chosen by the smallest sum of margins of all distributions
+//! and the distribution on that axis by the smallest overlap, then by the
+//! smallest area (R*-tree split).
+template<typename NumT>
+static void RTreeT_split(NumT_(RTreeNode)* node, NumT_(RTreeNode)* sibling, const NumT_(Box)& box, void* data)
+{
+  enum
+  {
+    COUNT = RTREE_NODE_CAPACITY + 1,
+    MINIMUM = RTREE_NODE_MINIMUM
+  };
+
+  NumT_(Box) boxes[COUNT];
+  void* datas[COUNT];
+
+  uint32_t i, k;
+
+  for (i = 0; i < RTREE_NODE_CAPACITY; i++)
+  {
+    boxes[i] = node->box[i];
+    datas[i] = node->data[i];
+  }
+
+  boxes[RTREE_NODE_CAPACITY] = box;
+  datas[RTREE_NODE_CAPACITY] = data;
+
+  uint8_t order[2][COUNT];
+  NumT_(Box) head[2][COUNT];
+  NumT_(Box) tail[2][COUNT];
+
+  uint32_t bestAxis = 0;
+  NumT bestMargin = Math::getPInfT<NumT>();
+
+  for (uint32_t axis = 0; axis < 2; axis++)
+  {
+    uint8_t* o = order[axis];
+    NumT keys[COUNT];
+
+    // Insertion sort by the center, there is only a few entries.
+    for (i = 0; i < COUNT; i++)
+    {
+      NumT key = axis == 0 ? boxes[i].x0 + boxes[i].x1 : boxes[i].y0 + boxes[i].y1;
+
+      for (k = i; k > 0 && keys[k - 1] > key; k--)
+      {
+        keys[k] = keys[k - 1];
+        o[k] = o[k - 1];
+      }
+
+      keys[k] = key;
+      o[k] = (uint8_t)i;
+    }
+
+    // Bounding boxes of the first (head) and the last (tail) entries.
+    head[axis][0] = boxes[o[0]];
+    for (i = 1; i < COUNT; i++)
+    {
+      head[axis][i] = head[axis][i - 1];
+      RTreeT_unite<NumT>(head[axis][i], boxes[o[i]]);
+    }
+
+    tail[axis][COUNT - 1] = boxes[o[COUNT - 1]];
+    for (i = COUNT - 1; i > 0; i--)
+    {
+      tail[axis][i - 1] = tail[axis][i];
+      RTreeT_unite<NumT>(tail[axis][i - 1], boxes[o[i - 1]]);
+    }
+
+    NumT margin = NumT(0);
+    for (k = MINIMUM; k <= COUNT - MINIMUM; k++)
+      margin += RTreeT_getMargin<NumT>(head[axis][k - 1]) + RTreeT_getMargin<NumT>(tail[axis][k]);
+
+    if (margin < bestMargin)
+    {
+      bestAxis = axis;
+      bestMargin = margin;
+    }
+  }
+
+  uint32_t bestSplit = MINIMUM;
+  NumT bestOverlap = Math::getPInfT<NumT>();
+  NumT bestArea = Math::getPInfT<NumT>();
+
+  for (k = MINIMUM; k <= COUNT - MINIMUM; k++)
+  {
+    const NumT_(Box)& a = head[bestAxis][k - 1];
+    const NumT_(Box)& b = tail[bestAxis][k];
+
+    NumT overlap = RTreeT_getOverlap<NumT>(a, b);
+    NumT area = RTreeT_getArea<NumT>(a) + RTreeT_getArea<NumT>(b);
+
+    if (overlap < bestOverlap || (overlap == bestOverlap && area < bestArea))
+    {
+      bestSplit = k;
+      bestOverlap = overlap;
+      bestArea = area;
+    }
+  }
+
+  const uint8_t* o = order[bestAxis];
+
+  node->count = 0;
+  for (i = 0; i < bestSplit; i++)
+    RTreeT_append<NumT>(node, boxes[o[i]], datas[o[i]]);
+
+  for (; i < COUNT; i++)
+    RTreeT_append<NumT>(sibling, boxes[o[i]], datas[o[i]]);
+}
+
+//! @internal
+//!
+//! @brief Insert an entry to a node at @a level, which is a leaf entry if
+//! @a level is zero or a subtree otherwise.
+template<typename NumT>
+static err_t RTreeT_insertAt(NumT_(RTree)* self, const NumT_(Box)& box, void* data, uint32_t level)
+{
+  NumT_(RTreeNode)* node = self->_root;
+
+  if (node == NULL)
+  {
+    node = RTreeT_allocNode<NumT>(self, level);
+    if (FOG_IS_NULL(node))
+      return ERR_RT_OUT_OF_MEMORY;
+
+    self->_root = node;
+  }
+
+  FOG_ASSERT(node->level >= level);
+
+  // Find the node to insert to.
+  while (node->level > level)
+  {
+    uint32_t i = RTreeT_chooseSubtree<NumT>(node, box);
+    node = node->getChild(i);
+  }
+
+  // Allocate the nodes needed to split the full nodes on the path first, so
+  // the tree is never left half-modified. The spare nodes are linked through
+  // their parent.
+  NumT_(RTreeNode)* spare = NULL;
+
+  {
+    NumT_(RTreeNode)* p = node;
+
+    while (p->count == RTREE_NODE_CAPACITY)
+    {
+      NumT_(RTreeNode)* n = RTreeT_allocNode<NumT>(self, 0);
+      if (FOG_IS_NULL(n))
+        goto _OutOfMemory;
+
+      n->parent = spare;
+      spare = n;
+
+      if (p->parent == NULL)
+      {
+        // The root is split too, a new root is needed.
+        n = RTreeT_allocNode<NumT>(self, 0);
+        if (FOG_IS_NULL(n))
+          goto _OutOfMemory;
+
+        n->parent = spare;
+        spare = n;
+        break;
+      }
+
+      p = p->parent;
+    }
+  }
+
+  // Enlarge the boxes on the path.
+  {
+    NumT_(RTreeNode)* p = node;
+
+    while (p->parent != NULL)
+    {
+      NumT_(RTreeNode)* parent = p->parent;
+      RTreeT_unite<NumT>(parent->box[RTreeT_getChildIndex<NumT>(parent, p)], box);
+      p = parent;
+    }
+  }
+
+  {
+    NumT_(Box) curBox(box);
+    void* curData = data;
+
+    for (;;)
+    {
+      if (node->count < RTREE_NODE_CAPACITY)
+      {
+        RTreeT_append<NumT>(node, curBox, curData);
+        break;
+      }
+
+      NumT_(RTreeNode)* sibling = spare;
+      spare = spare->parent;
+
+      sibling->parent = NULL;
+      sibling->level = node->level;
+      sibling->count = 0;
+
+      RTreeT_split<NumT>(node, sibling, curBox, curData);
+
+      NumT_(RTreeNode)* parent = node->parent;
+      if (parent == NULL)
+      {
+        NumT_(RTreeNode)* root = spare;
+        spare = spare->parent;
+
+        root->parent = NULL;
+        root->level = node->level + 1;
+        root->count = 0;
+
+        NumT_(Box) nodeBox(UNINITIALIZED);
+
+        RTreeT_getNodeBox<NumT>(node, nodeBox);
+        RTreeT_append<NumT>(root, nodeBox, node);
+
+        RTreeT_getNodeBox<NumT>(sibling, nodeBox);
+        RTreeT_append<NumT>(root, nodeBox, sibling);
+
+        self->_root = root;
+        break;
+      }
+
+      // The box of the split node shrunk, the sibling is inserted to the
+      // parent, which can be split too.
+      RTreeT_getNodeBox<NumT>(node, parent->box[RTreeT_getChildIndex<NumT>(parent, node)]);
+      RTreeT_getNodeBox<NumT>(sibling, curBox);
+
+      curData = sibling;
+      node = parent;
+    }
+  }
+
+  FOG_ASSERT(spare == NULL);
+  FOG_ASSERT(self->_root->level < RTREE_MAX_HEIGHT);
+  return ERR_OK;
+
+_OutOfMemory:
+  while (spare != NULL)
+  {
+    NumT_(RTreeNode)* next = spare->parent;
+    RTreeT_freeNode<NumT>(self, spare);
+    spare = next;
+  }
+
+  // Don't leave an empty root created above.
+  if (self->_root->count == 0)
+  {
+    RTreeT_freeNode<NumT>(self, self->_root);
+    self->_root = NULL;
+  }
+
+  return ERR_RT_OUT_OF_MEMORY;
+}
+
+template<typename NumT>
+static err_t FOG_CDECL RTreeT_insert(NumT_(RTree)* self, const NumT_(Box)* box, void* data)
+{
+  if (!RTreeT_isValidBox<NumT>(*box))
+    return ERR_RT_INVALID_ARGUMENT;
+
+  FOG_RETURN_ON_ERROR(RTreeT_insertAt<NumT>(self, *box, data, 0));
+
+  self->_length++;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RTreeT - Remove]
+// ============================================================================
+
+template<typename NumT>
+static bool RTreeT_findEntry(NumT_(RTreeNode)* node, const NumT_(Box)& box, void* data,
+  NumT_(RTreeNode)** dstNode, uint32_t* dstIndex)
+{
+  uint32_t count = node->count;
+  uint32_t i;
+
+  if (node->isLeaf())
+  {
+    for (i = 0; i < count; i++)
+    {
+      if (node->data[i] == data && RTreeT_isSameBox<NumT>(node->box[i], box))
+      {
+        *dstNode = node;
+        *dstIndex = i;
+        return true;
+      }
+    }
+  }
+  else
+  {
+    for (i = 0; i < count; i++)
+    {
+      if (RTreeT_subsumes<NumT>(node->box[i], box) &&
+          RTreeT_findEntry<NumT>(node->getChild(i), box, data, dstNode, dstIndex))
+      {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+template<typename NumT>
+static size_t RTreeT_countEntries(const NumT_(RTreeNode)* node)
+{
+  uint32_t count = node->count;
+
+  if (node->isLeaf())
+    return count;
+
+  size_t result = 0;
+  for (uint32_t i = 0; i < count; i++)
+    result += RTreeT_countEntries<NumT>(node->getChild(i));
+  return result;
+}
+
+//! @internal
+//!
+//! @brief Remove the entry at @a index of @a leaf and condense the tree.
+//!
+//! Nodes which drop under @c RTREE_NODE_MINIMUM entries are removed from the
+//! tree and their entries are inserted again at the same level, the boxes of
+//! the other nodes on the path are shrunk.
+template<typename NumT>
+static err_t RTreeT_removeEntry(NumT_(RTree)* self, NumT_(RTreeNode)* leaf, uint32_t index)
+{
+  RTreeT_removeAt<NumT>(leaf, index);
+  self->_length--;
+
+  // Orphaned nodes are linked through their parent, the last pushed node is
+  // the highest one.
+  NumT_(RTreeNode)* orphans = NULL;
+  NumT_(RTreeNode)* node = leaf;
+
+  while (node->parent != NULL)
+  {
+    NumT_(RTreeNode)* parent = node->parent;
+    uint32_t i = RTreeT_getChildIndex<NumT>(parent, node);
+
+    if (node->count < RTREE_NODE_MINIMUM)
+    {
+      RTreeT_removeAt<NumT>(parent, i);
+
+      node->parent = orphans;
+      orphans = node;
+    }
+    else
+    {
+      RTreeT_getNodeBox<NumT>(node, parent->box[i]);
+    }
+
+    node = parent;
+  }
+
+  err_t err = ERR_OK;
+
+  while (orphans != NULL)
+  {
+    NumT_(RTreeNode)* orphan = orphans;
+    orphans = orphans->parent;
+
+    // The root lost all children, reuse it at the level of the orphan.
+    NumT_(RTreeNode)* root = self->_root;
+    if (root != NULL && root->count == 0)
+      root->level = orphan->level;
+
+    uint32_t count = orphan->count;
+    for (uint32_t i = 0; i < count; i++)
+    {
+      err_t e = RTreeT_insertAt<NumT>(self, orphan->box[i], orphan->data[i], orphan->level);
+      if (FOG_IS_ERROR(e))
+        err = e;
+    }
+
+    RTreeT_freeNode<NumT>(self, orphan);
+  }
+
+  // Shorten the tree if the root has only one child.
+  node = self->_root;
+
+  if (node != NULL)
+  {
+    while (!node->isLeaf() && node->count == 1)
+    {
+      NumT_(RTreeNode)* child = node->getChild(0);
+
+      RTreeT_freeNode<NumT>(self, node);
+      child->parent = NULL;
+      node = child;
+    }
+
+    if (node->count == 0)
+    {
+      RTreeT_freeNode<NumT>(self, node);
+      node = NULL;
+    }
+
+    self->_root = node;
+  }
+
+  if (FOG_IS_ERROR(err))
+  {
+    // Some entries of the orphaned nodes were lost.
+    self->_length = self->_root != NULL ? RTreeT_countEntries<NumT>(self->_root) : 0;
+  }
+
+  return err;
+}
+
+template<typename NumT>
+static err_t FOG_CDECL RTreeT_remove(NumT_(RTree)* self, const NumT_(Box)* box, void* data)
+{
+  NumT_(RTreeNode)* leaf;
+  uint32_t index;
+
+  if (self->_root == NULL || !RTreeT_findEntry<NumT>(self->_root, *box, data, &leaf, &index))
+    return ERR_RT_OBJECT_NOT_FOUND;
+
+  return RTreeT_removeEntry<NumT>(self, leaf, index);
+}
+
+// ============================================================================
+// [Fog::RTreeT - Update]
+// ============================================================================
+
+template<typename NumT>
+static err_t FOG_CDECL RTreeT_update(NumT_(RTree)* self, const NumT_(Box)* oldBox, const NumT_(Box)* newBox, void* data)
+{
+  if (!RTreeT_isValidBox<NumT>(*newBox))
+    return ERR_RT_INVALID_ARGUMENT;
+
+  NumT_(RTreeNode)* leaf;
+  uint32_t index;
+
+  if (self->_root == NULL || !RTreeT_findEntry<NumT>(self->_root, *oldBox, data, &leaf, &index))
+    return ERR_RT_OBJECT_NOT_FOUND;
+
+  // The entry stays in its leaf if the box of the leaf covers the new box,
+  // the boxes of the leaf and its parents are only kept conservative.
+  NumT_(RTreeNode)* parent = leaf->parent;
+
+  if (parent == NULL || RTreeT_subsumes<NumT>(parent->box[RTreeT_getChildIndex<NumT>(parent, leaf)], *newBox))
+  {
+    leaf->box[index] = *newBox;
+    return ERR_OK;
+  }
+
+  FOG_RETURN_ON_ERROR(RTreeT_removeEntry<NumT>(self, leaf, index));
+  FOG_RETURN_ON_ERROR(RTreeT_insertAt<NumT>(self, *newBox, data, 0));
+
+  self->_length++;
+  return ERR_OK;
+}
+
+// ============================================================================
+// [Fog::RTreeT - Nearest]
+// ============================================================================
+
+template<typename NumT>
+struct RTreeT_NearestContext
+{
+  NumT px;
+  NumT py;
+
+  NumT_(RTreeItem)* dst;
+  size_t count;
+  size_t found;
+
+  //! @brief Squared distance which must be beaten, the distance of the last
+  //! entry found if @c found == @c count, the maximum distance otherwise.
+  NumT bound;
+};
+
+template<typename NumT>
+static void RTreeT_addNearest(RTreeT_NearestContext<NumT>& ctx, const NumT_(Box)& box, void* data, NumT d)
+{
+  NumT_(RTreeItem)* dst = ctx.dst;
+  size_t i;
+
+  if (ctx.found < ctx.count)
+    i = ctx.found++;
+  else
+    i = ctx.count - 1;
+
+  while (i > 0 && RTreeT_getDistanceSquared<NumT>(dst[i - 1].box, ctx.px, ctx.py) > d)
+  {
+    dst[i] = dst[i - 1];
+    i--;
+  }
+
+  dst[i].box = box;
+  dst[i].data = data;
+
+  if (ctx.found == ctx.count)
+    ctx.bound = RTreeT_getDistanceSquared<NumT>(dst[ctx.count - 1].box, ctx.px, ctx.py);
+}
+
+template<typename NumT>
+static void RTreeT_findNearestInNode(RTreeT_NearestContext<NumT>& ctx, const NumT_(RTreeNode)* node)
+{
+  uint32_t count = node->count;
+  uint32_t i;
+
+  if (node->isLeaf())
+  {
+    for (i = 0; i < count; i++)
+    {
+      NumT d = RTreeT_getDistanceSquared<NumT>(node->box[i], ctx.px, ctx.py);
+      if (d < ctx.bound)
+        RTreeT_addNearest<NumT>(ctx, node->box[i], node->data[i], d);
+    }
+    return;
+  }
+
+  // Visit the children in the order of their distance, the farther children
+  // are likely pruned by the bound found in the closer ones.
+  NumT dist[RTREE_NODE_CAPACITY];
+  uint8_t order[RTREE_NODE_CAPACITY];
+  uint32_t n = 0;
+
+  for (i = 0; i < count; i++)
+  {
+    NumT d = RTreeT_getDistanceSquared<NumT>(node->box[i], ctx.px, ctx.py);
+    if (!(d < ctx.bound))
+      continue;
+
+    uint32_t k;
+    for (k = n; k > 0 && dist[k - 1] > d; k--)
+    {
+      dist[k] = dist[k - 1];
+      order[k] = order[k - 1];
+    }
+
+    dist[k] = d;
+    order[k] = (uint8_t)i;
+    n++;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    if (!(dist[i] < ctx.bound))
+      break;
+
+    RTreeT_findNearestInNode<NumT>(ctx, node->getChild(order[i]));
+  }
+}
+
+template<typename NumT>
+static size_t FOG_CDECL RTreeT_findNearest(const NumT_(RTree)* self,
+  NumT_(RTreeItem)* dst, NumT* dstDistance, size_t count, const NumT_(Point)* pt, NumT maxDistance)
+{
+  if (self->_root == NULL || count == 0 || !(maxDistance > NumT(0)))
+    return 0;
+
+  RTreeT_NearestContext<NumT> ctx;
+  ctx.px = pt->x;
+  ctx.py = pt->y;
+  ctx.dst = dst;
+  ctx.count = count;
+  ctx.found = 0;
+  ctx.bound = maxDistance * maxDistance;
+
+  RTreeT_findNearestInNode<NumT>(ctx, self->_root);
+
+  if (dstDistance != NULL)
+  {
+    for (size_t i = 0; i < ctx.found; i++)
+      dstDistance[i] = Math::sqrt(RTreeT_getDistanceSquared<NumT>(dst[i].box, ctx.px, ctx.py));
+  }
+
+  return ctx.found;
+}
+
+// ============================================================================
+// [Fog::RTreeIteratorT - Query]
+// ============================================================================
+
+template<typename NumT, uint32_t QueryType>
+static FOG_INLINE bool RTreeIteratorT_match(const NumT_(Box)& box, const NumT_(Box)& q)
+{
+  if (QueryType == RTREE_QUERY_POINT)
+    return box.x0 <= q.x0 && q.x0 < box.x1 && box.y0 <= q.y0 && q.y0 < box.y1;
+  else
+    return box.x0 <= q.x1 && q.x0 <= box.x1 && box.y0 <= q.y1 && q.y0 <= box.y1;
+}
+
+//! @internal
+//!
+//! @brief Find the next matching entry starting at @a index of @a node.
+//!
+//! The predicate of nodes is the same as the predicate of entries. It's valid
+//! for both query types, because the box of a node covers its entries. The
+//! position in the parents is kept in the iterator stack, so no memory is
+//! needed.
+template<typename NumT, uint32_t QueryType>
+static bool RTreeIteratorT_advance(NumT_(RTreeIterator)* self, const NumT_(RTreeNode)* node, uint32_t index)
+{
+  const NumT_(Box)& q = self->_query;
+
+  for (;;)
+  {
+    uint32_t count = node->count;
+
+    if (node->isLeaf())
+    {
+      for (; index < count; index++)
+      {
+        if (RTreeIteratorT_match<NumT, QueryType>(node->box[index], q))
+        {
+          self->_node = node;
+          self->_index = index;
+          return true;
+        }
+      }
+    }
+    else
+    {
+      for (; index < count; index++)
+      {
+        if (RTreeIteratorT_match<NumT, QueryType>(node->box[index], q))
+          break;
+      }
+
+      if (index < count)
+      {
+        self->_stack[node->level] = (uint8_t)index;
+
+        node = node->getChild(index);
+        index = 0;
+        continue;
+      }
+    }
+
+    node = node->parent;
+    if (node == NULL)
+    {
+      self->_node = NULL;
+      self->_index = 0;
+      return false;
+    }
+
+    index = self->_stack[node->level] + 1;
+  }
+}
+
+template<typename NumT>
+static bool FOG_CDECL RTreeIteratorT_start(NumT_(RTreeIterator)* self,
+  const NumT_(RTree)* tree, const NumT_(Box)* box, uint32_t queryType)
+{
+  FOG_ASSERT(queryType < RTREE_QUERY_COUNT);
+
+  self->_tree = tree;
+  self->_node = NULL;
+  self->_index = 0;
+  self->_queryType = queryType;
+  self->_query = *box;
+
+  const NumT_(RTreeNode)* root = tree->_root;
+  if (root == NULL)
+    return false;
+
+  if (queryType == RTREE_QUERY_POINT)
+    return RTreeIteratorT_advance<NumT, RTREE_QUERY_POINT>(self, root, 0);
+  else
+    return RTreeIteratorT_advance<NumT, RTREE_QUERY_BOX>(self, root, 0);
+}
+
+template<typename NumT>
+static bool FOG_CDECL RTreeIteratorT_next(NumT_(RTreeIterator)* self)
+{
+  const NumT_(RTreeNode)* node = self->_node;
+  if (node == NULL)
+    return false;
+
+  if (self->_queryType == RTREE_QUERY_POINT)
+    return RTreeIteratorT_advance<NumT, RTREE_QUERY_POINT>(self, node, self->_index + 1);
+  else
+    return RTreeIteratorT_advance<NumT, RTREE_QUERY_BOX>(self, node, self->_index + 1);
+}
+
+// ============================================================================
+// [Init / Fini]
+// ============================================================================
+
+FOG_NO_EXPORT void RTree_init(void)
+{
+  fog_api.rtreef_ctor = RTreeT_ctor<float>;
+  fog_api.rtreef_dtor = RTreeT_dtor<float>;
+  fog_api.rtreef_getBoundingBox = RTreeT_getBoundingBox<float>;
+  fog_api.rtreef_clear = RTreeT_clear<float>;
+  fog_api.rtreef_build = RTreeT_build<float>;
+  fog_api.rtreef_insert = RTreeT_insert<float>;
+  fog_api.rtreef_remove = RTreeT_remove<float>;
+  fog_api.rtreef_update = RTreeT_update<float>;
+  fog_api.rtreef_findNearest = RTreeT_findNearest<float>;
+  fog_api.rtreeiteratorf_start = RTreeIteratorT_start<float>;
+  fog_api.rtreeiteratorf_next = RTreeIteratorT_next<float>;
+
+  fog_api.rtreed_ctor = RTreeT_ctor<double>;
+  fog_api.rtreed_dtor = RTreeT_dtor<double>;
+  fog_api.rtreed_getBoundingBox = RTreeT_getBoundingBox<double>;
+  fog_api.rtreed_clear = RTreeT_clear<double>;
+  fog_api.rtreed_build = RTreeT_build<double>;
+  fog_api.rtreed_insert = RTreeT_insert<double>;
+  fog_api.rtreed_remove = RTreeT_remove<double>;
+  fog_api.rtreed_update = RTreeT_update<double>;
+  fog_api.rtreed_findNearest = RTreeT_findNearest<double>;
+  fog_api.rtreeiteratord_start = RTreeIteratorT_start<double>;
+  fog_api.rtreeiteratord_next = RTreeIteratorT_next<double>;
+}
+
+} // Fog namespace
@@ -0,0 +1,569 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_TOOLS_RTREE_H
+#define _FOG_G2D_TOOLS_RTREE_H
+
+// [Dependencies]
+#include <Fog/Core/Global/Global.h>
+#include <Fog/Core/Math/Math.h>
+#include <Fog/Core/Memory/MemPool.h>
+#include <Fog/G2d/Geometry/Box.h>
+#include <Fog/G2d/Geometry/Point.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Tools
+//! @{
+
+// ============================================================================
+// [Fog::RTreeItemF]
+// ============================================================================
+
+//! @brief R-tree entry (float), a box and the user data associated with it.
+struct FOG_NO_EXPORT RTreeItemF
+{
+  BoxF box;
+  void* data;
+};
+
+// ============================================================================
+// [Fog::RTreeNodeF]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief R-tree node (float).
+//!
+//! Leaf nodes (level zero) contain the entries of the tree, the data of other
+//! nodes are their children.
+struct FOG_NO_EXPORT RTreeNodeF
+{
+  FOG_INLINE bool isLeaf() const { return level == 0; }
+  FOG_INLINE RTreeNodeF* getChild(size_t index) const { return reinterpret_cast<RTreeNodeF*>(data[index]); }
+
+  //! @brief Parent node, @c NULL for the root.
+  RTreeNodeF* parent;
+  //! @brief Level, zero for leaves.
+  uint32_t level;
+  //! @brief Count of entries.
+  uint32_t count;
+
+  //! @brief Boxes of entries or children.
+  BoxF box[RTREE_NODE_CAPACITY];
+  //! @brief User data of entries or children.
+  void* data[RTREE_NODE_CAPACITY];
+};
+
+// ============================================================================
+// [Fog::RTreeF]
+// ============================================================================
+
+//! @brief R-tree (float), a spatial index of boxes.
+//!
+//! The tree can be bulk-loaded by @c build() (sort-tile-recursive packing,
+//! the fastest way to index a static set of boxes and the best structure for
+//! queries) or maintained by @c insert(), @c remove() and @c update(). Each
+//! entry is identified by its box and user data, the same entry can't be
+//! inserted twice.
+//!
+//! Use @c RTreeIteratorF to find entries containing a point or intersecting
+//! a box and @c findNearest() to find the entries closest to a point.
+struct FOG_NO_EXPORT RTreeF
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RTreeF()
+  {
+    fog_api.rtreef_ctor(this);
+  }
+
+  FOG_INLINE ~RTreeF()
+  {
+    fog_api.rtreef_dtor(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE size_t getLength() const { return _length; }
+  FOG_INLINE bool isEmpty() const { return _length == 0; }
+
+  //! @brief Get the height of the tree (zero if the tree is empty).
+  FOG_INLINE uint32_t getHeight() const { return _root != NULL ? _root->level + 1 : 0; }
+  FOG_INLINE const RTreeNodeF* getRoot() const { return _root; }
+
+  //! @brief Get the bounding box of all entries.
+  FOG_INLINE err_t getBoundingBox(BoxF& dst) const
+  {
+    return fog_api.rtreef_getBoundingBox(this, &dst);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Clear / Build]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void clear()
+  {
+    fog_api.rtreef_clear(this);
+  }
+
+  //! @brief Replace the content of the tree by @a length @a items.
+  FOG_INLINE err_t build(const RTreeItemF* items, size_t length)
+  {
+    return fog_api.rtreef_build(this, items, length);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Insert / Remove / Update]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE err_t insert(const BoxF& box, void* data)
+  {
+    return fog_api.rtreef_insert(this, &box, data);
+  }
+
+  //! @brief Remove the entry of @a box and @a data, returns
+  //! @c ERR_RT_OBJECT_NOT_FOUND if there is no such entry.
+  FOG_INLINE err_t remove(const BoxF& box, void* data)
+  {
+    return fog_api.rtreef_remove(this, &box, data);
+  }
+
+  //! @brief Move the entry of @a oldBox and @a data to @a newBox.
+  //!
+  //! The entry stays in its leaf if the leaf covers the new box, which is the
+  //! common case of objects moving by small steps.
+  FOG_INLINE err_t update(const BoxF& oldBox, const BoxF& newBox, void* data)
+  {
+    return fog_api.rtreef_update(this, &oldBox, &newBox, data);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Nearest]
+  // --------------------------------------------------------------------------
+
+  //! @brief Find the entry closest to @a pt, returns @c false if the tree is
+  //! empty.
+  //!
+  //! The distance is measured to the box of the entry and it's zero if the
+  //! box contains the point.
+  FOG_INLINE bool findNearest(RTreeItemF& dst, const PointF& pt) const
+  {
+    return fog_api.rtreef_findNearest(this, &dst, NULL, 1, &pt, Math::getPInfF()) != 0;
+  }
+
+  //! @brief Find the entry closest to @a pt, closer than @a maxDistance.
+  FOG_INLINE bool findNearest(RTreeItemF& dst, float& dstDistance, const PointF& pt, float maxDistance) const
+  {
+    return fog_api.rtreef_findNearest(this, &dst, &dstDistance, 1, &pt, maxDistance) != 0;
+  }
+
+  //! @brief Find up to @a count entries closest to @a pt, closer than
+  //! @a maxDistance, sorted by the distance.
+  //!
+  //! Returns the count of entries found, @a dstDistance can be @c NULL.
+  FOG_INLINE size_t findNearest(RTreeItemF* dst, float* dstDistance, size_t count, const PointF& pt, float maxDistance) const
+  {
+    return fog_api.rtreef_findNearest(this, dst, dstDistance, count, &pt, maxDistance);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Root node, @c NULL if the tree is empty.
+  RTreeNodeF* _root;
+  //! @brief Count of entries.
+  size_t _length;
+  //! @brief Node allocator.
+  MemPool _nodePool;
+
+private:
+  FOG_NO_COPY(RTreeF)
+};
+
+// ============================================================================
+// [Fog::RTreeIteratorF]
+// ============================================================================
+
+//! @brief R-tree query iterator (float).
+//!
+//! The iterator doesn't allocate memory, it only holds the position in the
+//! tree. It's invalidated by any modification of the tree.
+//!
+//! @code
+//! for (RTreeIteratorF it(tree, pt); it.isValid(); it.next())
+//!   process(it.getData());
+//! @endcode
+struct FOG_NO_EXPORT RTreeIteratorF
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RTreeIteratorF() :
+    _tree(NULL),
+    _node(NULL),
+    _index(0),
+    _queryType(RTREE_QUERY_BOX)
+  {
+  }
+
+  //! @brief Create an iterator of entries containing the point @a pt.
+  FOG_INLINE RTreeIteratorF(const RTreeF& tree, const PointF& pt) { start(tree, pt); }
+
+  //! @brief Create an iterator of entries intersecting the box @a box.
+  FOG_INLINE RTreeIteratorF(const RTreeF& tree, const BoxF& box) { start(tree, box); }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE bool isValid() const
+  {
+    return _node != NULL;
+  }
+
+  FOG_INLINE const BoxF& getBox() const
+  {
+    FOG_ASSERT_X(isValid(),
+      "Fog::RTreeIteratorF::getBox() - Iterator is not valid.");
+
+    return _node->box[_index];
+  }
+
+  FOG_INLINE void* getData() const
+  {
+    FOG_ASSERT_X(isValid(),
+      "Fog::RTreeIteratorF::getData() - Iterator is not valid.");
+
+    return _node->data[_index];
+  }
+
+  // --------------------------------------------------------------------------
+  // [Start / Next]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE bool start(const RTreeF& tree, const PointF& pt)
+  {
+    BoxF box(pt.x, pt.y, pt.x, pt.y);
+    return fog_api.rtreeiteratorf_start(this, &tree, &box, RTREE_QUERY_POINT);
+  }
+
+  FOG_INLINE bool start(const RTreeF& tree, const BoxF& box)
+  {
+    return fog_api.rtreeiteratorf_start(this, &tree, &box, RTREE_QUERY_BOX);
+  }
+
+  FOG_INLINE bool next()
+  {
+    FOG_ASSERT_X(isValid(),
+      "Fog::RTreeIteratorF::next() - Iterator already at the end.");
+
+    return fog_api.rtreeiteratorf_next(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Tree.
+  const RTreeF* _tree;
+  //! @brief Current leaf, @c NULL if the iterator is at the end.
+  const RTreeNodeF* _node;
+  //! @brief Index of the current entry in @c _node.
+  uint32_t _index;
+  //! @brief Query type, see @c RTREE_QUERY.
+  uint32_t _queryType;
+  //! @brief Query box (a point is stored as a box of zero size).
+  BoxF _query;
+  //! @brief Index of the child visited at each level.
+  uint8_t _stack[RTREE_MAX_HEIGHT];
+};
+
+// ============================================================================
+// [Fog::RTreeItemD]
+// ============================================================================
+
+//! @brief R-tree entry (double), a box and the user data associated with it.
+struct FOG_NO_EXPORT RTreeItemD
+{
+  BoxD box;
+  void* data;
+};
+
+// ============================================================================
+// [Fog::RTreeNodeD]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief R-tree node (double).
+//!
+//! Leaf nodes (level zero) contain the entries of the tree, the data of other
+//! nodes are their children.
+struct FOG_NO_EXPORT RTreeNodeD
+{
+  FOG_INLINE bool isLeaf() const { return level == 0; }
+  FOG_INLINE RTreeNodeD* getChild(size_t index) const { return reinterpret_cast<RTreeNodeD*>(data[index]); }
+
+  //! @brief Parent node, @c NULL for the root.
+  RTreeNodeD* parent;
+  //! @brief Level, zero for leaves.
+  uint32_t level;
+  //! @brief Count of entries.
+  uint32_t count;
+
+  //! @brief Boxes of entries or children.
+  BoxD box[RTREE_NODE_CAPACITY];
+  //! @brief User data of entries or children.
+  void* data[RTREE_NODE_CAPACITY];
+};
+
+// ============================================================================
+// [Fog::RTreeD]
+// ============================================================================
+
+//! @brief R-tree (double).
+//!
+//! @sa RTreeF.
+struct FOG_NO_EXPORT RTreeD
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RTreeD()
+  {
+    fog_api.rtreed_ctor(this);
+  }
+
+  FOG_INLINE ~RTreeD()
+  {
+    fog_api.rtreed_dtor(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE size_t getLength() const { return _length; }
+  FOG_INLINE bool isEmpty() const { return _length == 0; }
+
+  //! @brief Get the height of the tree (zero if the tree is empty).
+  FOG_INLINE uint32_t getHeight() const { return _root != NULL ? _root->level + 1 : 0; }
+  FOG_INLINE const RTreeNodeD* getRoot() const { return _root; }
+
+  //! @brief Get the bounding box of all entries.
+  FOG_INLINE err_t getBoundingBox(BoxD& dst) const
+  {
+    return fog_api.rtreed_getBoundingBox(this, &dst);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Clear / Build]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void clear()
+  {
+    fog_api.rtreed_clear(this);
+  }
+
+  //! @brief Replace the content of the tree by @a length @a items.
+  FOG_INLINE err_t build(const RTreeItemD* items, size_t length)
+  {
+    return fog_api.rtreed_build(this, items, length);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Insert / Remove / Update]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE err_t insert(const BoxD& box, void* data)
+  {
+    return fog_api.rtreed_insert(this, &box, data);
+  }
+
+  //! @brief Remove the entry of @a box and @a data, returns
+  //! @c ERR_RT_OBJECT_NOT_FOUND if there is no such entry.
+  FOG_INLINE err_t remove(const BoxD& box, void* data)
+  {
+    return fog_api.rtreed_remove(this, &box, data);
+  }
+
+  //! @brief Move the entry of @a oldBox and @a data to @a newBox.
+  //!
+  //! The entry stays in its leaf if the leaf covers the new box, which is the
+  //! common case of objects moving by small steps.
+  FOG_INLINE err_t update(const BoxD& oldBox, const BoxD& newBox, void* data)
+  {
+    return fog_api.rtreed_update(this, &oldBox, &newBox, data);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Nearest]
+  // --------------------------------------------------------------------------
+
+  //! @brief Find the entry closest to @a pt, returns @c false if the tree is
+  //! empty.
+  //!
+  //! The distance is measured to the box of the entry and it's zero if the
+  //! box contains the point.
+  FOG_INLINE bool findNearest(RTreeItemD& dst, const PointD& pt) const
+  {
+    return fog_api.rtreed_findNearest(this, &dst, NULL, 1, &pt, Math::getPInfD()) != 0;
+  }
+
+  //! @brief Find the entry closest to @a pt, closer than @a maxDistance.
+  FOG_INLINE bool findNearest(RTreeItemD& dst, double& dstDistance, const PointD& pt, double maxDistance) const
+  {
+    return fog_api.rtreed_findNearest(this, &dst, &dstDistance, 1, &pt, maxDistance) != 0;
+  }
+
+  //! @brief Find up to @a count entries closest to @a pt, closer than
+  //! @a maxDistance, sorted by the distance.
+  //!
+  //! Returns the count of entries found, @a dstDistance can be @c NULL.
+  FOG_INLINE size_t findNearest(RTreeItemD* dst, double* dstDistance, size_t count, const PointD& pt, double maxDistance) const
+  {
+    return fog_api.rtreed_findNearest(this, dst, dstDistance, count, &pt, maxDistance);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Root node, @c NULL if the tree is empty.
+  RTreeNodeD* _root;
+  //! @brief Count of entries.
+  size_t _length;
+  //! @brief Node allocator.
+  MemPool _nodePool;
+
+private:
+  FOG_NO_COPY(RTreeD)
+};
+
+// ============================================================================
+// [Fog::RTreeIteratorD]
+// ============================================================================
+
+//! @brief R-tree query iterator (double).
+//!
+//! @sa RTreeIteratorF.
+struct FOG_NO_EXPORT RTreeIteratorD
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RTreeIteratorD() :
+    _tree(NULL),
+    _node(NULL),
+    _index(0),
+    _queryType(RTREE_QUERY_BOX)
+  {
+  }
+
+  //! @brief Create an iterator of entries containing the point @a pt.
+  FOG_INLINE RTreeIteratorD(const RTreeD& tree, const PointD& pt) { start(tree, pt); }
+
+  //! @brief Create an iterator of entries intersecting the box @a box.
+  FOG_INLINE RTreeIteratorD(const RTreeD& tree, const BoxD& box) { start(tree, box); }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE bool isValid() const
+  {
+    return _node != NULL;
+  }
+
+  FOG_INLINE const BoxD& getBox() const
+  {
+    FOG_ASSERT_X(isValid(),
+      "Fog::RTreeIteratorD::getBox() - Iterator is not valid.");
+
+    return _node->box[_index];
+  }
+
+  FOG_INLINE void* getData() const
+  {
+    FOG_ASSERT_X(isValid(),
+      "Fog::RTreeIteratorD::getData() - Iterator is not valid.");
+
+    return _node->data[_index];
+  }
+
+  // --------------------------------------------------------------------------
+  // [Start / Next]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE bool start(const RTreeD& tree, const PointD& pt)
+  {
+    BoxD box(pt.x, pt.y, pt.x, pt.y);
+    return fog_api.rtreeiteratord_start(this, &tree, &box, RTREE_QUERY_POINT);
+  }
+
+  FOG_INLINE bool start(const RTreeD& tree, const BoxD& box)
+  {
+    return fog_api.rtreeiteratord_start(this, &tree, &box, RTREE_QUERY_BOX);
+  }
+
+  FOG_INLINE bool next()
+  {
+    FOG_ASSERT_X(isValid(),
+      "Fog::RTreeIteratorD::next() - Iterator already at the end.");
+
+    return fog_api.rtreeiteratord_next(this);
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Tree.
+  const RTreeD* _tree;
+  //! @brief Current leaf, @c NULL if the iterator is at the end.
+  const RTreeNodeD* _node;
+  //! @brief Index of the current entry in @c _node.
+  uint32_t _index;
+  //! @brief Query type, see @c RTREE_QUERY.
+  uint32_t _queryType;
+  //! @brief Query box (a point is stored as a box of zero size).
+  BoxD _query;
+  //! @brief Index of the child visited at each level.
+  uint8_t _stack[RTREE_MAX_HEIGHT];
+};
+
+// ============================================================================
+// [Fog::RTreeT<> / Fog::RTreeItemT<> / Fog::RTreeIteratorT<>]
+// ============================================================================
+
+_FOG_NUM_T(RTree)
+_FOG_NUM_T(RTreeItem)
+_FOG_NUM_T(RTreeIterator)
+_FOG_NUM_T(RTreeNode)
+_FOG_NUM_F(RTree)
+_FOG_NUM_F(RTreeItem)
+_FOG_NUM_F(RTreeIterator)
+_FOG_NUM_F(RTreeNode)
+_FOG_NUM_D(RTree)
+_FOG_NUM_D(RTreeItem)
+_FOG_NUM_D(RTreeIterator)
+_FOG_NUM_D(RTreeNode)
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_TOOLS_RTREE_H
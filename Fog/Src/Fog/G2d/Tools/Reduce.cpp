@@ -10,11 +10,15 @@
 
 // [Dependencies]
 #include <Fog/Core/Acc/AccC.h>
+#include <Fog/Core/Memory/MemMgr.h>
 #include <Fog/Core/Memory/MemOps.h>
-#include <Fog/Core/Tools/Hash.h>
 #include <Fog/G2d/Imaging/Image.h>
 #include <Fog/G2d/Tools/Reduce_p.h>
 
+#if defined(FOG_HARDCODE_SSE2)
+# include <Fog/Core/Acc/AccSse2.h>
+#endif // FOG_HARDCODE_SSE2
+
 #include <stdlib.h>
 
 namespace Fog {
@@ -36,17 +40,75 @@ static int _Reduce_compareAscent(const void* _a, const void* _b)
     return 0;
 }
 
+// ============================================================================
+// [Fog::Reduce - Histogram]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Histogram of up to 256 colors.
+//!
+//! The entities are stored in the order in which they were found, the table
+//! is used to find the entity by its key.
+struct FOG_NO_EXPORT ReduceHistogram
+{
+  FOG_INLINE ReduceHistogram(Reduce::Entity* entities) :
+    entities(entities),
+    count(0)
+  {
+    MemOps::set(table, 0xFF, sizeof(table));
+  }
+
+  //! @brief Get entity of @a key, create it if it doesn't exist. Returns NULL
+  //! if the image contains more than 256 colors.
+  FOG_INLINE Reduce::Entity* get(uint32_t key)
+  {
+    uint32_t h = Reduce::getTableIndex(key);
+
+    for (;;)
+    {
+      uint32_t i = table[h];
+
+      if (i == Reduce::TABLE_EMPTY)
+        break;
+
+      if (entities[i].key == key)
+        return &entities[i];
+
+      h = (h + 1) & (Reduce::TABLE_SIZE - 1);
+    }
+
+    if (count == 256)
+      return NULL;
+
+    Reduce::Entity* e = &entities[count];
+    e->key = key;
+    e->usage = 0;
+
+    table[h] = (uint16_t)count++;
+    return e;
+  }
+
+  Reduce::Entity* entities;
+  uint32_t count;
+  uint16_t table[Reduce::TABLE_SIZE];
+};
+
 // ============================================================================
 // [Fog::Reduce - Construction / Destruction]
 // ============================================================================
 
-Reduce::Reduce()
+Reduce::Reduce() :
+  _cube(NULL),
+  _cubeBits(5)
 {
   reset();
 }
 
 Reduce::~Reduce()
 {
+  if (_cube != NULL)
+    MemMgr::free(_cube);
 }
 
 // ============================================================================
@@ -55,10 +117,17 @@ Reduce::~Reduce()
 
 void Reduce::reset()
 {
-  _indexes.clear();
+  if (_cube != NULL)
+  {
+    MemMgr::free(_cube);
+    _cube = NULL;
+  }
 
+  MemOps::set(_table, 0xFF, sizeof(_table));
   MemOps::zero(_entities, sizeof(_entities));
+
   _count = 0;
+  _mask = 0xFFFFFFFF;
 }
 
 // ============================================================================
@@ -94,6 +163,15 @@ bool Reduce::analyze(const Image& image, bool discardAlphaChannel)
       {
         for (x = 0; x < w; x++, p++) e[p[0]].usage++;
       }
+
+      // Remove unused entities.
+      for (i = 0; i < 256; i++)
+      {
+        if (e[i].usage != 0)
+          e[_count++] = e[i];
+      }
+
+      _mask = 0xFF;
       break;
     }
 
@@ -101,11 +179,32 @@ bool Reduce::analyze(const Image& image, bool discardAlphaChannel)
     case 24:
     case 32:
     {
-      Hash<uint32_t, uint64_t> hash;
+      ReduceHistogram hist(e);
 
       uint32_t mask = image.getFormatDescription().getUsedBits32();
       if (discardAlphaChannel) mask ^= image.getFormatDescription().getAMask32();
 
+      // Most images contain runs of the same color, so the last entity is
+      // checked before the table is used.
+      Entity* last = NULL;
+      uint32_t lastKey = 0;
+
+#define _FOG_REDUCE_ADD(_Key_) \
+      FOG_MACRO_BEGIN \
+        uint32_t _key = _Key_; \
+        \
+        if (last == NULL || _key != lastKey) \
+        { \
+          /* Finished, the color reduction isn't possible. */ \
+          last = hist.get(_key); \
+          if (last == NULL) \
+            return false; \
+          lastKey = _key; \
+        } \
+        \
+        last->usage++; \
+      FOG_MACRO_END
+
 #define _FOG_REDUCE_LOOP(_BytesPerPixel_, _Load_) \
       FOG_MACRO_BEGIN \
         for (y = 0; y < h; y++, p += stride) \
@@ -115,41 +214,81 @@ bool Reduce::analyze(const Image& image, bool discardAlphaChannel)
             uint32_t c; \
             _Load_(c, p); \
             Acc::p32And(c, c, mask); \
-            \
-            /* Increase the count of 'c' if it is already in the hash-table. */ \
-            if (hash.contains(c)) \
-              (*hash.usePtr(c))++; \
-            /* Create new node if sum of the created nodes is smaller than 256. */ \
-            else if (hash.getLength() < 256) \
-              if (FOG_IS_ERROR(hash.put(c, 1))) return false; \
-            /* Finished, the color reduction isn't possible. */ \
-            else \
-              return false; \
+            _FOG_REDUCE_ADD(c); \
           } \
         } \
       FOG_MACRO_END
 
       if (depth == 16)
+      {
         _FOG_REDUCE_LOOP(2, Acc::p32Load2a);
+      }
       else if (depth == 24)
+      {
         _FOG_REDUCE_LOOP(3, Acc::p32Load3b);
-      else if (depth == 32)
-        _FOG_REDUCE_LOOP(4, Acc::p32Load4a);
-
-      // If we are here, the color reduction is possible.
-      i = 0;
-
-      HashIterator<uint32_t, uint64_t> it(hash);
-      while (it.isValid())
+      }
+      else
       {
-        e[i].key   = it.getKey();
-        e[i].usage = it.getItem();
+#if defined(FOG_HARDCODE_SSE2)
+        __m128i xmmMask = _mm_set1_epi32((int)mask);
 
-        it.next();
+        for (y = 0; y < h; y++, p += stride)
+        {
+          x = w;
+
+          // Four pixels equal to the last color are counted at once.
+          while (x >= 4)
+          {
+            if (last != NULL)
+            {
+              __m128i xmm0;
+              int msk0;
+
+              Acc::m128iLoad16u(xmm0, p);
+              Acc::m128iAnd(xmm0, xmm0, xmmMask);
+              Acc::m128iCmpEqPI32(xmm0, xmm0, _mm_set1_epi32((int)lastKey));
+              Acc::m128iMoveMaskPI8(msk0, xmm0);
+
+              if (msk0 == 0xFFFF)
+              {
+                last->usage += 4;
+                p += 16;
+                x -= 4;
+                continue;
+              }
+            }
+
+            for (i = 0; i < 4; i++, p += 4)
+            {
+              uint32_t c;
+              Acc::p32Load4a(c, p);
+              Acc::p32And(c, c, mask);
+              _FOG_REDUCE_ADD(c);
+            }
+            x -= 4;
+          }
+
+          for (; x; x--, p += 4)
+          {
+            uint32_t c;
+            Acc::p32Load4a(c, p);
+            Acc::p32And(c, c, mask);
+            _FOG_REDUCE_ADD(c);
+          }
+        }
+#else
+        _FOG_REDUCE_LOOP(4, Acc::p32Load4a);
+#endif // FOG_HARDCODE_SSE2
       }
 
-      // The count of items in the hash table means the count of colors used.
-      _count = (uint32_t)hash.getLength();
+#undef _FOG_REDUCE_LOOP
+#undef _FOG_REDUCE_ADD
+
+      // If we are here, the color reduction is possible. The count of items
+      // in the histogram means the count of colors used.
+      _count = hist.count;
+      _mask = mask;
+      break;
     }
 
     default:
@@ -164,9 +303,48 @@ bool Reduce::analyze(const Image& image, bool discardAlphaChannel)
   if (_count == 2 && e[1].key == 0) MemOps::xchg_t<Entity>(&e[0], &e[1]);
 
   // Create a fast index table.
-  for (i = 0; i < (int)_count; i++)
   {
-    if (FOG_IS_ERROR(_indexes.put(e[i].key, i))) goto _Fail;
+    for (i = 0; i < (int)_count; i++)
+    {
+      uint32_t t = getTableIndex(e[i].key);
+
+      while (_table[t] != TABLE_EMPTY)
+        t = (t + 1) & (TABLE_SIZE - 1);
+      _table[t] = (uint16_t)i;
+    }
+
+    // Use the 15-bit cube, switch to the 18-bit one if too many colors share
+    // the same cell (these colors have to be found using the table).
+    for (_cubeBits = 5; ; _cubeBits++)
+    {
+      size_t cubeSize = (size_t)1 << (_cubeBits * 3);
+      uint32_t collisions = 0;
+
+      _cube = reinterpret_cast<uint8_t*>(MemMgr::alloc(cubeSize));
+      if (FOG_IS_NULL(_cube))
+        goto _Fail;
+
+      MemOps::zero(_cube, cubeSize);
+
+      // Entities are inserted in reverse order so the most used colors win.
+      // The cell is occupied if it refers to an already inserted entity (its
+      // index is greater than i) which maps to the same cell.
+      for (i = (int)_count - 1; i >= 0; i--)
+      {
+        uint32_t cubeIndex = getCubeIndex(e[i].key);
+        uint32_t old = _cube[cubeIndex];
+
+        if ((int)old > i && getCubeIndex(e[old].key) == cubeIndex)
+          collisions++;
+        _cube[cubeIndex] = (uint8_t)i;
+      }
+
+      if (_cubeBits == 6 || collisions <= _count / 16)
+        break;
+
+      MemMgr::free(_cube);
+      _cube = NULL;
+    }
   }
 
   // Build palette.
@@ -188,6 +366,7 @@ bool Reduce::analyze(const Image& image, bool discardAlphaChannel)
         }
         // ... Fall through ...
 
+      case IMAGE_FORMAT_XRGB32:
       case IMAGE_FORMAT_RGB24:
         for (uint32_t i = 0; i < _count; i++)
           pal[i] = _entities[i].key | 0xFF000000;
@@ -225,9 +404,22 @@ _Fail:
 // [Fog::Reduce - Translate]
 // ============================================================================
 
-uint32_t Reduce::traslate(uint32_t key) const
+uint32_t Reduce::traslateSlow(uint32_t key) const
 {
-  return _indexes.get(key, 255);
+  uint32_t t = getTableIndex(key);
+
+  for (;;)
+  {
+    uint32_t i = _table[t];
+
+    if (i == TABLE_EMPTY)
+      return 255;
+
+    if (_entities[i].key == key)
+      return i;
+
+    t = (t + 1) & (TABLE_SIZE - 1);
+  }
 }
 
 } // Fog namespace
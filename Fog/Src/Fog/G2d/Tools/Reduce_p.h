@@ -6,7 +6,6 @@
 #ifndef _FOG_G2D_TOOLS_REDUCE_P_H
 #define _FOG_G2D_TOOLS_REDUCE_P_H
 
-#include <Fog/Core/Tools/Hash.h>
 #include <Fog/G2d/Imaging/Image.h>
 
 namespace Fog {
@@ -29,6 +28,11 @@ namespace Fog {
 //! If count of colors is larger than 256, operation is stopped and count
 //! of colors is set to zero. Zero means "not able to reduce depth without
 //! quantization".
+//!
+//! Translation uses a direct-mapped RGB cube (15 or 18 bits, depending on how
+//! many colors share the same cell) which contains a candidate index verified
+//! against the entity key. Colors which share a cell, or differ only in alpha,
+//! are found in a small open-addressing table of all keys.
 struct FOG_NO_EXPORT Reduce
 {
   // --------------------------------------------------------------------------
@@ -51,11 +55,22 @@ struct FOG_NO_EXPORT Reduce
     uint64_t usage;
   };
 
+  // --------------------------------------------------------------------------
+  // [Constants]
+  // --------------------------------------------------------------------------
+
+  enum
+  {
+    //! @brief Size of the exact-match table (twice the maximum count of colors).
+    TABLE_SIZE = 512,
+    //! @brief Empty slot in the exact-match table.
+    TABLE_EMPTY = 0xFFFF
+  };
+
   // --------------------------------------------------------------------------
   // [Methods]
   // --------------------------------------------------------------------------
 
-  FOG_INLINE const Hash<uint32_t, uint8_t>& getIndexes() const { return _indexes; }
   FOG_INLINE const Entity* getEntities() const { return _entities; }
   FOG_INLINE const ImagePalette& getPalette() const { return _palette; }
 
@@ -65,15 +80,53 @@ struct FOG_NO_EXPORT Reduce
   void reset();
   bool analyze(const Image& image, bool discardAlphaChannel = false);
 
-  uint32_t traslate(uint32_t key) const;
+  //! @brief Get palette index of @a key (must be masked by @c getMask()) or
+  //! 255 if the key is not in the palette.
+  FOG_INLINE uint32_t traslate(uint32_t key) const
+  {
+    if (_cube != NULL)
+    {
+      uint32_t i = _cube[getCubeIndex(key)];
+      if (_entities[i].key == key && i < _count)
+        return i;
+    }
+
+    return traslateSlow(key);
+  }
+
+  uint32_t traslateSlow(uint32_t key) const;
+
+  // --------------------------------------------------------------------------
+  // [Helpers]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE uint32_t getCubeIndex(uint32_t key) const
+  {
+    uint32_t b = _cubeBits;
+    uint32_t m = (1U << b) - 1;
+
+    return (((key >> (24 - b)) & m) << (b * 2)) |
+           (((key >> (16 - b)) & m) << (b    )) |
+           (((key >> ( 8 - b)) & m)           ) ;
+  }
+
+  static FOG_INLINE uint32_t getTableIndex(uint32_t key)
+  {
+    return (key * 0x9E3779B1U) >> (32 - 9);
+  }
 
   // --------------------------------------------------------------------------
   // [Members]
   // --------------------------------------------------------------------------
 
 protected:
-  //! @brief Color to index hash.
-  Hash<uint32_t, uint8_t> _indexes;
+  //! @brief Direct-mapped RGB cube, contains index of the candidate entity.
+  uint8_t* _cube;
+  //! @brief Bits per component of @c _cube (5 or 6).
+  uint32_t _cubeBits;
+
+  //! @brief Exact-match table, entity index or @c TABLE_EMPTY.
+  uint16_t _table[TABLE_SIZE];
 
   //! @brief Entities.
   Entity _entities[256];
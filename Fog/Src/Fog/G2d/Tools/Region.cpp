@@ -10,14 +10,20 @@
 
 // [Dependencies]
 #include <Fog/Core/Global/Init_p.h>
+#include <Fog/Core/Global/Private.h>
 #include <Fog/Core/Math/Math.h>
 #include <Fog/Core/Memory/MemBufferTmp_p.h>
 #include <Fog/Core/Memory/MemMgr.h>
 #include <Fog/Core/OS/OSUtil.h>
 #include <Fog/Core/Tools/Cpu.h>
 #include <Fog/Core/Tools/Swap.h>
+#include <Fog/G2d/Geometry/Path.h>
+#include <Fog/G2d/Geometry/PathTmp_p.h>
+#include <Fog/G2d/Geometry/Transform.h>
+#include <Fog/G2d/Imaging/ImageBits.h>
 #include <Fog/G2d/Painting/Rasterizer_p.h>
 #include <Fog/G2d/Tools/Region.h>
+#include <Fog/G2d/Tools/RegionBuilder_p.h>
 #include <Fog/G2d/Tools/RegionTmp_p.h>
 #include <Fog/G2d/Tools/RegionUtil_p.h>
 
@@ -3229,6 +3235,252 @@ static bool FOG_CDECL Region_eq(const Region* a, const Region* b)
   return true;
 }
 
+// ============================================================================
+// [Fog::Region - FromMask]
+// ============================================================================
+
+static err_t FOG_CDECL Region_fromMask(Region* self, const ImageBits* mask, uint32_t threshold)
+{
+  if (mask->getFormat() != IMAGE_FORMAT_A8)
+    return ERR_IMAGE_INVALID_FORMAT;
+
+  int w = mask->getSize().w;
+  int h = mask->getSize().h;
+
+  if (threshold < 1)
+    threshold = 1;
+
+  if (w <= 0 || h <= 0 || threshold > 0xFF)
+  {
+    self->clear();
+    return ERR_OK;
+  }
+
+  RegionBuilder builder(self);
+  if (FOG_IS_ERROR(builder.begin(128)))
+    return builder.getError();
+
+  const uint8_t* row = mask->getData();
+  ssize_t stride = mask->getStride();
+
+  for (int y = 0; y < h; y++, row += stride)
+  {
+    builder.beginRow(y);
+
+    int x = 0;
+    for (;;)
+    {
+      while (x < w && row[x] < threshold)
+        x++;
+
+      if (x == w)
+        break;
+
+      int x0 = x;
+      while (x < w && row[x] >= threshold)
+        x++;
+
+      builder.addRun(x0, x);
+    }
+
+    builder.endRow();
+  }
+
+  return builder.end();
+}
+
+// ============================================================================
+// [Fog::Region - FromPath]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Filler used by @c Region_fromPathT(), converts spans produced by
+//! the rasterizer into region runs.
+struct FOG_NO_EXPORT RegionFromPathFiller8 : public RasterFiller
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RegionFromPathFiller8(RegionBuilder* builder, uint32_t threshold)
+  {
+    this->_prepare = (RasterFiller::PrepareFunc)prepareFn;
+    this->_process = (RasterFiller::ProcessFunc)processFn;
+    this->_skip = (RasterFiller::SkipFunc)skipFn;
+
+    this->builder = builder;
+    this->threshold = threshold;
+    this->y = 0;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Callbacks]
+  // --------------------------------------------------------------------------
+
+  static void FOG_FASTCALL prepareFn(RegionFromPathFiller8* self, int y)
+  {
+    self->y = y;
+  }
+
+  static void FOG_FASTCALL skipFn(RegionFromPathFiller8* self, int step)
+  {
+    self->y += step;
+  }
+
+  static void FOG_FASTCALL processFn(RegionFromPathFiller8* self, RasterSpan* _span)
+  {
+    RasterSpan8* span = reinterpret_cast<RasterSpan8*>(_span);
+    RegionBuilder* builder = self->builder;
+    uint32_t threshold = self->threshold;
+
+    builder->beginRow(self->y);
+
+    do {
+      int x0 = span->getX0();
+      int len = span->getLength();
+      uint8_t* m = reinterpret_cast<uint8_t*>(span->getGenericMask());
+
+      int i = 0;
+      int start;
+
+      switch (span->getType())
+      {
+        case RASTER_SPAN_C:
+          if (((0xFF * RasterSpan8::getConstMaskFromPointer(m)) >> 8) >= threshold)
+            builder->addRun(x0, x0 + len);
+          break;
+
+        case RASTER_SPAN_A8_GLYPH:
+        case RASTER_SPAN_AX_GLYPH:
+          while (i < len)
+          {
+            while (i < len && m[i] < threshold) i++;
+            if (i == len) break;
+
+            start = i;
+            while (i < len && m[i] >= threshold) i++;
+            builder->addRun(x0 + start, x0 + i);
+          }
+          break;
+
+        case RASTER_SPAN_AX_EXTRA:
+        {
+          const uint16_t* m16 = reinterpret_cast<const uint16_t*>(m);
+
+          while (i < len)
+          {
+            while (i < len && (uint32_t)((0xFF * m16[i]) >> 8) < threshold) i++;
+            if (i == len) break;
+
+            start = i;
+            while (i < len && (uint32_t)((0xFF * m16[i]) >> 8) >= threshold) i++;
+            builder->addRun(x0 + start, x0 + i);
+          }
+          break;
+        }
+      }
+
+      span = span->getNext();
+    } while (span);
+
+    builder->endRow();
+    self->y++;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  RegionBuilder* builder;
+  uint32_t threshold;
+  int y;
+};
+
+template<typename NumT>
+static err_t FOG_CDECL Region_fromPathT(Region* self, const NumT_(Path)* path, uint32_t fillRule, const NumT_(Transform)* tr, uint32_t threshold)
+{
+  if (fillRule >= FILL_RULE_COUNT)
+    return ERR_RT_INVALID_ARGUMENT;
+
+  if (threshold < 1)
+    threshold = 1;
+
+  if (path->isEmpty() || threshold > 0xFF)
+  {
+    self->clear();
+    return ERR_OK;
+  }
+
+  NumT_T1(PathTmp, 32) transformed;
+  if (tr != NULL && tr->getType() != TRANSFORM_TYPE_IDENTITY)
+  {
+    FOG_RETURN_ON_ERROR(tr->mapPath(transformed, *path));
+    path = &transformed;
+  }
+
+  NumT_(Box) boundingBox(UNINITIALIZED);
+  err_t err = path->getBoundingBox(boundingBox);
+
+  if (FOG_IS_ERROR(err))
+  {
+    self->clear();
+    return err == ERR_GEOMETRY_NONE ? (err_t)ERR_OK : err;
+  }
+
+  // Keep the scene-box in a range which is safe for the rasterizer.
+  NumT limit = NumT(1 << 21);
+
+  boundingBox.x0 = Math::bound<NumT>(boundingBox.x0, -limit, limit);
+  boundingBox.y0 = Math::bound<NumT>(boundingBox.y0, -limit, limit);
+  boundingBox.x1 = Math::bound<NumT>(boundingBox.x1, -limit, limit);
+  boundingBox.y1 = Math::bound<NumT>(boundingBox.y1, -limit, limit);
+
+  int x0 = (boundingBox.x0 >= NumT(0.0)) ? Math::ifloor(boundingBox.x0) : -Math::iceil(-boundingBox.x0);
+  int y0 = (boundingBox.y0 >= NumT(0.0)) ? Math::ifloor(boundingBox.y0) : -Math::iceil(-boundingBox.y0);
+
+  int x1 = (boundingBox.x1 >= NumT(0.0)) ? Math::iceil(boundingBox.x1) : -Math::ifloor(-boundingBox.x1);
+  int y1 = (boundingBox.y1 >= NumT(0.0)) ? Math::iceil(boundingBox.y1) : -Math::ifloor(-boundingBox.y1);
+
+  int w = x1 - x0;
+  int h = y1 - y0;
+
+  if (w <= 0 || h <= 0)
+  {
+    self->clear();
+    return ERR_OK;
+  }
+
+  PathRasterizer8 rasterizer;
+  RasterScanline8 scanline;
+
+  rasterizer.setSceneBox(BoxI(0, 0, w, h));
+  rasterizer.setFillRule(fillRule);
+  rasterizer.setOpacity(0x100);
+
+  FOG_RETURN_ON_ERROR(rasterizer.init());
+
+  rasterizer.addPath(*path, NumT_(Point)(NumT(-x0), NumT(-y0)));
+  rasterizer.finalize();
+
+  if (!rasterizer.isValid())
+  {
+    self->clear();
+    return rasterizer.getError();
+  }
+
+  RegionBuilder builder(self);
+  if (FOG_IS_ERROR(builder.begin(128)))
+    return builder.getError();
+
+  builder.setOffset(PointI(x0, y0));
+
+  RegionFromPathFiller8 filler(&builder, threshold);
+  rasterizer.render(&filler, &scanline);
+
+  return builder.end();
+}
+
 // ============================================================================
 // [Fog::Region - RegionData]
 // ============================================================================
@@ -3444,6 +3696,10 @@ FOG_NO_EXPORT void Region_init(void)
   fog_api.region_hitTestRect = Region_hitTestRect;
   fog_api.region_eq = Region_eq;
 
+  fog_api.region_fromMask = Region_fromMask;
+  fog_api.region_fromPathF = Region_fromPathT<float>;
+  fog_api.region_fromPathD = Region_fromPathT<double>;
+
   fog_api.region_dCreate = Region_dCreate;
   fog_api.region_dCreateBox = Region_dCreateBox;
   fog_api.region_dCreateRegion = Region_dCreateRegion;
@@ -362,6 +362,44 @@ struct FOG_NO_EXPORT Region
     return fog_api.region_intersectAndClip(this, this, &region, &clipBox);
   }
 
+  // --------------------------------------------------------------------------
+  // [FromMask / FromPath]
+  // --------------------------------------------------------------------------
+
+  //! @brief Create region from the A8 @a mask, pixels having alpha greater or
+  //! equal to @a threshold are included.
+  //!
+  //! Scanlines containing the same runs are merged into a single band.
+  FOG_INLINE err_t fromMask(const ImageBits& mask, uint32_t threshold = 0x80)
+  {
+    return fog_api.region_fromMask(this, &mask, threshold);
+  }
+
+  //! @brief Create region from the rasterized @a path, pixels having coverage
+  //! greater or equal to @a threshold are included.
+  FOG_INLINE err_t fromPath(const PathF& path, uint32_t fillRule, uint32_t threshold = 0x80)
+  {
+    return fog_api.region_fromPathF(this, &path, fillRule, NULL, threshold);
+  }
+
+  //! @overload
+  FOG_INLINE err_t fromPath(const PathF& path, uint32_t fillRule, const TransformF& tr, uint32_t threshold = 0x80)
+  {
+    return fog_api.region_fromPathF(this, &path, fillRule, &tr, threshold);
+  }
+
+  //! @overload
+  FOG_INLINE err_t fromPath(const PathD& path, uint32_t fillRule, uint32_t threshold = 0x80)
+  {
+    return fog_api.region_fromPathD(this, &path, fillRule, NULL, threshold);
+  }
+
+  //! @overload
+  FOG_INLINE err_t fromPath(const PathD& path, uint32_t fillRule, const TransformD& tr, uint32_t threshold = 0x80)
+  {
+    return fog_api.region_fromPathD(this, &path, fillRule, &tr, threshold);
+  }
+
   // --------------------------------------------------------------------------
   // [BoundingBox]
   // --------------------------------------------------------------------------
@@ -0,0 +1,218 @@
+// [Fog-G2d]
+//
+// [License]
+// MIT, See COPYING file in package
+
+// [Guard]
+#ifndef _FOG_G2D_TOOLS_REGIONBUILDER_P_H
+#define _FOG_G2D_TOOLS_REGIONBUILDER_P_H
+
+// [Dependencies]
+#include <Fog/G2d/Tools/Region.h>
+
+namespace Fog {
+
+//! @addtogroup Fog_G2d_Tools
+//! @{
+
+// ============================================================================
+// [Fog::RegionBuilder]
+// ============================================================================
+
+//! @internal
+//!
+//! @brief Region builder, used to create a region from scanlines.
+//!
+//! The scanlines must be added from top to bottom and the runs of each
+//! scanline from left to right. Consecutive scanlines which contain the same
+//! runs are merged into a single band, so the result is a valid YX sorted
+//! region.
+struct FOG_NO_EXPORT RegionBuilder
+{
+  // --------------------------------------------------------------------------
+  // [Construction / Destruction]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE RegionBuilder(Region* dst) :
+    _dst(dst),
+    _data(NULL),
+    _length(0),
+    _capacity(0),
+    _prevBand(INVALID_INDEX),
+    _curBand(0),
+    _x0(INT_MAX),
+    _x1(INT_MIN),
+    _y(0),
+    _offset(0, 0),
+    _error(ERR_OK)
+  {
+  }
+
+  // --------------------------------------------------------------------------
+  // [Accessors]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE err_t getError() const { return _error; }
+
+  //! @brief Set the offset added to all runs and scanlines.
+  FOG_INLINE void setOffset(const PointI& offset) { _offset = offset; }
+
+  // --------------------------------------------------------------------------
+  // [Begin / End]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE err_t begin(size_t capacity)
+  {
+    _error = _dst->prepare(capacity);
+    if (FOG_IS_ERROR(_error))
+      return _error;
+
+    _data = _dst->_d->data;
+    _capacity = _dst->_d->capacity;
+    return ERR_OK;
+  }
+
+  FOG_INLINE err_t end()
+  {
+    if (FOG_IS_ERROR(_error))
+    {
+      _dst->clear();
+      return _error;
+    }
+
+    RegionData* d = _dst->_d;
+    d->length = _length;
+
+    if (_length == 0)
+      d->boundingBox.reset();
+    else
+      d->boundingBox.setBox(_x0, _data[0].y0, _x1, _data[_length - 1].y1);
+
+    return ERR_OK;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Row]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE void beginRow(int y)
+  {
+    _y = y + _offset.y;
+    _curBand = _length;
+  }
+
+  //! @brief Add a run [x0, x1) to the current scanline, a run which touches
+  //! the previous one is joined with it.
+  FOG_INLINE void addRun(int x0, int x1)
+  {
+    FOG_ASSERT(x0 < x1);
+
+    x0 += _offset.x;
+    x1 += _offset.x;
+
+    if (_length != _curBand && _data[_length - 1].x1 == x0)
+    {
+      _data[_length - 1].x1 = x1;
+      return;
+    }
+
+    if (FOG_UNLIKELY(_length == _capacity) && !_grow())
+      return;
+
+    _data[_length++].setBox(x0, _y, x1, _y + 1);
+  }
+
+  FOG_INLINE void endRow()
+  {
+    size_t count = _length - _curBand;
+    if (count == 0)
+      return;
+
+    BoxI* cur = _data + _curBand;
+
+    if (cur[0].x0 < _x0) _x0 = cur[0].x0;
+    if (cur[count - 1].x1 > _x1) _x1 = cur[count - 1].x1;
+
+    // Merge with the previous band if it's adjacent and contains the same runs.
+    if (_prevBand != INVALID_INDEX && _curBand - _prevBand == count && _data[_prevBand].y1 == _y)
+    {
+      BoxI* prev = _data + _prevBand;
+      size_t i;
+
+      for (i = 0; i < count; i++)
+      {
+        if (prev[i].x0 != cur[i].x0 || prev[i].x1 != cur[i].x1)
+          goto _NewBand;
+      }
+
+      for (i = 0; i < count; i++)
+        prev[i].y1 = _y + 1;
+
+      _length = _curBand;
+      return;
+    }
+
+_NewBand:
+    _prevBand = _curBand;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Helpers]
+  // --------------------------------------------------------------------------
+
+  FOG_INLINE bool _grow()
+  {
+    if (FOG_IS_ERROR(_error))
+      return false;
+
+    size_t capacity = _capacity < 64 ? size_t(128) : _capacity * 2;
+    _dst->_d->length = _length;
+
+    _error = _dst->reserve(capacity);
+    if (FOG_IS_ERROR(_error))
+      return false;
+
+    _data = _dst->_d->data;
+    _capacity = _dst->_d->capacity;
+    return true;
+  }
+
+  // --------------------------------------------------------------------------
+  // [Members]
+  // --------------------------------------------------------------------------
+
+  //! @brief Destination region.
+  Region* _dst;
+  //! @brief Destination boxes (owned by @c _dst).
+  BoxI* _data;
+
+  //! @brief Count of boxes.
+  size_t _length;
+  //! @brief Capacity of @c _data.
+  size_t _capacity;
+
+  //! @brief Index of the first box of the previous band.
+  size_t _prevBand;
+  //! @brief Index of the first box of the current scanline.
+  size_t _curBand;
+
+  //! @brief Bounding box - left.
+  int _x0;
+  //! @brief Bounding box - right.
+  int _x1;
+  //! @brief Current scanline.
+  int _y;
+
+  //! @brief Offset added to all runs and scanlines.
+  PointI _offset;
+
+  //! @brief Error (out of memory).
+  err_t _error;
+};
+
+//! @}
+
+} // Fog namespace
+
+// [Guard]
+#endif // _FOG_G2D_TOOLS_REGIONBUILDER_P_H
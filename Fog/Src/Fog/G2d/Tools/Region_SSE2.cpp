@@ -9,6 +9,7 @@
 #endif // FOG_PRECOMP
 
 // [Dependencies]
+#include <Fog/Core/Acc/AccC.h>
 #include <Fog/Core/Acc/AccSse2.h>
 #include <Fog/Core/Global/Init_p.h>
 #include <Fog/Core/Math/Math.h>
@@ -16,8 +17,10 @@
 #include <Fog/Core/Memory/MemMgr.h>
 #include <Fog/Core/OS/OSUtil.h>
 #include <Fog/Core/Tools/Cpu.h>
+#include <Fog/G2d/Imaging/ImageBits.h>
 #include <Fog/G2d/Painting/Rasterizer_p.h>
 #include <Fog/G2d/Tools/Region.h>
+#include <Fog/G2d/Tools/RegionBuilder_p.h>
 #include <Fog/G2d/Tools/RegionTmp_p.h>
 #include <Fog/G2d/Tools/RegionUtil_p.h>
 
@@ -278,6 +281,125 @@ static bool FOG_CDECL Region_eq_SSE2(const Region* a, const Region* b)
   return mask == 0xFFFF;
 }
 
+// ============================================================================
+// [Fog::Region - FromMask (SSE2)]
+// ============================================================================
+
+static err_t FOG_CDECL Region_fromMask_SSE2(Region* self, const ImageBits* mask, uint32_t threshold)
+{
+  if (mask->getFormat() != IMAGE_FORMAT_A8)
+    return ERR_IMAGE_INVALID_FORMAT;
+
+  int w = mask->getSize().w;
+  int h = mask->getSize().h;
+
+  if (threshold < 1)
+    threshold = 1;
+
+  if (w <= 0 || h <= 0 || threshold > 0xFF)
+  {
+    self->clear();
+    return ERR_OK;
+  }
+
+  RegionBuilder builder(self);
+  if (FOG_IS_ERROR(builder.begin(128)))
+    return builder.getError();
+
+  const uint8_t* row = mask->getData();
+  ssize_t stride = mask->getStride();
+
+  __m128i xmm_t;
+  Acc::m128iCvtSI128FromSI(xmm_t, (int)threshold);
+  Acc::m128iExtendPI8FromSI8(xmm_t, xmm_t);
+
+  for (int y = 0; y < h; y++, row += stride)
+  {
+    builder.beginRow(y);
+
+    // Start of the current run or -1 if outside of a run.
+    int start = -1;
+    int x = 0;
+
+    // Each byte is compared with the threshold (max(a, t) == a means a >= t)
+    // and the result is converted to 16-bit mask. Blocks which are fully
+    // inside or outside of the run are skipped, the others are walked bit
+    // by bit.
+    while (x + 16 <= w)
+    {
+      __m128i xmm0, xmm1;
+      int msk;
+
+      Acc::m128iLoad16u(xmm0, row + x);
+      Acc::m128iMaxPU8(xmm1, xmm0, xmm_t);
+      Acc::m128iCmpEqPI8(xmm1, xmm1, xmm0);
+      Acc::m128iMoveMaskPI8(msk, xmm1);
+
+      if (msk == 0x0000)
+      {
+        if (start >= 0)
+        {
+          builder.addRun(start, x);
+          start = -1;
+        }
+      }
+      else if (msk == 0xFFFF)
+      {
+        if (start < 0)
+          start = x;
+      }
+      else
+      {
+        uint32_t bits = (uint32_t)msk;
+        uint32_t pos = 0;
+        uint32_t i;
+
+        for (;;)
+        {
+          uint32_t m = (start < 0 ? bits : ~bits & 0xFFFF) >> pos;
+          if (!Acc::p32CTZ(i, m))
+            break;
+
+          pos += i;
+          if (start < 0)
+          {
+            start = x + (int)pos;
+          }
+          else
+          {
+            builder.addRun(start, x + (int)pos);
+            start = -1;
+          }
+        }
+      }
+
+      x += 16;
+    }
+
+    while (x < w)
+    {
+      if (row[x] >= threshold)
+      {
+        if (start < 0)
+          start = x;
+      }
+      else if (start >= 0)
+      {
+        builder.addRun(start, x);
+        start = -1;
+      }
+      x++;
+    }
+
+    if (start >= 0)
+      builder.addRun(start, w);
+
+    builder.endRow();
+  }
+
+  return builder.end();
+}
+
 // ============================================================================
 // [Init / Fini]
 // ============================================================================
@@ -290,6 +412,7 @@ FOG_NO_EXPORT void Region_init_SSE2(void)
 
   fog_api.region_translate = Region_translate_SSE2;
   fog_api.region_eq = Region_eq_SSE2;
+  fog_api.region_fromMask = Region_fromMask_SSE2;
 }
 
 } // Fog namespace
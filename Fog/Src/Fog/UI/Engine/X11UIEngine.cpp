@@ -126,6 +126,20 @@ static const char X11UIEngine_XExtSymbolNames[] =
   "XShmPutImage\0"
 };
 
+// X11-xcb symbols.
+static const char X11UIEngine_XcbSymbolNames[] =
+{
+  "XGetXCBConnection\0"
+};
+
+// Xcb-shm symbols.
+static const char X11UIEngine_XcbShmSymbolNames[] =
+{
+  "xcb_generate_id\0"
+  "xcb_shm_attach_fd_checked\0"
+  "xcb_request_check\0"
+};
+
 // Xrender symbols.
 static const char X11UIEngine_XRenderSymbolNames[] =
 {
@@ -479,6 +493,7 @@ X11UIEngine::X11UIEngine() :
   _xim(0),
   _numButtons(0),
   _xShm(false),
+  _xShmFd(false),
   _xPrivateColorMap(false),
   _xForcePixmap(true),
   _xDontLogUnsupportedBpp(false),
@@ -494,6 +509,7 @@ X11UIEngine::X11UIEngine() :
   MemOps::zero(&_XLib   , sizeof(_XLib));
   MemOps::zero(&_XExt   , sizeof(_XExt));
   MemOps::zero(&_XRender, sizeof(_XRender));
+  MemOps::zero(&_XcbShm , sizeof(_XcbShm));
 
   if (openXlib() != ERR_OK)
     return;
@@ -531,7 +547,8 @@ err_t X11UIEngine::openXlib()
 
   const size_t numXLibSymbols = sizeof(X11UIEngineXLibAPI) / sizeof(void*);
   const size_t numXExtSymbols = sizeof(X11UIEngineXExtAPI) / sizeof(void*);
-  const size_t numXRenderSymbols = sizeof(X11UIEngineXRenderAPI) / sizeof(void*);  
+  const size_t numXRenderSymbols = sizeof(X11UIEngineXRenderAPI) / sizeof(void*);
+  const size_t numXcbShmSymbols = sizeof(X11UIEngineXcbShmAPI) / sizeof(void*) - 1;
 
   // Load X11.
   FOG_RETURN_ON_ERROR(name.set(Ascii8("X11")));
@@ -577,6 +594,35 @@ err_t X11UIEngine::openXlib()
     _XRenderLibrary.close();
   }
 
+  // Load X11-xcb and Xcb-shm (XSHM segments attached by file descriptor).
+  name.set(Ascii8("X11-xcb"));
+  if (_XcbLibrary.openLibrary(name) != ERR_OK)
+  {
+    Logger::debug("Fog::X11UIEngine", "openXlib", "Failed to open X11-xcb library.");
+  }
+  else if (_XcbLibrary.getSymbols(reinterpret_cast<void**>(&_XcbShm._XGetXCBConnection),
+    X11UIEngine_XcbSymbolNames, FOG_ARRAY_SIZE(X11UIEngine_XcbSymbolNames),
+    1, &badSymbol) != 1)
+  {
+    Logger::debug("Fog::X11UIEngine", "openXlib", "Failed to load X11-xcb symbol %s.", badSymbol);
+    _XcbLibrary.close();
+  }
+  else
+  {
+    name.set(Ascii8("xcb-shm"));
+    if (_XcbShmLibrary.openLibrary(name) != ERR_OK)
+    {
+      Logger::debug("Fog::X11UIEngine", "openXlib", "Failed to open xcb-shm library.");
+    }
+    else if (_XcbShmLibrary.getSymbols(reinterpret_cast<void**>(&_XcbShm._xcb_generate_id),
+      X11UIEngine_XcbShmSymbolNames, FOG_ARRAY_SIZE(X11UIEngine_XcbShmSymbolNames),
+      numXcbShmSymbols, &badSymbol) != numXcbShmSymbols)
+    {
+      Logger::debug("Fog::X11UIEngine", "openXlib", "Failed to load xcb-shm symbol %s.", badSymbol);
+      _XcbShmLibrary.close();
+    }
+  }
+
   // Setup locale.
   if (!_XLib._XSupportsLocale())
   {
@@ -618,6 +664,7 @@ err_t X11UIEngine::openDisplay()
   _gc = _XLib._XCreateGC(_display, _root, 0, NULL);
 
   _xShm = false;
+  _xShmFd = false;
   _xPrivateColorMap = false;
 
   // Create wakeup pipe.
@@ -638,6 +685,7 @@ err_t X11UIEngine::openDisplay()
 
   // Get whether the X-SHM pixmap extension is supported.
   _xShm = _XExtLibrary.isOpen();
+  _xShmFd = _xShm && _XcbShmLibrary.isOpen();
   return ERR_OK;
 
 _Fail:
@@ -1015,6 +1063,7 @@ void X11UIEngine::doBlitWindow(UIEngineWindow* window)
     }
 
     case UI_ENGINE_BUFFER_X11_XSHMIMAGE:
+    case UI_ENGINE_BUFFER_X11_XSHMFDIMAGE:
     {
       _XExt._XShmPutImage(_display, wnd, gc, d->_ximage, 0, 0, 0, 0, cw, ch, false);
       break;
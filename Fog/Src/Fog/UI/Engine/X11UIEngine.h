@@ -285,6 +285,31 @@ struct FOG_NO_EXPORT X11UIEngineXRenderAPI
   Cursor (FOG_CDECL *_XRenderCreateCursor)(XDisplay* display, XPicture source, unsigned int x, unsigned int y);
 };
 
+// ============================================================================
+// [Fog::X11UIEngineXcbShmAPI]
+// ============================================================================
+
+//! @brief XCB void cookie (binary compatible to @c xcb_void_cookie_t).
+struct FOG_NO_EXPORT X11XcbVoidCookie
+{
+  unsigned int sequence;
+};
+
+//! @brief Subset of libX11-xcb and libxcb-shm API used to attach the XSHM
+//! segment by file descriptor (MIT-SHM 1.2).
+//!
+//! XCB headers are not required, the connection is an opaque pointer.
+struct FOG_NO_EXPORT X11UIEngineXcbShmAPI
+{
+  // libX11-xcb.
+  void* (FOG_CDECL *_XGetXCBConnection)(XDisplay* display);
+
+  // libxcb-shm (and libxcb it depends on).
+  uint32_t (FOG_CDECL *_xcb_generate_id)(void* connection);
+  X11XcbVoidCookie (FOG_CDECL *_xcb_shm_attach_fd_checked)(void* connection, uint32_t shmseg, int32_t fd, uint8_t readOnly);
+  void* (FOG_CDECL *_xcb_request_check)(void* connection, X11XcbVoidCookie cookie);
+};
+
 // ============================================================================
 // [Fog::X11UIEngine]
 // ============================================================================
@@ -418,6 +443,9 @@ struct FOG_UI_X11_API X11UIEngine : public UIEngine
 
   //! @brief Whether the X-SHM extension is supported.
   uint32_t _xShm : 1;
+  //! @brief Whether the X-SHM segment can be attached by file descriptor, in
+  //! such case the double-buffer is @c IMAGE_TYPE_SHARED image.
+  uint32_t _xShmFd : 1;
   //! @brief Whether the private color-map was allocated (8-bpp only).
   uint32_t _xPrivateColorMap : 1;
   //! @brief Force to create XPixmap when creating double-buffer (default true).
@@ -458,6 +486,10 @@ struct FOG_UI_X11_API X11UIEngine : public UIEngine
   Library _XExtLibrary;
   //! @brief Xrender library object (dynamically opened libXrender library).
   Library _XRenderLibrary;
+  //! @brief X11-xcb library object (dynamically opened libX11-xcb library).
+  Library _XcbLibrary;
+  //! @brief Xcb-shm library object (dynamically opened libxcb-shm library).
+  Library _XcbShmLibrary;
 
   // --------------------------------------------------------------------------
   // [Members - API]
@@ -469,6 +501,8 @@ struct FOG_UI_X11_API X11UIEngine : public UIEngine
   X11UIEngineXExtAPI _XExt;
   //! @brief Xrender API.
   X11UIEngineXRenderAPI _XRender;
+  //! @brief X11-xcb and Xcb-shm API.
+  X11UIEngineXcbShmAPI _XcbShm;
 };
 
 //! @}
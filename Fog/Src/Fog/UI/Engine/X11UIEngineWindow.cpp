@@ -20,6 +20,7 @@
 // [Dependencies - C -Shared memory and IPC]
 #include <errno.h>
 #include <fcntl.h>
+#include <stdlib.h>
 #include <sys/ipc.h>
 #include <sys/shm.h>
 #include <sys/utsname.h>
@@ -525,6 +526,59 @@ err_t X11UIEngineWindowImpl::allocDoubleBuffer(const SizeI& size)
   // [Primary-Buffer]
   // --------------------------------------------------------------------------
   
+  // Try to create the double-buffer as IMAGE_TYPE_SHARED image and to pass
+  // its file descriptor to the X-Server (MIT-SHM 1.2). There is no SysV IPC
+  // segment in such case.
+  if (xEngine->_xShmFd && xDepth == 32)
+  {
+    ImageSharedInfo sharedInfo;
+
+    if (_shmImage.create(size, xFormat, IMAGE_TYPE_SHARED) == ERR_OK &&
+        _shmImage.getStride() == (ssize_t)xStride &&
+        _shmImage.exportShared(sharedInfo) == ERR_OK)
+    {
+      void* xcb = xEngine->_XcbShm._XGetXCBConnection(xEngine->_display);
+
+      MemOps::zero_t<XShmSegmentInfo>(&_shmInfo);
+      _shmInfo.shmid = -1;
+      _shmInfo.shmseg = xEngine->_XcbShm._xcb_generate_id(xcb);
+      _shmInfo.shmaddr = reinterpret_cast<char*>(_shmImage.getFirstX());
+      _shmInfo.readOnly = false;
+
+      // The file descriptor is closed by XCB after it's sent.
+      X11XcbVoidCookie cookie = xEngine->_XcbShm._xcb_shm_attach_fd_checked(
+        xcb, (uint32_t)_shmInfo.shmseg, sharedInfo.getFd(), 0);
+      void* xcbError = xEngine->_XcbShm._xcb_request_check(xcb, cookie);
+
+      if (xcbError == NULL)
+      {
+        _ximage = xEngine->_XExt._XShmCreateImage(
+          xEngine->_display, xEngine->_visual, xEngine->_displayInfo._depth, ZPixmap, _shmInfo.shmaddr, &_shmInfo, size.w, size.h);
+
+        if (_ximage != NULL)
+        {
+          _bufferType = UI_ENGINE_BUFFER_X11_XSHMFDIMAGE;
+          _bufferPtr = (uint8_t*)_shmInfo.shmaddr;
+          goto _Converter;
+        }
+
+        Logger::error("Fog::X11UIEngineWindowImpl", "allocDoubleBuffer",
+          "Failed to call XShmCreateImage().");
+
+        xEngine->_XExt._XShmDetach(xEngine->_display, &_shmInfo);
+        xEngine->_XLib._XSync(xEngine->_display, false);
+      }
+      else
+      {
+        // The X-Server doesn't support MIT-SHM 1.2, don't try it again.
+        ::free(xcbError);
+        xEngine->_xShmFd = false;
+      }
+    }
+
+    _shmImage.reset();
+  }
+
   if (xEngine->_xShm)
   {
     FOG_ASSERT(xEngine._XExtLibrary.isOpen());
@@ -606,6 +660,7 @@ _TryXImage:
   // [Primary-Buffer / Secondary-Buffer Converter]
   // --------------------------------------------------------------------------
 
+_Converter:
   if (_secondaryFB._data == NULL)
   {
     _bufferData.data = _bufferPtr;
@@ -687,6 +742,19 @@ err_t X11UIEngineWindowImpl::freeDoubleBuffer()
       break;
     }
 
+    case UI_ENGINE_BUFFER_X11_XSHMFDIMAGE:
+    {
+      _ximage->data = NULL;
+      xEngine->_XLib._XDestroyImage(_ximage);
+
+      xEngine->_XExt._XShmDetach(xEngine->_display, &_shmInfo);
+      xEngine->_XLib._XSync(xEngine->_display, false);
+
+      // Unmaps the memory and closes the file descriptor.
+      _shmImage.reset();
+      break;
+    }
+
     default:
       return ERR_RT_INVALID_STATE;
   }
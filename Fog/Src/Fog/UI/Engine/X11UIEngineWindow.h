@@ -130,6 +130,8 @@ struct FOG_API X11UIEngineWindowImpl : public UIEngineWindowImpl
   uint8_t* _bufferPtr;
   //! @brief Double-Buffer XSHM Segment information.
   XShmSegmentInfo _shmInfo;
+  //! @brief Double-Buffer shared image (XSHM segment attached by fd).
+  Image _shmImage;
   //! @brief Double-Buffer XPixmap.
   Pixmap _pixmap;
   //! @brief Double-Buffer XImage.